@@ -47,11 +47,39 @@ inline const ManifestData& GetFrameworkManifestData() {
       .settings = nlohmann::json::parse(R"json(
             {
               "plugin_states": {},
-              "hook_states": {}
+              "hook_states": {},
+              "telemetry_recording": {
+                "enabled": false,
+                "keyframe_interval": 60
+              },
+              "telemetry_export": {
+                "enabled": false,
+                "name": "SPF_Telemetry"
+              },
+              "telemetry_stream": {
+                "enabled": false,
+                "address": "127.0.0.1",
+                "port": 46100,
+                "keyframe_interval": 60
+              },
+              "route_history": {
+                "always_record": false,
+                "save_on_exit": false
+              },
+              "deferred_events": {
+                "capacity": 4096,
+                "drain_budget_us": 1000
+              },
+              "async_logging": {
+                "enabled": true,
+                "queue_size": 8192,
+                "flush_interval_ms": 200,
+                "overflow": "drop"
+              }
             }
         )json"),
       // .logging
-      .logging = {.level = "trace",  // logging level, for sink file, UI has its own filter ("trace", "debug", "info", "warn", "error", "critical")
+      .logging = {.level = "trace",  // logging level, for sink file and the lowest level the UI collects ("trace", "debug", "info", "warn", "error", "critical")
                   .sinks =
                       {
                           .file = true,  // create a log file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Windows.h>
+#include <chrono>
 #include <memory>
 #include <vector>
 #include <set>
@@ -8,6 +9,7 @@
 #include "SPF/Namespace.hpp"
 #include "SPF/Core/InitializationReport.hpp"
 #include "SPF/Config/IConfigurable.hpp"
+#include "SPF/Telemetry/ChannelGroups.hpp"
 
 struct scs_telemetry_init_params_t;
 struct scs_input_init_params_t;
@@ -83,6 +85,13 @@ class ApiService;
 namespace Telemetry {
 class GameContext;
 class SCSTelemetryService;
+namespace Recording {
+class TelemetryRecorder;
+}  // namespace Recording
+namespace Export {
+class SharedMemoryExporter;
+class TelemetryStreamServer;
+}  // namespace Export
 }  // namespace Telemetry
 
 namespace Core {
@@ -125,8 +134,10 @@ class Core {
 
   /**
    * @brief Main shutdown function.
+   * @param processTerminating True when called from DllMain because the process is exiting;
+   *        the other threads are already gone then and must not be waited for.
    */
-  void FullShutdown();
+  void FullShutdown(bool processTerminating = false);
 
   /**
    * @brief Resets all SDK-dependent components to allow for a safe re-initialization.
@@ -218,6 +229,7 @@ class Core {
   bool m_telemetryReady = false;
   bool m_inputReady = false;
   bool m_handlersBound = false;
+  std::chrono::microseconds m_deferredEventBudget{1000};  // Per-frame time for dispatching deferred events
 
   // --- Logging Components ---
   std::shared_ptr<Logging::Logger> m_logger;
@@ -235,6 +247,13 @@ class Core {
 
   std::unique_ptr<Telemetry::GameContext> m_gameContext;
   std::unique_ptr<Telemetry::SCSTelemetryService> m_telemetryService;
+  std::unique_ptr<Telemetry::Recording::TelemetryRecorder> m_telemetryRecorder;
+  std::unique_ptr<Telemetry::Export::SharedMemoryExporter> m_telemetryExporter;
+  std::unique_ptr<Telemetry::Export::TelemetryStreamServer> m_telemetryStream;
+  Telemetry::ChannelLease m_fullTelemetryChannels;  // Held while recording or exporting, which need every channel.
+  Telemetry::ChannelLease m_routeChannels;          // Held when the route is always recorded.
+  Telemetry::ChannelLease m_streamChannels;         // The channels of the fields stream clients selected.
+  uint64_t m_streamSelectionRevision = 0;
   std::unique_ptr<Modules::IInputService> m_inputService;
 
   // --- Event Sinks ---
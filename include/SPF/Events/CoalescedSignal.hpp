@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/Utils/Signal.hpp"
+
+SPF_NS_BEGIN
+namespace Events {
+/**
+ * @class CoalescedSignal
+ * @brief Calls a signal once per distinct event for the events posted during a batch.
+ *
+ * Outside a batch, Post() calls the signal right away. Between BeginBatch() and the matching
+ * EndBatch(), events are grouped by a key instead (without a key function all of them share
+ * one key). Within a group the last posted event wins, unless a merge function is given,
+ * which then folds each new event into the pending one (e.g. a set union). The outermost
+ * EndBatch() calls the signal for each group in the order the groups were first posted, so
+ * listeners do their work once per burst instead of once per change.
+ *
+ * Not thread-safe: post from the main thread (see DeferredEventQueue for posting from other
+ * threads). Events that listeners post while the signal is being called are delivered after
+ * the current calls, by the same Flush().
+ */
+template <typename Event>
+class CoalescedSignal {
+ public:
+  using KeyFunction_t = std::string (*)(const Event&);
+  using MergeFunction_t = void (*)(Event& pending, const Event& incoming);
+
+  explicit CoalescedSignal(Utils::Signal<void(const Event&)>& signal, KeyFunction_t key = nullptr, MergeFunction_t merge = nullptr) noexcept
+      : m_signal(signal), m_key(key), m_merge(merge) {}
+
+  CoalescedSignal(const CoalescedSignal&) = delete;
+  CoalescedSignal& operator=(const CoalescedSignal&) = delete;
+
+  void Post(const Event& event) {
+    ++m_posted;
+    auto [it, inserted] = m_index.try_emplace(m_key ? m_key(event) : std::string(), m_pending.size());
+    if (inserted) {
+      m_pending.push_back(event);
+    } else if (m_merge) {
+      m_merge(m_pending[it->second], event);
+    } else {
+      m_pending[it->second] = event;
+    }
+
+    if (m_batchDepth == 0) Flush();
+  }
+
+  /**
+   * @brief Holds back posted events until the matching EndBatch(). Batches nest.
+   */
+  void BeginBatch() { ++m_batchDepth; }
+
+  /**
+   * @brief Ends a batch; the outermost one delivers the pending events.
+   */
+  void EndBatch() {
+    if (m_batchDepth > 0 && --m_batchDepth == 0) Flush();
+  }
+
+  /**
+   * @brief Calls the signal once for each pending group.
+   * @return The number of calls; 0 if called from a listener of this signal.
+   */
+  size_t Flush() {
+    if (m_inFlush) return 0;  // The running Flush() picks up what the listener posted.
+
+    m_inFlush = true;
+    size_t calls = 0;
+    while (!m_pending.empty()) {
+      // Swap the batch out first, so listeners that post start the next one.
+      m_flushing.swap(m_pending);
+      m_index.clear();
+      for (const Event& event : m_flushing) {
+        m_signal.Call(event);
+      }
+      calls += m_flushing.size();
+      m_flushing.clear();
+    }
+    m_inFlush = false;
+
+    m_delivered += calls;
+    return calls;
+  }
+
+  void Clear() {
+    m_pending.clear();
+    m_index.clear();
+  }
+
+  bool HasPending() const { return !m_pending.empty(); }
+  uint64_t GetPostedCount() const { return m_posted; }
+  uint64_t GetDeliveredCount() const { return m_delivered; }
+
+ private:
+  Utils::Signal<void(const Event&)>& m_signal;
+  KeyFunction_t m_key;
+  MergeFunction_t m_merge;
+
+  std::vector<Event> m_pending;                    // One event per group, in first-posted order
+  std::unordered_map<std::string, size_t> m_index;  // Group key -> index in m_pending
+  std::vector<Event> m_flushing;
+  uint32_t m_batchDepth = 0;
+  bool m_inFlush = false;
+  uint64_t m_posted = 0;
+  uint64_t m_delivered = 0;
+};
+}  // namespace Events
+SPF_NS_END
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/Utils/Signal.hpp"
+
+SPF_NS_BEGIN
+namespace Events {
+struct DeferredEventStats {
+  uint64_t posted = 0;
+  uint64_t dispatched = 0;
+  uint64_t dropped = 0;           // Posts rejected because the queue was full
+  uint32_t pending = 0;           // Posted but not dispatched yet
+  uint32_t maxPending = 0;
+  uint64_t budgetExhausted = 0;   // Drains that left events for the next one
+  uint64_t lastDrainUs = 0;
+  uint64_t maxDrainUs = 0;
+};
+
+/**
+ * @class DeferredEventQueue
+ * @brief Carries events from any thread to the thread that drains the queue.
+ *
+ * Post() may be called from any thread without taking a lock: the event is moved into a node
+ * that is pushed onto an intrusive lock-free stack. Drain() runs on the owning thread (the
+ * framework drains once per frame in Core::Update), takes the whole stack at once and calls
+ * each event's signal in the order the events were posted. Listeners therefore always run on
+ * the draining thread, and need no locking against the poster.
+ *
+ * The number of pending events is bounded; posts beyond the capacity are dropped and counted.
+ * Events posted while draining (including by listeners) are dispatched by the next Drain().
+ * The signals passed to Post() must outlive the dispatch of their events.
+ */
+class DeferredEventQueue {
+ public:
+  static constexpr uint32_t DefaultCapacity = 4096;
+
+  DeferredEventQueue() = default;
+  ~DeferredEventQueue();
+
+  DeferredEventQueue(const DeferredEventQueue&) = delete;
+  DeferredEventQueue& operator=(const DeferredEventQueue&) = delete;
+
+  /**
+   * @brief Queues `event` for `signal`. Safe to call from any thread.
+   * @return False if the queue is full and the event was dropped.
+   */
+  template <typename Event>
+  bool Post(Utils::Signal<void(const Event&)>& signal, std::type_identity_t<Event> event) {
+    if (!Reserve()) return false;
+    Push(new EventNode<Event>(signal, std::move(event)));
+    return true;
+  }
+
+  /**
+   * @brief Dispatches pending events on the calling thread.
+   * @param budget Time after which the remaining events are left for the next call
+   *        (zero dispatches everything). At least one event is dispatched per call.
+   * @return The number of events dispatched.
+   */
+  size_t Drain(std::chrono::microseconds budget = std::chrono::microseconds::zero());
+
+  /**
+   * @brief Destroys the pending events without dispatching them. Call from the draining thread.
+   */
+  void Clear();
+
+  void SetCapacity(uint32_t capacity) { m_capacity.store(capacity > 0 ? capacity : 1, std::memory_order_relaxed); }
+  DeferredEventStats GetStats() const;
+
+ private:
+  struct Node {
+    Node* next = nullptr;
+    void (*dispatch)(Node*) = nullptr;
+    void (*destroy)(Node*) = nullptr;
+  };
+
+  template <typename Event>
+  struct EventNode : Node {
+    Utils::Signal<void(const Event&)>* signal;
+    Event event;
+
+    EventNode(Utils::Signal<void(const Event&)>& target, Event&& value) : signal(&target), event(std::move(value)) {
+      dispatch = [](Node* node) {
+        auto* self = static_cast<EventNode*>(node);
+        self->signal->Call(self->event);
+      };
+      destroy = [](Node* node) { delete static_cast<EventNode*>(node); };
+    }
+  };
+
+  bool Reserve();
+  void Push(Node* node);
+  void TakePosted();  // Moves the posted stack, in posting order, to the ready list
+  void Release(Node* node);
+
+  // Shared with posting threads.
+  std::atomic<Node*> m_posted = nullptr;  // Newest first
+  std::atomic<uint32_t> m_capacity = DefaultCapacity;
+  std::atomic<uint32_t> m_pending = 0;
+  std::atomic<uint32_t> m_maxPending = 0;
+  std::atomic<uint64_t> m_postedCount = 0;
+  std::atomic<uint64_t> m_dropped = 0;
+
+  // Draining thread only, apart from the statistics being read.
+  Node* m_readyHead = nullptr;  // Oldest first
+  Node* m_readyTail = nullptr;
+  std::atomic<uint64_t> m_dispatched = 0;
+  std::atomic<uint64_t> m_budgetExhausted = 0;
+  std::atomic<uint64_t> m_lastDrainUs = 0;
+  std::atomic<uint64_t> m_maxDrainUs = 0;
+};
+}  // namespace Events
+SPF_NS_END
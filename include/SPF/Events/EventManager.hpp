@@ -6,7 +6,9 @@
 #include "SPF/Events/TelemetryEvents.hpp"
 #include "SPF/Events/PluginEvents.hpp"
 #include "SPF/Events/UIEvents.hpp"
+#include "SPF/Events/CoalescedSignal.hpp"
 #include "SPF/Events/ConfigEvents.hpp"
+#include "SPF/Events/DeferredEventQueue.hpp"
 #include "SPF/Input/InputEvents.hpp"
 #include "SPF/Events/EventProxyBase.hpp"
 #include "SPF/Events/SystemEvents.hpp"
@@ -105,6 +107,33 @@ class EventManager {
  public:
   SystemEvents System;
 
+  // Events posted from other threads, dispatched on the main thread by Core::Update.
+  // Declared after System, so pending events are destroyed before their signals.
+  DeferredEventQueue Deferred;
+
+  // Bursty events. Delivered right away, except inside a Batch, which delivers them once per
+  // distinct change when it ends.
+  struct CoalescedEvents {
+    CoalescedSignal<UI::OnSettingWasChanged> OnSettingWasChanged;  // Last value per setting
+    CoalescedSignal<Config::OnKeybindsModified> OnKeybindsModified;  // Once per batch
+
+    /// Scope of a batch operation (resetting keys, a plugin's OnLoad). Batches nest.
+    class Batch {
+     public:
+      explicit Batch(CoalescedEvents& events);
+      ~Batch();
+      Batch(const Batch&) = delete;
+      Batch& operator=(const Batch&) = delete;
+
+     private:
+      CoalescedEvents& m_events;
+    };
+
+    explicit CoalescedEvents(SystemEvents& system);
+  };
+
+  CoalescedEvents Coalesced{System};
+
  private:
   struct InternalEvents {
     // TODO: Add internal events if needed
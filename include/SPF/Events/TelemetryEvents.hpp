@@ -10,6 +10,9 @@
 #include "SPF/Telemetry/SCS/Controls.hpp" // For Controls
 #include "SPF/Telemetry/SCS/Events.hpp"   // For SpecialEvents, GameplayEvents
 #include "SPF/Telemetry/SCS/Gearbox.hpp"  // For GearboxConstants
+#include "SPF/Telemetry/DerivedChannels.hpp"   // For DerivedData
+#include "SPF/Telemetry/TelemetryFields.hpp"   // For FieldMask
+#include "SPF/Telemetry/TelemetrySnapshot.hpp" // For TelemetrySnapshot
 #include <vector> // For std::vector
 #include <cstdint>
 
@@ -109,6 +112,19 @@ struct TelemetryEventSignals {
      * @param data The new gearbox configuration constants.
      */
     Utils::Signal<void(const SPF::Telemetry::SCS::GearboxConstants& data)> OnGearboxConstantsChanged;
+
+    /**
+     * @brief Fired every frame after OnTruckDataUpdated with the values derived from the truck channels.
+     * @param data The updated derived data.
+     */
+    Utils::Signal<void(const SPF::Telemetry::DerivedData& data)> OnDerivedDataUpdated;
+
+    /**
+     * @brief Fired at frame start, after the per-struct signals, when at least one tracked field changed.
+     * @param snapshot The snapshot published for this frame.
+     * @param changed One bit per SPF::Telemetry::Field that changed since the previous frame start.
+     */
+    Utils::Signal<void(const SPF::Telemetry::TelemetrySnapshot& snapshot, const SPF::Telemetry::FieldMask& changed)> OnFieldsChanged;
 };
 
 } // namespace Events::Telemetry
@@ -2,6 +2,7 @@
 
 #include "SPF/Handles/IHandle.hpp"
 #include "SPF/Modules/API/TelemetryApi.hpp" // Include for BaseSubscriptionHandler
+#include "SPF/Telemetry/FieldHistory.hpp"
 #include <string>
 #include <vector>
 #include <memory> // For std::unique_ptr
@@ -17,6 +18,19 @@ class TelemetryHandle : public IHandle {
   // This vector will hold all active telemetry subscriptions for this plugin.
   // Using unique_ptr to BaseSubscriptionHandler allows polymorphism and RAII.
   std::vector<std::unique_ptr<Modules::API::TelemetryApi::BaseSubscriptionHandler>> m_subscriptionHandlers;
+
+  // Channel groups read through the polling getters. Kept until the plugin releases its
+  // handle, since a plugin that polls a struct once usually keeps polling it.
+  Telemetry::ChannelLease m_polledChannels;
+
+  // Set by DemandChannelGroups; GetView then stops demanding every group.
+  bool m_declaredViewChannels = false;
+
+  // Fields recorded in the shared history through RecordFieldHistory.
+  std::vector<Telemetry::FieldHistoryLease> m_historyLeases;
+
+  // Sequence of the last gameplay event returned by ReadGameplayEvents.
+  uint64_t m_gameplayEventCursor = 0;
 };
 }  // namespace Handles
 SPF_NS_END
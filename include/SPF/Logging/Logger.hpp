@@ -97,6 +97,19 @@ class ILogSink {
    */
   virtual void Log(const LogMessage& msg) = 0;
 
+  /**
+   * @brief Writes out anything the sink buffers. Called on shutdown, on a crash and by the
+   *        asynchronous backend after each batch.
+   */
+  virtual void Flush() {}
+
+  /**
+   * @brief Flush() for the crash handler: gives up instead of waiting when the sink is busy,
+   *        which may be the crashed write itself.
+   * @return False if the sink was skipped.
+   */
+  virtual bool TryFlush() { return true; }
+
   /**
    * @brief Sets the formatting pattern for this sink.
    * @param pattern A string with placeholders ({timestamp}, {level}, {message}, etc.).
@@ -113,6 +126,14 @@ class ILogSink {
    */
   virtual bool ShouldFilterByLevel() const { return true; }
 
+  /**
+   * @brief For sinks that are not filtered by the logger's level: the lowest level the sink
+   *        takes from loggers whose own level is higher. Messages the logger's level lets
+   *        through always reach the sink.
+   * @return Trace by default, i.e. the sink receives every message.
+   */
+  virtual LogLevel GetMinLevel() const { return LogLevel::Trace; }
+
  protected:
   std::string m_name;
   std::string m_formatter_pattern = "[{timestamp:%Y-%m-%d %H:%M:%S.%e}] [{level}] [{logger_name}] {message}";
@@ -145,6 +166,19 @@ class Logger {
    */
   LogLevel GetLevel() const;
 
+  /**
+   * @brief Checks whether a message of the given level would reach any sink.
+   * This is a single atomic load; the logging methods call it before formatting, and callers
+   * can use it to skip building expensive arguments.
+   */
+  bool ShouldLog(LogLevel level) const { return level >= m_minSinkLevel.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Re-reads the sinks' own levels (ILogSink::GetMinLevel), which the logger caches.
+   * Call after changing the level of a sink that is not filtered by the logger level.
+   */
+  void RefreshSinkLevels();
+
   /**
    * @brief Returns the number of sinks attached to this logger.
    */
@@ -183,11 +217,12 @@ class Logger {
    * @brief Template method for logging a message with a specific level.
    * @tparam ...Args Argument types for formatting.
    * @param level The logging level.
-   * @param format_str The {fmt} style format string.
+   * @param format_str The {fmt} style format string, checked against the arguments at compile
+   *        time. Wrap strings only known at runtime in fmt::runtime().
    * @param ...args The arguments for formatting.
    */
   template <typename... Args>
-  void Log(LogLevel level, fmt::string_view format_str, Args&&... args);
+  void Log(LogLevel level, fmt::format_string<Args...> format_str, Args&&... args);
 
   /**
    * @brief Logs a message with pre-packed variadic arguments.
@@ -201,31 +236,31 @@ class Logger {
 
   // Convenience methods for each log level.
   template <typename... Args>
-  void Trace(fmt::string_view format_str, Args&&... args);
+  void Trace(fmt::format_string<Args...> format_str, Args&&... args);
   template <typename... Args>
-  void Debug(fmt::string_view format_str, Args&&... args);
+  void Debug(fmt::format_string<Args...> format_str, Args&&... args);
   template <typename... Args>
-  void Info(fmt::string_view format_str, Args&&... args);
+  void Info(fmt::format_string<Args...> format_str, Args&&... args);
   template <typename... Args>
-  void Warn(fmt::string_view format_str, Args&&... args);
+  void Warn(fmt::format_string<Args...> format_str, Args&&... args);
   template <typename... Args>
-  void Error(fmt::string_view format_str, Args&&... args);
+  void Error(fmt::format_string<Args...> format_str, Args&&... args);
   template <typename... Args>
-  void Critical(fmt::string_view format_str, Args&&... args);
+  void Critical(fmt::format_string<Args...> format_str, Args&&... args);
 
   // Throttling wrappers
   template <typename... Args>
-  void TraceThrottled(std::chrono::nanoseconds duration, fmt::string_view format_str, Args&&... args);
+  void TraceThrottled(std::chrono::nanoseconds duration, fmt::format_string<Args...> format_str, Args&&... args);
   template <typename... Args>
-  void DebugThrottled(std::chrono::nanoseconds duration, fmt::string_view format_str, Args&&... args);
+  void DebugThrottled(std::chrono::nanoseconds duration, fmt::format_string<Args...> format_str, Args&&... args);
   template <typename... Args>
-  void InfoThrottled(std::chrono::nanoseconds duration, fmt::string_view format_str, Args&&... args);
+  void InfoThrottled(std::chrono::nanoseconds duration, fmt::format_string<Args...> format_str, Args&&... args);
   template <typename... Args>
-  void WarnThrottled(std::chrono::nanoseconds duration, fmt::string_view format_str, Args&&... args);
+  void WarnThrottled(std::chrono::nanoseconds duration, fmt::format_string<Args...> format_str, Args&&... args);
   template <typename... Args>
-  void ErrorThrottled(std::chrono::nanoseconds duration, fmt::string_view format_str, Args&&... args);
+  void ErrorThrottled(std::chrono::nanoseconds duration, fmt::format_string<Args...> format_str, Args&&... args);
   template <typename... Args>
-  void CriticalThrottled(std::chrono::nanoseconds duration, fmt::string_view format_str, Args&&... args);
+  void CriticalThrottled(std::chrono::nanoseconds duration, fmt::format_string<Args...> format_str, Args&&... args);
 
   void LogThrottledManual(LogLevel level, const char* throttle_key, std::chrono::milliseconds duration, fmt::string_view message);
 
@@ -235,12 +270,24 @@ class Logger {
    * @param location Information about the call site (filled in by the compiler).
    */
   template <typename... Args>
-  void LogThrottledImpl(LogLevel level, std::chrono::nanoseconds throttle_duration, const std::source_location& location, fmt::string_view format_str, Args&&... args);
+  void LogThrottledImpl(LogLevel level, std::chrono::nanoseconds throttle_duration, const std::source_location& location, fmt::format_string<Args...> format_str, Args&&... args);
+
+  /**
+   * @brief Formats the message and passes it to the sinks that accept its level.
+   */
+  void Dispatch(LogLevel level, fmt::string_view format_str, fmt::format_args args);
+
+  /**
+   * @brief Recomputes m_minSinkLevel from the sinks and the logger level. Call with m_mutex held.
+   */
+  void UpdateMinSinkLevel_unlocked();
 
   std::string m_name;
   std::vector<std::shared_ptr<ILogSink>> m_sinks;
   mutable std::mutex m_mutex;
   std::atomic<LogLevel> m_level = LogLevel::Info;  // Default level
+  // The lowest level any sink accepts, Unknown (above everything) if there are no sinks.
+  std::atomic<LogLevel> m_minSinkLevel = LogLevel::Unknown;
 
   // For throttling
   std::unordered_map<size_t, std::chrono::steady_clock::time_point> m_throttle_map;
@@ -249,29 +296,18 @@ class Logger {
 
 // The implementation of template methods must be in the header file.
 template <typename... Args>
-void Logger::Log(LogLevel level, fmt::string_view format_str, Args&&... args) {
-  // The log level is now checked per-sink, not globally at the start.
-
-  // Formatting the message in the buffer
-  fmt::memory_buffer buffer;
-  fmt::vformat_to(std::back_inserter(buffer), format_str, fmt::make_format_args(args...));
-
-  // Creating a message object
-  LogMessage msg{
-      .timestamp = std::chrono::system_clock::now(), .level = level, .thread_id = std::this_thread::get_id(), .logger_name = m_name, .formatted_message = std::move(buffer)};
-
-  // We lock the mutex and send a message to all "sinks"
-  std::lock_guard<std::mutex> lock(m_mutex);
-  for (const auto& sink : m_sinks) {
-    if (sink->ShouldFilterByLevel() && msg.level < m_level.load(std::memory_order_relaxed)) {
-      continue;  // Skip this sink if it filters and the level is too low
-    }
-    sink->Log(msg);
-  }
+void Logger::Log(LogLevel level, fmt::format_string<Args...> format_str, Args&&... args) {
+  // No sink wants this level: skip formatting altogether.
+  if (!ShouldLog(level)) return;
+
+  Dispatch(level, format_str, fmt::make_format_args(args...));
 }
 
 template <typename... Args>
-void Logger::LogThrottledImpl(LogLevel level, std::chrono::nanoseconds throttle_duration, const std::source_location& location, fmt::string_view format_str, Args&&... args) {
+void Logger::LogThrottledImpl(LogLevel level, std::chrono::nanoseconds throttle_duration, const std::source_location& location, fmt::format_string<Args...> format_str, Args&&... args) {
+  // Checked before the throttle, so a disabled level neither takes the lock nor uses up the window.
+  if (!ShouldLog(level)) return;
+
   // Generate a unique key for the call location
   size_t location_hash = std::hash<std::string>{}(location.file_name()) ^ (std::hash<int>{}(location.line()) << 1);
 
@@ -294,53 +330,53 @@ void Logger::LogThrottledImpl(LogLevel level, std::chrono::nanoseconds throttle_
 }
 
 template <typename... Args>
-void Logger::Trace(fmt::string_view format_str, Args&&... args) {
+void Logger::Trace(fmt::format_string<Args...> format_str, Args&&... args) {
   Log(LogLevel::Trace, format_str, std::forward<Args>(args)...);
 }
 template <typename... Args>
-void Logger::Debug(fmt::string_view format_str, Args&&... args) {
+void Logger::Debug(fmt::format_string<Args...> format_str, Args&&... args) {
   Log(LogLevel::Debug, format_str, std::forward<Args>(args)...);
 }
 template <typename... Args>
-void Logger::Info(fmt::string_view format_str, Args&&... args) {
+void Logger::Info(fmt::format_string<Args...> format_str, Args&&... args) {
   Log(LogLevel::Info, format_str, std::forward<Args>(args)...);
 }
 template <typename... Args>
-void Logger::Warn(fmt::string_view format_str, Args&&... args) {
+void Logger::Warn(fmt::format_string<Args...> format_str, Args&&... args) {
   Log(LogLevel::Warn, format_str, std::forward<Args>(args)...);
 }
 template <typename... Args>
-void Logger::Error(fmt::string_view format_str, Args&&... args) {
+void Logger::Error(fmt::format_string<Args...> format_str, Args&&... args) {
   Log(LogLevel::Error, format_str, std::forward<Args>(args)...);
 }
 template <typename... Args>
-void Logger::Critical(fmt::string_view format_str, Args&&... args) {
+void Logger::Critical(fmt::format_string<Args...> format_str, Args&&... args) {
   Log(LogLevel::Critical, format_str, std::forward<Args>(args)...);
 }
 
 // Implementing wrappers for throttling
 template <typename... Args>
-void Logger::TraceThrottled(std::chrono::nanoseconds duration, fmt::string_view format_str, Args&&... args) {
+void Logger::TraceThrottled(std::chrono::nanoseconds duration, fmt::format_string<Args...> format_str, Args&&... args) {
   LogThrottledImpl(LogLevel::Trace, duration, std::source_location::current(), format_str, std::forward<Args>(args)...);
 }
 template <typename... Args>
-void Logger::DebugThrottled(std::chrono::nanoseconds duration, fmt::string_view format_str, Args&&... args) {
+void Logger::DebugThrottled(std::chrono::nanoseconds duration, fmt::format_string<Args...> format_str, Args&&... args) {
   LogThrottledImpl(LogLevel::Debug, duration, std::source_location::current(), format_str, std::forward<Args>(args)...);
 }
 template <typename... Args>
-void Logger::InfoThrottled(std::chrono::nanoseconds duration, fmt::string_view format_str, Args&&... args) {
+void Logger::InfoThrottled(std::chrono::nanoseconds duration, fmt::format_string<Args...> format_str, Args&&... args) {
   LogThrottledImpl(LogLevel::Info, duration, std::source_location::current(), format_str, std::forward<Args>(args)...);
 }
 template <typename... Args>
-void Logger::WarnThrottled(std::chrono::nanoseconds duration, fmt::string_view format_str, Args&&... args) {
+void Logger::WarnThrottled(std::chrono::nanoseconds duration, fmt::format_string<Args...> format_str, Args&&... args) {
   LogThrottledImpl(LogLevel::Warn, duration, std::source_location::current(), format_str, std::forward<Args>(args)...);
 }
 template <typename... Args>
-void Logger::ErrorThrottled(std::chrono::nanoseconds duration, fmt::string_view format_str, Args&&... args) {
+void Logger::ErrorThrottled(std::chrono::nanoseconds duration, fmt::format_string<Args...> format_str, Args&&... args) {
   LogThrottledImpl(LogLevel::Error, duration, std::source_location::current(), format_str, std::forward<Args>(args)...);
 }
 template <typename... Args>
-void Logger::CriticalThrottled(std::chrono::nanoseconds duration, fmt::string_view format_str, Args&&... args) {
+void Logger::CriticalThrottled(std::chrono::nanoseconds duration, fmt::format_string<Args...> format_str, Args&&... args) {
   LogThrottledImpl(LogLevel::Critical, duration, std::source_location::current(), format_str, std::forward<Args>(args)...);
 }
 
@@ -3,10 +3,12 @@
 #include "SPF/Config/IConfigurable.hpp"
 #include "SPF/Core/InitializationReport.hpp"
 #include <SPF/Logging/Logger.hpp>
+#include <SPF/Logging/Sinks/AsyncSink.hpp>
 #include <string>
 #include <memory>
 #include <map>
 #include <mutex>
+#include <optional>
 #include <vector>
 #include <filesystem>
 #include <nlohmann/json.hpp>
@@ -24,8 +26,48 @@ class LoggerFactory : public Config::IConfigurable {
  public:
   static LoggerFactory& GetInstance();
 
-  Core::InitializationReport Initialize(const std::filesystem::path& log_dir, const nlohmann::json& framework_config);
-  void Shutdown();
+  /**
+   * @param async_options When set, file sinks can write on a background thread (see AsyncSink)
+   *        once StartAsyncWriters() has been called.
+   */
+  Core::InitializationReport Initialize(const std::filesystem::path& log_dir, const nlohmann::json& framework_config,
+                                        const std::optional<Sinks::AsyncSinkOptions>& async_options = std::nullopt);
+
+  /**
+   * @param processTerminating True when called from DllMain at process exit, where the writer
+   *        threads have already been terminated and must not be waited for.
+   */
+  void Shutdown(bool processTerminating = false);
+
+  /**
+   * @brief Starts the writer threads of the asynchronous file sinks, including ones created later.
+   *        Must not be called from DllMain.
+   */
+  void StartAsyncWriters();
+
+  /**
+   * @brief Writes out the queues and joins the writer threads; file sinks write synchronously
+   *        afterwards. Must not be called from DllMain, so the framework calls it from the SDK
+   *        shutdown callbacks, before the DLL is unloaded.
+   */
+  void StopAsyncWriters();
+
+  /**
+   * @brief Synchronously writes out everything the sinks have buffered or queued.
+   *        Also runs on an unhandled exception, before the previous handler.
+   */
+  void Flush();
+
+  /**
+   * @brief Flush() for when the caller may already hold the factory lock, such as a crash
+   *        inside the factory. Does nothing in that case.
+   */
+  bool TryFlush();
+
+  /**
+   * @brief Messages dropped by the asynchronous backend because its queue was full.
+   */
+  uint64_t GetDroppedMessageCount() const;
 
   std::shared_ptr<Logger> GetLogger(const std::string& name);
   std::shared_ptr<Sinks::LoggerWindowSink> GetUISink() const;
@@ -46,7 +88,13 @@ class LoggerFactory : public Config::IConfigurable {
   void CreateGlobalSinks(const nlohmann::json& framework_sinks_config, Core::InitializationReport& report);
   void AddGlobalSink(const std::shared_ptr<ILogSink>& sink);
   void RemoveGlobalSink(const std::shared_ptr<ILogSink>& sink);
+  // The UI sink collects from the framework's log level down, whatever the loggers' own levels.
+  void SetUISinkLevel_unlocked(LogLevel level);
   void ManagePrivateFileSink(const std::string& componentName, bool wantsFileSink);
+  std::shared_ptr<ILogSink> MakeFileSink(const std::filesystem::path& path, const std::string& name);
+  void FlushSinks_unlocked(bool crashing);
+  void InstallCrashFlush();
+  void RemoveCrashFlush();
 
   LogLevel m_frameworkLogLevel = LogLevel::Info;
   bool m_isInitialized;
@@ -62,6 +110,15 @@ class LoggerFactory : public Config::IConfigurable {
   std::vector<std::shared_ptr<ILogSink>> m_globalSinks;
   std::shared_ptr<Sinks::LoggerWindowSink> m_uiSink;
   std::shared_ptr<ILogSink> m_frameworkFileSink;
+
+  // File sinks, including private ones, so they can be flushed without going through the loggers.
+  std::vector<std::shared_ptr<ILogSink>> m_fileSinks;
+
+  // The asynchronous ones among them, so they can be started and stopped.
+  std::optional<Sinks::AsyncSinkOptions> m_asyncOptions;
+  std::vector<std::shared_ptr<Sinks::AsyncSink>> m_asyncSinks;
+  bool m_asyncWritersRunning = false;
+  uint64_t m_retiredDroppedCount = 0;  // Dropped by async sinks that were removed since
 };
 
 }  // namespace Logging
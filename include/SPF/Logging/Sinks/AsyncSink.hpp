@@ -0,0 +1,130 @@
+#pragma once
+
+#include <SPF/Logging/Logger.hpp>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "SPF/Namespace.hpp"
+
+SPF_NS_BEGIN
+
+namespace Logging::Sinks {
+
+/**
+ * @brief Settings of the asynchronous logging backend.
+ */
+struct AsyncSinkOptions {
+  enum class Overflow {
+    Drop,  // Discard the message and count it
+    Block  // Wait for the writer thread to make room
+  };
+
+  size_t capacity = 8192;                          // Queued messages, rounded up to a power of two
+  std::chrono::milliseconds flushInterval{200};  // Longest time a message waits for the writer
+  Overflow overflow = Overflow::Drop;
+};
+
+/**
+ * @brief A sink that hands messages to a writer thread, which passes them to another sink.
+ *
+ * While the writer runs, Log() copies the already formatted message into a bounded lock-free
+ * ring (a sequence-numbered ring that any number of threads may push into) and returns; the
+ * writer takes the messages in batches, passes them to the target sink and flushes it once per
+ * batch. Errors and a filling queue wake the writer early. When the ring is full the message is
+ * dropped or the caller waits, depending on the overflow policy; dropped messages are counted
+ * and reported in the log once there is room again.
+ *
+ * The writer only runs between Start() and Stop(); otherwise messages go to the target
+ * directly. Both must be called outside DllMain: the thread is joined, and thread start and
+ * exit need the loader lock. When the process is terminating, Abandon() is used instead.
+ */
+class AsyncSink : public Logging::ILogSink {
+ public:
+  AsyncSink(std::shared_ptr<ILogSink> target, const AsyncSinkOptions& options);
+  ~AsyncSink() override;
+
+  AsyncSink(const AsyncSink&) = delete;
+  AsyncSink& operator=(const AsyncSink&) = delete;
+
+  fmt::string_view GetName() const override { return m_target->GetName(); }
+  void Log(const Logging::LogMessage& msg) override;
+  void Flush() override;
+  bool TryFlush() override;
+  void SetFormatter(std::string pattern) override { m_target->SetFormatter(std::move(pattern)); }
+  bool ShouldFilterByLevel() const override { return m_target->ShouldFilterByLevel(); }
+  LogLevel GetMinLevel() const override { return m_target->GetMinLevel(); }
+
+  /**
+   * @brief Starts the writer thread. Does nothing if it is running.
+   */
+  void Start();
+
+  /**
+   * @brief Writes out the queued messages and joins the writer thread; later messages are
+   *        passed to the target directly.
+   */
+  void Stop();
+
+  /**
+   * @brief Stop() for DllMain at process exit, where Windows has already terminated the writer
+   *        thread: releases the thread object without waiting and writes out the queue if the
+   *        writer lock is free.
+   */
+  void Abandon();
+
+  const std::shared_ptr<ILogSink>& GetTarget() const { return m_target; }
+  uint64_t GetDroppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence = 0;
+    std::chrono::system_clock::time_point timestamp;
+    LogLevel level = LogLevel::Info;
+    std::thread::id threadId;
+    std::array<char, 64> loggerName = {};
+    uint8_t loggerNameSize = 0;
+    fmt::memory_buffer message;
+  };
+
+  bool TryPush(const Logging::LogMessage& msg);
+  void WriteDirect(const Logging::LogMessage& msg);
+  void Run();
+  // Passes the queued messages to the target. Call with m_writeMutex held.
+  // Returns true if anything was written.
+  bool Drain_unlocked();
+  bool ReportDropped_unlocked();
+
+  std::shared_ptr<ILogSink> m_target;
+  AsyncSinkOptions m_options;
+  std::unique_ptr<Cell[]> m_cells;
+  size_t m_mask = 0;
+
+  // Producers.
+  std::atomic<size_t> m_enqueuePos = 0;
+  std::atomic<uint64_t> m_dropped = 0;
+  std::atomic<bool> m_async = false;
+
+  // Whoever holds m_writeMutex consumes the ring and writes to the target.
+  std::mutex m_writeMutex;
+  std::atomic<std::thread::id> m_writeOwner;  // Lets the crash flush skip a write it interrupted
+  std::atomic<size_t> m_dequeuePos = 0;       // Read by producers only to estimate the queue length
+  uint64_t m_reportedDropped = 0;
+  Logging::LogMessage m_scratch;
+  std::array<char, 64> m_scratchName = {};  // m_scratch.logger_name points here, not into the ring
+
+  // Writer thread control.
+  std::mutex m_stateMutex;
+  std::condition_variable m_wake;
+  bool m_stopping = false;
+  std::thread m_thread;
+};
+
+}  // namespace Logging::Sinks
+
+SPF_NS_END
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <SPF/Logging/Logger.hpp>
+#include <atomic>
 #include <fstream>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <filesystem>
 
 #include "SPF/Namespace.hpp"
@@ -41,8 +44,18 @@ class FileSink : public Logging::ILogSink {
    */
   void Log(const Logging::LogMessage& msg) override;
 
+  /**
+   * @brief Flushes the file. Lines are only flushed on their own from level Error up.
+   */
+  void Flush() override;
+  bool TryFlush() override;
+
  private:
   std::ofstream m_file;
+  fmt::memory_buffer m_line;  // Reused for every line
+  std::mutex m_mutex;         // The sink is shared by loggers that log concurrently
+  std::atomic<std::thread::id> m_writeOwner;  // Lets the crash flush skip a write it interrupted
+
 };
 
 }  // namespace Logging::Sinks
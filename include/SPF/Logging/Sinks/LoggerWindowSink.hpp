@@ -3,6 +3,7 @@
 #include "SPF/Logging/Logger.hpp"  // Correct include for ILogSink
 #include "SPF/Namespace.hpp"
 
+#include <atomic>
 #include <vector>
 #include <mutex>
 #include <string>
@@ -11,6 +12,9 @@ SPF_NS_BEGIN
 namespace Logging::Sinks {
 /**
  * @brief A sink that collects log messages in memory for UI rendering.
+ * It is not filtered by the loggers' levels: it has its own level (the framework's log level),
+ * and takes everything at or above it from every logger, plus whatever a logger's level lets
+ * through below it.
  * This class is thread-safe.
  */
 class LoggerWindowSink : public ILogSink  // Use the fully qualified name
@@ -44,6 +48,13 @@ class LoggerWindowSink : public ILogSink  // Use the fully qualified name
 
   // --- ILogSink Overrides ---
   bool ShouldFilterByLevel() const override { return false; }
+  LogLevel GetMinLevel() const override { return m_level.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Sets the lowest level collected from loggers whose own level is higher.
+   * Loggers cache it; call Logger::RefreshSinkLevels() on the loggers that use this sink.
+   */
+  void SetLevel(LogLevel level) { m_level.store(level, std::memory_order_relaxed); }
 
   /**
    * @brief Provides thread-safe access to the collected messages.
@@ -59,6 +70,7 @@ class LoggerWindowSink : public ILogSink  // Use the fully qualified name
  private:
   mutable std::mutex m_mutex;
   std::vector<DisplayMessage> m_items;
+  std::atomic<LogLevel> m_level = LogLevel::Trace;
 };
 }  // namespace Logging::Sinks
 SPF_NS_END
\ No newline at end of file
@@ -10,11 +10,20 @@
 #include "SPF/Telemetry/SCS/Controls.hpp" // For Controls
 #include "SPF/Telemetry/SCS/Events.hpp"   // For SpecialEvents, GameplayEvents
 #include "SPF/Telemetry/SCS/Gearbox.hpp"  // For GearboxConstants
+#include "SPF/Telemetry/ChannelGroups.hpp"
+#include "SPF/Telemetry/ChannelSubscriptions.hpp"
+#include "SPF/Telemetry/DerivedChannels.hpp"
+#include "SPF/Telemetry/FieldAggregator.hpp"
+#include "SPF/Telemetry/TelemetryFields.hpp" // For Field, FieldMask
+#include "SPF/Telemetry/TelemetrySnapshot.hpp"
+#include "SPF/Telemetry/TelemetryTiming.hpp"
+#include "SPF/Telemetry/TriggerEngine.hpp"
 
 #include "SPF/Utils/Signal.hpp"
 #include "SPF/Utils/Delegate.hpp"
 #include <functional> // For std::function
 #include <memory> // For std::unique_ptr, std::make_unique
+#include <vector>
 
 SPF_NS_BEGIN
 
@@ -28,6 +37,25 @@ class TelemetryApi {
     // Base class for all telemetry subscription handlers. Used for type erasure in TelemetryHandle.
     struct BaseSubscriptionHandler {
         virtual ~BaseSubscriptionHandler() = default;
+
+        // Whether SetCallbackRate may be applied. Handlers for which skipping an event
+        // would lose information (gameplay events, window results) return false.
+        virtual bool SupportsRateLimit() const { return true; }
+
+        // Returns false while the render clock has not yet reached the next delivery slot.
+        // Slots advance by the interval rather than from the last delivery, so the average
+        // rate matches the requested one even though deliveries snap to frames.
+        bool PassesRateLimit();
+
+        uint64_t m_minIntervalUs = 0; // 0 = deliver every event
+        uint64_t m_nextDeliveryUs = 0;
+        bool m_hasDelivered = false;
+
+        // Keeps the SDK channels behind the subscribed data registered while the handler exists.
+        SPF::Telemetry::ChannelLease m_channels;
+
+        // Duration of each delivery to the plugin (conversion included); null unless SPF_TELEMETRY_TIMING is on.
+        std::shared_ptr<SPF::Telemetry::TimingHistogram> m_timing;
     };
 
     // Templated handler for specific telemetry event types
@@ -45,6 +73,8 @@ class TelemetryApi {
         }
 
         void OnEvent(const CppDataType& cpp_data) {
+            if (!PassesRateLimit()) return;
+            SPF_TELEMETRY_TIME_SCOPE(m_timing);
             m_invoker_func(cpp_data, m_user_data_ptr);
         }
 
@@ -66,7 +96,10 @@ class TelemetryApi {
             m_sink.template Connect<&GameplayEventSubscriptionHandler::OnEvent>(this);
         }
 
+        bool SupportsRateLimit() const override { return false; }
+
         void OnEvent(const char* event_id, const SPF::Telemetry::SCS::GameplayEvents& cpp_data) {
+            SPF_TELEMETRY_TIME_SCOPE(m_timing);
             m_invoker_func(event_id, cpp_data, m_user_data_ptr);
         }
 
@@ -75,6 +108,92 @@ class TelemetryApi {
         Utils::Sink<void(const char*, const SPF::Telemetry::SCS::GameplayEvents&)> m_sink;
     };
 
+    // Handler for per-field subscriptions. Frames in which none of the watched fields changed
+    // are rejected with a single mask test; otherwise each watched field is checked against
+    // its deadband and all changes are delivered to the plugin in one call.
+    struct FieldSubscriptionHandler : public BaseSubscriptionHandler {
+        struct WatchedField {
+            SPF::Telemetry::Field field;
+            SPF_Telemetry_Deadband_Mode mode;
+            double deadband;
+            double lastReported;
+        };
+
+        FieldSubscriptionHandler(
+            Utils::Signal<void(const SPF::Telemetry::TelemetrySnapshot&, const SPF::Telemetry::FieldMask&)>& signal,
+            std::vector<WatchedField> fields,
+            SPF_Telemetry_FieldChanges_Callback callback,
+            void* user_data_ptr
+        );
+
+        void OnEvent(const SPF::Telemetry::TelemetrySnapshot& snapshot, const SPF::Telemetry::FieldMask& changed);
+
+        std::vector<WatchedField> m_fields;
+        SPF::Telemetry::FieldMask m_interest;
+        SPF::Telemetry::FieldMask m_pending; // Watched fields changed since the last delivery
+        std::vector<SPF_Telemetry_FieldChange> m_changes; // Reused between frames
+        SPF_Telemetry_FieldChanges_Callback m_callback;
+        void* m_user_data_ptr;
+        Utils::Sink<void(const SPF::Telemetry::TelemetrySnapshot&, const SPF::Telemetry::FieldMask&)> m_sink;
+    };
+
+    // Handler for windowed aggregates. The window itself is shared through the service's
+    // FieldAggregator; the handler only copies its own fields out when a window closes.
+    struct FieldAggregateSubscriptionHandler : public BaseSubscriptionHandler {
+        FieldAggregateSubscriptionHandler(
+            SPF::Telemetry::FieldAggregator& aggregator,
+            std::vector<SPF::Telemetry::Field> fields,
+            uint32_t window_ms,
+            SPF_Telemetry_FieldAggregates_Callback callback,
+            void* user_data_ptr
+        );
+        ~FieldAggregateSubscriptionHandler() override;
+
+        bool SupportsRateLimit() const override { return false; }
+
+        void OnEvent(const SPF::Telemetry::AggregateWindow& window);
+
+        SPF::Telemetry::FieldAggregator& m_aggregator;
+        std::vector<SPF::Telemetry::Field> m_fields;
+        SPF::Telemetry::AggregateWindow& m_window;
+        std::vector<SPF_Telemetry_FieldAggregate> m_results; // Reused between windows
+        SPF_Telemetry_FieldAggregates_Callback m_callback;
+        void* m_user_data_ptr;
+        Utils::Sink<void(const SPF::Telemetry::AggregateWindow&)> m_sink;
+    };
+
+    // Handler for single channel subscriptions. The service calls it from its channel dispatch
+    // with the raw SDK value, so only that one value is converted per delivery.
+    struct ChannelSubscriptionHandler : public BaseSubscriptionHandler {
+        ChannelSubscriptionHandler(SPF_Telemetry_Channel_Callback callback, void* user_data_ptr)
+            : m_callback(callback), m_user_data_ptr(user_data_ptr) {}
+
+        // Skipping a value could lose the only change of a changes-only subscription.
+        bool SupportsRateLimit() const override { return false; }
+
+        void OnValue(const SPF::Telemetry::ChannelValue& value);
+
+        SPF_Telemetry_Channel_Callback m_callback;
+        void* m_user_data_ptr;
+        SPF::Telemetry::ChannelSubscription m_subscription; // Last member: unsubscribes before the rest is destroyed
+    };
+
+    // Handler for triggers. The conditions are evaluated by the service's TriggerEngine together
+    // with those of every other plugin; the handler is only called on reported transitions.
+    struct TriggerSubscriptionHandler : public BaseSubscriptionHandler {
+        TriggerSubscriptionHandler(SPF_Telemetry_Trigger_Callback callback, void* user_data_ptr)
+            : m_callback(callback), m_user_data_ptr(user_data_ptr) {}
+
+        // Transitions are rare and a skipped one would leave the plugin with the wrong state.
+        bool SupportsRateLimit() const override { return false; }
+
+        void OnTransition(const SPF::Telemetry::TriggerEvent& event);
+
+        SPF_Telemetry_Trigger_Callback m_callback;
+        void* m_user_data_ptr;
+        SPF::Telemetry::TriggerSubscription m_subscription; // Last member: removes the trigger before the rest is destroyed
+    };
+
   static void FillTelemetryApi(SPF_Telemetry_API* api);
 
   // --- Event-Driven Callback Invocation & Conversion ---
@@ -93,6 +212,7 @@ class TelemetryApi {
   static void InvokeSpecialEventsCallback(const SPF::Telemetry::SCS::SpecialEvents& cpp_data, SPF_Telemetry_SpecialEvents_Callback callback, void* user_data);
   static void InvokeGameplayEventsCallback(const char* event_id, const SPF::Telemetry::SCS::GameplayEvents& cpp_data, SPF_Telemetry_GameplayEvents_Callback callback, void* user_data);
   static void InvokeGearboxConstantsCallback(const SPF::Telemetry::SCS::GearboxConstants& cpp_data, SPF_Telemetry_GearboxConstants_Callback callback, void* user_data);
+  static void InvokeDerivedDataCallback(const SPF::Telemetry::DerivedData& cpp_data, SPF_Telemetry_DerivedData_Callback callback, void* user_data);
 
   // --- Event Subscription (New RAII-based C-API Proxies) ---
   static SPF_Telemetry_Callback_Handle* T_RegisterForGameState(SPF_Telemetry_Handle* handle, SPF_Telemetry_GameState_Callback callback, void* user_data);
@@ -109,6 +229,12 @@ class TelemetryApi {
   static SPF_Telemetry_Callback_Handle* T_RegisterForSpecialEvents(SPF_Telemetry_Handle* handle, SPF_Telemetry_SpecialEvents_Callback callback, void* user_data);
   static SPF_Telemetry_Callback_Handle* T_RegisterForGameplayEvents(SPF_Telemetry_Handle* handle, SPF_Telemetry_GameplayEvents_Callback callback, void* user_data);
   static SPF_Telemetry_Callback_Handle* T_RegisterForGearboxConstants(SPF_Telemetry_Handle* handle, SPF_Telemetry_GearboxConstants_Callback callback, void* user_data);
+  static SPF_Telemetry_Callback_Handle* T_RegisterForDerivedData(SPF_Telemetry_Handle* handle, SPF_Telemetry_DerivedData_Callback callback, void* user_data);
+  static SPF_Telemetry_Callback_Handle* T_RegisterForFieldChanges(SPF_Telemetry_Handle* handle, const SPF_Telemetry_FieldSubscription* subscriptions, uint32_t count, SPF_Telemetry_FieldChanges_Callback callback, void* user_data);
+  static SPF_Telemetry_Callback_Handle* T_RegisterForFieldAggregates(SPF_Telemetry_Handle* handle, const SPF_Telemetry_Field* fields, uint32_t count, uint32_t window_ms, SPF_Telemetry_FieldAggregates_Callback callback, void* user_data);
+  static SPF_Telemetry_Callback_Handle* T_RegisterForChannel(SPF_Telemetry_Handle* handle, const char* channel, uint32_t index, bool changes_only, SPF_Telemetry_Channel_Callback callback, void* user_data);
+  static SPF_Telemetry_Callback_Handle* T_RegisterForTrigger(SPF_Telemetry_Handle* handle, const SPF_Telemetry_TriggerCondition* conditions, uint32_t count, const SPF_Telemetry_TriggerOptions* options, SPF_Telemetry_Trigger_Callback callback, void* user_data);
+  static bool T_SetCallbackRate(SPF_Telemetry_Handle* handle, SPF_Telemetry_Callback_Handle* callback_handle, float rate_hz);
 
  private:
   static SPF_Telemetry_Handle* T_GetContext(const char* pluginName);
@@ -125,7 +251,26 @@ class TelemetryApi {
   static void T_GetSpecialEvents(SPF_Telemetry_Handle* handle, SPF_SpecialEvents* out_data);
   static void T_GetGameplayEvents(SPF_Telemetry_Handle* handle, SPF_GameplayEvents* out_data);
   static void T_GetGearboxConstants(SPF_Telemetry_Handle* handle, SPF_GearboxConstants* out_data);
+  static void T_GetDerivedData(SPF_Telemetry_Handle* handle, SPF_DerivedData* out_data);
   static int T_GetLastGameplayEventId(SPF_Telemetry_Handle* handle, char* out_buffer, int buffer_size);
+  static const SPF_TelemetryView* T_GetView(SPF_Telemetry_Handle* handle, uint32_t version, uint64_t* out_frame_sequence);
+  static void T_DemandChannelGroups(SPF_Telemetry_Handle* handle, uint32_t groups);
+  static uint32_t T_GetTimingStats(SPF_Telemetry_Handle* handle, SPF_Telemetry_TimingStats* out_stats, uint32_t max_count);
+  static bool T_GetCallbackTiming(SPF_Telemetry_Handle* handle, SPF_Telemetry_Callback_Handle* callback_handle, SPF_Telemetry_TimingStats* out_stats);
+
+  // --- Gameplay Event History ---
+  static uint64_t T_GetLatestGameplayEventSequence(SPF_Telemetry_Handle* handle);
+  static uint32_t T_ReadGameplayEvents(SPF_Telemetry_Handle* handle, SPF_GameplayEventRecord* out_events, uint32_t max_count, uint64_t* out_missed);
+  static void T_SetGameplayEventCursor(SPF_Telemetry_Handle* handle, uint64_t sequence);
+  static uint32_t T_QueryGameplayEvents(SPF_Telemetry_Handle* handle, uint64_t after_sequence, const char* event_id, SPF_GameplayEventRecord* out_events, uint32_t max_count);
+
+  static void T_GetInterpolatedPlacements(SPF_Telemetry_Handle* handle, SPF_InterpolatedPlacements* out_data);
+  static void T_GetRouteInfo(SPF_Telemetry_Handle* handle, SPF_RouteInfo* out_info);
+  static bool T_FindNearestRoutePoint(SPF_Telemetry_Handle* handle, double x, double z, double max_distance, SPF_RoutePoint* out_point, double* out_distance);
+  static uint32_t T_GetRoutePointsInBox(SPF_Telemetry_Handle* handle, double min_x, double min_z, double max_x, double max_z, SPF_RoutePoint* out_points, uint32_t max_count);
+  static bool T_SaveRoute(SPF_Telemetry_Handle* handle, const char* path);
+  static bool T_RecordFieldHistory(SPF_Telemetry_Handle* handle, const SPF_Telemetry_Field* fields, uint32_t count);
+  static uint32_t T_GetFieldHistory(SPF_Telemetry_Handle* handle, SPF_Telemetry_Field field, uint64_t from_time, uint64_t to_time, SPF_Telemetry_HistoryPoint* out_points, uint32_t max_points);
 
 
 
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "SPF/Namespace.hpp"
@@ -12,6 +16,17 @@
 #include "SPF/Telemetry/SCS/Controls.hpp"
 #include "SPF/Telemetry/SCS/Events.hpp"
 #include "SPF/Telemetry/SCS/Gearbox.hpp"
+#include "SPF/Telemetry/ChannelGroups.hpp"
+#include "SPF/Telemetry/ChannelSubscriptions.hpp"
+#include "SPF/Telemetry/DerivedChannels.hpp"
+#include "SPF/Telemetry/FieldAggregator.hpp"
+#include "SPF/Telemetry/FieldHistory.hpp"
+#include "SPF/Telemetry/GameplayEventHistory.hpp"
+#include "SPF/Telemetry/PlacementInterpolator.hpp"
+#include "SPF/Telemetry/RouteStore.hpp"
+#include "SPF/Telemetry/TelemetryFields.hpp"
+#include "SPF/Telemetry/TelemetrySnapshot.hpp"
+#include "SPF/Telemetry/TriggerEngine.hpp"
 #include "SPF/Utils/Signal.hpp" // Added for Utils::Signal
 
 SPF_NS_BEGIN
@@ -43,6 +58,30 @@ class ITelemetryService {
   virtual const SPF::Telemetry::SCS::GameplayEvents& GetGameplayEvents() const = 0;
   virtual const SPF::Telemetry::SCS::GearboxConstants& GetGearboxConstants() const = 0;
   virtual const std::string& GetLastGameplayEventId() const = 0;
+  virtual const SPF::Telemetry::DerivedData& GetDerivedData() const = 0;
+
+  /**
+   * @brief Gets the most recent gameplay events, including those raised in earlier frames.
+   *        Safe to read from any thread.
+   */
+  virtual const SPF::Telemetry::GameplayEventHistory& GetGameplayEventHistory() const = 0;
+
+  /**
+   * @brief Gets the truck's world placement, cabin offset and head offset at the render time
+   *        of the current visual frame, smoothed between simulation steps.
+   *
+   * Evaluated once per visual frame, so overlays drawn from it move smoothly at any refresh
+   * rate. Only updated while the TruckMotion channel group is leased. Safe to call from any thread.
+   */
+  virtual SPF::Telemetry::InterpolatedPlacements GetInterpolatedPlacements() const = 0;
+
+  /**
+   * @brief Gets the simplified path the truck has driven this run, with spatial lookups.
+   *
+   * Sampled at every unpaused frame end while the TruckMotion channel group is leased; a
+   * gap in leasing starts a new track. Safe to use from any thread.
+   */
+  virtual SPF::Telemetry::RouteStore& GetRouteStore() = 0;
 
   // Signal Accessors
   virtual Utils::Signal<void(const SPF::Telemetry::SCS::GameState&)>& GetGameStateSignal() = 0;
@@ -59,12 +98,104 @@ class ITelemetryService {
   virtual Utils::Signal<void(const SPF::Telemetry::SCS::SpecialEvents&)>& GetSpecialEventsSignal() = 0;
   virtual Utils::Signal<void(const char*, const SPF::Telemetry::SCS::GameplayEvents&)>& GetGameplayEventsSignal() = 0;
   virtual Utils::Signal<void(const SPF::Telemetry::SCS::GearboxConstants&)>& GetGearboxConstantsSignal() = 0;
+  virtual Utils::Signal<void(const SPF::Telemetry::TelemetrySnapshot&, const SPF::Telemetry::FieldMask&)>& GetFieldsChangedSignal() = 0;
+  virtual Utils::Signal<void(const SPF::Telemetry::DerivedData&)>& GetDerivedDataSignal() = 0;
 
   /**
    * @brief Gets the time elapsed since the last frame.
    * @return Delta time in seconds.
    */
   virtual float GetDeltaTime() const = 0;
+
+  /**
+   * @brief Gets a counter that changes every time the service publishes new data.
+   *
+   * It is incremented around every frame (once the channel values of the frame have
+   * been written) and on every configuration, gameplay, pause and resume event.
+   * Consumers that derive data from the telemetry structs (e.g. the C-API conversion
+   * cache) compare it to know whether their copy is current.
+   */
+  virtual uint64_t GetDataRevision() const = 0;
+
+  /**
+   * @brief Gets the most recently published telemetry snapshot.
+   *
+   * A new snapshot is published at every frame start and after every configuration,
+   * gameplay, pause and resume event. Unlike the Get* accessors above, which reference
+   * live data that the game keeps writing during a frame, a snapshot never changes and
+   * may be kept and read from any thread.
+   * @return The latest snapshot; never null.
+   */
+  virtual std::shared_ptr<const SPF::Telemetry::TelemetrySnapshot> GetSnapshot() const = 0;
+
+  /**
+   * @brief Gets the fields whose values changed between the two most recent frame starts.
+   *
+   * Fields only set bits when a channel write actually changes the stored value, so a
+   * frame in which nothing moved yields an empty mask. The fields-changed signal is only
+   * fired for non-empty masks.
+   */
+  virtual const SPF::Telemetry::FieldMask& GetChangedFields() const = 0;
+
+  /**
+   * @brief Gets the shared windowed aggregates (min/max/mean/last over N ms) of fields.
+   *
+   * Windows are fed once per frame start by the service, after the data signals; every
+   * consumer of the same window length shares one set of results.
+   */
+  virtual SPF::Telemetry::FieldAggregator& GetFieldAggregator() = 0;
+
+  /**
+   * @brief Gets the shared history of recorded fields: every frame for the last minutes,
+   *        and per-second and per-ten-second min/max/mean for longer, queried decimated
+   *        to the width of a graph. Safe to use from any thread.
+   */
+  virtual SPF::Telemetry::FieldHistory& GetFieldHistory() = 0;
+
+  /**
+   * @brief Starts recording fields in the shared history.
+   *
+   * Fields are sampled at every frame start, after the data signals. History only covers
+   * the time a field has been recorded by at least one consumer, so keep the lease for as
+   * long as the history may be looked at. The lease keeps the fields' channel groups registered.
+   * @return The lease, or an empty one if no fields were given.
+   */
+  virtual SPF::Telemetry::FieldHistoryLease RecordFieldHistory(std::span<const SPF::Telemetry::Field> fields) = 0;
+
+  /**
+   * @brief Declares that the caller reads data fed by the given channel groups.
+   *
+   * A group's SDK channels are only registered while at least one lease holds it, so the
+   * game does not call back for values nobody reads. The SDK only allows registration
+   * from event callbacks, so a newly acquired group is registered at the next frame start
+   * (or configuration event) and its data is current from the following frame on.
+   * @return A lease that keeps the groups registered until it is destroyed or reset.
+   */
+  virtual SPF::Telemetry::ChannelLease AcquireChannels(const SPF::Telemetry::ChannelGroupMask& groups) = 0;
+
+  /**
+   * @brief Subscribes to a single SDK channel, e.g. "truck.engine.rpm" or "trailer.0.cargo.damage".
+   *
+   * The name is resolved once, here. The callback then runs on the game thread at every
+   * frame start for which the channel has a value, straight from the value the game sent,
+   * without going through any of the data structs. The subscription keeps the channel's
+   * group registered.
+   * @param index The element of an indexed channel (wheels, H-shifter selectors), or
+   *        SCS_U32_NIL for channels without an index.
+   * @param changesOnly Only call back in frames in which the value changed.
+   * @return The subscription, or an empty one if the channel or index is unknown.
+   */
+  virtual SPF::Telemetry::ChannelSubscription SubscribeToChannel(std::string_view name, uint32_t index, SPF::Telemetry::ChannelCallback callback, bool changesOnly) = 0;
+
+  /**
+   * @brief Adds a trigger: a set of field conditions that must all hold, reported on transitions.
+   *
+   * All triggers are evaluated together once per frame start, after the data signals, so
+   * consumers do not need to poll the fields and keep their own timers. The callback runs
+   * on the game thread. The subscription keeps the channel groups of the fields registered.
+   * @return The subscription, or an empty one if no conditions or no callback were given.
+   */
+  virtual SPF::Telemetry::TriggerSubscription AddTrigger(std::span<const SPF::Telemetry::TriggerCondition> conditions, const SPF::Telemetry::TriggerOptions& options, SPF::Telemetry::TriggerCallback callback) = 0;
 };
 
 }  // namespace Modules
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -18,6 +19,7 @@
 #define SPF_TELEMETRY_SELECTOR_MAX_COUNT 8
 #define SPF_TELEMETRY_ID_MAX_SIZE 64
 #define SPF_TELEMETRY_STRING_MAX_SIZE 256
+#define SPF_TELEMETRY_EVENT_ATTRIBUTE_MAX_COUNT 16
 
 
 // --- Forward Declarations for nested structs ---
@@ -622,6 +624,133 @@ typedef struct {
     SPF_GameplayEvent_TrainUsed train_used;
 } SPF_GameplayEvents;
 
+/**
+ * @brief Type of a recorded gameplay event attribute.
+ */
+typedef enum {
+    SPF_TELEMETRY_ATTRIBUTE_TYPE_NONE = 0, ///< A type the framework does not convert (e.g. vectors).
+    SPF_TELEMETRY_ATTRIBUTE_TYPE_BOOL = 1,
+    SPF_TELEMETRY_ATTRIBUTE_TYPE_S32 = 2,
+    SPF_TELEMETRY_ATTRIBUTE_TYPE_U32 = 3,
+    SPF_TELEMETRY_ATTRIBUTE_TYPE_S64 = 4,
+    SPF_TELEMETRY_ATTRIBUTE_TYPE_U64 = 5,
+    SPF_TELEMETRY_ATTRIBUTE_TYPE_FLOAT = 6,
+    SPF_TELEMETRY_ATTRIBUTE_TYPE_DOUBLE = 7,
+    SPF_TELEMETRY_ATTRIBUTE_TYPE_STRING = 8
+} SPF_Telemetry_Attribute_Type;
+
+/**
+ * @struct SPF_GameplayEventAttribute
+ * @brief One attribute of a recorded gameplay event, as sent by the game.
+ */
+typedef struct {
+    char name[SPF_TELEMETRY_ID_MAX_SIZE]; ///< SDK attribute name, e.g. "revenue".
+    uint32_t index;                       ///< Array index, or UINT32_MAX for attributes that are not indexed.
+    SPF_Telemetry_Attribute_Type type;    ///< Selects the member of `value` (or `value_string`) that is set.
+    union {
+        bool value_bool;
+        int32_t value_s32;
+        uint32_t value_u32;
+        int64_t value_s64;
+        uint64_t value_u64;
+        float value_float;
+        double value_double;
+    } value;
+    char value_string[SPF_TELEMETRY_STRING_MAX_SIZE]; ///< Set for SPF_TELEMETRY_ATTRIBUTE_TYPE_STRING, empty otherwise.
+} SPF_GameplayEventAttribute;
+
+/**
+ * @struct SPF_GameplayEventRecord
+ * @brief A gameplay event from the framework's event history (see `ReadGameplayEvents`).
+ */
+typedef struct {
+    uint64_t sequence;                  ///< 1 for the first event recorded, then increasing by one.
+    char id[SPF_TELEMETRY_ID_MAX_SIZE]; ///< SDK event id, e.g. "job.delivered".
+    SPF_Timestamps timestamps;          ///< Timestamps of the frame the event arrived in.
+    uint32_t game_time;                 ///< In-game time of that frame, in minutes.
+    SPF_SpecialEvents special_events;   ///< The one-frame flags this event raised (all false for other events).
+    uint32_t attribute_count;           ///< Valid elements of `attributes`; extra attributes are dropped.
+    SPF_GameplayEventAttribute attributes[SPF_TELEMETRY_EVENT_ATTRIBUTE_MAX_COUNT];
+} SPF_GameplayEventRecord;
+
+/**
+ * @struct SPF_InterpolatedPlacements
+ * @brief Truck placements at the render time of the current visual frame (see `GetInterpolatedPlacements`).
+ */
+typedef struct {
+    SPF_DPlacement world_placement; ///< World position and orientation of the truck.
+    SPF_Placement cabin_offset;     ///< Position and orientation of the cabin relative to the chassis.
+    SPF_Placement head_offset;      ///< Position and orientation of the driver's head relative to the cabin.
+    uint64_t render_time;           ///< Render timestamp the placements were evaluated at. @unit microseconds
+    float alpha;                    ///< 0 = previous simulation step, 1 = latest step, above 1 = extrapolated.
+    bool valid;                     ///< False until the first sample arrives after the truck channels were leased.
+} SPF_InterpolatedPlacements;
+
+/**
+ * @brief Type of a raw channel value (see `RegisterForChannel`). Matches the SDK value types.
+ */
+typedef enum {
+    SPF_TELEMETRY_CHANNEL_TYPE_NONE = 0,
+    SPF_TELEMETRY_CHANNEL_TYPE_BOOL = 1,
+    SPF_TELEMETRY_CHANNEL_TYPE_S32 = 2,
+    SPF_TELEMETRY_CHANNEL_TYPE_U32 = 3,
+    SPF_TELEMETRY_CHANNEL_TYPE_U64 = 4,
+    SPF_TELEMETRY_CHANNEL_TYPE_FLOAT = 5,
+    SPF_TELEMETRY_CHANNEL_TYPE_DOUBLE = 6,
+    SPF_TELEMETRY_CHANNEL_TYPE_FVECTOR = 7,
+    SPF_TELEMETRY_CHANNEL_TYPE_DVECTOR = 8,
+    SPF_TELEMETRY_CHANNEL_TYPE_EULER = 9,
+    SPF_TELEMETRY_CHANNEL_TYPE_FPLACEMENT = 10,
+    SPF_TELEMETRY_CHANNEL_TYPE_DPLACEMENT = 11,
+    SPF_TELEMETRY_CHANNEL_TYPE_S64 = 12
+} SPF_Telemetry_Channel_Type;
+
+/**
+ * @struct SPF_Telemetry_ChannelValue
+ * @brief One value of a single SDK channel, as sent by the game.
+ */
+typedef struct {
+    uint32_t index;                  ///< Element of an indexed channel, or UINT32_MAX for channels without an index.
+    SPF_Telemetry_Channel_Type type; ///< Selects the member of `value` that is set.
+    union {
+        bool value_bool;
+        int32_t value_s32;
+        uint32_t value_u32;
+        uint64_t value_u64;
+        int64_t value_s64;
+        float value_float;
+        double value_double;
+        SPF_FVector value_fvector;
+        SPF_DVector value_dvector;
+        SPF_Euler value_euler;
+        SPF_Placement value_fplacement;
+        SPF_DPlacement value_dplacement;
+    } value;
+    bool changed; ///< The value differs from the previous frame's (always true for the first value delivered).
+} SPF_Telemetry_ChannelValue;
+
+/**
+ * @struct SPF_RoutePoint
+ * @brief A position on the recorded route (see `FindNearestRoutePoint`).
+ */
+typedef struct {
+    SPF_DVector position; ///< World position, quantized to 0.1 m. @unit meters
+    float heading;        ///< Heading of the truck at that position. @unit turns
+    uint64_t time;        ///< Simulation timestamp at which the truck was there. @unit microseconds
+} SPF_RoutePoint;
+
+/**
+ * @struct SPF_RouteInfo
+ * @brief Size of the recorded route (see `GetRouteInfo`).
+ */
+typedef struct {
+    uint64_t sample_count; ///< Positions sampled since recording started.
+    uint64_t point_count;  ///< Positions kept after simplification.
+    uint64_t track_count;  ///< Continuous pieces; a new one starts after a teleport, ferry, reload or recording gap.
+    uint64_t memory_bytes; ///< Approximate memory used by the route and its index.
+    double length;         ///< Length of the kept route. @unit meters
+} SPF_RouteInfo;
+
 /**
  * @struct SPF_GearboxConstants
  * @brief Contains static information about the truck's H-shifter gearbox layout.
@@ -659,3 +788,83 @@ typedef struct {
     ///< The total number of configured slots in the H-shifter layout.
     uint32_t slot_count;
 } SPF_GearboxConstants;
+
+/**
+ * @struct SPF_DerivedData
+ * @brief Values the framework computes from the truck channels once per frame.
+ *        The scalar members can also be watched as `SPF_TELEMETRY_FIELD_DERIVED_*` fields.
+ */
+typedef struct {
+    float longitudinal_g;    ///< Forward acceleration in g; negative while braking.
+    float lateral_g;         ///< Sideways acceleration in g; positive towards the right.
+    float vertical_g;        ///< Vertical acceleration in g.
+    float jerk;              ///< Magnitude of the change of linear acceleration. @unit m/s^3
+
+    uint32_t wheel_count;    ///< Number of valid entries in `wheel_slip`.
+    float wheel_slip[SPF_TELEMETRY_WHEEL_MAX_COUNT]; ///< (wheel surface speed - truck speed) / max(|truck speed|, 1 m/s) per truck wheel.
+    float max_wheel_slip;    ///< Largest absolute slip of the wheels that are on the ground.
+
+    float fuel_economy;      ///< Consumption over the last 100 m or more driven. @unit l/100 km
+    float trip_fuel_economy; ///< Consumption since the trip started. @unit l/100 km
+    float trip_distance;     ///< Distance driven since the trip started. A new trip starts when the odometer jumps (other truck, ferry, train). @unit km
+    float trip_fuel_used;    ///< Fuel used since the trip started. @unit liters
+    float fuel_rate;         ///< Fuel flow over the last second or more of simulation. @unit l/h
+    float time_to_empty;     ///< Time until the tank is empty at `fuel_rate`; 0 while no fuel is used. @unit seconds
+
+    uint32_t axle_count;     ///< Number of valid entries in `axle_suspension_deflection`.
+    float axle_suspension_deflection[SPF_TELEMETRY_WHEEL_MAX_COUNT]; ///< Mean suspension deflection per truck axle, front to back. @unit meters
+} SPF_DerivedData;
+
+// --- Versioned Views ---
+
+/**
+ * @struct SPF_StructHeader
+ * @brief Leading member of framework-owned structs that are handed out by pointer.
+ *
+ * `version` changes only when the existing layout changes incompatibly. Compatible
+ * additions are appended to the end of the struct and only grow `size`, so a plugin
+ * built against an older header keeps reading the members it knows, and a plugin built
+ * against a newer header can test for new members with SPF_STRUCT_HAS_MEMBER.
+ */
+typedef struct {
+    uint32_t size;    ///< sizeof() of the struct as built into the framework.
+    uint32_t version; ///< Layout version of the struct as built into the framework.
+} SPF_StructHeader;
+
+/**
+ * @brief True if the framework-owned struct `ptr` (of type `type`) contains `member`.
+ */
+#define SPF_STRUCT_HAS_MEMBER(ptr, type, member) \
+    ((ptr)->header.size >= offsetof(type, member) + sizeof(((const type*)0)->member))
+
+#define SPF_TELEMETRY_VIEW_VERSION 1
+
+/**
+ * @struct SPF_TelemetryView
+ * @brief The complete telemetry state of one frame, owned by the framework.
+ *
+ * Returned by `SPF_Telemetry_API::GetView`. The contents never change while the view is
+ * valid, i.e. until the next frame starts, so a plugin can read any number of members
+ * in place without copying the struct.
+ */
+typedef struct {
+    SPF_StructHeader header;  ///< size = sizeof(SPF_TelemetryView), version = SPF_TELEMETRY_VIEW_VERSION.
+    uint64_t frame_sequence;  ///< Number of frames started before the view was built. Changes when the view is rebuilt.
+
+    SPF_GameState game_state;
+    SPF_Timestamps timestamps;
+    SPF_CommonData common_data;
+    SPF_TruckConstants truck_constants;
+    SPF_TruckData truck_data;
+    SPF_Trailer trailers[SPF_TELEMETRY_TRAILER_MAX_COUNT]; ///< All trailer slots, as returned by `GetTrailers`.
+    uint32_t trailer_count;
+    SPF_JobConstants job_constants;
+    SPF_JobData job_data;
+    SPF_NavigationData navigation_data;
+    SPF_Controls controls;
+    SPF_SpecialEvents special_events;
+    SPF_GameplayEvents gameplay_events;
+    SPF_GearboxConstants gearbox_constants;
+    SPF_DerivedData derived_data;
+    char last_gameplay_event_id[SPF_TELEMETRY_ID_MAX_SIZE];
+} SPF_TelemetryView;
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "SPF_TelemetryData.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =================================================================================================
+// Shared-Memory Telemetry Export
+// =================================================================================================
+// When `settings.telemetry_export.enabled` is set, the framework publishes every telemetry frame
+// into a named shared-memory region so that external programs (dashboards, loggers) can read it
+// without loading a telemetry plugin of their own.
+//
+// Region names:
+//   Windows: "Local\<name>"          (mapping), "Local\<name>.frame" (semaphore)
+//   POSIX:   "/<name>"               (shm_open), "/<name>.frame"     (sem_open)
+// where <name> is `settings.telemetry_export.name` (default SPF_TELEMETRY_SHM_DEFAULT_NAME).
+//
+// The region is an SPF_TelemetryShmHeader followed by one SPF_TelemetryShmFrame. The frame is
+// guarded by a sequence lock:
+//
+//   Writer: sequence += 1 (odd) -> write frame -> sequence += 1 (even) -> frame_id = frame.frame_id
+//
+//   Reader: do {
+//               s1 = load_acquire(&header->sequence);
+//               if (s1 & 1) continue;                  // write in progress
+//               memcpy(&copy, &region->frame, sizeof copy);
+//               acquire_fence();
+//               s2 = load_relaxed(&header->sequence);
+//           } while (s1 != s2);
+//
+// A successful copy additionally satisfies copy.frame_id == copy.frame_id_end.
+//
+// To wait for a new frame instead of polling `frame_id`, a reader atomically increments
+// `waiters`, re-checks `frame_id`, waits on the "<name>.frame" semaphore and then decrements
+// `waiters`. The writer posts the semaphore once per registered waiter after each frame.
+// Wake-ups may be spurious; always re-check `frame_id`.
+//
+// The header fields marked (atomic) must be accessed with atomic operations.
+
+#define SPF_TELEMETRY_SHM_MAGIC 0x54465053u // "SPFT"
+#define SPF_TELEMETRY_SHM_VERSION 1
+#define SPF_TELEMETRY_SHM_DEFAULT_NAME "SPF_Telemetry"
+
+/**
+ * @brief The complete telemetry state of one frame, using the plugin API structs.
+ */
+typedef struct {
+    uint64_t frame_id; ///< Number of frames published since the exporter started (the first frame is 1).
+
+    SPF_GameState game_state;
+    SPF_Timestamps timestamps;
+    SPF_CommonData common_data;
+    SPF_TruckConstants truck_constants;
+    SPF_TruckData truck_data;
+    SPF_Trailer trailers[SPF_TELEMETRY_TRAILER_MAX_COUNT];
+    uint32_t trailer_count;
+    SPF_JobConstants job_constants;
+    SPF_JobData job_data;
+    SPF_NavigationData navigation_data;
+    SPF_Controls controls;
+    SPF_SpecialEvents special_events;
+    SPF_GameplayEvents gameplay_events;
+    SPF_GearboxConstants gearbox_constants;
+    char last_gameplay_event_id[SPF_TELEMETRY_ID_MAX_SIZE];
+
+    uint64_t frame_id_end; ///< Equal to `frame_id` in every consistent copy.
+} SPF_TelemetryShmFrame;
+
+/**
+ * @brief Describes the region. Check `magic`, `version` and `frame_size` before reading.
+ */
+typedef struct {
+    uint32_t magic;       ///< SPF_TELEMETRY_SHM_MAGIC once the writer has initialized the region.
+    uint32_t version;     ///< SPF_TELEMETRY_SHM_VERSION of the writer.
+    uint32_t header_size; ///< sizeof(SPF_TelemetryShmHeader) of the writer.
+    uint32_t frame_size;  ///< sizeof(SPF_TelemetryShmFrame) of the writer.
+    uint64_t sequence;    ///< (atomic) Sequence lock; odd while the frame is being written.
+    uint64_t frame_id;    ///< (atomic) `frame_id` of the last completely written frame.
+    uint32_t waiters;     ///< (atomic) Readers currently blocked on the frame semaphore.
+    uint32_t writer_active; ///< (atomic) 1 while the game is running the exporter, 0 after it stopped.
+    uint8_t reserved[24];
+} SPF_TelemetryShmHeader;
+
+typedef struct {
+    SPF_TelemetryShmHeader header;
+    SPF_TelemetryShmFrame frame;
+} SPF_TelemetryShmRegion;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =================================================================================================
+// UDP Telemetry Stream
+// =================================================================================================
+// When `settings.telemetry_stream.enabled` is set, the framework streams the scalar telemetry
+// fields (the values of SPF_Telemetry_Field, including the derived ones) over UDP to every
+// client that asks for them, so that hardware dashboards and second-screen apps can follow
+// the game without a telemetry plugin of their own. The server listens on
+// `settings.telemetry_stream.address`:`settings.telemetry_stream.port` (default 127.0.0.1:46100).
+//
+// All integers are little-endian; packets are at most SPF_TELEMETRY_STREAM_MAX_PACKET bytes.
+// Every packet starts with an SPF_TelemetryStreamHeader.
+//
+// Client -> server:
+//   SUBSCRIBE    header | uint16 flags | uint16 field_count | uint16 fields[field_count]
+//                Selects the fields to receive, by SPF_Telemetry_Field value. Resend it at least
+//                every SPF_TELEMETRY_STREAM_CLIENT_TIMEOUT_MS / 2 as a keep-alive; clients that
+//                stay silent longer are dropped. Repeating the current selection only renews
+//                the client, unless SPF_TELEMETRY_STREAM_SUBSCRIBE_RESYNC is set.
+//   UNSUBSCRIBE  header
+//
+// Server -> client:
+//   SCHEMA       header | SPF_TelemetryStreamSchema | uint16 fields[field_count]
+//                Sent in reply to every SUBSCRIBE that changes the selection. Lists the accepted
+//                fields (unknown ids are dropped) in the order their values appear in frames.
+//   FRAME        header | SPF_TelemetryStreamFrame | body
+//                One per telemetry frame. Every value is a float32.
+//                Keyframe (flags & SPF_TELEMETRY_STREAM_FRAME_KEYFRAME):
+//                  float32 values[field_count]
+//                Delta:
+//                  uint8 changed[(field_count + 7) / 8]  bit i (LSB first) set: field i changed
+//                  varint deltas[]                        one per changed field, in field order
+//                A delta is the XOR of the value's bits with the bits of the value last sent to
+//                the client, as an unsigned LEB128 varint.
+//
+// Decoding a delta frame needs every frame since the last keyframe. Keyframes are sent after
+// each schema, every `keyframe_interval` frames, and on request: a client that sees a gap in
+// `sequence` should ignore delta frames and send a SUBSCRIBE with the RESYNC flag. Frames whose
+// `schema_id` differs from the last SCHEMA received are to be ignored as well.
+
+#define SPF_TELEMETRY_STREAM_MAGIC 0x53465053u // "SPFS"
+#define SPF_TELEMETRY_STREAM_VERSION 1
+#define SPF_TELEMETRY_STREAM_DEFAULT_PORT 46100
+#define SPF_TELEMETRY_STREAM_MAX_PACKET 1400
+#define SPF_TELEMETRY_STREAM_MAX_FIELDS 256
+#define SPF_TELEMETRY_STREAM_CLIENT_TIMEOUT_MS 5000
+
+typedef enum {
+    SPF_TELEMETRY_STREAM_PACKET_SUBSCRIBE = 1,
+    SPF_TELEMETRY_STREAM_PACKET_UNSUBSCRIBE = 2,
+    SPF_TELEMETRY_STREAM_PACKET_SCHEMA = 3,
+    SPF_TELEMETRY_STREAM_PACKET_FRAME = 4
+} SPF_TelemetryStreamPacketType;
+
+#define SPF_TELEMETRY_STREAM_SUBSCRIBE_RESYNC 0x0001 // Send a keyframe next, e.g. after packet loss.
+#define SPF_TELEMETRY_STREAM_FRAME_KEYFRAME 0x01
+
+#pragma pack(push, 1)
+typedef struct {
+    uint32_t magic;   ///< SPF_TELEMETRY_STREAM_MAGIC
+    uint8_t version;  ///< SPF_TELEMETRY_STREAM_VERSION of the sender.
+    uint8_t type;     ///< SPF_TelemetryStreamPacketType
+    uint16_t reserved;
+} SPF_TelemetryStreamHeader;
+
+typedef struct {
+    uint32_t schema_id;          ///< Changes with every selection; frames carry it.
+    uint16_t known_field_count;  ///< SPF_TELEMETRY_FIELD_COUNT of the server.
+    uint16_t keyframe_interval;  ///< Frames between keyframes.
+    uint16_t field_count;        ///< Number of accepted fields that follow.
+} SPF_TelemetryStreamSchema;
+
+typedef struct {
+    uint32_t schema_id;
+    uint32_t sequence;      ///< Counts the frames sent to this client; a gap means a lost frame.
+    uint64_t frame_id;      ///< Telemetry frame number (see `SPF_TelemetryShmFrame::frame_id`).
+    uint64_t render_time;   ///< Render time of the frame. @unit microseconds
+    uint64_t publish_time;  ///< Monotonic clock of the game's machine when the frame was queued (QueryPerformanceCounter / CLOCK_MONOTONIC). @unit microseconds
+    uint8_t flags;          ///< SPF_TELEMETRY_STREAM_FRAME_*
+} SPF_TelemetryStreamFrame;
+#pragma pack(pop)
+
+#ifdef __cplusplus
+}
+#endif
@@ -125,6 +125,281 @@ typedef void (*SPF_Telemetry_GameplayEvents_Callback)(const char* event_id, cons
  */
 typedef void (*SPF_Telemetry_GearboxConstants_Callback)(const SPF_GearboxConstants* data, void* user_data);
 
+/**
+ * @brief Callback for the values the framework derives from the truck channels, fired every frame.
+ * @param data A pointer to the structure containing the derived values.
+ * @param user_data The custom pointer you provided when registering the callback.
+ */
+typedef void (*SPF_Telemetry_DerivedData_Callback)(const SPF_DerivedData* data, void* user_data);
+
+// =================================================================================================
+// Field Change Subscriptions
+// =================================================================================================
+// Instead of receiving a whole struct every frame, a plugin can name the individual values it
+// cares about and be called only when one of them changes.
+
+/**
+ * @brief Identifies a single scalar telemetry value for `RegisterForFieldChanges`.
+ * @note The values are stable; new fields are only ever appended before `SPF_TELEMETRY_FIELD_COUNT`.
+ */
+typedef enum {
+    // Game state / common
+    SPF_TELEMETRY_FIELD_GAME_PAUSED = 0,
+    SPF_TELEMETRY_FIELD_GAME_SCALE = 1,
+    SPF_TELEMETRY_FIELD_MULTIPLAYER_TIME_OFFSET = 2,
+    SPF_TELEMETRY_FIELD_GAME_TIME = 3,
+    SPF_TELEMETRY_FIELD_NEXT_REST_STOP = 4,
+
+    // Truck
+    SPF_TELEMETRY_FIELD_TRUCK_SPEED = 5,
+    SPF_TELEMETRY_FIELD_TRUCK_ENGINE_RPM = 6,
+    SPF_TELEMETRY_FIELD_TRUCK_GEAR = 7,
+    SPF_TELEMETRY_FIELD_TRUCK_DISPLAYED_GEAR = 8,
+    SPF_TELEMETRY_FIELD_TRUCK_CRUISE_CONTROL_SPEED = 9,
+    SPF_TELEMETRY_FIELD_TRUCK_HSHIFTER_SLOT = 10,
+    SPF_TELEMETRY_FIELD_TRUCK_PARKING_BRAKE = 11,
+    SPF_TELEMETRY_FIELD_TRUCK_MOTOR_BRAKE = 12,
+    SPF_TELEMETRY_FIELD_TRUCK_RETARDER_LEVEL = 13,
+    SPF_TELEMETRY_FIELD_TRUCK_AIR_PRESSURE = 14,
+    SPF_TELEMETRY_FIELD_TRUCK_AIR_PRESSURE_WARNING = 15,
+    SPF_TELEMETRY_FIELD_TRUCK_AIR_PRESSURE_EMERGENCY = 16,
+    SPF_TELEMETRY_FIELD_TRUCK_BRAKE_TEMPERATURE = 17,
+    SPF_TELEMETRY_FIELD_TRUCK_FUEL_AMOUNT = 18,
+    SPF_TELEMETRY_FIELD_TRUCK_FUEL_WARNING = 19,
+    SPF_TELEMETRY_FIELD_TRUCK_FUEL_AVERAGE_CONSUMPTION = 20,
+    SPF_TELEMETRY_FIELD_TRUCK_FUEL_RANGE = 21,
+    SPF_TELEMETRY_FIELD_TRUCK_ADBLUE_AMOUNT = 22,
+    SPF_TELEMETRY_FIELD_TRUCK_ADBLUE_WARNING = 23,
+    SPF_TELEMETRY_FIELD_TRUCK_OIL_PRESSURE = 24,
+    SPF_TELEMETRY_FIELD_TRUCK_OIL_PRESSURE_WARNING = 25,
+    SPF_TELEMETRY_FIELD_TRUCK_OIL_TEMPERATURE = 26,
+    SPF_TELEMETRY_FIELD_TRUCK_WATER_TEMPERATURE = 27,
+    SPF_TELEMETRY_FIELD_TRUCK_WATER_TEMPERATURE_WARNING = 28,
+    SPF_TELEMETRY_FIELD_TRUCK_BATTERY_VOLTAGE = 29,
+    SPF_TELEMETRY_FIELD_TRUCK_BATTERY_VOLTAGE_WARNING = 30,
+    SPF_TELEMETRY_FIELD_TRUCK_ELECTRIC_ENABLED = 31,
+    SPF_TELEMETRY_FIELD_TRUCK_ENGINE_ENABLED = 32,
+    SPF_TELEMETRY_FIELD_TRUCK_WIPERS = 33,
+    SPF_TELEMETRY_FIELD_TRUCK_DIFFERENTIAL_LOCK = 34,
+    SPF_TELEMETRY_FIELD_TRUCK_LIFT_AXLE = 35,
+    SPF_TELEMETRY_FIELD_TRUCK_LIFT_AXLE_INDICATOR = 36,
+    SPF_TELEMETRY_FIELD_TRUCK_TRAILER_LIFT_AXLE = 37,
+    SPF_TELEMETRY_FIELD_TRUCK_TRAILER_LIFT_AXLE_INDICATOR = 38,
+    SPF_TELEMETRY_FIELD_TRUCK_LBLINKER = 39,
+    SPF_TELEMETRY_FIELD_TRUCK_RBLINKER = 40,
+    SPF_TELEMETRY_FIELD_TRUCK_HAZARD_WARNING = 41,
+    SPF_TELEMETRY_FIELD_TRUCK_LIGHT_LBLINKER = 42,
+    SPF_TELEMETRY_FIELD_TRUCK_LIGHT_RBLINKER = 43,
+    SPF_TELEMETRY_FIELD_TRUCK_LIGHT_PARKING = 44,
+    SPF_TELEMETRY_FIELD_TRUCK_LIGHT_LOW_BEAM = 45,
+    SPF_TELEMETRY_FIELD_TRUCK_LIGHT_HIGH_BEAM = 46,
+    SPF_TELEMETRY_FIELD_TRUCK_LIGHT_AUX_FRONT = 47,
+    SPF_TELEMETRY_FIELD_TRUCK_LIGHT_AUX_ROOF = 48,
+    SPF_TELEMETRY_FIELD_TRUCK_LIGHT_BEACON = 49,
+    SPF_TELEMETRY_FIELD_TRUCK_LIGHT_BRAKE = 50,
+    SPF_TELEMETRY_FIELD_TRUCK_LIGHT_REVERSE = 51,
+    SPF_TELEMETRY_FIELD_TRUCK_DASHBOARD_BACKLIGHT = 52,
+    SPF_TELEMETRY_FIELD_TRUCK_WEAR_ENGINE = 53,
+    SPF_TELEMETRY_FIELD_TRUCK_WEAR_TRANSMISSION = 54,
+    SPF_TELEMETRY_FIELD_TRUCK_WEAR_CABIN = 55,
+    SPF_TELEMETRY_FIELD_TRUCK_WEAR_CHASSIS = 56,
+    SPF_TELEMETRY_FIELD_TRUCK_WEAR_WHEELS = 57,
+    SPF_TELEMETRY_FIELD_TRUCK_ODOMETER = 58,
+
+    // Controls
+    SPF_TELEMETRY_FIELD_USER_STEERING = 59,
+    SPF_TELEMETRY_FIELD_USER_THROTTLE = 60,
+    SPF_TELEMETRY_FIELD_USER_BRAKE = 61,
+    SPF_TELEMETRY_FIELD_USER_CLUTCH = 62,
+    SPF_TELEMETRY_FIELD_EFFECTIVE_STEERING = 63,
+    SPF_TELEMETRY_FIELD_EFFECTIVE_THROTTLE = 64,
+    SPF_TELEMETRY_FIELD_EFFECTIVE_BRAKE = 65,
+    SPF_TELEMETRY_FIELD_EFFECTIVE_CLUTCH = 66,
+
+    // Job
+    SPF_TELEMETRY_FIELD_JOB_CARGO_DAMAGE = 67,
+    SPF_TELEMETRY_FIELD_JOB_REMAINING_DELIVERY_MINUTES = 68,
+
+    // Navigation
+    SPF_TELEMETRY_FIELD_NAVIGATION_DISTANCE = 69,
+    SPF_TELEMETRY_FIELD_NAVIGATION_TIME = 70,
+    SPF_TELEMETRY_FIELD_NAVIGATION_SPEED_LIMIT = 71,
+    SPF_TELEMETRY_FIELD_NAVIGATION_TIME_REAL_SECONDS = 72,
+
+    // Derived (see SPF_DerivedData)
+    SPF_TELEMETRY_FIELD_DERIVED_LONGITUDINAL_G = 73,
+    SPF_TELEMETRY_FIELD_DERIVED_LATERAL_G = 74,
+    SPF_TELEMETRY_FIELD_DERIVED_VERTICAL_G = 75,
+    SPF_TELEMETRY_FIELD_DERIVED_JERK = 76,
+    SPF_TELEMETRY_FIELD_DERIVED_MAX_WHEEL_SLIP = 77,
+    SPF_TELEMETRY_FIELD_DERIVED_FUEL_ECONOMY = 78,
+    SPF_TELEMETRY_FIELD_DERIVED_TRIP_FUEL_ECONOMY = 79,
+    SPF_TELEMETRY_FIELD_DERIVED_FUEL_RATE = 80,
+    SPF_TELEMETRY_FIELD_DERIVED_TIME_TO_EMPTY = 81,
+
+    SPF_TELEMETRY_FIELD_COUNT = 82
+} SPF_Telemetry_Field;
+
+/**
+ * @brief Groups of SDK channels the framework registers with the game on demand (see
+ *        `DemandChannelGroups`). Combine them with `|`. Common data is always registered.
+ */
+typedef enum {
+    SPF_TELEMETRY_CHANNEL_GROUP_JOB = 1u << 1,          // Cargo damage
+    SPF_TELEMETRY_CHANNEL_GROUP_NAVIGATION = 1u << 2,   // Navigation distance, time and speed limit
+    SPF_TELEMETRY_CHANNEL_GROUP_TRUCK = 1u << 3,        // Dashboard, lights, brakes, wear, gears
+    SPF_TELEMETRY_CHANNEL_GROUP_TRUCK_MOTION = 1u << 4, // Placement, velocities, accelerations, cabin and head offsets
+    SPF_TELEMETRY_CHANNEL_GROUP_TRUCK_WHEELS = 1u << 5, // Per-wheel channels of the truck
+    SPF_TELEMETRY_CHANNEL_GROUP_CONTROLS = 1u << 6,     // User and effective input
+    SPF_TELEMETRY_CHANNEL_GROUP_TRAILERS = 1u << 7,     // Per-trailer channels, including trailer wheels
+    SPF_TELEMETRY_CHANNEL_GROUP_ALL = 0xFEu
+} SPF_Telemetry_Channel_Group;
+
+/**
+ * @brief How small changes of a subscribed field are filtered out.
+ */
+typedef enum {
+    SPF_TELEMETRY_DEADBAND_NONE = 0,     // Report every change.
+    SPF_TELEMETRY_DEADBAND_ABSOLUTE = 1, // Report when |value - last reported| > deadband.
+    SPF_TELEMETRY_DEADBAND_RELATIVE = 2  // Report when |value - last reported| > deadband * |last reported|.
+} SPF_Telemetry_Deadband_Mode;
+
+/**
+ * @brief Describes one field a plugin wants to be notified about.
+ */
+typedef struct {
+    SPF_Telemetry_Field field;
+    SPF_Telemetry_Deadband_Mode deadband_mode;
+    double deadband; // Ignored for SPF_TELEMETRY_DEADBAND_NONE.
+} SPF_Telemetry_FieldSubscription;
+
+/**
+ * @brief A single reported change. Booleans are reported as 0.0 / 1.0.
+ */
+typedef struct {
+    SPF_Telemetry_Field field;
+    double value;    // The new value.
+    double previous; // The value last reported for this field (or the value at registration).
+} SPF_Telemetry_FieldChange;
+
+/**
+ * @brief Callback for field change subscriptions. Called at most once per frame with all
+ *        subscribed fields that passed their deadband in that frame.
+ * @param changes An array of changes, valid only for the duration of the call.
+ * @param count The number of elements in `changes` (always at least 1).
+ * @param user_data The custom pointer you provided when registering the callback.
+ */
+typedef void (*SPF_Telemetry_FieldChanges_Callback)(const SPF_Telemetry_FieldChange* changes, uint32_t count, void* user_data);
+
+/**
+ * @brief Aggregate of one field over one window. Booleans aggregate as 0.0 / 1.0.
+ */
+typedef struct {
+    SPF_Telemetry_Field field;
+    double min;
+    double max;
+    double mean;           // Weighted by the render time each frame covers.
+    double last;           // The value in the last frame of the window.
+    uint32_t sample_count; // The number of frames sampled in the window.
+} SPF_Telemetry_FieldAggregate;
+
+/**
+ * @brief Callback for windowed aggregate subscriptions. Called once per closed window.
+ * @param aggregates An array with one entry per subscribed field, valid only for the duration of the call.
+ * @param count The number of elements in `aggregates`.
+ * @param window_start Start of the window, in render time (microseconds, see `SPF_Timestamps::render`).
+ * @param window_end End of the window (exclusive), in render time.
+ * @param user_data The custom pointer you provided when registering the callback.
+ */
+typedef void (*SPF_Telemetry_FieldAggregates_Callback)(const SPF_Telemetry_FieldAggregate* aggregates, uint32_t count, uint64_t window_start, uint64_t window_end, void* user_data);
+
+/**
+ * @brief Callback for single channel subscriptions (see `RegisterForChannel`).
+ * @param value The channel value, valid only for the duration of the call.
+ * @param user_data The custom pointer you provided when registering the callback.
+ */
+typedef void (*SPF_Telemetry_Channel_Callback)(const SPF_Telemetry_ChannelValue* value, void* user_data);
+
+/**
+ * @brief How a trigger condition compares its field with the threshold.
+ */
+typedef enum {
+    SPF_TELEMETRY_COMPARE_GREATER = 0,
+    SPF_TELEMETRY_COMPARE_GREATER_EQUAL = 1,
+    SPF_TELEMETRY_COMPARE_LESS = 2,
+    SPF_TELEMETRY_COMPARE_LESS_EQUAL = 3,
+    SPF_TELEMETRY_COMPARE_EQUAL = 4,    // |value - threshold| <= hysteresis
+    SPF_TELEMETRY_COMPARE_NOT_EQUAL = 5 // |value - threshold| > hysteresis
+} SPF_Telemetry_Compare_Op;
+
+/**
+ * @brief One condition of a trigger (see `RegisterForTrigger`). Booleans compare as 0.0 / 1.0.
+ */
+typedef struct {
+    SPF_Telemetry_Field field;
+    SPF_Telemetry_Compare_Op op;
+    double threshold;
+    // For the ordering operators, how far the value must move back past the threshold before
+    // a condition that holds stops holding. For EQUAL / NOT_EQUAL, the tolerance. 0 for none.
+    double hysteresis;
+} SPF_Telemetry_TriggerCondition;
+
+/**
+ * @brief Which transitions of a trigger are reported.
+ */
+typedef enum {
+    SPF_TELEMETRY_TRIGGER_EDGE_RISING = 0,  // The conditions started to hold.
+    SPF_TELEMETRY_TRIGGER_EDGE_FALLING = 1, // The conditions stopped holding.
+    SPF_TELEMETRY_TRIGGER_EDGE_BOTH = 2
+} SPF_Telemetry_Trigger_Edge;
+
+/**
+ * @brief Timing and reporting of a trigger.
+ */
+typedef struct {
+    uint32_t hold_ms;    // How long all conditions must hold before the trigger activates.
+    uint32_t release_ms; // How long they must stay broken before it deactivates.
+    SPF_Telemetry_Trigger_Edge edge;
+} SPF_Telemetry_TriggerOptions;
+
+/**
+ * @brief A transition of a trigger.
+ */
+typedef struct {
+    bool active;                   // true when the trigger activated, false when it deactivated.
+    uint64_t render_time;          // Render time of the transition (microseconds, see `SPF_Timestamps::render`).
+    uint64_t previous_duration_us; // How long the trigger was in its previous state.
+} SPF_Telemetry_TriggerEvent;
+
+/**
+ * @brief Callback for triggers (see `RegisterForTrigger`).
+ * @param event The transition, valid only for the duration of the call.
+ * @param user_data The custom pointer you provided when registering the callback.
+ */
+typedef void (*SPF_Telemetry_Trigger_Callback)(const SPF_Telemetry_TriggerEvent* event, void* user_data);
+
+/**
+ * @brief One point of a field's recorded history (see `GetFieldHistory`).
+ */
+typedef struct {
+    uint64_t time; // Render time (microseconds, see `SPF_Timestamps::render`); for downsampled points, the start of the bucket.
+    float value;   // The sample, or the mean of the samples the point stands for.
+    float min;     // Range of the samples the point stands for, including those
+    float max;     // dropped by decimation.
+} SPF_Telemetry_HistoryPoint;
+
+/**
+ * @brief Recent durations of one timed section (a stage of the telemetry service, C struct
+ *        conversion, or one plugin subscription), computed from its last 1024 to 2048 samples.
+ */
+typedef struct {
+    char name[SPF_TELEMETRY_STRING_MAX_SIZE]; // E.g. "Service: derived channels" or "MyPlugin: TruckData".
+    uint64_t sample_count;
+    double p50_us; // Median, in microseconds (resolution about 12%).
+    double p99_us;
+    double max_us;
+} SPF_Telemetry_TimingStats;
+
 
 /**
  * @struct SPF_Telemetry_API
@@ -263,9 +538,11 @@ typedef struct SPF_Telemetry_API {
     SPF_Telemetry_Callback_Handle* (*RegisterForTruckData)(SPF_Telemetry_Handle* handle, SPF_Telemetry_TruckData_Callback callback, void* user_data);
 
     /**
-     * @brief Registers a callback for live trailer data updates, fired every frame.
+     * @brief Registers a callback for live trailer data updates.
      * @details The callback receives a pointer to an array of `SPF_Trailer` structs and a count.
      *          This list is automatically filtered by the framework to only include active trailers.
+     *          It fires at a frame start only if a channel value or the configuration of any trailer
+     *          changed since the previous frame start; frames in which no trailer changed are skipped.
      * @param handle The telemetry context handle for your plugin.
      * @param callback The function to be called when trailer data is updated.
      * @param user_data Optional user-defined data to be passed to the callback.
@@ -458,6 +735,318 @@ typedef struct SPF_Telemetry_API {
      */
     int (*GetLastGameplayEventId)(SPF_Telemetry_Handle* handle, char* out_buffer, int buffer_size);
 
+    /**
+     * @brief Registers a callback for changes of individual telemetry fields.
+     *
+     * The callback runs at frame start, only in frames where at least one of the subscribed
+     * fields changed by more than its deadband. The value at registration is the initial
+     * baseline, so no call is made for it. A change that stays inside the deadband does not
+     * move the baseline, so slow drifts are still reported once they add up.
+     *
+     * @param handle The telemetry context handle.
+     * @param subscriptions An array of fields to watch. Copied; need not outlive the call.
+     * @param count The number of elements in `subscriptions`.
+     * @param callback The function to call with the batch of changes.
+     * @param user_data A custom pointer that will be passed back to your callback.
+     * @return A handle for the subscription, or NULL if the arguments are invalid (e.g. an unknown field).
+     */
+    SPF_Telemetry_Callback_Handle* (*RegisterForFieldChanges)(SPF_Telemetry_Handle* handle, const SPF_Telemetry_FieldSubscription* subscriptions, uint32_t count, SPF_Telemetry_FieldChanges_Callback callback, void* user_data);
+
+    /**
+     * @brief Registers a callback for min/max/mean/last of fields over fixed windows.
+     *
+     * Windows are aligned to multiples of `window_ms` on the render clock and close at the
+     * first frame past their end, so the callback runs at roughly 1000 / `window_ms` Hz.
+     * Aggregates are computed once per frame by the framework and shared by every plugin
+     * that uses the same window length.
+     *
+     * @param handle The telemetry context handle.
+     * @param fields An array of fields to aggregate. Copied; need not outlive the call.
+     * @param count The number of elements in `fields`.
+     * @param window_ms The window length in milliseconds (at least 1).
+     * @param callback The function to call with the results of each window.
+     * @param user_data A custom pointer that will be passed back to your callback.
+     * @return A handle for the subscription, or NULL if the arguments are invalid.
+     */
+    SPF_Telemetry_Callback_Handle* (*RegisterForFieldAggregates)(SPF_Telemetry_Handle* handle, const SPF_Telemetry_Field* fields, uint32_t count, uint32_t window_ms, SPF_Telemetry_FieldAggregates_Callback callback, void* user_data);
+
+    /**
+     * @brief Limits how often a subscription's callback is invoked.
+     *
+     * Deliveries are spaced at least 1 / `rate_hz` seconds apart on the render clock; events in
+     * between are skipped (a skipped struct update is superseded by the next one). Field change
+     * subscriptions keep collecting the fields that changed in skipped frames and report them
+     * at the next delivery. Gameplay event, aggregate, channel and trigger subscriptions cannot be rate-limited.
+     *
+     * @param handle The telemetry context handle the subscription was registered with.
+     * @param callback_handle The subscription returned by a `RegisterFor...()` function.
+     * @param rate_hz The maximum delivery rate; 0 removes the limit.
+     * @return true on success, false if the subscription is unknown or cannot be rate-limited.
+     */
+    bool (*SetCallbackRate)(SPF_Telemetry_Handle* handle, SPF_Telemetry_Callback_Handle* callback_handle, float rate_hz);
+
+    /**
+     * @brief Retrieves the values derived from the truck channels (g-forces, wheel slip, fuel economy, ...).
+     * @param handle The telemetry context handle.
+     * @param[out] out_data Pointer to an `SPF_DerivedData` struct to be filled with data.
+     */
+    void (*GetDerivedData)(SPF_Telemetry_Handle* handle, SPF_DerivedData* out_data);
+
+    /**
+     * @brief Registers a callback for the derived values, fired every frame after the truck data callback.
+     * @param handle The telemetry context handle for your plugin.
+     * @param callback The function to be called with the derived values.
+     * @param user_data Optional user-defined data to be passed to the callback.
+     * @return An opaque handle that represents the subscription. Its lifetime is managed automatically
+     *         by the parent `SPF_Telemetry_Handle`.
+     */
+    SPF_Telemetry_Callback_Handle* (*RegisterForDerivedData)(SPF_Telemetry_Handle* handle, SPF_Telemetry_DerivedData_Callback callback, void* user_data);
+
+    /**
+     * @brief Returns the framework's read-only view of the current frame, without copying it.
+     *
+     * The view is built at most once per frame (on the first call after the frame started) and
+     * shared by all plugins. The returned pointer and the contents stay valid until the next
+     * frame starts; do not keep it across frames, call `GetView` again instead. Call it from the
+     * game thread (e.g. `OnUpdate` or a telemetry callback).
+     *
+     * The view holds every struct, so unless the plugin has called `DemandChannelGroups`, the
+     * first call makes the framework register all channel groups with the game (thousands of
+     * channel callbacks per second with trailers attached) for as long as the handle lives.
+     * Plugins that read only part of the view should call `DemandChannelGroups` first; the
+     * members outside the demanded groups then keep their last received values.
+     *
+     * @param handle The telemetry context handle.
+     * @param version Pass SPF_TELEMETRY_VIEW_VERSION. NULL is returned if the framework's
+     *        layout version differs, i.e. the plugin was built against an incompatible header.
+     * @param[out] out_frame_sequence Optional. Receives `frame_sequence` of the returned view.
+     * @return The view, or NULL if telemetry is unavailable or the version does not match.
+     *         Use SPF_STRUCT_HAS_MEMBER before reading members added after the plugin's header.
+     */
+    const SPF_TelemetryView* (*GetView)(SPF_Telemetry_Handle* handle, uint32_t version, uint64_t* out_frame_sequence);
+
+    /**
+     * @brief Gets the sequence number of the most recent gameplay event, or 0 if none was recorded.
+     *
+     * The framework keeps the last events (at least 128) with their timestamps and attributes,
+     * so plugins do not need to watch `RegisterForGameplayEvents` or the special event flags
+     * every frame to see them all.
+     *
+     * @param handle The telemetry context handle.
+     */
+    uint64_t (*GetLatestGameplayEventSequence)(SPF_Telemetry_Handle* handle);
+
+    /**
+     * @brief Reads the gameplay events the plugin has not read yet, oldest first.
+     *
+     * Each context handle has its own read cursor. It starts before the oldest event still
+     * held and advances past every event returned, so calling this from time to time (e.g.
+     * in `OnUpdate`) delivers each event once. Call repeatedly while it returns `max_count`.
+     *
+     * @param handle The telemetry context handle.
+     * @param[out] out_events Array that receives the events.
+     * @param max_count The number of elements in `out_events`.
+     * @param[out] out_missed Optional. Receives the number of unread events that were
+     *        overwritten by newer ones before this call and are lost.
+     * @return The number of events written to `out_events`.
+     */
+    uint32_t (*ReadGameplayEvents)(SPF_Telemetry_Handle* handle, SPF_GameplayEventRecord* out_events, uint32_t max_count, uint64_t* out_missed);
+
+    /**
+     * @brief Moves the handle's read cursor, e.g. to `GetLatestGameplayEventSequence()` to skip
+     *        everything that happened before the plugin was loaded.
+     * @param handle The telemetry context handle.
+     * @param sequence The sequence of the last event to treat as read.
+     */
+    void (*SetGameplayEventCursor)(SPF_Telemetry_Handle* handle, uint64_t sequence);
+
+    /**
+     * @brief Finds events in the history without touching the handle's read cursor.
+     * @param handle The telemetry context handle.
+     * @param after_sequence Only events with a greater sequence are returned; 0 for all.
+     * @param event_id Only events with this id are returned (e.g. "player.fined"); NULL for all.
+     * @param[out] out_events Array that receives the events, oldest first.
+     * @param max_count The number of elements in `out_events`.
+     * @return The number of events written to `out_events`.
+     */
+    uint32_t (*QueryGameplayEvents)(SPF_Telemetry_Handle* handle, uint64_t after_sequence, const char* event_id, SPF_GameplayEventRecord* out_events, uint32_t max_count);
+
+    /**
+     * @brief Gets the frame timing statistics of the telemetry service and of all plugin subscriptions.
+     *
+     * Timing is compiled into the framework only when it is built with SPF_TELEMETRY_TIMING;
+     * otherwise this always returns 0.
+     *
+     * @param handle The telemetry context handle.
+     * @param[out] out_stats Array that receives the sections; may be NULL to query the count.
+     * @param max_count The number of elements in `out_stats`.
+     * @return The total number of timed sections, which may exceed `max_count`.
+     */
+    uint32_t (*GetTimingStats)(SPF_Telemetry_Handle* handle, SPF_Telemetry_TimingStats* out_stats, uint32_t max_count);
+
+    /**
+     * @brief Gets how long the framework spends delivering one of your subscriptions, including your callback.
+     * @param handle The telemetry context handle the subscription was registered with.
+     * @param callback_handle The subscription returned by a `RegisterFor...()` function.
+     * @param[out] out_stats Receives the statistics; `name` is left empty.
+     * @return false if the subscription is unknown or timing is not compiled in.
+     */
+    bool (*GetCallbackTiming)(SPF_Telemetry_Handle* handle, SPF_Telemetry_Callback_Handle* callback_handle, SPF_Telemetry_TimingStats* out_stats);
+
+    /**
+     * @brief Gets the truck placements smoothed to the frame that is being rendered.
+     *
+     * The game updates `world_placement`, `cabin_offset` and `head_offset` once per
+     * simulation step, which at high refresh rates is less often than once per frame.
+     * The framework keeps the placements of the last two steps and evaluates them at the
+     * render time of each visual frame, interpolating between the steps or extrapolating
+     * past the latest one by at most one step. Use this instead of `GetTruckData` for
+     * anything drawn on screen.
+     *
+     * @param handle The telemetry context handle.
+     * @param[out] out_data Receives the placements.
+     */
+    void (*GetInterpolatedPlacements)(SPF_Telemetry_Handle* handle, SPF_InterpolatedPlacements* out_data);
+
+    /**
+     * @brief Registers a callback for a single SDK channel, without any struct conversion.
+     *
+     * The channel name is resolved once, at registration. At every frame start for which
+     * the channel has a value, the callback receives it as the game sent it. Only the
+     * channel's group is registered with the game on behalf of this subscription.
+     *
+     * @param handle The telemetry context handle.
+     * @param channel The SDK channel name, e.g. "truck.engine.rpm", "truck.wheel.steering"
+     *        or "trailer.0.cargo.damage".
+     * @param index The element of an indexed channel (wheels, H-shifter selectors), or
+     *        UINT32_MAX for channels without an index.
+     * @param changes_only If true, the callback only runs in frames in which the value
+     *        changed (and once for the first value).
+     * @param callback The function to call with the value.
+     * @param user_data A custom pointer that will be passed back to your callback.
+     * @return A handle for the subscription, or NULL if the channel or index is unknown.
+     */
+    SPF_Telemetry_Callback_Handle* (*RegisterForChannel)(SPF_Telemetry_Handle* handle, const char* channel, uint32_t index, bool changes_only, SPF_Telemetry_Channel_Callback callback, void* user_data);
+
+    /**
+     * @brief Registers a trigger: a callback for when a set of field conditions starts or
+     *        stops holding, e.g. "speed > 90 for 5 s" or "parking brake released while the
+     *        engine is off".
+     *
+     * The framework evaluates the triggers of all plugins together once per frame start and
+     * only calls back on the transitions selected by `options->edge`, so there is no need to
+     * poll the fields or keep timers. A trigger starts inactive: conditions that already hold
+     * at registration activate it once they have held for `hold_ms`.
+     *
+     * @param handle The telemetry context handle.
+     * @param conditions The conditions, all of which must hold. Copied; need not outlive the call.
+     * @param count The number of elements in `conditions`.
+     * @param options Hold and release durations and the edges to report, or NULL for an
+     *        immediate rising edge. Copied.
+     * @param callback The function to call on each reported transition.
+     * @param user_data A custom pointer that will be passed back to your callback.
+     * @return A handle for the subscription, or NULL if the arguments are invalid (e.g. an unknown field).
+     */
+    SPF_Telemetry_Callback_Handle* (*RegisterForTrigger)(SPF_Telemetry_Handle* handle, const SPF_Telemetry_TriggerCondition* conditions, uint32_t count, const SPF_Telemetry_TriggerOptions* options, SPF_Telemetry_Trigger_Callback callback, void* user_data);
+
+    /**
+     * @brief Gets the size of the route recorded by the framework.
+     *
+     * The framework records the path the truck drives, simplified to within 1 m and stored
+     * compactly, so plugins do not need to keep their own position history. Recording runs
+     * while any plugin uses the route functions (or reads the truck's motion channels) and
+     * the game is not paused.
+     *
+     * @param handle The telemetry context handle.
+     * @param[out] out_info Receives the statistics.
+     */
+    void (*GetRouteInfo)(SPF_Telemetry_Handle* handle, SPF_RouteInfo* out_info);
+
+    /**
+     * @brief Finds the closest position on the recorded route, measured horizontally (x/z).
+     *
+     * The returned position is interpolated along the route, including its time and heading.
+     *
+     * @param handle The telemetry context handle.
+     * @param x World x coordinate of the query position.
+     * @param z World z coordinate of the query position.
+     * @param max_distance Positions further away than this are ignored. Keep it as small as
+     *        the use allows; the search grows with it. `INFINITY` or `DBL_MAX` search the
+     *        whole route. @unit meters
+     * @param[out] out_point Receives the closest position.
+     * @param[out] out_distance Receives the distance to it. May be NULL.
+     * @return false if no part of the route lies within `max_distance`, or if `x` or `z` is
+     *         not finite or `max_distance` is NaN.
+     */
+    bool (*FindNearestRoutePoint)(SPF_Telemetry_Handle* handle, double x, double z, double max_distance, SPF_RoutePoint* out_point, double* out_distance);
+
+    /**
+     * @brief Gets the kept route positions within an x/z bounding box, e.g. to draw a minimap.
+     *
+     * @param handle The telemetry context handle.
+     * @param min_x, min_z, max_x, max_z The box, in world coordinates. Edges may be
+     *        `-INFINITY`/`INFINITY` for an unbounded side.
+     * @param[out] out_points An array that receives up to `max_count` positions. May be NULL if `max_count` is 0.
+     * @param max_count The capacity of `out_points`.
+     * @return The number of positions in the box, which may be larger than `max_count`;
+     *         0 if an edge is NaN.
+     */
+    uint32_t (*GetRoutePointsInBox)(SPF_Telemetry_Handle* handle, double min_x, double min_z, double max_x, double max_z, SPF_RoutePoint* out_points, uint32_t max_count);
+
+    /**
+     * @brief Writes the recorded route to a `.spfroute` file.
+     *
+     * @param handle The telemetry context handle.
+     * @param path The destination file; it is overwritten.
+     * @return false if the file could not be written.
+     */
+    bool (*SaveRoute)(SPF_Telemetry_Handle* handle, const char* path);
+
+    /**
+     * @brief Starts recording fields in the framework's shared history.
+     *
+     * The framework keeps every frame of the last couple of minutes, and min/max/mean per
+     * second for 15 minutes and per ten seconds for 2 hours, for the fields any consumer
+     * records, so plugins that draw graphs do not need their own history arrays. History
+     * starts when a field is first recorded. The fields stay recorded until the plugin
+     * releases its telemetry handle.
+     *
+     * @param handle The telemetry context handle.
+     * @param fields The fields to record. Copied; need not outlive the call.
+     * @param count The number of elements in `fields`.
+     * @return false if the arguments are invalid (e.g. an unknown field).
+     */
+    bool (*RecordFieldHistory)(SPF_Telemetry_Handle* handle, const SPF_Telemetry_Field* fields, uint32_t count);
+
+    /**
+     * @brief Reads the recorded history of a field, decimated to at most `max_points` points.
+     *
+     * Pass the width of the graph in pixels as `max_points`: the coarsest resolution that
+     * still has a point per pixel is chosen and reduced to `max_points` with
+     * Largest-Triangle-Three-Buckets, which keeps the shape of the series. Each point's
+     * min/max covers the samples it replaces, so spikes can be drawn as an envelope.
+     *
+     * @param handle The telemetry context handle.
+     * @param field A field recorded with `RecordFieldHistory` (by any consumer).
+     * @param from_time, to_time The range, in render time (microseconds, see `SPF_Timestamps::render`).
+     * @param[out] out_points An array that receives the points, oldest first.
+     * @param max_points The capacity of `out_points`; at least 3.
+     * @return The number of points written; 0 if the field is not recorded.
+     */
+    uint32_t (*GetFieldHistory)(SPF_Telemetry_Handle* handle, SPF_Telemetry_Field field, uint64_t from_time, uint64_t to_time, SPF_Telemetry_HistoryPoint* out_points, uint32_t max_points);
+
+    /**
+     * @brief Declares the channel groups the plugin reads through `GetView`.
+     *
+     * The groups stay registered until the plugin releases its telemetry handle. Once a plugin
+     * has called this, `GetView` no longer registers all groups for it. The polling getters
+     * and subscriptions still register the groups they need themselves.
+     *
+     * @param handle The telemetry context handle.
+     * @param groups A combination of `SPF_Telemetry_Channel_Group` flags.
+     */
+    void (*DemandChannelGroups)(SPF_Telemetry_Handle* handle, uint32_t groups);
+
 } SPF_Telemetry_API;
 
 #ifdef __cplusplus
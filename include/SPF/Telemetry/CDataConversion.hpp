@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/SPF_API/SPF_TelemetryData.h"
+#include "SPF/Telemetry/SCS/Common.hpp"
+#include "SPF/Telemetry/SCS/Truck.hpp"
+#include "SPF/Telemetry/SCS/Trailer.hpp"
+#include "SPF/Telemetry/SCS/Job.hpp"
+#include "SPF/Telemetry/SCS/Navigation.hpp"
+#include "SPF/Telemetry/SCS/Controls.hpp"
+#include "SPF/Telemetry/SCS/Events.hpp"
+#include "SPF/Telemetry/SCS/Gearbox.hpp"
+#include "SPF/Telemetry/ChannelSubscriptions.hpp"
+#include "SPF/Telemetry/DerivedChannels.hpp"
+#include "SPF/Telemetry/GameplayEventHistory.hpp"
+#include "SPF/Telemetry/PlacementInterpolator.hpp"
+#include "SPF/Telemetry/RouteStore.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+struct TelemetrySnapshot;
+}
+
+namespace Telemetry::Conversion {
+// =================================================================================================
+// C++ -> C Conversion
+// =================================================================================================
+// Each function fills a C-API struct (SPF_TelemetryData.h) from its C++ counterpart. Strings
+// and arrays are truncated to the fixed C sizes. None of the converters allocate, so they
+// can write straight into caller-owned or shared storage.
+
+inline SPF_FVector ToC(const scs_value_fvector_t& v) { return {v.x, v.y, v.z}; }
+inline SPF_Placement ToC(const scs_value_fplacement_t& p) { return {{p.position.x, p.position.y, p.position.z}, {p.orientation.heading, p.orientation.pitch, p.orientation.roll}}; }
+inline SPF_DPlacement ToC(const scs_value_dplacement_t& p) { return {{p.position.x, p.position.y, p.position.z}, {p.orientation.heading, p.orientation.pitch, p.orientation.roll}}; }
+
+const char* GameToString(SPF::Game game);
+
+void ConvertGameState(const SCS::GameState& cpp_data, SPF_GameState& c_data);
+void ConvertTimestamps(const SCS::Timestamps& cpp_data, SPF_Timestamps& c_data);
+void ConvertCommonData(const SCS::CommonData& cpp_data, SPF_CommonData& c_data);
+void ConvertWheelConstants(const std::vector<SCS::WheelConstants>& cpp_wheels, uint32_t count, SPF_WheelConstants* c_wheels);
+void ConvertWheelData(const SCS::WheelDataStore& cpp_wheels, uint32_t count, SPF_WheelData* c_wheels);
+void ConvertTruckConstants(const SCS::TruckConstants& cpp_data, SPF_TruckConstants& c_data);
+void ConvertTruckData(const SCS::TruckData& cpp_data, const SCS::TruckConstants& cpp_consts, SPF_TruckData& c_data);
+void ConvertTrailerConstants(const SCS::TrailerConstants& cpp_consts, SPF_TrailerConstants& c_consts);
+void ConvertTrailer(const SCS::Trailer& cpp_trailer, SPF_Trailer& c_trailer);
+void ConvertJobConstants(const SCS::JobConstants& cpp_data, SPF_JobConstants& c_data);
+void ConvertJobData(const SCS::JobData& cpp_data, SPF_JobData& c_data);
+void ConvertNavigationData(const SCS::NavigationData& cpp_data, SPF_NavigationData& c_data);
+void ConvertControls(const SCS::Controls& cpp_data, SPF_Controls& c_data);
+void ConvertSpecialEvents(const SCS::SpecialEvents& cpp_data, SPF_SpecialEvents& c_data);
+void ConvertGameplayEvents(const SCS::GameplayEvents& cpp_data, SPF_GameplayEvents& c_data);
+void ConvertGearboxConstants(const SCS::GearboxConstants& cpp_data, SPF_GearboxConstants& c_data);
+void ConvertDerivedData(const DerivedData& cpp_data, SPF_DerivedData& c_data);
+void ConvertRecordedEvent(const RecordedEvent& cpp_data, SPF_GameplayEventRecord& c_data);
+void ConvertInterpolatedPlacements(const InterpolatedPlacements& cpp_data, SPF_InterpolatedPlacements& c_data);
+void ConvertChannelValue(const ChannelValue& cpp_data, SPF_Telemetry_ChannelValue& c_data);
+void ConvertRoutePoint(const RoutePoint& cpp_data, SPF_RoutePoint& c_data);
+
+/**
+ * @brief Fills every member of a telemetry view from a snapshot, including its header.
+ */
+void ConvertTelemetryView(const TelemetrySnapshot& snapshot, SPF_TelemetryView& c_view);
+
+}  // namespace Telemetry::Conversion
+SPF_NS_END
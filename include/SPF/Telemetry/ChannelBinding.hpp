@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/Telemetry/SCS/Common.hpp"
+#include "SPF/Telemetry/Sdk.hpp"
+#include "SPF/Telemetry/TelemetryFields.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+/**
+ * @struct ChannelTap
+ * @brief Raw copies of the values a binding receives, kept while plugins subscribe to the channel itself.
+ *
+ * Indexed channels (wheels, selectors) share one binding for all indices, so the tap holds
+ * one slot per index; channels without an index use slot 0. Values for indices without a
+ * slot are ignored.
+ */
+struct ChannelTap {
+  struct Slot {
+    scs_value_t value = {};
+    bool received = false;  // A value arrived since the tap was installed.
+    bool changed = false;   // The value changed since the changes were last cleared.
+  };
+
+  std::vector<Slot> slots;
+
+  static size_t SlotIndex(scs_u32_t index) { return index == SCS_U32_NIL ? 0 : index; }
+
+  void Capture(scs_u32_t index, const scs_value_t& value);
+  void ClearChanges() {
+    for (auto& slot : slots) slot.changed = false;
+  }
+};
+
+/**
+ * @struct ChannelBinding
+ * @brief A pre-resolved destination for a single registered SDK channel.
+ *
+ * Each `register_for_channel` call receives its own ChannelBinding as the callback
+ * context. When the game delivers a value, the binding writes it straight into the
+ * field it was created for, so no channel-name matching happens at runtime.
+ * A binding can also track a Field: when a write actually changes the stored value,
+ * the field's bit is set in the tracking mask (see Track()); trailer bindings mark their
+ * trailer's bit the same way (see TrackTrailer()).
+ *
+ * Bindings are handed to the SDK by address and must stay alive (and must not move)
+ * for as long as the channel is registered.
+ */
+struct ChannelBinding {
+  /// Writes the value into `target`; returns true if the stored value changed.
+  using WriteFn = bool (*)(void* target, scs_u32_t index, const scs_value_t& value);
+  using NotifyFn = void (*)(void* owner);
+
+  void* target = nullptr;      // The field (or container) the value is written into.
+  WriteFn write = nullptr;     // Typed writer for `target`.
+  void* owner = nullptr;       // Optional object passed to `notify`.
+  NotifyFn notify = nullptr;   // Optional hook run after the value was written.
+  FieldMask* changes = nullptr;  // Optional mask that receives `field` on change.
+  Field field = Field::Count;
+  TrailerMask* trailerChanges = nullptr;  // Optional mask that receives `trailer` on change.
+  uint32_t trailer = 0;
+  ChannelTap* tap = nullptr;     // Optional raw copy of every value, see ChannelSubscriptionRegistry.
+
+  /**
+   * @brief Returns a copy of this binding that marks `trackedField` in `mask` whenever the value changes.
+   */
+  ChannelBinding Track(FieldMask& mask, Field trackedField) const {
+    ChannelBinding tracked = *this;
+    tracked.changes = &mask;
+    tracked.field = trackedField;
+    return tracked;
+  }
+
+  /**
+   * @brief Returns a copy of this binding that marks `trailerIndex` in `mask` whenever the value changes.
+   */
+  ChannelBinding TrackTrailer(TrailerMask& mask, uint32_t trailerIndex) const {
+    ChannelBinding tracked = *this;
+    tracked.trailerChanges = &mask;
+    tracked.trailer = trailerIndex;
+    return tracked;
+  }
+
+  /**
+   * @brief The single channel callback registered with the SDK for every bound channel.
+   * @param context A pointer to the ChannelBinding that was passed on registration.
+   */
+  static void StaticChannelCallback(const scs_string_t name, const scs_u32_t index, const scs_value_t* value, scs_context_t context);
+};
+
+namespace ChannelWriters {
+// --- Value extraction, one overload per SDK value type we bind to ---
+inline void Read(const scs_value_t& value, bool& out) { out = value.value_bool.value != 0; }
+inline void Read(const scs_value_t& value, int32_t& out) { out = value.value_s32.value; }
+inline void Read(const scs_value_t& value, uint32_t& out) { out = value.value_u32.value; }
+inline void Read(const scs_value_t& value, float& out) { out = value.value_float.value; }
+inline void Read(const scs_value_t& value, scs_value_fvector_t& out) { out = value.value_fvector; }
+inline void Read(const scs_value_t& value, scs_value_fplacement_t& out) { out = value.value_fplacement; }
+inline void Read(const scs_value_t& value, scs_value_dplacement_t& out) { out = value.value_dplacement; }
+
+/// Stores `value` into `out`. Returns true if the stored value changed.
+template <typename T>
+bool Assign(T& out, const T& value) {
+  if constexpr (std::is_arithmetic_v<T>) {
+    if (out == value) return false;
+  } else {
+    // SDK vector/placement structs have no operator==; they are plain data.
+    if (std::memcmp(&out, &value, sizeof(T)) == 0) return false;
+  }
+  out = value;
+  return true;
+}
+
+/// Writes a non-indexed channel into a plain field of type T.
+template <typename T>
+bool WriteField(void* target, scs_u32_t, const scs_value_t& value) {
+  T incoming{};
+  Read(value, incoming);
+  return Assign(*static_cast<T*>(target), incoming);
+}
+
+/// Writes an indexed wheel channel into `(WheelDataStore.*Member)[index]`.
+template <auto Member>
+bool WriteWheelField(void* target, scs_u32_t index, const scs_value_t& value) {
+  auto& wheels = *static_cast<SCS::WheelDataStore*>(target);
+  if (index >= wheels.size()) return false;
+  auto& slot = (wheels.*Member)[index];
+  std::remove_reference_t<decltype(slot)> incoming{};
+  Read(value, incoming);
+  return Assign(slot, incoming);
+}
+
+/// Writes the indexed `wheel.on_ground` channel into the store's on_ground bitset.
+inline bool WriteWheelOnGround(void* target, scs_u32_t index, const scs_value_t& value) {
+  auto& wheels = *static_cast<SCS::WheelDataStore*>(target);
+  if (index >= wheels.size()) return false;
+  const bool incoming = value.value_bool.value != 0;
+  if (wheels.on_ground.test(index) == incoming) return false;
+  wheels.on_ground.set(index, incoming);
+  return true;
+}
+
+/// Writes an indexed boolean channel into a `std::vector<bool>` (e.g. H-shifter selectors).
+inline bool WriteBoolElement(void* target, scs_u32_t index, const scs_value_t& value) {
+  auto& flags = *static_cast<std::vector<bool>*>(target);
+  if (index >= flags.size()) return false;
+  const bool incoming = value.value_bool.value != 0;
+  if (flags[index] == incoming) return false;
+  flags[index] = incoming;
+  return true;
+}
+}  // namespace ChannelWriters
+
+/**
+ * @brief Creates a binding that writes a non-indexed channel directly into `field`.
+ */
+template <typename T>
+ChannelBinding BindField(T& field, void* owner = nullptr, ChannelBinding::NotifyFn notify = nullptr) {
+  return ChannelBinding{&field, &ChannelWriters::WriteField<T>, owner, notify};
+}
+
+}  // namespace Telemetry
+SPF_NS_END
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/Telemetry/TelemetryFields.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+/**
+ * @enum ChannelGroup
+ * @brief Sets of SDK channels that are registered and unregistered together.
+ *
+ * The telemetry service only registers a group's channels with the game while some
+ * consumer holds a ChannelLease for it. Data of groups that are not registered keeps
+ * the last value that was received.
+ */
+enum class ChannelGroup : uint8_t {
+  Common,       // Scale, game time, rest stops; always registered (the service uses them itself)
+  Job,          // Cargo damage
+  Navigation,   // Navigation distance, time and speed limit
+  Truck,        // Dashboard, lights, brakes, wear, gear and H-shifter selectors
+  TruckMotion,  // World placement, velocities, accelerations, cabin and head offsets
+  TruckWheels,  // Per-wheel channels of the truck
+  Controls,     // User and effective input
+  Trailers,     // Per-trailer channels, including trailer wheels
+  Count
+};
+
+inline constexpr size_t ChannelGroupCount = static_cast<size_t>(ChannelGroup::Count);
+
+/// One bit per ChannelGroup.
+using ChannelGroupMask = std::bitset<ChannelGroupCount>;
+
+/**
+ * @brief Builds a group mask from a list of groups.
+ */
+template <typename... Groups>
+ChannelGroupMask MakeChannelGroupMask(Groups... groups) {
+  ChannelGroupMask mask;
+  (mask.set(static_cast<size_t>(groups)), ...);
+  return mask;
+}
+
+inline ChannelGroupMask AllChannelGroups() { return ChannelGroupMask{}.set(); }
+
+inline bool HasChannelGroup(const ChannelGroupMask& mask, ChannelGroup group) { return mask.test(static_cast<size_t>(group)); }
+
+/**
+ * @brief Gets the groups whose channels feed a field (derived fields depend on several).
+ */
+ChannelGroupMask ChannelGroupsForField(Field field);
+
+/**
+ * @class ChannelDemand
+ * @brief Reference counts of the channel groups consumers currently need.
+ *
+ * Owned by the telemetry service through a shared_ptr and shared with every lease, so a
+ * lease may outlive the service that issued it. Leases may be taken and dropped from any
+ * thread; the service polls GetRevision() once per frame.
+ */
+class ChannelDemand {
+ public:
+  void Acquire(const ChannelGroupMask& groups);
+  void Release(const ChannelGroupMask& groups);
+
+  /// Groups with at least one reference.
+  ChannelGroupMask GetGroups() const;
+
+  /// Incremented whenever GetGroups() changes.
+  uint64_t GetRevision() const { return m_revision.load(std::memory_order_acquire); }
+
+ private:
+  mutable std::mutex m_mutex;
+  std::array<uint32_t, ChannelGroupCount> m_refs = {};
+  std::atomic<uint64_t> m_revision = 0;
+};
+
+/**
+ * @class ChannelLease
+ * @brief Holds a reference to a set of channel groups and releases it when destroyed.
+ *
+ * Obtained from ITelemetryService::AcquireChannels(). Move-only; a default-constructed
+ * lease holds nothing.
+ */
+class ChannelLease {
+ public:
+  ChannelLease() = default;
+  ChannelLease(std::shared_ptr<ChannelDemand> demand, const ChannelGroupMask& groups);
+  ~ChannelLease();
+
+  ChannelLease(ChannelLease&& other) noexcept;
+  ChannelLease& operator=(ChannelLease&& other) noexcept;
+  ChannelLease(const ChannelLease&) = delete;
+  ChannelLease& operator=(const ChannelLease&) = delete;
+
+  const ChannelGroupMask& GetGroups() const { return m_groups; }
+
+  /**
+   * @brief Adds groups to the lease. Does nothing for a default-constructed lease.
+   */
+  void Extend(const ChannelGroupMask& groups);
+
+  void Reset();
+
+ private:
+  std::shared_ptr<ChannelDemand> m_demand;
+  ChannelGroupMask m_groups;
+};
+}  // namespace Telemetry
+SPF_NS_END
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/Telemetry/ChannelBinding.hpp"
+#include "SPF/Telemetry/ChannelGroups.hpp"
+#include "SPF/Telemetry/Sdk.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+/**
+ * @struct ChannelValue
+ * @brief One value of a subscribed SDK channel, as the game sent it.
+ */
+struct ChannelValue {
+  scs_u32_t index = SCS_U32_NIL;  // SCS_U32_NIL for channels without an index
+  scs_value_t value = {};
+  bool changed = false;  // Differs from the value of the previous frame (always true on the first delivery)
+};
+
+using ChannelCallback = std::function<void(const ChannelValue&)>;
+
+/**
+ * @class ChannelSubscriptionRegistry
+ * @brief Subscriptions to single SDK channels, served from the bindings' raw values.
+ *
+ * The service lists every channel it can bind (name, type and binding) once; a subscription
+ * resolves its channel name to an id at that point and never matches names again. While a
+ * channel has subscribers its binding carries a ChannelTap, and Dispatch() hands the tapped
+ * values to the subscribers once per frame.
+ *
+ * Subscriptions may be added and removed from any thread; they take effect on the game
+ * thread at the next Apply(). A removed subscriber is never called again once Remove()
+ * returned, unless the removal happens on another thread during a dispatch.
+ */
+class ChannelSubscriptionRegistry {
+ public:
+  using ChannelId = uint32_t;
+
+  /// Highest index (exclusive) accepted for indexed channels.
+  static constexpr scs_u32_t MaxChannelIndex = 64;
+
+  struct ChannelInfo {
+    std::string name;
+    scs_value_type_t type = SCS_VALUE_TYPE_INVALID;
+    scs_u32_t flags = SCS_TELEMETRY_CHANNEL_FLAG_none;
+    ChannelGroup group = ChannelGroup::Common;
+    bool indexed = false;
+    ChannelBinding* binding = nullptr;
+  };
+
+  struct Subscriber {
+    ChannelId channel = 0;
+    scs_u32_t index = SCS_U32_NIL;
+    ChannelCallback callback;
+    bool changesOnly = false;
+    std::atomic<bool> active = true;
+
+    // Game thread only.
+    ChannelTap* tap = nullptr;
+    bool delivered = false;
+  };
+
+  // --- Channel directory, filled by the service when it binds its channels ---
+  void ClearChannels();
+  void AddChannel(ChannelInfo info);
+  std::optional<ChannelId> FindChannel(std::string_view name) const;
+
+  /// Valid for ids returned by FindChannel() until the channels are cleared.
+  const ChannelInfo& GetChannel(ChannelId id) const { return m_channels[id]; }
+
+  // --- Subscriptions ---
+  std::shared_ptr<Subscriber> Add(ChannelId channel, scs_u32_t index, ChannelCallback callback, bool changesOnly);
+  void Remove(const std::shared_ptr<Subscriber>& subscriber);
+
+  // --- Game thread ---
+
+  /**
+   * @brief Installs the taps of new subscribers and removes those nobody uses any more.
+   * @param refresh Called for each new subscriber whose channel value was not received yet,
+   *        so the service can ask the game to send the current value again.
+   */
+  void Apply(const std::function<void(const ChannelInfo&, scs_u32_t index)>& refresh);
+
+  /**
+   * @brief Delivers the tapped values and clears their change flags.
+   */
+  void Dispatch();
+
+ private:
+  struct TapState {
+    ChannelTap tap;
+    uint32_t subscribers = 0;
+  };
+
+  void Release(Subscriber& subscriber);
+
+  mutable std::mutex m_mutex;
+  std::vector<ChannelInfo> m_channels;
+  std::unordered_map<std::string, ChannelId> m_channelIds;
+  std::vector<std::shared_ptr<Subscriber>> m_pendingAdds;
+  std::vector<std::shared_ptr<Subscriber>> m_pendingRemoves;
+  std::atomic<bool> m_hasPending = false;
+
+  // Game thread only.
+  std::vector<std::shared_ptr<Subscriber>> m_active;
+  std::unordered_map<ChannelBinding*, std::unique_ptr<TapState>> m_taps;
+};
+
+/**
+ * @class ChannelSubscription
+ * @brief Keeps a channel subscription, and the channel's group, alive until destroyed.
+ *
+ * Obtained from ITelemetryService::SubscribeToChannel(). Move-only; a default-constructed
+ * or failed subscription holds nothing and converts to false.
+ */
+class ChannelSubscription {
+ public:
+  ChannelSubscription() = default;
+  ChannelSubscription(std::shared_ptr<ChannelSubscriptionRegistry> registry, std::shared_ptr<ChannelSubscriptionRegistry::Subscriber> subscriber, ChannelLease channels);
+  ~ChannelSubscription();
+
+  ChannelSubscription(ChannelSubscription&& other) noexcept = default;
+  ChannelSubscription& operator=(ChannelSubscription&& other) noexcept;
+  ChannelSubscription(const ChannelSubscription&) = delete;
+  ChannelSubscription& operator=(const ChannelSubscription&) = delete;
+
+  explicit operator bool() const { return m_subscriber != nullptr; }
+
+  void Reset();
+
+ private:
+  std::shared_ptr<ChannelSubscriptionRegistry> m_registry;
+  std::shared_ptr<ChannelSubscriptionRegistry::Subscriber> m_subscriber;
+  ChannelLease m_channels;
+};
+}  // namespace Telemetry
+SPF_NS_END
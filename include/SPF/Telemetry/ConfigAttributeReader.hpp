@@ -1,15 +1,81 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
+#include <span>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
-#include "SPF/Telemetry/ConfigAttributeReader.hpp"
 #include "SPF/Telemetry/Sdk.hpp"
 #include "SPF/Namespace.hpp"
 
 SPF_NS_BEGIN
 namespace Telemetry {
+class ConfigAttributeReader;
+
+namespace AttributeValues {
+// --- Typed extraction; each returns false if the attribute has a different type ---
+inline bool Read(const scs_value_t& value, bool& out) {
+  if (value.type != SCS_VALUE_TYPE_bool) return false;
+  out = value.value_bool.value != 0;
+  return true;
+}
+inline bool Read(const scs_value_t& value, int32_t& out) {
+  if (value.type != SCS_VALUE_TYPE_s32) return false;
+  out = value.value_s32.value;
+  return true;
+}
+inline bool Read(const scs_value_t& value, uint32_t& out) {
+  if (value.type != SCS_VALUE_TYPE_u32) return false;
+  out = value.value_u32.value;
+  return true;
+}
+inline bool Read(const scs_value_t& value, int64_t& out) {
+  if (value.type != SCS_VALUE_TYPE_s64) return false;
+  out = value.value_s64.value;
+  return true;
+}
+inline bool Read(const scs_value_t& value, uint64_t& out) {
+  if (value.type != SCS_VALUE_TYPE_u64) return false;
+  out = value.value_u64.value;
+  return true;
+}
+inline bool Read(const scs_value_t& value, float& out) {
+  if (value.type != SCS_VALUE_TYPE_float) return false;
+  out = value.value_float.value;
+  return true;
+}
+inline bool Read(const scs_value_t& value, std::string& out) {
+  if (value.type != SCS_VALUE_TYPE_string) return false;
+  out = value.value_string.value;
+  return true;
+}
+inline bool Read(const scs_value_t& value, scs_value_fvector_t& out) {
+  if (value.type != SCS_VALUE_TYPE_fvector) return false;
+  out = value.value_fvector;
+  return true;
+}
+}  // namespace AttributeValues
+
+/**
+ * @struct AttributeBinding
+ * @brief Decodes one configuration attribute into the field it was created for.
+ *
+ * A processor describes its whole configuration as a table of bindings and hands it to
+ * ConfigAttributeReader::Read(), instead of making one getter call per field. Attributes
+ * that are missing or have an unexpected type leave the value-initialized default, which
+ * matches `GetX(...).value_or({})`. See BindAttribute / BindAttributeArray / BindAttributeElements.
+ */
+struct AttributeBinding {
+  using ReadFn = void (*)(const ConfigAttributeReader& reader, const char* name, void* target);
+
+  const char* name = nullptr;
+  void* target = nullptr;  // The field (or container) the value is written into.
+  ReadFn read = nullptr;   // Typed reader for `target`.
+};
+
 /**
  * @class ConfigAttributeReader
  * @brief A helper class to safely read attributes from the null-terminated
@@ -17,6 +83,8 @@ namespace Telemetry {
  *
  * This class encapsulates the unsafe C-style iteration and string comparisons,
  * providing a clean, type-safe interface for accessing configuration values.
+ * The constructor indexes the array by (name, index) in a single pass, so each
+ * lookup afterwards is a hash probe rather than a scan of all attributes.
  */
 class ConfigAttributeReader {
  public:
@@ -37,13 +105,37 @@ class ConfigAttributeReader {
   std::optional<std::string> GetString(const char* name, uint32_t index = SCS_U32_NIL) const;
   std::optional<scs_value_fvector_t> GetFVector(const char* name, uint32_t index = SCS_U32_NIL) const;
 
+  /**
+   * @brief Typed getter behind the Get* functions; T is any type AttributeValues::Read accepts.
+   */
+  template <typename T>
+  std::optional<T> Get(const char* name, uint32_t index = SCS_U32_NIL) const {
+    const auto* attr = FindAttribute(name, index);
+    T value{};
+    if (attr && AttributeValues::Read(attr->value, value)) return value;
+    return std::nullopt;
+  }
+
   // --- Getters for indexed/array values ---
 
   std::vector<float> GetFloatArray(const char* name, uint32_t count) const;
   std::vector<bool> GetBoolArray(const char* name, uint32_t count) const;
   std::vector<scs_value_fvector_t> GetFVectorArray(const char* name, uint32_t count) const;
 
+  // --- Bulk decoding ---
+
+  /**
+   * @brief Decodes every binding of the table. Containers bound with BindAttributeArray or
+   *        BindAttributeElements must already have their final size.
+   */
+  void Read(std::span<const AttributeBinding> bindings) const;
+
  private:
+  struct IndexEntry {
+    uint32_t hash = 0;
+    const scs_named_value_t* attribute = nullptr;  // nullptr for an empty slot
+  };
+
   /**
    * @brief Finds an attribute by its name and index.
    * @param name The name of the attribute (e.g., "truck.brand_id").
@@ -53,7 +145,56 @@ class ConfigAttributeReader {
   const scs_named_value_t* FindAttribute(const char* name, uint32_t index) const;
 
   const scs_named_value_t* m_attributes;
+  std::vector<IndexEntry> m_index;  // Open addressing, linear probing; size is a power of two.
 };
 
+namespace AttributeReaders {
+template <typename T>
+void ReadField(const ConfigAttributeReader& reader, const char* name, void* target) {
+  *static_cast<T*>(target) = reader.Get<T>(name).value_or(T{});
+}
+
+template <typename T>
+void ReadArray(const ConfigAttributeReader& reader, const char* name, void* target) {
+  auto& values = *static_cast<std::vector<T>*>(target);
+  for (uint32_t i = 0; i < values.size(); ++i) {
+    values[i] = reader.Get<T>(name, i).value_or(T{});
+  }
+}
+
+template <auto Member, typename Element>
+void ReadElements(const ConfigAttributeReader& reader, const char* name, void* target) {
+  using T = std::remove_cvref_t<decltype(std::declval<Element&>().*Member)>;
+  auto& elements = *static_cast<std::vector<Element>*>(target);
+  for (uint32_t i = 0; i < elements.size(); ++i) {
+    elements[i].*Member = reader.Get<T>(name, i).value_or(T{});
+  }
+}
+}  // namespace AttributeReaders
+
+/**
+ * @brief Binds a non-indexed attribute to `field`.
+ */
+template <typename T>
+AttributeBinding BindAttribute(const char* name, T& field) {
+  return AttributeBinding{name, &field, &AttributeReaders::ReadField<T>};
+}
+
+/**
+ * @brief Binds an indexed attribute to `values[i]` for every element of `values`.
+ */
+template <typename T>
+AttributeBinding BindAttributeArray(const char* name, std::vector<T>& values) {
+  return AttributeBinding{name, &values, &AttributeReaders::ReadArray<T>};
+}
+
+/**
+ * @brief Binds an indexed attribute to `elements[i].*Member` for every element (e.g. one wheel member).
+ */
+template <auto Member, typename Element>
+AttributeBinding BindAttributeElements(const char* name, std::vector<Element>& elements) {
+  return AttributeBinding{name, &elements, &AttributeReaders::ReadElements<Member, Element>};
+}
+
 }  // namespace Telemetry
-SPF_NS_END
\ No newline at end of file
+SPF_NS_END
@@ -3,6 +3,7 @@
 #include "SPF/Namespace.hpp"
 #include "SPF/Telemetry/SCS/Controls.hpp"
 #include "SPF/Telemetry/Sdk.hpp"
+#include "SPF/Telemetry/TelemetryFields.hpp"
 
 SPF_NS_BEGIN
 
@@ -26,15 +27,19 @@ class ControlsProcessor {
   void Initialize(const scs_telemetry_init_params_v100_t* const scs_params);
   void Shutdown();
 
-  void HandleChannelUpdate(const scs_string_t name, const scs_u32_t index, const scs_value_t* value);
-
   const SCS::Controls& GetData() const { return m_controls; }
+  SCS::Controls& GetMutableData() { return m_controls; }
+
+  // Fields whose values changed since the service last collected them (see SCSTelemetryService::HandleFrameStart).
+  const FieldMask& GetChangedFields() const { return m_changedFields; }
+  FieldMask& GetMutableChangedFields() { return m_changedFields; }
 
  private:
   Logging::Logger& m_logger;
   GameContext& m_context;
 
   SCS::Controls m_controls;
+  FieldMask m_changedFields;
 };
 
 }  // namespace Telemetry
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/Telemetry/SCS/Common.hpp"
+#include "SPF/Telemetry/SCS/Truck.hpp"
+#include "SPF/Telemetry/TelemetryFields.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+/// Number of wheel and axle slots in DerivedData (equal to SPF_TELEMETRY_WHEEL_MAX_COUNT).
+inline constexpr size_t DerivedWheelMaxCount = SCS::WheelMaxCount;
+
+/**
+ * @struct DerivedData
+ * @brief Values computed from the truck channels once per frame by the telemetry service.
+ *
+ * The scalar members are also available as `Field::Derived*` for field subscriptions.
+ */
+struct DerivedData {
+  // Linear acceleration in the truck's frame, in g. Longitudinal is positive when
+  // speeding up forward, lateral is positive towards the right.
+  float longitudinal_g = 0.0f;
+  float lateral_g = 0.0f;
+  float vertical_g = 0.0f;
+  float jerk = 0.0f;  // Magnitude of the change of linear acceleration, m/s^3
+
+  // Slip ratio per truck wheel: (wheel surface speed - truck speed) / max(|truck speed|, 1 m/s).
+  uint32_t wheel_count = 0;
+  std::array<float, DerivedWheelMaxCount> wheel_slip = {};
+  float max_wheel_slip = 0.0f;  // Largest |slip| of the wheels on the ground
+
+  float fuel_economy = 0.0f;       // l/100 km over the last 100 m or more driven
+  float trip_fuel_economy = 0.0f;  // l/100 km since the trip started
+  float trip_distance = 0.0f;      // km driven since the trip started
+  float trip_fuel_used = 0.0f;     // l used since the trip started
+  float fuel_rate = 0.0f;          // l/h over the last second or more of simulation
+  float time_to_empty = 0.0f;      // s until the tank is empty at fuel_rate; 0 while not consuming
+
+  // Mean suspension deflection of the wheels of each axle, front to back.
+  uint32_t axle_count = 0;
+  std::array<float, DerivedWheelMaxCount> axle_suspension_deflection = {};
+};
+
+/**
+ * @enum DerivedInput
+ * @brief Inputs a derived channel can depend on. A channel is only evaluated in frames
+ *        in which at least one of its inputs changed.
+ */
+enum class DerivedInput : uint8_t {
+  LinearAcceleration,
+  Speed,
+  Wheels,          // Per-wheel data (angular velocity, suspension, on_ground)
+  WheelConstants,  // Wheel count, radius and position
+  FuelAmount,
+  Odometer,
+  SimulationTime,
+  Count
+};
+
+using DerivedInputMask = std::bitset<static_cast<size_t>(DerivedInput::Count)>;
+
+/**
+ * @brief Builds an input mask from a list of inputs.
+ */
+template <typename... Inputs>
+DerivedInputMask MakeInputMask(Inputs... inputs) {
+  DerivedInputMask mask;
+  (mask.set(static_cast<size_t>(inputs)), ...);
+  return mask;
+}
+
+/**
+ * @struct DerivedFrame
+ * @brief The data a derived channel may read. The wheel pointers are contiguous per-member
+ *        arrays (taken from the truck's WheelDataStore or gathered once per frame), so
+ *        channels can loop over them directly.
+ */
+struct DerivedFrame {
+  const SCS::TruckConstants& constants;
+  const SCS::TruckData& truck;
+  const SCS::Timestamps& timestamps;
+  uint64_t simulationDeltaUs;  // Simulation time since the previous frame; 0 while paused
+
+  uint32_t wheelCount;
+  const float* wheelAngularVelocity;  // Rotations per second
+  const float* wheelSuspension;
+  const float* wheelOnGround;  // 0 or 1
+  const float* wheelRadius;    // 0 for wheels that are not simulated
+  const float* wheelPositionZ;
+};
+
+/**
+ * @class DerivedChannel
+ * @brief One computed value (or group of values) with declared inputs.
+ */
+class DerivedChannel {
+ public:
+  DerivedChannel(const char* name, DerivedInputMask inputs) : m_name(name), m_inputs(inputs) {}
+  virtual ~DerivedChannel() = default;
+
+  const char* GetName() const { return m_name; }
+  const DerivedInputMask& GetInputs() const { return m_inputs; }
+
+  /**
+   * @brief Updates the channel's members of `out`, marking the Field of every value that changed.
+   */
+  virtual void Evaluate(const DerivedFrame& frame, DerivedData& out, FieldMask& changes) = 0;
+
+ private:
+  const char* m_name;
+  DerivedInputMask m_inputs;
+};
+
+/**
+ * @class DerivedChannelRegistry
+ * @brief Hosts the derived channels and evaluates them once per frame.
+ *
+ * The registry works out which inputs changed since the previous frame (from the service's
+ * change mask for scalar inputs, by comparison for vectors and wheel arrays) and evaluates
+ * only the channels that depend on them. The built-in channels are registered on construction.
+ */
+class DerivedChannelRegistry {
+ public:
+  DerivedChannelRegistry();
+
+  void Register(std::unique_ptr<DerivedChannel> channel);
+
+  /**
+   * @brief Evaluates the channels whose inputs changed. Called at frame start, after the
+   *        service has collected the frame's changed fields.
+   * @param changes The service's change mask for this frame; derived fields are added to it.
+   */
+  void Evaluate(const SCS::TruckConstants& constants, const SCS::TruckData& truck, const SCS::Timestamps& timestamps, FieldMask& changes);
+
+  const DerivedData& GetData() const { return m_data; }
+  const std::vector<std::unique_ptr<DerivedChannel>>& GetChannels() const { return m_channels; }
+
+ private:
+  /**
+   * @brief Gathers the wheel members the store does not hold as floats into m_wheel* and
+   *        compares the wheel inputs with the previous frame.
+   */
+  void GatherWheels(const SCS::TruckConstants& constants, const SCS::TruckData& truck, DerivedInputMask& changed);
+
+  std::vector<std::unique_ptr<DerivedChannel>> m_channels;
+  DerivedData m_data;
+
+  // Previous-frame inputs that are not covered by the service's change mask.
+  bool m_hasPrevious = false;
+  scs_value_fvector_t m_previousAcceleration = {};
+  uint64_t m_previousSimulationUs = 0;
+
+  uint32_t m_wheelCount = 0;
+  std::array<float, DerivedWheelMaxCount> m_previousAngularVelocity = {};
+  std::array<float, DerivedWheelMaxCount> m_previousSuspension = {};
+  std::array<float, DerivedWheelMaxCount> m_wheelOnGround = {};
+  std::array<float, DerivedWheelMaxCount> m_wheelRadius = {};
+  std::array<float, DerivedWheelMaxCount> m_wheelPositionZ = {};
+};
+}  // namespace Telemetry
+SPF_NS_END
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "SPF/Namespace.hpp"
+#include "SPF/Telemetry/GameplayEventHistory.hpp"
 #include "SPF/Telemetry/SCS/Events.hpp"
 #include "SPF/Telemetry/Sdk.hpp"
 
@@ -27,11 +28,17 @@ class EventsProcessor {
   void Shutdown();
 
   void HandleFrameStart();  // To reset one-frame flags
-  void HandleGameplayEvent(const scs_telemetry_gameplay_event_t* info);
+  /**
+   * @brief Decodes the event and appends it to the history.
+   * @param timestamps Timestamps of the frame the event arrived in, stored with the event.
+   * @param gameTime In-game time of that frame, in minutes.
+   */
+  void HandleGameplayEvent(const scs_telemetry_gameplay_event_t* info, const SCS::Timestamps& timestamps, uint32_t gameTime);
 
   const SCS::SpecialEvents& GetSpecialEvents() const { return m_specialEvents; }
   const SCS::GameplayEvents& GetGameplayEvents() const { return m_gameplayEvents; }
   const std::string& GetLastGameplayEventId() const;
+  const GameplayEventHistory& GetHistory() const { return m_history; }
 
  private:
   Logging::Logger& m_logger;
@@ -40,6 +47,7 @@ class EventsProcessor {
   std::string m_lastGameplayEventId;
   SCS::SpecialEvents m_specialEvents;
   SCS::GameplayEvents m_gameplayEvents;
+  GameplayEventHistory m_history;
 };
 
 }  // namespace Telemetry
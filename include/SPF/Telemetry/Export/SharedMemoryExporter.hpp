@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/SPF_API/SPF_TelemetrySharedMemory.h"
+#include "SPF/Utils/SharedMemory.hpp"
+
+SPF_NS_BEGIN
+namespace Modules {
+class ITelemetryService;
+}
+
+namespace Telemetry::Export {
+/**
+ * @class SharedMemoryExporter
+ * @brief Publishes every telemetry frame into a named shared-memory region for external programs.
+ *
+ * The layout and the reading protocol are described in SPF_TelemetrySharedMemory.h.
+ * All memory is set up in Start(); Publish() runs on the game thread and neither
+ * allocates nor takes a lock.
+ */
+class SharedMemoryExporter {
+ public:
+  SharedMemoryExporter() = default;
+  ~SharedMemoryExporter();
+
+  SharedMemoryExporter(const SharedMemoryExporter&) = delete;
+  SharedMemoryExporter& operator=(const SharedMemoryExporter&) = delete;
+
+  /**
+   * @brief Creates the region and the frame semaphore under `name`.
+   * @return False on failure (see GetLastError).
+   */
+  bool Start(const std::string& name);
+  void Stop();
+
+  /**
+   * @brief Converts the service's current data and publishes it as one frame.
+   * Must be called at frame start, after the service has published its snapshot.
+   */
+  void Publish(const Modules::ITelemetryService& telemetry);
+
+  bool IsRunning() const { return m_region != nullptr; }
+  uint64_t GetFramesPublished() const { return m_framesPublished; }
+  const std::string& GetLastError() const { return m_lastError; }
+
+ private:
+  Utils::SharedMemory m_memory;
+  Utils::NamedSemaphore m_frameSemaphore;
+  SPF_TelemetryShmRegion* m_region = nullptr;
+  std::unique_ptr<SPF_TelemetryShmFrame> m_staging;  // Converted off the shared region
+  uint64_t m_framesPublished = 0;
+  std::string m_lastError;
+};
+}  // namespace Telemetry::Export
+SPF_NS_END
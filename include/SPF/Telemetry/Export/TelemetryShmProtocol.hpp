@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/SPF_API/SPF_TelemetrySharedMemory.h"
+#include "SPF/Utils/SharedMemory.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry::Export {
+// =================================================================================================
+// Sequence-lock protocol for SPF_TelemetryShmRegion (see SPF_TelemetrySharedMemory.h).
+// =================================================================================================
+// Shared between the exporter and external readers/tools so both sides use the same ordering.
+// The header fields are plain integers in the C layout; std::atomic_ref gives them atomic
+// access without changing the layout.
+
+static_assert(sizeof(SPF_TelemetryShmHeader) == 64, "The shared-memory header layout is fixed");
+static_assert(std::atomic_ref<uint64_t>::is_always_lock_free, "The seqlock needs lock-free 64-bit atomics");
+
+inline std::atomic_ref<uint64_t> Sequence(SPF_TelemetryShmHeader& header) { return std::atomic_ref<uint64_t>(header.sequence); }
+inline std::atomic_ref<uint64_t> FrameId(SPF_TelemetryShmHeader& header) { return std::atomic_ref<uint64_t>(header.frame_id); }
+inline std::atomic_ref<uint32_t> Waiters(SPF_TelemetryShmHeader& header) { return std::atomic_ref<uint32_t>(header.waiters); }
+inline std::atomic_ref<uint32_t> WriterActive(SPF_TelemetryShmHeader& header) { return std::atomic_ref<uint32_t>(header.writer_active); }
+
+/**
+ * @brief Initializes the header of a freshly created region. Call before readers can see it.
+ */
+inline void InitializeRegion(SPF_TelemetryShmRegion& region) {
+  std::memset(&region, 0, sizeof(region));
+  region.header.version = SPF_TELEMETRY_SHM_VERSION;
+  region.header.header_size = sizeof(SPF_TelemetryShmHeader);
+  region.header.frame_size = sizeof(SPF_TelemetryShmFrame);
+  WriterActive(region.header).store(1, std::memory_order_relaxed);
+  std::atomic_ref<uint32_t>(region.header.magic).store(SPF_TELEMETRY_SHM_MAGIC, std::memory_order_release);
+}
+
+/**
+ * @brief Copies a fully prepared frame into the region under the sequence lock, then wakes waiting readers.
+ *
+ * Neither allocates nor blocks. The frame is staged outside the region so that the window
+ * in which readers have to retry is a single memcpy.
+ */
+inline void PublishFrame(SPF_TelemetryShmRegion& region, const SPF_TelemetryShmFrame& staged, Utils::NamedSemaphore& frameSemaphore) {
+  auto sequence = Sequence(region.header);
+  const uint64_t start = sequence.load(std::memory_order_relaxed);
+  sequence.store(start + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  std::memcpy(&region.frame, &staged, sizeof(staged));
+
+  sequence.store(start + 2, std::memory_order_release);
+  FrameId(region.header).store(staged.frame_id, std::memory_order_release);
+
+  const uint32_t waiters = Waiters(region.header).load(std::memory_order_acquire);
+  if (waiters > 0) frameSemaphore.Post(waiters);
+}
+
+/**
+ * @brief Makes one attempt to copy a consistent frame out of the region.
+ * @return False if a write was in progress or overlapped the copy; simply try again.
+ */
+inline bool TryReadFrame(SPF_TelemetryShmRegion& region, SPF_TelemetryShmFrame& out) {
+  auto sequence = Sequence(region.header);
+  const uint64_t before = sequence.load(std::memory_order_acquire);
+  if (before & 1) return false;
+
+  std::memcpy(&out, &region.frame, sizeof(out));
+
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return sequence.load(std::memory_order_relaxed) == before;
+}
+
+/**
+ * @brief Blocks until a frame newer than `lastFrameId` was published or `timeoutMs` elapsed.
+ * @return The id of the newest published frame (equal to `lastFrameId` on timeout).
+ */
+inline uint64_t WaitForFrame(SPF_TelemetryShmRegion& region, Utils::NamedSemaphore& frameSemaphore, uint64_t lastFrameId, uint32_t timeoutMs) {
+  auto frameId = FrameId(region.header);
+  uint64_t current = frameId.load(std::memory_order_acquire);
+  if (current != lastFrameId) return current;
+
+  auto waiters = Waiters(region.header);
+  waiters.fetch_add(1, std::memory_order_acq_rel);
+  current = frameId.load(std::memory_order_acquire);  // Re-check: the writer may not have seen us.
+  if (current == lastFrameId) {
+    frameSemaphore.Wait(timeoutMs);
+    current = frameId.load(std::memory_order_acquire);
+  }
+  waiters.fetch_sub(1, std::memory_order_acq_rel);
+  return current;
+}
+}  // namespace Telemetry::Export
+SPF_NS_END
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/SPF_API/SPF_TelemetryStream.h"
+#include "SPF/Telemetry/Recording/RecordingFormat.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry::Export {
+// =================================================================================================
+// Packet encoding for the UDP telemetry stream (see SPF_TelemetryStream.h).
+// =================================================================================================
+// Shared between the server and clients/tools so both sides agree on the layout. Varints are
+// the ones of the recording format.
+
+static_assert(sizeof(SPF_TelemetryStreamHeader) == 8, "The stream header layout is fixed");
+static_assert(sizeof(SPF_TelemetryStreamFrame) == 33, "The stream frame layout is fixed");
+static_assert(std::endian::native == std::endian::little, "The stream is encoded by copying little-endian structs");
+
+template <typename T>
+inline void AppendPod(std::vector<uint8_t>& out, const T& value) {
+  const size_t at = out.size();
+  out.resize(at + sizeof(T));
+  std::memcpy(out.data() + at, &value, sizeof(T));
+}
+
+inline void BeginPacket(std::vector<uint8_t>& out, SPF_TelemetryStreamPacketType type) {
+  out.clear();
+  AppendPod(out, SPF_TelemetryStreamHeader{SPF_TELEMETRY_STREAM_MAGIC, SPF_TELEMETRY_STREAM_VERSION, static_cast<uint8_t>(type), 0});
+}
+
+/**
+ * @brief Validates the header of a received packet.
+ * @return The packet type, or 0 if the packet is not a stream packet of this version.
+ */
+inline uint8_t ReadPacketType(const uint8_t* data, size_t size) {
+  if (size < sizeof(SPF_TelemetryStreamHeader)) return 0;
+  SPF_TelemetryStreamHeader header;
+  std::memcpy(&header, data, sizeof(header));
+  if (header.magic != SPF_TELEMETRY_STREAM_MAGIC || header.version != SPF_TELEMETRY_STREAM_VERSION) return 0;
+  return header.type;
+}
+
+inline void EncodeSubscribe(std::vector<uint8_t>& out, std::span<const uint16_t> fields, uint16_t flags) {
+  BeginPacket(out, SPF_TELEMETRY_STREAM_PACKET_SUBSCRIBE);
+  AppendPod(out, flags);
+  AppendPod(out, static_cast<uint16_t>(fields.size()));
+  for (const uint16_t field : fields) AppendPod(out, field);
+}
+
+/**
+ * @class StreamDecoder
+ * @brief Client-side state of one stream: the schema and the latest decoded values.
+ */
+class StreamDecoder {
+ public:
+  enum class Result {
+    Ignored,  // Not a stream packet, or not meant for the current schema
+    Schema,   // A new field list; values are unknown until the next keyframe
+    Frame,    // GetValues() holds the values of the frame
+    Resync,   // A frame was lost or could not be decoded; send SUBSCRIBE with RESYNC
+  };
+
+  Result Decode(const uint8_t* data, size_t size) {
+    const uint8_t type = ReadPacketType(data, size);
+    Recording::Reader reader(data, size, sizeof(SPF_TelemetryStreamHeader));
+
+    if (type == SPF_TELEMETRY_STREAM_PACKET_SCHEMA) {
+      SPF_TelemetryStreamSchema schema;
+      reader.ReadBytes(&schema, sizeof(schema));
+      if (reader.Failed() || schema.field_count > SPF_TELEMETRY_STREAM_MAX_FIELDS) return Result::Ignored;
+      std::vector<uint16_t> fields(schema.field_count);
+      if (!fields.empty()) reader.ReadBytes(fields.data(), fields.size() * sizeof(uint16_t));
+      if (reader.Failed()) return Result::Ignored;
+
+      m_schema = schema;
+      m_fields = std::move(fields);
+      m_values.assign(m_fields.size(), 0.0f);
+      m_hasSchema = true;
+      m_synced = false;
+      return Result::Schema;
+    }
+    if (type != SPF_TELEMETRY_STREAM_PACKET_FRAME || !m_hasSchema) return Result::Ignored;
+
+    SPF_TelemetryStreamFrame frame;
+    reader.ReadBytes(&frame, sizeof(frame));
+    if (reader.Failed() || frame.schema_id != m_schema.schema_id) return Result::Ignored;
+
+    const bool keyframe = (frame.flags & SPF_TELEMETRY_STREAM_FRAME_KEYFRAME) != 0;
+    const bool gap = m_hasSequence && frame.sequence != m_frame.sequence + 1;
+    m_frame = frame;
+    m_hasSequence = true;
+    if (!keyframe && (gap || !m_synced)) {
+      m_synced = false;
+      return Result::Resync;
+    }
+
+    if (keyframe) {
+      if (!m_values.empty()) reader.ReadBytes(m_values.data(), m_values.size() * sizeof(float));
+    } else {
+      const size_t maskBytes = (m_values.size() + 7) / 8;
+      uint8_t mask[SPF_TELEMETRY_STREAM_MAX_FIELDS / 8] = {};
+      reader.ReadBytes(mask, maskBytes);
+      for (size_t i = 0; i < m_values.size() && !reader.Failed(); ++i) {
+        if (!(mask[i / 8] & (1u << (i % 8)))) continue;
+        const auto bits = std::bit_cast<uint32_t>(m_values[i]) ^ static_cast<uint32_t>(reader.ReadVarint());
+        m_values[i] = std::bit_cast<float>(bits);
+      }
+    }
+    m_synced = !reader.Failed();
+    return m_synced ? Result::Frame : Result::Resync;
+  }
+
+  const SPF_TelemetryStreamSchema& GetSchema() const { return m_schema; }
+  const SPF_TelemetryStreamFrame& GetFrame() const { return m_frame; }
+  const std::vector<uint16_t>& GetFields() const { return m_fields; }
+  const std::vector<float>& GetValues() const { return m_values; }
+
+ private:
+  SPF_TelemetryStreamSchema m_schema = {};
+  SPF_TelemetryStreamFrame m_frame = {};
+  std::vector<uint16_t> m_fields;
+  std::vector<float> m_values;
+  bool m_hasSchema = false;
+  bool m_hasSequence = false;
+  bool m_synced = false;
+};
+}  // namespace Telemetry::Export
+SPF_NS_END
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/SPF_API/SPF_TelemetryStream.h"
+#include "SPF/Telemetry/TelemetryFields.hpp"
+#include "SPF/Utils/UdpSocket.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+struct TelemetrySnapshot;
+}
+
+namespace Telemetry::Export {
+struct StreamStats {
+  uint32_t clients = 0;
+  uint64_t framesQueued = 0;
+  uint64_t framesDropped = 0;  // Queued frames overwritten because the sender fell behind
+  uint64_t packetsSent = 0;
+  uint64_t bytesSent = 0;  // Payload bytes, without UDP/IP headers
+};
+
+/**
+ * @class TelemetryStreamServer
+ * @brief Streams the telemetry fields selected by each client over UDP.
+ *
+ * The wire format is described in SPF_TelemetryStream.h. Publish() runs on the game thread
+ * and only copies the fields any client selected into a small preallocated queue; encoding,
+ * sending and handling client requests happen on the server's own thread. Each client gets
+ * its own field selection and delta state, so a client only costs the bytes of the fields
+ * it asked for that changed.
+ */
+class TelemetryStreamServer {
+ public:
+  static constexpr size_t QueueCapacity = 8;
+  static constexpr size_t MaxClients = 16;
+
+  TelemetryStreamServer() = default;
+  ~TelemetryStreamServer();
+
+  TelemetryStreamServer(const TelemetryStreamServer&) = delete;
+  TelemetryStreamServer& operator=(const TelemetryStreamServer&) = delete;
+
+  /**
+   * @brief Binds the socket and starts the server thread.
+   * @param keyframeInterval Frames between keyframes of each client.
+   * @return False on failure (see GetLastError).
+   */
+  bool Start(const std::string& address, uint16_t port, uint32_t keyframeInterval);
+  void Stop();
+
+  /**
+   * @brief Queues the snapshot's values of the selected fields for sending. Does nothing
+   *        while no client is subscribed. Call at frame start.
+   */
+  void Publish(const TelemetrySnapshot& snapshot);
+
+  /**
+   * @brief The union of the fields all clients selected, and a counter that changes with
+   *        it, so the owner can keep the matching channel groups registered.
+   */
+  FieldMask GetSelectedFields() const;
+  uint64_t GetSelectionRevision() const { return m_selectionRevision.load(std::memory_order_acquire); }
+
+  bool IsRunning() const { return m_thread.joinable(); }
+  uint16_t GetPort() const { return m_socket.GetLocalPort(); }
+  StreamStats GetStats() const;
+  const std::string& GetLastError() const { return m_lastError; }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct QueuedFrame {
+    uint64_t frameId = 0;
+    uint64_t renderTime = 0;
+    uint64_t publishTime = 0;
+    std::array<float, FieldCount> values = {};
+  };
+
+  struct Client {
+    Utils::UdpEndpoint endpoint;
+    std::vector<uint16_t> fields;  // Accepted selection, in the order values are sent
+    std::vector<uint32_t> sent;    // Bits of the values last sent, per field
+    uint32_t schemaId = 0;
+    uint32_t sequence = 0;
+    uint32_t framesSinceKeyframe = 0;
+    bool needsKeyframe = true;
+    Clock::time_point lastSeen;
+  };
+
+  void Run();
+  void ReceiveRequests();
+  void HandleSubscribe(const Utils::UdpEndpoint& from, const uint8_t* data, size_t size);
+  void DropClient(const Utils::UdpEndpoint& from);
+  void DropExpiredClients();
+  void UpdateSelection();
+  void SendSchema(const Client& client);
+  void SendFrame(Client& client, const QueuedFrame& frame);
+  void Send(const Utils::UdpEndpoint& to);
+
+  Utils::UdpSocket m_socket;
+  std::thread m_thread;
+  uint32_t m_keyframeInterval = 60;
+  std::string m_lastError;
+
+  // Shared between Publish() and the server thread.
+  mutable std::mutex m_mutex;
+  std::condition_variable m_wake;
+  bool m_stopping = false;
+  std::array<QueuedFrame, QueueCapacity> m_queue;
+  size_t m_queueHead = 0;  // Oldest queued frame
+  size_t m_queueCount = 0;
+  FieldMask m_selectedFields;
+  std::atomic<uint64_t> m_selectionRevision = 0;
+  std::atomic<uint32_t> m_clientCount = 0;
+  uint64_t m_framesQueued = 0;
+  uint64_t m_framesDropped = 0;
+  std::atomic<uint64_t> m_packetsSent = 0;
+  std::atomic<uint64_t> m_bytesSent = 0;
+
+  // Server thread only.
+  std::vector<Client> m_clients;
+  uint32_t m_nextSchemaId = 1;
+  std::vector<uint8_t> m_packet;
+  std::array<uint8_t, SPF_TELEMETRY_STREAM_MAX_PACKET> m_receiveBuffer = {};
+};
+}  // namespace Telemetry::Export
+SPF_NS_END
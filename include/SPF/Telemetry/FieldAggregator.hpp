@@ -0,0 +1,112 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/Telemetry/TelemetryFields.hpp"
+#include "SPF/Utils/Signal.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+struct TelemetrySnapshot;
+
+/**
+ * @struct FieldWindowStats
+ * @brief Aggregate of one field over one closed window.
+ */
+struct FieldWindowStats {
+  double min = 0.0;
+  double max = 0.0;
+  double mean = 0.0;  // Weighted by the render time each sample covers.
+  double last = 0.0;
+  uint32_t samples = 0;
+};
+
+/**
+ * @class AggregateWindow
+ * @brief Accumulates min/max/mean/last of a set of fields over fixed-length windows.
+ *
+ * Windows are aligned to multiples of their length on the game's render clock, so every
+ * subscriber of the same length sees the same boundaries. A window closes at the first
+ * frame whose render time lies past its end; the closed signal is then fired once with
+ * the results, and the next window starts with that frame's sample.
+ */
+class AggregateWindow {
+ public:
+  explicit AggregateWindow(uint64_t lengthUs);
+
+  uint64_t GetLength() const { return m_lengthUs; }
+
+  // Render time (microseconds) covered by the most recently closed window.
+  uint64_t GetClosedStart() const { return m_closedStartUs; }
+  uint64_t GetClosedEnd() const { return m_closedStartUs + m_lengthUs; }
+
+  /**
+   * @brief Results of the most recently closed window. Only meaningful for acquired fields
+   *        while the closed signal is being fired (or afterwards, until the next close).
+   */
+  const FieldWindowStats& GetStats(Field field) const { return m_closed[static_cast<size_t>(field)]; }
+
+  Utils::Signal<void(const AggregateWindow&)>& GetClosedSignal() { return m_closedSignal; }
+
+ private:
+  friend class FieldAggregator;
+
+  struct Accumulator {
+    uint32_t refs = 0;
+    double min = 0.0;
+    double max = 0.0;
+    double weightedSum = 0.0;
+    double weight = 0.0;  // Render time covered by the samples
+    double plainSum = 0.0;
+    double last = 0.0;
+    uint32_t samples = 0;
+  };
+
+  void Acquire(Field field);
+  void Release(Field field);
+  bool IsUnused() const { return m_activeFields.empty(); }
+  void Sample(const TelemetrySnapshot& snapshot, uint64_t nowUs);
+  void Close();
+
+  uint64_t m_lengthUs;
+  uint64_t m_windowStartUs = 0;
+  uint64_t m_closedStartUs = 0;
+  uint64_t m_lastSampleUs = 0;
+  bool m_hasLastSample = false;
+  bool m_open = false;
+
+  std::vector<Field> m_activeFields;
+  std::array<Accumulator, FieldCount> m_accumulators = {};
+  std::array<FieldWindowStats, FieldCount> m_closed = {};
+  Utils::Signal<void(const AggregateWindow&)> m_closedSignal;
+};
+
+/**
+ * @class FieldAggregator
+ * @brief Owns the aggregate windows requested by consumers and feeds them once per frame.
+ *
+ * Consumers asking for the same window length share one AggregateWindow, so each
+ * aggregate is computed once per frame regardless of how many subscribers read it.
+ * Windows and fields are reference counted and dropped when the last consumer releases them.
+ */
+class FieldAggregator {
+ public:
+  AggregateWindow& Acquire(uint32_t windowMs, std::span<const Field> fields);
+  void Release(AggregateWindow& window, std::span<const Field> fields);
+
+  /**
+   * @brief Adds the snapshot's values to every window, closing windows that have ended.
+   *        Called by the telemetry service at frame start.
+   */
+  void Sample(const TelemetrySnapshot& snapshot);
+
+ private:
+  std::vector<std::unique_ptr<AggregateWindow>> m_windows;
+};
+}  // namespace Telemetry
+SPF_NS_END
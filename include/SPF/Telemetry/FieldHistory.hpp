@@ -0,0 +1,158 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/Telemetry/ChannelGroups.hpp"
+#include "SPF/Telemetry/TelemetryFields.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+struct TelemetrySnapshot;
+
+/**
+ * @struct HistoryPoint
+ * @brief One point of a field's history, as returned by FieldHistory::Query().
+ */
+struct HistoryPoint {
+  uint64_t time = 0;   // Render time (µs); for the downsampled tiers, the start of the bucket
+  float value = 0.0f;  // The sample, or the mean of the bucket
+  float min = 0.0f;    // Range of all samples the point stands for, including those
+  float max = 0.0f;    // dropped by decimation
+};
+
+/**
+ * @class FieldHistory
+ * @brief The recent history of the fields consumers asked for, shared by all of them.
+ *
+ * Each field is stored as a column of three ring buffers sharing one time column per
+ * ring: one value per frame (Raw), and min/max/mean per second and per ten seconds. The
+ * downsampled tiers are maintained incrementally: every frame is added to the open
+ * one-second bucket, and every closed one-second bucket to the open ten-second bucket.
+ * Buckets are aligned to multiples of their length on the render clock, like the
+ * aggregate windows of FieldAggregator.
+ *
+ * Query() picks the coarsest tier that still has at least as many points in the range as
+ * the caller can draw, and reduces them to that count with Largest-Triangle-Three-Buckets,
+ * so a graph costs O(width) to draw regardless of the range it spans.
+ *
+ * Fields are reference counted; a field's columns are allocated when it is first acquired
+ * and dropped with its last release, so history starts when a field is first recorded.
+ * All members may be called from any thread.
+ */
+class FieldHistory {
+ public:
+  enum class Tier : uint8_t { Raw, Seconds, TenSeconds };
+  static constexpr size_t TierCount = 3;
+
+  // Bucket length of each tier (µs); the raw tier keeps every frame.
+  static constexpr std::array<uint64_t, TierCount> BucketLength = {0, 1'000'000, 10'000'000};
+  // About 2 minutes at 60 fps, 15 minutes and 2 hours.
+  static constexpr std::array<size_t, TierCount> Capacity = {8192, 900, 720};
+
+  FieldHistory();
+
+  void Acquire(std::span<const Field> fields);
+  void Release(std::span<const Field> fields);
+  bool IsRecording(Field field) const;
+
+  /**
+   * @brief Appends the snapshot's values of the recorded fields. Called by the telemetry
+   *        service at frame start. A restarted render clock clears the history.
+   */
+  void Sample(const TelemetrySnapshot& snapshot);
+
+  void Clear();
+
+  /**
+   * @brief Reads a field's history between two render times, decimated to a point count.
+   * @param maxPoints The most points to return, typically the width of the graph in
+   *        pixels; at least 3.
+   * @param out Receives the points, oldest first. Points recorded before the field was
+   *        acquired are skipped.
+   * @return The number of points written to `out`.
+   */
+  size_t Query(Field field, uint64_t fromUs, uint64_t toUs, size_t maxPoints, std::vector<HistoryPoint>& out) const;
+
+  // Render time (µs) of the newest sample, or 0 if nothing has been recorded.
+  uint64_t GetLatestTime() const;
+
+ private:
+  struct Column {
+    std::vector<float> value;  // The sample (Raw) or the bucket mean
+    std::vector<float> min;    // Downsampled tiers only
+    std::vector<float> max;
+  };
+
+  struct Accumulator {
+    float min = 0.0f;
+    float max = 0.0f;
+    double sum = 0.0;
+    uint32_t count = 0;
+  };
+
+  struct Ring {
+    std::vector<uint64_t> time;
+    std::array<Column, FieldCount> columns;
+    size_t head = 0;  // Next slot to write
+    size_t count = 0;
+
+    // Bucket being accumulated (downsampled tiers only).
+    bool open = false;
+    uint64_t openStart = 0;
+    std::array<Accumulator, FieldCount> pending = {};
+  };
+
+  size_t Append(Tier tier, uint64_t time);
+  void Feed(Tier tier, uint64_t time, const std::array<Accumulator, FieldCount>& samples);
+  void Close(Tier tier);
+  void ClearLocked();
+  static void Decimate(std::vector<HistoryPoint>& points, size_t target);
+
+  Ring& GetRing(Tier tier) { return m_rings[static_cast<size_t>(tier)]; }
+
+  mutable std::mutex m_mutex;
+  std::array<Ring, TierCount> m_rings;
+  std::array<uint32_t, FieldCount> m_refs = {};
+  std::vector<Field> m_fields;  // Fields with a reference
+
+  bool m_hasLastSample = false;
+  uint64_t m_lastSampleUs = 0;
+  std::array<Accumulator, FieldCount> m_frame = {};  // Values of the current frame, as single-sample accumulators
+};
+
+/**
+ * @class FieldHistoryLease
+ * @brief Keeps fields recorded in the FieldHistory, and their channel groups registered,
+ *        until destroyed.
+ *
+ * Obtained from ITelemetryService::RecordFieldHistory(). Move-only; a default-constructed
+ * lease holds nothing and converts to false.
+ */
+class FieldHistoryLease {
+ public:
+  FieldHistoryLease() = default;
+  FieldHistoryLease(std::shared_ptr<FieldHistory> history, std::vector<Field> fields, ChannelLease channels);
+  ~FieldHistoryLease();
+
+  FieldHistoryLease(FieldHistoryLease&& other) noexcept = default;
+  FieldHistoryLease& operator=(FieldHistoryLease&& other) noexcept;
+  FieldHistoryLease(const FieldHistoryLease&) = delete;
+  FieldHistoryLease& operator=(const FieldHistoryLease&) = delete;
+
+  explicit operator bool() const { return m_history != nullptr; }
+
+  void Reset();
+
+ private:
+  std::shared_ptr<FieldHistory> m_history;
+  std::vector<Field> m_fields;
+  ChannelLease m_channels;
+};
+}  // namespace Telemetry
+SPF_NS_END
@@ -3,6 +3,7 @@
 #include "SPF/Namespace.hpp"
 #include "SPF/Telemetry/SCS/Common.hpp"
 #include "SPF/Telemetry/Sdk.hpp"
+#include "SPF/Telemetry/TelemetryFields.hpp"
 
 SPF_NS_BEGIN
 
@@ -33,16 +34,23 @@ class GameDataProcessor {
   void HandlePaused();
   void HandleStarted();
   void HandleFrameStart(const scs_telemetry_frame_start_t* info);
-  void HandleChannelUpdate(const scs_string_t name, const scs_u32_t index, const scs_value_t* value);
 
   const SCS::GameState& GetGameState() const { return m_gameState; }
   const SCS::Timestamps& GetTimestamps() const { return m_timestamps; }
   const SCS::CommonData& GetCommonData() const { return m_commonData; }
+  SCS::GameState& GetMutableGameState() { return m_gameState; }
+  SCS::CommonData& GetMutableCommonData() { return m_commonData; }
 
- private:
+  // Fields whose values changed since the service last collected them (see SCSTelemetryService::HandleFrameStart).
+  const FieldMask& GetChangedFields() const { return m_changedFields; }
+  FieldMask& GetMutableChangedFields() { return m_changedFields; }
+
+  // Derived values, re-run by the channel bindings whenever one of their inputs changes.
   void RecalculateRestStopTime();
   void RecalculateRealTimeDurations();
 
+ private:
+
   Logging::Logger& m_logger;
   GameContext& m_context;
   Events::EventManager& m_eventManager;
@@ -52,6 +60,7 @@ class GameDataProcessor {
   SCS::GameState m_gameState;
   SCS::Timestamps m_timestamps;
   SCS::CommonData m_commonData;
+  FieldMask m_changedFields;
 };
 
 }  // namespace Telemetry
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/Telemetry/ConfigAttributeReader.hpp"
+#include "SPF/Telemetry/SCS/Common.hpp"
+#include "SPF/Telemetry/SCS/Events.hpp"
+#include "SPF/Telemetry/Sdk.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+/**
+ * @struct RecordedEventAttribute
+ * @brief One attribute of a recorded gameplay event, copied out of the SDK array.
+ *
+ * Non-string values are kept in `value` as received. For strings `value.value_string.value`
+ * is null and the text is held in `text`, since the SDK's pointer dies with the callback.
+ */
+struct RecordedEventAttribute {
+  std::string name;
+  uint32_t index = SCS_U32_NIL;
+  scs_value_t value = {};
+  std::string text;
+
+  /**
+   * @brief Typed read; returns false if the attribute has a different type.
+   */
+  template <typename T>
+  bool Read(T& out) const {
+    if constexpr (std::is_same_v<T, std::string>) {
+      if (value.type != SCS_VALUE_TYPE_string) return false;
+      out = text;
+      return true;
+    } else {
+      return AttributeValues::Read(value, out);
+    }
+  }
+};
+
+/**
+ * @struct RecordedEvent
+ * @brief A gameplay event as kept by GameplayEventHistory.
+ */
+struct RecordedEvent {
+  uint64_t sequence = 0;  // 1 for the first event recorded, then increasing by one
+  std::string id;         // SDK event id, e.g. "job.delivered"
+  SCS::Timestamps timestamps;
+  uint32_t gameTime = 0;             // In-game minutes (CommonData::game_time) when the event arrived
+  SCS::SpecialEvents specialEvents;  // The one-frame flags this event raised, if any
+  std::vector<RecordedEventAttribute> attributes;
+
+  const RecordedEventAttribute* FindAttribute(std::string_view name, uint32_t index = SCS_U32_NIL) const;
+
+  template <typename T>
+  std::optional<T> Get(std::string_view name, uint32_t index = SCS_U32_NIL) const {
+    const auto* attr = FindAttribute(name, index);
+    T value{};
+    if (attr && attr->Read(value)) return value;
+    return std::nullopt;
+  }
+};
+
+/**
+ * @class GameplayEventHistory
+ * @brief A bounded ring buffer of the most recent gameplay events.
+ *
+ * The special event flags only last one frame and the service keeps just the last event of
+ * each kind, so a consumer that does not look every frame misses events. The history keeps
+ * the last GetCapacity() events with their timestamps and attributes; consumers keep a
+ * cursor (the sequence of the last event they read) and catch up whenever they like.
+ *
+ * Slots are overwritten in place, so once the buffer is full recording reuses the string
+ * and vector storage of the event it replaces. Recording happens on the game thread; reads
+ * may come from any thread and run the visitor under the history's lock, so a visitor must
+ * not call back into the history.
+ */
+class GameplayEventHistory {
+ public:
+  static constexpr size_t DefaultCapacity = 128;
+
+  explicit GameplayEventHistory(size_t capacity = DefaultCapacity);
+
+  /**
+   * @brief Appends an event, overwriting the oldest one once the buffer is full.
+   */
+  void Record(const scs_telemetry_gameplay_event_t& info, const SCS::SpecialEvents& raised, const SCS::Timestamps& timestamps, uint32_t gameTime);
+
+  size_t GetCapacity() const { return m_slots.size(); }
+
+  /// Sequence of the newest event, or 0 if nothing was recorded yet.
+  uint64_t GetLatestSequence() const;
+
+  /// Sequence of the oldest event still held, or 0 if the history is empty.
+  uint64_t GetOldestSequence() const;
+
+  /**
+   * @brief Visits the held events with a sequence greater than `after`, oldest first.
+   * @param id If not empty, only events with this id are visited.
+   * @param visitor `bool(const RecordedEvent&)`; return false to stop.
+   * @return The number of events visited.
+   */
+  template <typename Visitor>
+  size_t Query(uint64_t after, std::string_view id, Visitor&& visitor) const {
+    std::lock_guard lock(m_mutex);
+    size_t visited = 0;
+    for (uint64_t sequence = FirstAfter(after); sequence <= m_latest; ++sequence) {
+      const auto& event = Slot(sequence);
+      if (!id.empty() && event.id != id) continue;
+      ++visited;
+      if (!visitor(event)) break;
+    }
+    return visited;
+  }
+
+  /**
+   * @brief Visits the events after `cursor`, oldest first, and advances `cursor` past every
+   *        event visited. Stops early if the visitor returns false.
+   * @param missed If not null, receives the number of events after `cursor` that were
+   *        already overwritten and can no longer be read.
+   * @return The number of events visited.
+   */
+  template <typename Visitor>
+  size_t Read(uint64_t& cursor, Visitor&& visitor, uint64_t* missed = nullptr) const {
+    std::lock_guard lock(m_mutex);
+    const uint64_t first = FirstAfter(cursor);
+    if (missed) *missed = first - cursor - 1;
+    size_t visited = 0;
+    for (uint64_t sequence = first; sequence <= m_latest; ++sequence) {
+      ++visited;
+      cursor = sequence;
+      if (!visitor(Slot(sequence))) break;
+    }
+    return visited;
+  }
+
+ private:
+  /// First held sequence greater than `after` (greater than m_latest if there is none).
+  uint64_t FirstAfter(uint64_t after) const;
+  const RecordedEvent& Slot(uint64_t sequence) const { return m_slots[(sequence - 1) % m_slots.size()]; }
+
+  mutable std::mutex m_mutex;
+  std::vector<RecordedEvent> m_slots;
+  uint64_t m_latest = 0;
+};
+}  // namespace Telemetry
+SPF_NS_END
@@ -4,6 +4,7 @@
 #include "SPF/Telemetry/SCS/Job.hpp"
 #include "SPF/Telemetry/SCS/Navigation.hpp"
 #include "SPF/Telemetry/Sdk.hpp"
+#include "SPF/Telemetry/TelemetryFields.hpp"
 
 SPF_NS_BEGIN
 
@@ -28,7 +29,6 @@ class JobProcessor {
   void Shutdown();
 
   void HandleConfiguration(const scs_telemetry_configuration_t* info);
-  void HandleChannelUpdate(const scs_string_t name, const scs_u32_t index, const scs_value_t* value);
 
   const SCS::JobConstants& GetJobConstants() const { return m_jobConstants; }
   const SCS::JobData& GetJobData() const { return m_jobData; }
@@ -36,6 +36,10 @@ class JobProcessor {
   const SCS::NavigationData& GetNavigationData() const { return m_navigationData; }
   SCS::NavigationData& GetMutableNavigationData() { return m_navigationData; }
 
+  // Fields whose values changed since the service last collected them (see SCSTelemetryService::HandleFrameStart).
+  const FieldMask& GetChangedFields() const { return m_changedFields; }
+  FieldMask& GetMutableChangedFields() { return m_changedFields; }
+
  private:
   Logging::Logger& m_logger;
   GameContext& m_context;
@@ -43,6 +47,7 @@ class JobProcessor {
   SCS::JobConstants m_jobConstants;
   SCS::JobData m_jobData;
   SCS::NavigationData m_navigationData;
+  FieldMask m_changedFields;
 };
 
 }  // namespace Telemetry
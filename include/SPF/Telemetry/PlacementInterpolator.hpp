@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/Telemetry/SCS/Truck.hpp"
+#include "SPF/Telemetry/Sdk.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+/**
+ * @struct InterpolatedPlacements
+ * @brief Truck placements evaluated at the render time of the current frame.
+ */
+struct InterpolatedPlacements {
+  scs_value_dplacement_t world_placement = {};
+  scs_value_fplacement_t cabin_offset = {};
+  scs_value_fplacement_t head_offset = {};
+
+  uint64_t render_time = 0;  // Render timestamp (µs) the placements were evaluated at
+  // Position between the two samples: 0 = older, 1 = newer, above 1 = extrapolated.
+  float alpha = 1.0f;
+  bool valid = false;  // At least one sample was recorded since the last reset
+};
+
+/**
+ * @class PlacementInterpolator
+ * @brief Smooths the truck placements between simulation steps.
+ *
+ * The SDK updates placements once per simulation step, which runs at a fixed rate while
+ * frames are rendered at whatever rate the display allows, so the simulation timestamp
+ * advances in steps and oscillates around the render timestamp. The interpolator keeps
+ * the placements of the last two simulation steps and, once per rendered frame, evaluates
+ * them at the render timestamp: between the two samples it interpolates, past the newer
+ * one it extrapolates by at most one step.
+ *
+ * Samples are added on the game thread; Update() and Get() may be called from any thread.
+ */
+class PlacementInterpolator {
+ public:
+  /// Extrapolation never reaches further past the newest sample than this many sample intervals.
+  static constexpr float MaxExtrapolation = 1.0f;
+  /// Samples further apart than this (µs) are not blended, e.g. after a pause or a teleport.
+  static constexpr uint64_t MaxSampleInterval = 250000;
+
+  /**
+   * @brief Records the placements of a frame once its channel values have arrived.
+   *        Frames that did not advance the simulation replace nothing.
+   */
+  void AddSample(const SCS::Timestamps& timestamps, const SCS::TruckData& truck);
+
+  /**
+   * @brief Evaluates the placements at the render time of the newest frame.
+   */
+  void Update();
+
+  /**
+   * @brief Drops all samples, e.g. when the game restarts its timers.
+   */
+  void Reset();
+
+  InterpolatedPlacements Get() const;
+
+ private:
+  struct Sample {
+    uint64_t simulationTime = 0;
+    scs_value_dplacement_t world_placement = {};
+    scs_value_fplacement_t cabin_offset = {};
+    scs_value_fplacement_t head_offset = {};
+  };
+
+  mutable std::mutex m_mutex;
+  std::array<Sample, 2> m_samples = {};  // [0] older, [1] newer
+  size_t m_sampleCount = 0;
+  uint64_t m_renderTime = 0;
+  InterpolatedPlacements m_result;
+};
+}  // namespace Telemetry
+SPF_NS_END
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/Telemetry/Sdk.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry::Recording {
+/**
+ * @brief On-disk layout of a telemetry recording (`.spftrec`).
+ *
+ * A recording is the raw SDK stream exactly as a telemetry plugin receives it:
+ *
+ *   FileHeader | record* | index entries | FileFooter
+ *
+ * Every record starts with a one-byte RecordType followed by a varint-encoded payload.
+ * Channel values are delta-encoded: each 32-bit word is XORed with the same word of the
+ * previous value of that channel and written as a varint, so unchanged values cost one
+ * byte per word. The delta state is reset at every Keyframe record, which makes each
+ * keyframe a valid starting point for decoding. The footer points at a table of
+ * keyframe offsets; a file without a valid footer (e.g. after a crash) is still
+ * readable, and the reader rebuilds the table by scanning.
+ */
+namespace Format {
+inline constexpr char HeaderMagic[8] = {'S', 'P', 'F', 'T', 'R', 'E', 'C', '1'};
+inline constexpr char FooterMagic[8] = {'S', 'P', 'F', 'T', 'I', 'D', 'X', '1'};
+inline constexpr uint32_t Version = 1;
+inline constexpr uint32_t DefaultKeyframeInterval = 60;
+}  // namespace Format
+
+enum class RecordType : uint8_t {
+  ChannelRegistered = 1,    // varint id, string name, varint index, varint type, varint flags
+  ChannelUnregistered = 2,  // varint id
+  ChannelValue = 3,         // varint id, u8 type (0 = no value), delta-encoded words / string
+  FrameStart = 4,           // varint flags, zigzag deltas of render/simulation/paused-simulation time
+  FrameEnd = 5,
+  Paused = 6,
+  Started = 7,
+  Configuration = 8,  // string id, attribute list
+  Gameplay = 9,       // string id, attribute list
+  Keyframe = 10,      // varint frame number; resets the delta state
+};
+
+#pragma pack(push, 1)
+struct FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t keyframeInterval;
+  uint32_t gameVersion;
+  char gameId[32];
+  char gameName[64];
+};
+
+struct IndexEntry {
+  uint64_t frame;   // Frame number of the keyframe.
+  uint64_t offset;  // File offset of the Keyframe record.
+};
+
+struct FileFooter {
+  uint64_t indexOffset;
+  uint64_t indexCount;
+  char magic[8];
+};
+#pragma pack(pop)
+
+// --- Value encoding shared by the recorder and the replayer ---
+
+/// Number of payload bytes a value type occupies on disk (strings are length-prefixed instead).
+size_t ValuePayloadSize(scs_value_type_t type);
+
+void WriteVarint(std::vector<uint8_t>& out, uint64_t value);
+void WriteString(std::vector<uint8_t>& out, const char* str);
+inline uint64_t ZigZag(int64_t value) { return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63); }
+inline int64_t UnZigZag(uint64_t value) { return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1); }
+
+/// Writes a full (non-delta) value, used for configuration and gameplay attributes.
+void WriteValue(std::vector<uint8_t>& out, const scs_value_t& value);
+/// Writes a named value list terminated by the SDK's null-name sentinel.
+void WriteAttributes(std::vector<uint8_t>& out, const scs_named_value_t* attributes);
+
+/**
+ * @class Reader
+ * @brief Bounds-checked cursor over a mapped record stream.
+ *
+ * Any read past the end sets the failed flag and returns zeros, so callers can decode a
+ * whole record and check `Failed()` once.
+ */
+class Reader {
+ public:
+  Reader(const uint8_t* data, size_t size, size_t offset = 0) : m_data(data), m_size(size), m_offset(offset) {}
+
+  bool AtEnd() const { return m_offset >= m_size; }
+  bool Failed() const { return m_failed; }
+  size_t Offset() const { return m_offset; }
+  void Seek(size_t offset) { m_offset = offset; }
+
+  uint8_t ReadByte();
+  uint64_t ReadVarint();
+  std::string ReadString();
+  void ReadBytes(void* out, size_t size);
+
+ private:
+  const uint8_t* m_data;
+  size_t m_size;
+  size_t m_offset;
+  bool m_failed = false;
+};
+
+/// Reads a value written by WriteValue. String values point into `storage`.
+void ReadValue(Reader& reader, scs_value_t& value, std::string& storage);
+}  // namespace Telemetry::Recording
+SPF_NS_END
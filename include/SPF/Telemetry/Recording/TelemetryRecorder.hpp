@@ -0,0 +1,118 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/Telemetry/Sdk.hpp"
+#include "SPF/Telemetry/Recording/RecordingFormat.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry::Recording {
+/**
+ * @class TelemetryRecorder
+ * @brief Captures the raw SCS telemetry stream into a `.spftrec` file.
+ *
+ * The recorder sits between the game and the telemetry consumer. `Start()` returns a
+ * copy of the game's init params whose register/unregister functions route through the
+ * recorder: every channel value, configuration, frame, pause/start and gameplay event is
+ * written to the file and then forwarded unchanged to the consumer's callback. Because
+ * the capture happens at the SDK boundary, a recording can be fed back to any consumer
+ * of the SDK (see TelemetryReplayer).
+ *
+ * Only one recorder can be active at a time, since the SDK's registration functions
+ * carry no context pointer.
+ */
+class TelemetryRecorder {
+ public:
+  TelemetryRecorder() = default;
+  ~TelemetryRecorder();
+
+  TelemetryRecorder(const TelemetryRecorder&) = delete;
+  TelemetryRecorder& operator=(const TelemetryRecorder&) = delete;
+
+  /**
+   * @brief Creates the recording file and returns the params to hand to the consumer.
+   * @param path Destination file.
+   * @param gameParams The params received from the game in `scs_telemetry_init`.
+   * @param keyframeInterval Number of frames between seekable keyframes.
+   * @return Interposed params (owned by the recorder), or nullptr on failure (see GetLastError).
+   */
+  const scs_telemetry_init_params_v100_t* Start(const std::string& path, const scs_telemetry_init_params_v100_t* gameParams,
+                                                uint32_t keyframeInterval = Format::DefaultKeyframeInterval);
+
+  /**
+   * @brief Writes the keyframe index and closes the file.
+   *
+   * Callbacks keep being forwarded to the consumer after the recording is stopped.
+   */
+  void Stop();
+
+  bool IsRecording() const { return m_file.is_open(); }
+  uint64_t GetFrameCount() const { return m_frame; }
+  uint64_t GetBytesWritten() const { return m_fileOffset + m_buffer.size(); }
+  const std::string& GetLastError() const { return m_lastError; }
+
+ private:
+  // Callback context for one registered channel.
+  struct ChannelTap {
+    TelemetryRecorder* recorder = nullptr;
+    uint32_t id = 0;
+    std::string name;
+    scs_u32_t index = 0;
+    scs_value_type_t type = SCS_VALUE_TYPE_INVALID;
+    scs_telemetry_channel_callback_t callback = nullptr;
+    scs_context_t context = nullptr;
+    bool active = false;
+    std::array<uint32_t, 10> previous = {};  // Delta base; large enough for a dplacement.
+  };
+
+  // Callback context for one registered event.
+  struct EventTap {
+    TelemetryRecorder* recorder = nullptr;
+    scs_event_t event = 0;
+    scs_telemetry_event_callback_t callback = nullptr;
+    scs_context_t context = nullptr;
+  };
+
+  // --- Interposed SDK functions ---
+  static SCSAPI_RESULT RegisterForEvent(const scs_event_t event, const scs_telemetry_event_callback_t callback, const scs_context_t context);
+  static SCSAPI_RESULT UnregisterFromEvent(const scs_event_t event);
+  static SCSAPI_RESULT RegisterForChannel(const scs_string_t name, const scs_u32_t index, const scs_value_type_t type, const scs_u32_t flags,
+                                          const scs_telemetry_channel_callback_t callback, const scs_context_t context);
+  static SCSAPI_RESULT UnregisterFromChannel(const scs_string_t name, const scs_u32_t index, const scs_value_type_t type);
+
+  static SCSAPI_VOID EventTrampoline(const scs_event_t event, const void* const event_info, const scs_context_t context);
+  static SCSAPI_VOID ChannelTrampoline(const scs_string_t name, const scs_u32_t index, const scs_value_t* const value, const scs_context_t context);
+
+  // --- Record writers ---
+  void RecordEvent(scs_event_t event, const void* eventInfo);
+  void RecordChannelValue(ChannelTap& tap, const scs_value_t* value);
+  void WriteKeyframe();
+  void FlushIfNeeded();
+  void Flush();
+
+  static TelemetryRecorder* s_active;
+
+  const scs_telemetry_init_params_v100_t* m_gameParams = nullptr;
+  scs_telemetry_init_params_v100_t m_params = {};
+
+  std::ofstream m_file;
+  std::vector<uint8_t> m_buffer;
+  uint64_t m_fileOffset = 0;
+  uint32_t m_keyframeInterval = Format::DefaultKeyframeInterval;
+  uint64_t m_frame = 0;
+  std::vector<IndexEntry> m_index;
+  scs_telemetry_frame_start_t m_previousFrame = {};
+  std::string m_lastError;
+
+  // Taps are handed to the SDK by address, so they live in containers that never move them.
+  std::deque<ChannelTap> m_channelTaps;
+  std::array<EventTap, SCS_TELEMETRY_EVENT_gameplay + 1> m_eventTaps = {};
+};
+}  // namespace Telemetry::Recording
+SPF_NS_END
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/Telemetry/Sdk.hpp"
+#include "SPF/Telemetry/Recording/RecordingFormat.hpp"
+#include "SPF/Utils/MappedFile.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry::Recording {
+/**
+ * @class TelemetryReplayer
+ * @brief Feeds a `.spftrec` recording to a telemetry consumer in place of the game.
+ *
+ * The replayer plays the role of the game's telemetry API. A consumer is initialized with
+ * GetInitParams() (e.g. by passing them to a plugin's `scs_telemetry_init`), registers
+ * its events and channels through them as usual, and then receives the recorded stream
+ * through its own callbacks. Recorded channel values are matched to the consumer's
+ * registrations by channel name and index, so the consumer does not have to register
+ * exactly what the recording session did.
+ *
+ * The file is memory-mapped and decoded in place. Playback can run at the recorded
+ * pace (driven by the frames' render timestamps) or as fast as possible.
+ *
+ * Only one replayer can be active at a time, since the SDK's registration functions
+ * carry no context pointer.
+ */
+class TelemetryReplayer {
+ public:
+  enum class Pacing { RealTime, MaxSpeed };
+
+  TelemetryReplayer() = default;
+  ~TelemetryReplayer();
+
+  TelemetryReplayer(const TelemetryReplayer&) = delete;
+  TelemetryReplayer& operator=(const TelemetryReplayer&) = delete;
+
+  /**
+   * @brief Maps and validates a recording. Rebuilds the keyframe index if the file has no footer.
+   * @return False on failure (see GetLastError).
+   */
+  bool Open(const std::string& path);
+  void Close();
+
+  /**
+   * @brief Gets the params to initialize the consumer with. Valid while the replayer is open.
+   */
+  const scs_telemetry_init_params_v100_t* GetInitParams() const { return &m_params; }
+
+  /**
+   * @brief Positions playback at the keyframe at or before `frame`, then fast-forwards to `frame`.
+   *
+   * Configuration, pause and resume events recorded before the keyframe are delivered
+   * again so the consumer's constants match the recording at that point. Channels that
+   * are only sent on change may keep their previous values until they next change.
+   */
+  bool SeekToFrame(uint64_t frame);
+
+  /**
+   * @brief Delivers records up to and including the next frame end.
+   * @return False once the end of the recording is reached.
+   */
+  bool StepFrame();
+
+  /**
+   * @brief Plays the recording to the end or until `maxFrames` frames were delivered.
+   * @return Number of frames delivered.
+   */
+  uint64_t Run(Pacing pacing, uint64_t maxFrames = UINT64_MAX);
+
+  bool AtEnd() const;
+  uint64_t GetCurrentFrame() const { return m_currentFrame; }
+  const std::vector<IndexEntry>& GetKeyframes() const { return m_index; }
+  const FileHeader& GetHeader() const { return m_header; }
+  const std::string& GetLastError() const { return m_lastError; }
+
+ private:
+  enum class Delivery { None, Configuration, All };
+
+  // A channel as it was registered in the recording.
+  struct RecordedChannel {
+    std::string name;
+    scs_u32_t index = 0;
+    scs_value_type_t type = SCS_VALUE_TYPE_INVALID;
+    std::array<uint32_t, 10> previous = {};  // Delta base
+    int registration = -1;                  // Resolved consumer registration, or -1
+    uint64_t resolvedGeneration = 0;         // m_registrationGeneration when resolved
+  };
+
+  // A channel registration made by the consumer.
+  struct Registration {
+    std::string name;
+    scs_u32_t index = 0;
+    scs_value_type_t type = SCS_VALUE_TYPE_INVALID;
+    scs_u32_t flags = 0;
+    scs_telemetry_channel_callback_t callback = nullptr;
+    scs_context_t context = nullptr;
+    bool active = false;
+  };
+
+  struct EventRegistration {
+    scs_telemetry_event_callback_t callback = nullptr;
+    scs_context_t context = nullptr;
+  };
+
+  // --- Replacement SDK functions handed to the consumer ---
+  static SCSAPI_RESULT RegisterForEvent(const scs_event_t event, const scs_telemetry_event_callback_t callback, const scs_context_t context);
+  static SCSAPI_RESULT UnregisterFromEvent(const scs_event_t event);
+  static SCSAPI_RESULT RegisterForChannel(const scs_string_t name, const scs_u32_t index, const scs_value_type_t type, const scs_u32_t flags,
+                                          const scs_telemetry_channel_callback_t callback, const scs_context_t context);
+  static SCSAPI_RESULT UnregisterFromChannel(const scs_string_t name, const scs_u32_t index, const scs_value_type_t type);
+  static SCSAPI_VOID Log(const scs_log_type_t type, const scs_string_t message);
+
+  // --- Decoding ---
+  bool ProcessRecord(Delivery delivery, RecordType* outType = nullptr);
+  void ResetDecoderState();
+  bool BuildIndexByScanning();
+  void DeliverEvent(scs_event_t event, const void* info) const;
+  void DecodeAttributes(Reader& reader);
+  const Registration* ResolveChannel(RecordedChannel& channel);
+
+  static TelemetryReplayer* s_active;
+
+  Utils::MappedFile m_file;
+  FileHeader m_header = {};
+  size_t m_recordsBegin = 0;
+  size_t m_recordsEnd = 0;
+  std::vector<IndexEntry> m_index;
+  Reader m_reader{nullptr, 0};
+  std::string m_lastError;
+
+  scs_telemetry_init_params_v100_t m_params = {};
+  std::string m_gameId;
+  std::string m_gameName;
+
+  // Decoder state
+  std::vector<RecordedChannel> m_recordedChannels;
+  scs_telemetry_frame_start_t m_frame = {};
+  uint64_t m_currentFrame = 0;
+  Pacing m_pacing = Pacing::MaxSpeed;
+  std::chrono::steady_clock::time_point m_paceStart;
+  scs_timestamp_t m_paceStartRenderTime = 0;
+  bool m_paceAnchored = false;
+
+  // Scratch storage for decoded configuration/gameplay attributes
+  std::vector<scs_named_value_t> m_attributes;
+  std::deque<std::string> m_attributeStrings;
+
+  // Consumer registrations
+  std::vector<Registration> m_registrations;
+  uint64_t m_registrationGeneration = 1;
+  std::array<EventRegistration, SCS_TELEMETRY_EVENT_gameplay + 1> m_events = {};
+};
+}  // namespace Telemetry::Recording
+SPF_NS_END
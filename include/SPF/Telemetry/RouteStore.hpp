@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/Telemetry/Sdk.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+/**
+ * @struct RoutePoint
+ * @brief One vertex of the recorded route, or a position interpolated along it.
+ */
+struct RoutePoint {
+  double x = 0.0;
+  double y = 0.0;
+  double z = 0.0;
+  float heading = 0.0f;  // Turns, as in the SDK placements
+  uint64_t time = 0;     // Simulation timestamp (µs)
+};
+
+struct RouteMatch {
+  RoutePoint point;       // Closest position on the route
+  double distance = 0.0;  // Horizontal (x/z) distance from the query position, in meters
+};
+
+struct RouteStats {
+  uint64_t samples = 0;  // Positions offered to the store
+  uint64_t points = 0;   // Vertices kept after simplification
+  uint64_t tracks = 0;   // Continuous pieces; a new one starts after a teleport, ferry or reload
+  uint64_t memoryBytes = 0;
+  double length = 0.0;  // Meters along the kept vertices
+};
+
+/**
+ * @class RouteStore
+ * @brief The path the truck drove, kept compact enough for sessions of many hours.
+ *
+ * Positions are simplified online with an opening-window variant of Douglas-Peucker:
+ * samples are collected while every one of them lies within Tolerance of the straight
+ * line from the last kept vertex to the newest sample, and the sample before the first
+ * one that does not becomes the next vertex. A straight highway therefore costs one
+ * vertex every MaxSegmentLength meters.
+ *
+ * Vertices are quantized to Quantum meters relative to the origin of a chunk and to
+ * milliseconds relative to its start time, 12 bytes each. Every vertex is entered,
+ * together with the segment leading to it, into a uniform grid of CellSize cells, which
+ * answers "nearest point on my past route" and bounding-box queries without scanning.
+ *
+ * All members may be called from any thread.
+ */
+class RouteStore {
+ public:
+  static constexpr double Tolerance = 1.0;  // Maximum deviation of a dropped sample from the kept line, in meters
+  static constexpr double MinSpacing = 2.0;  // Samples closer than this to the previous one are ignored
+  static constexpr double MaxSegmentLength = 250.0;
+  // A jump between two consecutive samples longer than this starts a new track.
+  static constexpr double BreakDistance = 500.0;
+  static constexpr double Quantum = 0.1;
+  static constexpr double CellSize = 256.0;
+  static constexpr size_t ChunkCapacity = 4096;
+
+  /**
+   * @brief Offers the truck position of a frame to the store.
+   */
+  void AddSample(const scs_value_dplacement_t& placement, uint64_t time);
+
+  /**
+   * @brief Ends the current track; the next sample starts a new one. Used when positions
+   *        stop being sampled for a while or the game reloads.
+   */
+  void Break();
+
+  void Clear();
+
+  /**
+   * @brief Finds the closest position on the route, measured horizontally.
+   * @param maxDistance Positions further away than this are not considered. Infinity
+   *        searches the whole route. Nothing is found if any argument is NaN.
+   */
+  std::optional<RouteMatch> FindNearest(double x, double z, double maxDistance) const;
+
+  /**
+   * @brief Collects the vertices that lie within an x/z bounding box, oldest first per chunk.
+   *        Edges may be infinite; nothing is found if one is NaN.
+   * @param out Receives at most `maxCount` points.
+   * @return The number of vertices in the box, which may exceed `maxCount`.
+   */
+  size_t FindInBox(double minX, double minZ, double maxX, double maxZ, std::vector<RoutePoint>& out, size_t maxCount) const;
+
+  RouteStats GetStats() const;
+
+  /**
+   * @brief Writes the route to a `.spfroute` file, keeping the vertex pending in the
+   *        simplifier. Load() replaces the route with one read from such a file.
+   */
+  bool Save(const std::string& path);
+  bool Load(const std::string& path);
+
+ private:
+  struct PackedPoint {
+    int16_t x;
+    int16_t y;
+    int16_t z;
+    uint16_t heading;  // Turns * 65536
+    uint32_t time;     // Milliseconds since the chunk's start time
+  };
+
+  struct Chunk {
+    double originX = 0.0;
+    double originY = 0.0;
+    double originZ = 0.0;
+    uint64_t startTime = 0;
+    bool continuesPrevious = false;  // The first point is connected to the last point of the previous chunk
+    std::vector<PackedPoint> points;
+  };
+
+  // Reference to a vertex: chunk index << PointBits | point index.
+  using PointRef = uint32_t;
+  static constexpr uint32_t PointBits = 12;
+  // Cell coordinates are clamped to this, so queries far outside any map (or infinite) stay
+  // representable and ring arithmetic cannot overflow.
+  static constexpr int64_t MaxCell = int64_t{1} << 40;
+
+  void Commit(const RoutePoint& point, bool startsTrack);
+  void FlushWindow();
+  bool Fits(const Chunk& chunk, const RoutePoint& point) const;
+  void Index(PointRef ref);
+  RoutePoint Unpack(PointRef ref) const;
+  std::optional<PointRef> Predecessor(PointRef ref) const;
+  static uint64_t CellKey(int64_t cellX, int64_t cellZ);
+  static int64_t CellOf(double coordinate);
+
+  mutable std::mutex m_mutex;
+  std::vector<Chunk> m_chunks;
+  std::unordered_map<uint64_t, std::vector<PointRef>> m_grid;
+  RouteStats m_stats;
+
+  // Simplifier state.
+  std::optional<RoutePoint> m_anchor;  // Last kept vertex
+  std::vector<RoutePoint> m_window;    // Samples since the anchor, none of them kept yet
+  std::optional<RoutePoint> m_lastSample;
+  bool m_breakPending = false;
+};
+}  // namespace Telemetry
+SPF_NS_END
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <array>
+#include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <ctime>  // For time_t
 #include <string>
@@ -70,6 +73,107 @@ struct WheelData {
   uint32_t substance = 0;
 };
 
+/// Capacity of WheelDataStore (equal to SPF_TELEMETRY_WHEEL_MAX_COUNT).
+inline constexpr size_t WheelMaxCount = 32;
+
+/**
+ * @class WheelDataStore
+ * @brief The per-wheel data of one vehicle, stored as one contiguous array per member.
+ *
+ * Wheel channels are written one member at a time, and the consumers (C conversion,
+ * derived channels) read one member across all wheels, so a structure of arrays keeps
+ * those loops on contiguous floats the compiler can vectorize. The store has a fixed
+ * capacity, so copying it into a snapshot does not allocate.
+ *
+ * `operator[]` and range-for return WheelData copies, so code written against the
+ * former `std::vector<WheelData>` keeps working for reading. Wheels past the capacity
+ * are dropped.
+ */
+class WheelDataStore {
+ public:
+  class const_iterator {
+   public:
+    using value_type = WheelData;
+    using difference_type = std::ptrdiff_t;
+
+    const_iterator() = default;
+    const_iterator(const WheelDataStore* store, size_t index) : m_store(store), m_index(index) {}
+
+    WheelData operator*() const { return (*m_store)[m_index]; }
+    const_iterator& operator++() {
+      ++m_index;
+      return *this;
+    }
+    const_iterator operator++(int) {
+      const_iterator previous = *this;
+      ++m_index;
+      return previous;
+    }
+    bool operator==(const const_iterator& other) const { return m_index == other.m_index; }
+
+   private:
+    const WheelDataStore* m_store = nullptr;
+    size_t m_index = 0;
+  };
+
+  size_t size() const { return m_count; }
+  bool empty() const { return m_count == 0; }
+
+  /**
+   * @brief Sets the wheel count (clamped to WheelMaxCount). Wheels beyond the new count are reset.
+   */
+  void resize(size_t count) {
+    count = count < WheelMaxCount ? count : WheelMaxCount;
+    for (size_t i = count; i < m_count; ++i) {
+      Set(i, WheelData{});
+    }
+    m_count = static_cast<uint32_t>(count);
+  }
+
+  /**
+   * @brief Returns a copy of one wheel in the WheelData layout.
+   */
+  WheelData operator[](size_t index) const {
+    WheelData wheel;
+    wheel.on_ground = on_ground.test(index);
+    wheel.suspension_deflection = suspension_deflection[index];
+    wheel.angular_velocity = angular_velocity[index];
+    wheel.steering = steering[index];
+    wheel.rotation = rotation[index];
+    wheel.lift = lift[index];
+    wheel.lift_offset = lift_offset[index];
+    wheel.substance = substance[index];
+    return wheel;
+  }
+
+  void Set(size_t index, const WheelData& wheel) {
+    on_ground.set(index, wheel.on_ground);
+    suspension_deflection[index] = wheel.suspension_deflection;
+    angular_velocity[index] = wheel.angular_velocity;
+    steering[index] = wheel.steering;
+    rotation[index] = wheel.rotation;
+    lift[index] = wheel.lift;
+    lift_offset[index] = wheel.lift_offset;
+    substance[index] = wheel.substance;
+  }
+
+  const_iterator begin() const { return {this, 0}; }
+  const_iterator end() const { return {this, m_count}; }
+
+  // Only the first size() elements of each array are meaningful; the rest stay zero.
+  std::bitset<WheelMaxCount> on_ground;
+  std::array<float, WheelMaxCount> suspension_deflection = {};
+  std::array<float, WheelMaxCount> angular_velocity = {};  // Rotations per second
+  std::array<float, WheelMaxCount> steering = {};
+  std::array<float, WheelMaxCount> rotation = {};
+  std::array<float, WheelMaxCount> lift = {};
+  std::array<float, WheelMaxCount> lift_offset = {};
+  std::array<uint32_t, WheelMaxCount> substance = {};
+
+ private:
+  uint32_t m_count = 0;
+};
+
 }  // namespace SCS
 }  // namespace Telemetry
 SPF_NS_END
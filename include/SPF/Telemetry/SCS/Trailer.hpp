@@ -36,13 +36,12 @@ struct TrailerData {
   float wear_body = 0.0f;
   float wear_chassis = 0.0f;
   float wear_wheels = 0.0f;
-  std::vector<WheelData> wheels;
+  WheelDataStore wheels;
 };
 
 struct Trailer {
   TrailerConstants constants;
   TrailerData data;
-  bool channels_registered = false;  // Internal flag for the processor
 };
 }  // namespace SCS
 }  // namespace Telemetry
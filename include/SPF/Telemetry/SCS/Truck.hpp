@@ -132,7 +132,7 @@ struct TruckData {
   uint32_t hshifter_slot = 0;
   std::vector<bool> hshifter_selector;
 
-  std::vector<WheelData> wheels;
+  WheelDataStore wheels;
 };
 }  // namespace SCS
 }  // namespace Telemetry
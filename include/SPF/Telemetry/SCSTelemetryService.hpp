@@ -1,12 +1,27 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "SPF/Namespace.hpp"
 #include "SPF/Modules/ITelemetryService.hpp"
 #include "SPF/Utils/Signal.hpp"
 #include "SPF/Telemetry/SCS/Gearbox.hpp"
+#include "SPF/Telemetry/ChannelBinding.hpp"
+#include "SPF/Telemetry/ChannelGroups.hpp"
+#include "SPF/Telemetry/ChannelSubscriptions.hpp"
+#include "SPF/Telemetry/DerivedChannels.hpp"
+#include "SPF/Telemetry/FieldAggregator.hpp"
+#include "SPF/Telemetry/FieldHistory.hpp"
+#include "SPF/Telemetry/PlacementInterpolator.hpp"
+#include "SPF/Telemetry/RouteStore.hpp"
+#include "SPF/Telemetry/TelemetryFields.hpp"
+#include "SPF/Telemetry/TelemetrySnapshot.hpp"
+#include "SPF/Telemetry/TelemetryTiming.hpp"
+#include "SPF/Telemetry/TriggerEngine.hpp"
 #include "SPF/Telemetry/Sdk.hpp"
 #include <chrono>
 
@@ -37,7 +52,13 @@ namespace Telemetry {
  * @brief The public-facing implementation of the ITelemetryService for SCS SDK.
  *
  * This class acts as a router, delegating SDK events and data processing
- * to specialized processor classes.
+ * to specialized processor classes. Channel values bypass the router entirely:
+ * every channel is registered with a ChannelBinding that writes straight into
+ * the owning processor's data.
+ *
+ * Channels are registered per ChannelGroup, only while a consumer holds a lease for
+ * the group (see AcquireChannels). Demand changes are applied from event callbacks,
+ * the only place the SDK allows (un)registration.
  */
 class SCSTelemetryService final : public Modules::ITelemetryService {
  public:
@@ -48,6 +69,12 @@ class SCSTelemetryService final : public Modules::ITelemetryService {
   void Initialize(const scs_telemetry_init_params_t* const params);
   void Shutdown();
 
+  /**
+   * @brief Evaluates the interpolated placements for the frame being rendered.
+   *        Called by the core once per visual frame, before plugins update.
+   */
+  void UpdateInterpolatedPlacements();
+
   // --- ITelemetryService Implementation ---
   const SCS::GameState& GetGameState() const override;
   const SCS::Timestamps& GetTimestamps() const override;
@@ -63,7 +90,20 @@ class SCSTelemetryService final : public Modules::ITelemetryService {
   const SCS::GameplayEvents& GetGameplayEvents() const override;
   const SCS::GearboxConstants& GetGearboxConstants() const override;
   const std::string& GetLastGameplayEventId() const override;
+  const DerivedData& GetDerivedData() const override;
+  const GameplayEventHistory& GetGameplayEventHistory() const override;
+  InterpolatedPlacements GetInterpolatedPlacements() const override;
+  RouteStore& GetRouteStore() override;
   float GetDeltaTime() const override;
+  uint64_t GetDataRevision() const override;
+  std::shared_ptr<const TelemetrySnapshot> GetSnapshot() const override;
+  const FieldMask& GetChangedFields() const override;
+  FieldAggregator& GetFieldAggregator() override;
+  FieldHistory& GetFieldHistory() override;
+  FieldHistoryLease RecordFieldHistory(std::span<const Field> fields) override;
+  ChannelLease AcquireChannels(const ChannelGroupMask& groups) override;
+  ChannelSubscription SubscribeToChannel(std::string_view name, uint32_t index, ChannelCallback callback, bool changesOnly) override;
+  TriggerSubscription AddTrigger(std::span<const TriggerCondition> conditions, const TriggerOptions& options, TriggerCallback callback) override;
 
   // --- Signal Accessors (ITelemetryService Implementation) ---
   Utils::Signal<void(const SPF::Telemetry::SCS::GameState&)>& GetGameStateSignal() override;
@@ -80,29 +120,76 @@ class SCSTelemetryService final : public Modules::ITelemetryService {
   Utils::Signal<void(const SPF::Telemetry::SCS::SpecialEvents&)>& GetSpecialEventsSignal() override;
   Utils::Signal<void(const char*, const SPF::Telemetry::SCS::GameplayEvents&)>& GetGameplayEventsSignal() override;
   Utils::Signal<void(const SPF::Telemetry::SCS::GearboxConstants&)>& GetGearboxConstantsSignal() override;
+  Utils::Signal<void(const TelemetrySnapshot&, const FieldMask&)>& GetFieldsChangedSignal() override;
+  Utils::Signal<void(const DerivedData&)>& GetDerivedDataSignal() override;
+
+  // Number of per-wheel channels the SDK exposes for each truck/trailer wheel.
+  static constexpr size_t WheelChannelCount = 8;
+  // Number of non-wheel channels the SDK exposes for each trailer.
+  static constexpr size_t TrailerChannelCount = 10;
 
   // --- Static Callbacks for SCS SDK ---
   static void StaticConfigurationCallback(scs_event_t event, const void* event_info, scs_context_t context);
   static void StaticFrameStartCallback(scs_event_t event, const void* event_info, scs_context_t context);
+  static void StaticFrameEndCallback(scs_event_t event, const void* event_info, scs_context_t context);
   static void StaticPausedCallback(scs_event_t event, const void* event_info, scs_context_t context);
   static void StaticStartedCallback(scs_event_t event, const void* event_info, scs_context_t context);
   static void StaticGameplayEventCallback(scs_event_t event, const void* event_info, scs_context_t context);
-  static void StaticChannelCallback(const scs_string_t name, const scs_u32_t index, const scs_value_t* value, scs_context_t context);
 
  private:
   // --- Internal Event Handlers (Routers) ---
   void HandleConfiguration(const scs_telemetry_configuration_t* info);
   void HandleFrameStart(const scs_telemetry_frame_start_t* info);
+  void HandleFrameEnd();
   void HandleGameplayEvent(const scs_telemetry_gameplay_event_t* info);
   void HandlePaused();
   void HandleStarted();
-  void HandleChannelUpdate(const scs_string_t name, const scs_u32_t index, const scs_value_t* value);
 
-  // --- Dynamic Channel Registration ---
+  /**
+   * @brief Copies the current processor state into a snapshot and publishes it.
+   *
+   * Snapshots are recycled from a small pool once no consumer references them any more,
+   * so in steady state publishing reuses existing string and vector storage. A slot is
+   * marked free by the deleter of the last reference (release) and checked before reuse
+   * (acquire), which orders the consumers' last reads before the next writes.
+   */
+  void PublishSnapshot();
+
+  /**
+   * @brief Moves the processors' change masks into m_changedFields and m_changedTrailers and clears them.
+   */
+  void CollectChangedFields();
+
+  // --- Channel Registration ---
+
+  /**
+   * @brief Resolves the bindings of every channel table entry and builds the trailer channel names.
+   */
+  void BindChannels();
+
+  /**
+   * @brief Registers and unregisters channels to match the current demand and configuration.
+   *        Only does work when either changed; must be called from an SDK event callback.
+   */
+  void ApplyChannelDemand();
+  void ApplyChannelGroups(const ChannelGroupMask& groups);
+
+  void UpdateTableChannels(const ChannelGroupMask& groups);
+  void UpdateTrailerChannels(scs_u32_t trailer_index, bool registered);
   void UpdateTruckWheelChannels(scs_u32_t wheel_count);
   void UpdateTrailerWheelChannels(scs_u32_t trailer_index, scs_u32_t wheel_count);
   void UpdateHShifterSelectorChannels(scs_u32_t selector_count);
 
+  /**
+   * @brief Lists every bound channel in the subscription registry, so names resolve to bindings.
+   */
+  void ListSubscribableChannels();
+
+  /**
+   * @brief Registers a channel again if it is registered, so the game resends its current value.
+   */
+  void RefreshChannel(const ChannelSubscriptionRegistry::ChannelInfo& channel, scs_u32_t index);
+
   // --- Processors ---
   std::unique_ptr<GameDataProcessor> m_gameDataProcessor;
   std::unique_ptr<TruckProcessor> m_truckProcessor;
@@ -112,6 +199,9 @@ class SCSTelemetryService final : public Modules::ITelemetryService {
   std::unique_ptr<ControlsProcessor> m_controlsProcessor;
   std::unique_ptr<GearboxProcessor> m_gearboxProcessor;
 
+  // Values computed from the processors' data once per frame.
+  std::unique_ptr<DerivedChannelRegistry> m_derivedChannels;
+
   // Common dependencies passed to processors
   Logging::Logger& m_logger;
   GameContext& m_context;
@@ -121,10 +211,84 @@ class SCSTelemetryService final : public Modules::ITelemetryService {
   scs_telemetry_register_for_channel_t m_register_for_channel = nullptr;
   scs_telemetry_unregister_from_channel_t m_unregister_from_channel = nullptr;
 
+  // Channel bindings handed to the SDK as callback contexts, one per channel table entry.
+  // Sized once in BindChannels() and never reallocated, so the addresses stay valid.
+  std::vector<ChannelBinding> m_channelBindings;
+  std::array<ChannelBinding, WheelChannelCount> m_truckWheelBindings = {};
+  ChannelBinding m_hshifterSelectorBinding = {};
+
+  struct TrailerChannels {
+    // "trailer.<index>.<suffix>", built once so registration does no formatting.
+    std::array<std::string, TrailerChannelCount> names;
+    std::array<std::string, WheelChannelCount> wheelNames;
+    std::array<ChannelBinding, TrailerChannelCount> bindings = {};
+    std::array<ChannelBinding, WheelChannelCount> wheelBindings = {};
+    bool configured = false;  // The trailer's configuration has been received at least once.
+    bool registered = false;
+    scs_u32_t registeredWheelCount = 0;
+  };
+  std::vector<TrailerChannels> m_trailerChannels;
+
+  // Channel demand shared with the leases handed out by AcquireChannels.
+  std::shared_ptr<ChannelDemand> m_channelDemand;
+  ChannelLease m_commonChannels;  // The service's own use of the common group.
+  uint64_t m_appliedDemandRevision = 0;
+  bool m_channelLayoutDirty = true;  // A configuration changed wheel, selector or trailer counts.
+
+  // Subscriptions to single channels, shared with the ChannelSubscription handles.
+  std::shared_ptr<ChannelSubscriptionRegistry> m_channelSubscriptions;
+
   // Tracking for dynamic channel registration
+  ChannelGroupMask m_registeredGroups;  // Groups whose table channels are registered
   scs_u32_t m_registered_truck_wheel_count = 0;
   scs_u32_t m_registered_hshifter_selector_count = 0;
-  std::vector<scs_u32_t> m_registered_trailer_wheel_counts;
+
+  // Incremented whenever new data is published (see ITelemetryService::GetDataRevision).
+  uint64_t m_dataRevision = 0;
+
+  // Fields changed between the two most recent frame starts.
+  FieldMask m_changedFields;
+
+  // Trailers whose channels or configuration changed between the two most recent frame starts.
+  TrailerMask m_changedTrailers;
+
+  // Windowed aggregates requested by consumers, sampled at every frame start.
+  FieldAggregator m_fieldAggregator;
+
+  // Recent history of the recorded fields, sampled at every frame start; shared with the FieldHistoryLease handles.
+  std::shared_ptr<FieldHistory> m_fieldHistory;
+
+  // Triggers added by consumers, evaluated at every frame start; shared with the TriggerSubscription handles.
+  std::shared_ptr<TriggerEngine> m_triggerEngine;
+
+  // Truck placements of the last two simulation steps, sampled at every frame end.
+  PlacementInterpolator m_placementInterpolator;
+
+  // The path driven, sampled at every frame end while the truck motion group is registered.
+  RouteStore m_routeStore;
+  bool m_routeSampling = false;
+
+  // --- Snapshots ---
+  struct SnapshotSlot {
+    TelemetrySnapshot snapshot;
+    std::atomic<bool> inUse = false;  // Cleared by the deleter of the published shared_ptr
+  };
+  static constexpr size_t SnapshotPoolSize = 4;
+  uint64_t m_frameId = 0;
+  std::vector<std::shared_ptr<SnapshotSlot>> m_snapshotPool;
+  std::atomic<std::shared_ptr<const TelemetrySnapshot>> m_latestSnapshot;
+
+  // Timing sections listed in the TimingRegistry; all null unless SPF_TELEMETRY_TIMING is on.
+  struct TimingSections {
+    std::shared_ptr<TimingHistogram> frameStart;  // The whole of HandleFrameStart
+    std::shared_ptr<TimingHistogram> processors;  // Processor frame start and cross-processor values
+    std::shared_ptr<TimingHistogram> derived;
+    std::shared_ptr<TimingHistogram> snapshot;
+    std::shared_ptr<TimingHistogram> dispatch;  // Signals, including every subscriber's callback
+    std::shared_ptr<TimingHistogram> channels;  // Channel (un)registration when demand changed
+    std::shared_ptr<TimingHistogram> configuration;
+    std::shared_ptr<TimingHistogram> gameplayEvent;
+  } m_timing;
 
   // Delta time calculation
   float m_deltaTime = 0.0f;
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+#include "SPF/Namespace.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+struct TelemetrySnapshot;
+
+/**
+ * @enum Field
+ * @brief Identifies a single scalar telemetry value that can be tracked for changes.
+ *
+ * Covers the per-frame scalars of the game state, common data, truck, controls, job and
+ * navigation, and the scalars computed by the derived channels. Vector/placement channels
+ * and per-wheel channels are not tracked individually; trailers are tracked as a whole,
+ * one bit per trailer (see TrailerMask).
+ *
+ * The numeric values are part of the plugin API (`SPF_Telemetry_Field`) and must not be
+ * reordered; new fields are appended before `Count`.
+ */
+enum class Field : uint16_t {
+  // Game state / common
+  GamePaused,
+  GameScale,
+  MultiplayerTimeOffset,
+  GameTime,
+  NextRestStop,
+
+  // Truck
+  TruckSpeed,
+  TruckEngineRpm,
+  TruckGear,
+  TruckDisplayedGear,
+  TruckCruiseControlSpeed,
+  TruckHShifterSlot,
+  TruckParkingBrake,
+  TruckMotorBrake,
+  TruckRetarderLevel,
+  TruckAirPressure,
+  TruckAirPressureWarning,
+  TruckAirPressureEmergency,
+  TruckBrakeTemperature,
+  TruckFuelAmount,
+  TruckFuelWarning,
+  TruckFuelAverageConsumption,
+  TruckFuelRange,
+  TruckAdblueAmount,
+  TruckAdblueWarning,
+  TruckOilPressure,
+  TruckOilPressureWarning,
+  TruckOilTemperature,
+  TruckWaterTemperature,
+  TruckWaterTemperatureWarning,
+  TruckBatteryVoltage,
+  TruckBatteryVoltageWarning,
+  TruckElectricEnabled,
+  TruckEngineEnabled,
+  TruckWipers,
+  TruckDifferentialLock,
+  TruckLiftAxle,
+  TruckLiftAxleIndicator,
+  TruckTrailerLiftAxle,
+  TruckTrailerLiftAxleIndicator,
+  TruckLBlinker,
+  TruckRBlinker,
+  TruckHazardWarning,
+  TruckLightLBlinker,
+  TruckLightRBlinker,
+  TruckLightParking,
+  TruckLightLowBeam,
+  TruckLightHighBeam,
+  TruckLightAuxFront,
+  TruckLightAuxRoof,
+  TruckLightBeacon,
+  TruckLightBrake,
+  TruckLightReverse,
+  TruckDashboardBacklight,
+  TruckWearEngine,
+  TruckWearTransmission,
+  TruckWearCabin,
+  TruckWearChassis,
+  TruckWearWheels,
+  TruckOdometer,
+
+  // Controls
+  UserSteering,
+  UserThrottle,
+  UserBrake,
+  UserClutch,
+  EffectiveSteering,
+  EffectiveThrottle,
+  EffectiveBrake,
+  EffectiveClutch,
+
+  // Job
+  JobCargoDamage,
+  JobRemainingDeliveryMinutes,
+
+  // Navigation
+  NavigationDistance,
+  NavigationTime,
+  NavigationSpeedLimit,
+  NavigationTimeRealSeconds,
+
+  // Derived (see DerivedData)
+  DerivedLongitudinalG,
+  DerivedLateralG,
+  DerivedVerticalG,
+  DerivedJerk,
+  DerivedMaxWheelSlip,
+  DerivedFuelEconomy,
+  DerivedTripFuelEconomy,
+  DerivedFuelRate,
+  DerivedTimeToEmpty,
+
+  Count
+};
+
+inline constexpr size_t FieldCount = static_cast<size_t>(Field::Count);
+
+/// One bit per Field; a set bit means the field's value changed.
+using FieldMask = std::bitset<FieldCount>;
+
+inline void MarkChanged(FieldMask& mask, Field field) { mask.set(static_cast<size_t>(field)); }
+
+/// Number of trailer slots the game reports (`SCS_TELEMETRY_trailers_count`).
+inline constexpr size_t TrailerSlotCount = 10;
+
+/// One bit per trailer index; a set bit means a channel value or the configuration of that trailer changed.
+using TrailerMask = std::bitset<TrailerSlotCount>;
+
+/**
+ * @brief Reads a field from a snapshot, widened to double (bools read as 0/1).
+ */
+double ReadFieldValue(const TelemetrySnapshot& snapshot, Field field);
+
+}  // namespace Telemetry
+SPF_NS_END
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/Telemetry/SCS/Common.hpp"
+#include "SPF/Telemetry/SCS/Truck.hpp"
+#include "SPF/Telemetry/SCS/Trailer.hpp"
+#include "SPF/Telemetry/SCS/Job.hpp"
+#include "SPF/Telemetry/SCS/Navigation.hpp"
+#include "SPF/Telemetry/SCS/Controls.hpp"
+#include "SPF/Telemetry/SCS/Events.hpp"
+#include "SPF/Telemetry/SCS/Gearbox.hpp"
+#include "SPF/Telemetry/DerivedChannels.hpp"
+#include "SPF/Telemetry/TelemetryFields.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+/**
+ * @struct TelemetrySnapshot
+ * @brief An immutable, self-consistent copy of all telemetry data at one point in time.
+ *
+ * Snapshots are published by the telemetry service and handed out as
+ * `std::shared_ptr<const TelemetrySnapshot>`. A published snapshot is never modified,
+ * so any thread may keep one for as long as it needs without locking and without
+ * seeing values from two different frames.
+ */
+struct TelemetrySnapshot {
+  uint64_t frameId = 0;   // Number of frames started before this snapshot was taken.
+  uint64_t revision = 0;  // Data revision (see ITelemetryService::GetDataRevision) at publication.
+  FieldMask changedFields;  // Fields changed at the most recent frame start (see ITelemetryService::GetChangedFields).
+  TrailerMask changedTrailers;  // Trailers changed at the most recent frame start.
+
+  SCS::GameState gameState;
+  SCS::Timestamps timestamps;
+  SCS::CommonData commonData;
+  SCS::TruckConstants truckConstants;
+  SCS::TruckData truckData;
+  std::vector<SCS::Trailer> trailers;
+  SCS::JobConstants jobConstants;
+  SCS::JobData jobData;
+  SCS::NavigationData navigationData;
+  SCS::Controls controls;
+  SCS::SpecialEvents specialEvents;
+  SCS::GameplayEvents gameplayEvents;
+  SCS::GearboxConstants gearboxConstants;
+  std::string lastGameplayEventId;
+  DerivedData derived;
+};
+}  // namespace Telemetry
+SPF_NS_END
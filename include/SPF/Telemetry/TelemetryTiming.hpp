@@ -0,0 +1,138 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+
+// Frame timing instrumentation of the telemetry service and the plugin callbacks. Enabled by
+// the SPF_TELEMETRY_TIMING CMake option; when it is off, SPF_TELEMETRY_TIME_SCOPE expands to
+// nothing and no histogram is ever registered.
+#ifndef SPF_TELEMETRY_TIMING
+#define SPF_TELEMETRY_TIMING 0
+#endif
+
+SPF_NS_BEGIN
+namespace Telemetry {
+/**
+ * @struct TimingStats
+ * @brief Percentiles of one timed section over its recent samples, in microseconds.
+ */
+struct TimingStats {
+  uint64_t count = 0;  // Samples the percentiles are computed from
+  double p50Us = 0.0;
+  double p99Us = 0.0;
+  double maxUs = 0.0;
+};
+
+/**
+ * @class TimingHistogram
+ * @brief Rolling histogram of durations.
+ *
+ * Durations go into log-linear buckets (eight per power of two, i.e. within ~12% of the
+ * true value) from 1 ns to ~4 s. The histogram keeps two generations of WindowSamples
+ * samples and drops the older one when the newer is full, so the statistics always
+ * cover the last WindowSamples to 2 * WindowSamples samples.
+ *
+ * Record() must only be called from one thread (the game thread); GetStats() may be
+ * called from any thread and sees a slightly stale but consistent-enough picture.
+ */
+class TimingHistogram {
+ public:
+  static constexpr uint32_t WindowSamples = 1024;
+
+  void Record(uint64_t nanoseconds);
+  TimingStats GetStats() const;
+
+ private:
+  static constexpr uint32_t SubBucketBits = 3;
+  static constexpr uint32_t SubBuckets = 1u << SubBucketBits;
+  static constexpr size_t BucketCount = (32 - SubBucketBits + 1) * SubBuckets;
+
+  static size_t BucketIndex(uint64_t nanoseconds);
+  static uint64_t BucketLowerBound(size_t index);
+
+  struct Generation {
+    std::array<std::atomic<uint32_t>, BucketCount> buckets = {};
+    std::atomic<uint32_t> count = 0;
+    std::atomic<uint64_t> max = 0;
+  };
+
+  // Single writer: plain load/store pairs instead of read-modify-write operations.
+  static void Increment(std::atomic<uint32_t>& value) { value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); }
+
+  std::array<Generation, 2> m_generations;
+  std::atomic<uint32_t> m_current = 0;
+};
+
+/**
+ * @class ScopedTiming
+ * @brief Records the time from construction to destruction into a histogram (if not null).
+ */
+class ScopedTiming {
+ public:
+  explicit ScopedTiming(TimingHistogram* histogram) : m_histogram(histogram), m_start(histogram ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{}) {}
+  explicit ScopedTiming(const std::shared_ptr<TimingHistogram>& histogram) : ScopedTiming(histogram.get()) {}
+  ~ScopedTiming() {
+    if (m_histogram) m_histogram->Record(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count());
+  }
+
+  ScopedTiming(const ScopedTiming&) = delete;
+  ScopedTiming& operator=(const ScopedTiming&) = delete;
+
+ private:
+  TimingHistogram* m_histogram;
+  std::chrono::steady_clock::time_point m_start;
+};
+
+/**
+ * @class TimingRegistry
+ * @brief Process-wide list of named timing histograms, read by the Telemetry window and the C API.
+ *
+ * Owners hold their histogram through the returned shared_ptr; the registry only keeps a
+ * weak reference, so a section disappears from the list when its owner (e.g. a plugin's
+ * subscription) goes away.
+ */
+class TimingRegistry {
+ public:
+  struct Entry {
+    std::string name;
+    TimingStats stats;
+  };
+
+  static TimingRegistry& GetInstance();
+
+  /**
+   * @brief Creates and lists a histogram. Names need not be unique.
+   */
+  std::shared_ptr<TimingHistogram> Add(std::string name);
+
+  /**
+   * @brief Gets the statistics of every live histogram, in registration order.
+   */
+  std::vector<Entry> GetStats();
+
+ private:
+  TimingRegistry() = default;
+
+  std::mutex m_mutex;
+  std::vector<std::pair<std::string, std::weak_ptr<TimingHistogram>>> m_histograms;
+};
+}  // namespace Telemetry
+SPF_NS_END
+
+#define SPF_TELEMETRY_TIMING_CONCAT_(a, b) a##b
+#define SPF_TELEMETRY_TIMING_CONCAT(a, b) SPF_TELEMETRY_TIMING_CONCAT_(a, b)
+
+#if SPF_TELEMETRY_TIMING
+/// Times the rest of the enclosing scope into `histogram` (a TimingHistogram* or shared_ptr).
+#define SPF_TELEMETRY_TIME_SCOPE(histogram) ::SPF::Telemetry::ScopedTiming SPF_TELEMETRY_TIMING_CONCAT(spfTiming_, __LINE__)(histogram)
+#else
+#define SPF_TELEMETRY_TIME_SCOPE(histogram) ((void)0)
+#endif
@@ -5,6 +5,7 @@
 #include "SPF/Namespace.hpp"
 #include "SPF/Telemetry/SCS/Trailer.hpp"
 #include "SPF/Telemetry/Sdk.hpp"
+#include "SPF/Telemetry/TelemetryFields.hpp"
 
 SPF_NS_BEGIN
 
@@ -29,15 +30,19 @@ class TrailerProcessor {
   void Shutdown();
 
   void HandleConfiguration(const scs_telemetry_configuration_t* info);
-  void HandleChannelUpdate(const scs_string_t name, const scs_u32_t index, const scs_value_t* value);
 
   const std::vector<SCS::Trailer>& GetData() const { return m_trailers; }
+  std::vector<SCS::Trailer>& GetMutableData() { return m_trailers; }
+
+  const TrailerMask& GetChangedTrailers() const { return m_changedTrailers; }
+  TrailerMask& GetMutableChangedTrailers() { return m_changedTrailers; }
 
  private:
   Logging::Logger& m_logger;
   GameContext& m_context;
 
   std::vector<SCS::Trailer> m_trailers;
+  TrailerMask m_changedTrailers;  // Trailers changed since the service last collected the mask.
 };
 
 }  // namespace Telemetry
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include "SPF/Namespace.hpp"
+#include "SPF/Telemetry/ChannelGroups.hpp"
+#include "SPF/Telemetry/TelemetryFields.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+struct TelemetrySnapshot;
+
+enum class CompareOp : uint8_t { Greater, GreaterEqual, Less, LessEqual, Equal, NotEqual };
+
+/**
+ * @struct TriggerCondition
+ * @brief One comparison of a field against a threshold. Booleans compare as 0.0 / 1.0.
+ *
+ * For the ordering operators, `hysteresis` is the distance the value has to move back past
+ * the threshold before a condition that holds stops holding (e.g. speed > 90 with a
+ * hysteresis of 2 holds from above 90 until below 88). For Equal and NotEqual it is the
+ * tolerance within which the value counts as equal.
+ */
+struct TriggerCondition {
+  Field field = Field::TruckSpeed;
+  CompareOp op = CompareOp::Greater;
+  double threshold = 0.0;
+  double hysteresis = 0.0;
+};
+
+enum class TriggerEdge : uint8_t { Rising, Falling, Both };
+
+struct TriggerOptions {
+  uint32_t holdMs = 0;     // How long all conditions must hold before the trigger activates
+  uint32_t releaseMs = 0;  // How long they must stay broken before it deactivates
+  TriggerEdge edge = TriggerEdge::Rising;
+};
+
+/**
+ * @struct TriggerEvent
+ * @brief A transition of a trigger, as passed to its callback.
+ */
+struct TriggerEvent {
+  bool active = false;
+  uint64_t renderTime = 0;        // Render time (µs) of the frame that made the transition
+  uint64_t previousDuration = 0;  // How long (µs) the trigger was in its previous state
+};
+
+using TriggerCallback = std::function<void(const TriggerEvent&)>;
+
+/**
+ * @class TriggerEngine
+ * @brief Evaluates the triggers registered by consumers once per frame.
+ *
+ * A trigger is a set of conditions that must all hold, plus hold/release durations and the
+ * edges to report. The conditions of all triggers are kept in flat per-member arrays, so a
+ * frame costs one gather of the referenced fields from the snapshot and one branch-free
+ * loop over the conditions, followed by a small state machine per trigger on the render
+ * clock. Callbacks only run on transitions. Frames in which none of the referenced fields
+ * changed and no hold or release timer is running are skipped entirely.
+ *
+ * Triggers may be added and removed from any thread; they take effect on the game thread
+ * at the next Evaluate(). A trigger starts inactive, so conditions that already hold when
+ * it is added activate it once they have held for `holdMs`.
+ */
+class TriggerEngine {
+ public:
+  struct Trigger {
+    std::vector<TriggerCondition> conditions;
+    TriggerOptions options;
+    TriggerCallback callback;
+    std::atomic<bool> active = true;  // Cleared on removal
+
+    // Game thread only.
+    bool on = false;              // Reported state
+    bool timing = false;          // The conditions disagree with `on` and the hold/release timer runs
+    uint64_t timerStart = 0;      // Render time the conditions started to disagree with `on`
+    uint64_t lastTransition = 0;  // Render time of the last reported change of `on`
+    size_t firstCondition = 0;    // Range in the condition arrays
+  };
+
+  std::shared_ptr<Trigger> Add(std::span<const TriggerCondition> conditions, const TriggerOptions& options, TriggerCallback callback);
+  void Remove(const std::shared_ptr<Trigger>& trigger);
+
+  /**
+   * @brief Applies pending additions and removals, evaluates the conditions against the
+   *        snapshot and calls back for every transition. Called by the telemetry service
+   *        at frame start.
+   */
+  void Evaluate(const TelemetrySnapshot& snapshot);
+
+ private:
+  void Apply();
+  void Compile();
+  void Step(Trigger& trigger, bool holds, uint64_t nowUs);
+
+  std::mutex m_mutex;
+  std::vector<std::shared_ptr<Trigger>> m_pendingAdds;
+  std::vector<std::shared_ptr<Trigger>> m_pendingRemoves;
+  std::atomic<bool> m_hasPending = false;
+
+  // Game thread only.
+  std::vector<std::shared_ptr<Trigger>> m_triggers;
+  bool m_compiled = true;  // The condition arrays match m_triggers
+  bool m_forceEvaluate = false;
+  bool m_hasLastTime = false;
+  uint64_t m_lastTimeUs = 0;
+
+  // Referenced fields, gathered from the snapshot once per evaluated frame.
+  std::vector<Field> m_fields;
+  FieldMask m_fieldMask;
+  std::array<double, FieldCount> m_values = {};
+
+  // Conditions, one element per condition of every trigger, in trigger order. Each is
+  // evaluated as `transform(value) > limit` (or >=), where the transform maps every operator
+  // onto "greater than": value * sign for the ordering operators, -|value - threshold| or
+  // |value - threshold| for Equal and NotEqual.
+  std::vector<uint16_t> m_condField;
+  std::vector<double> m_condCenter;  // Subtracted before the transform; 0 for ordering operators
+  std::vector<uint8_t> m_condAbs;
+  std::vector<double> m_condSign;
+  std::vector<double> m_condEnter;  // Limit while the condition does not hold
+  std::vector<double> m_condExit;   // Limit while it holds (hysteresis applied)
+  std::vector<uint8_t> m_condInclusive;
+  std::vector<uint8_t> m_condHolds;
+};
+
+/**
+ * @class TriggerSubscription
+ * @brief Keeps a trigger, and the channel groups of its fields, alive until destroyed.
+ *
+ * Obtained from ITelemetryService::AddTrigger(). Move-only; a default-constructed or
+ * failed subscription holds nothing and converts to false.
+ */
+class TriggerSubscription {
+ public:
+  TriggerSubscription() = default;
+  TriggerSubscription(std::shared_ptr<TriggerEngine> engine, std::shared_ptr<TriggerEngine::Trigger> trigger, ChannelLease channels);
+  ~TriggerSubscription();
+
+  TriggerSubscription(TriggerSubscription&& other) noexcept = default;
+  TriggerSubscription& operator=(TriggerSubscription&& other) noexcept;
+  TriggerSubscription(const TriggerSubscription&) = delete;
+  TriggerSubscription& operator=(const TriggerSubscription&) = delete;
+
+  explicit operator bool() const { return m_trigger != nullptr; }
+
+  void Reset();
+
+ private:
+  std::shared_ptr<TriggerEngine> m_engine;
+  std::shared_ptr<TriggerEngine::Trigger> m_trigger;
+  ChannelLease m_channels;
+};
+}  // namespace Telemetry
+SPF_NS_END
@@ -3,6 +3,7 @@
 #include "SPF/Namespace.hpp"
 #include "SPF/Telemetry/SCS/Truck.hpp"
 #include "SPF/Telemetry/Sdk.hpp"
+#include "SPF/Telemetry/TelemetryFields.hpp"
 
 SPF_NS_BEGIN
 
@@ -27,18 +28,23 @@ class TruckProcessor {
   void Shutdown();
 
   void HandleConfiguration(const scs_telemetry_configuration_t* info);
-  void HandleChannelUpdate(const scs_string_t name, const scs_u32_t index, const scs_value_t* value);
 
   const SCS::TruckData& GetData() const { return m_truckData; }
+  SCS::TruckData& GetMutableData() { return m_truckData; }
   const SCS::TruckConstants& GetConstants() const { return m_truckConstants; }
   SCS::TruckConstants& GetMutableConstants() { return m_truckConstants; }
 
+  // Fields whose values changed since the service last collected them (see SCSTelemetryService::HandleFrameStart).
+  const FieldMask& GetChangedFields() const { return m_changedFields; }
+  FieldMask& GetMutableChangedFields() { return m_changedFields; }
+
  private:
   Logging::Logger& m_logger;
   GameContext& m_context;
 
   SCS::TruckData m_truckData;
   SCS::TruckConstants m_truckConstants;
+  FieldMask m_changedFields;
 };
 
 }  // namespace Telemetry
@@ -9,6 +9,9 @@
 #include "SPF/Telemetry/SCS/Controls.hpp"
 #include "SPF/Telemetry/SCS/Events.hpp"
 #include "SPF/Telemetry/SCS/Gearbox.hpp"
+#include "SPF/Telemetry/ChannelGroups.hpp"
+#include "SPF/Telemetry/FieldHistory.hpp"
+#include "SPF/Telemetry/TelemetryFields.hpp"
 #include "SPF/Utils/Signal.hpp"
 #include <string>
 #include <vector>
@@ -32,53 +35,30 @@ class TelemetryWindow : public BaseWindow {
 
  private:
   // Event Handlers (Slots)
-  void OnGameStateUpdate(const Telemetry::SCS::GameState& data);
-  void OnTimestampsUpdate(const Telemetry::SCS::Timestamps& data);
-  void OnCommonDataUpdate(const Telemetry::SCS::CommonData& data);
-  void OnTruckConstantsUpdate(const Telemetry::SCS::TruckConstants& data);
-  void OnTruckDataUpdate(const Telemetry::SCS::TruckData& data);
-  void OnTrailersUpdate(const std::vector<Telemetry::SCS::Trailer>& data);
-  void OnJobConstantsUpdate(const Telemetry::SCS::JobConstants& data);
-  void OnJobDataUpdate(const Telemetry::SCS::JobData& data);
-  void OnNavigationDataUpdate(const Telemetry::SCS::NavigationData& data);
-  void OnControlsUpdate(const Telemetry::SCS::Controls& data);
   void OnSpecialEventsUpdate(const Telemetry::SCS::SpecialEvents& data);
-  void OnGameplayEventUpdate(const char* event_id, const Telemetry::SCS::GameplayEvents& data);
-  void OnGearboxConstantsUpdate(const Telemetry::SCS::GearboxConstants& data);
+  void OnTimestampsUpdate(const Telemetry::SCS::Timestamps& data);
+
+  // Draws a field's recorded history over [fromUs, toUs] across the available width, one point per pixel.
+  void RenderHistoryGraph(const char* id, Telemetry::Field field, float scale, uint64_t fromUs, uint64_t toUs);
 
  private:
   Modules::ITelemetryService& m_telemetryService;
 
   // Signal Sinks
-  Utils::Sink<void(const Telemetry::SCS::GameState&)> m_gameStateSink;
-  Utils::Sink<void(const Telemetry::SCS::Timestamps&)> m_timestampsSink;
-  Utils::Sink<void(const Telemetry::SCS::CommonData&)> m_commonDataSink;
-  Utils::Sink<void(const Telemetry::SCS::TruckConstants&)> m_truckConstantsSink;
-  Utils::Sink<void(const Telemetry::SCS::TruckData&)> m_truckDataSink;
-  Utils::Sink<void(const std::vector<Telemetry::SCS::Trailer>&)> m_trailersSink;
-  Utils::Sink<void(const Telemetry::SCS::JobConstants&)> m_jobConstantsSink;
-  Utils::Sink<void(const Telemetry::SCS::JobData&)> m_jobDataSink;
-  Utils::Sink<void(const Telemetry::SCS::NavigationData&)> m_navigationDataSink;
-  Utils::Sink<void(const Telemetry::SCS::Controls&)> m_controlsSink;
   Utils::Sink<void(const Telemetry::SCS::SpecialEvents&)> m_specialEventsSink;
-  Utils::Sink<void(const char*, const Telemetry::SCS::GameplayEvents&)> m_gameplayEventsSink;
-  Utils::Sink<void(const Telemetry::SCS::GearboxConstants&)> m_gearboxConstantsSink;
+  Utils::Sink<void(const Telemetry::SCS::Timestamps&)> m_timestampsSink;
+
+  // Every channel group, held only while the window is shown.
+  Telemetry::ChannelLease m_channels;
+
+  // Fields shown in the graphs tab. Recorded from the first time the tab is opened on, so
+  // the graphs keep their history while the window is closed.
+  Telemetry::FieldHistoryLease m_graphHistory;
+  std::vector<Telemetry::HistoryPoint> m_graphPoints;  // Reused by every graph
+  int m_graphRangeMinutes = 1;
 
-  // Data Cache
-  Telemetry::SCS::GameState m_gameState;
-  Telemetry::SCS::Timestamps m_timestamps;
-  Telemetry::SCS::CommonData m_commonData;
-  Telemetry::SCS::TruckConstants m_truckConstants;
-  Telemetry::SCS::TruckData m_truckData;
-  std::vector<Telemetry::SCS::Trailer> m_trailers;
-  Telemetry::SCS::JobConstants m_jobConstants;
-  Telemetry::SCS::JobData m_jobData;
-  Telemetry::SCS::NavigationData m_navigationData;
-  Telemetry::SCS::Controls m_controls;
+  // Latched special event flags (see constructor)
   Telemetry::SCS::SpecialEvents m_specialEvents;
-  Telemetry::SCS::GameplayEvents m_gameplayEvents;
-  Telemetry::SCS::GearboxConstants m_gearboxConstants;
-  std::string m_lastGameplayEventId;
   
   // Localization keys
   std::string m_locTabGame;
@@ -88,6 +68,8 @@ class TelemetryWindow : public BaseWindow {
   std::string m_locTabPositioning;
   std::string m_locTabTrailers;
   std::string m_locTabControlsEvents;
+  std::string m_locTabTiming;
+  std::string m_locTabGraphs;
 
   std::string m_locHeaderGameState;
   std::string m_locHeaderConstants;
@@ -153,6 +135,16 @@ class TelemetryWindow : public BaseWindow {
   std::string m_locLabelHshifterGear;
   std::string m_locLabelHshifterHandlePos;
   std::string m_locLabelHshifterSelectors;
+  std::string m_locLabelTimingSection;
+  std::string m_locLabelTimingSamples;
+  std::string m_locLabelTimingP50;
+  std::string m_locLabelTimingP99;
+  std::string m_locLabelTimingMax;
+  std::string m_locLabelTimingDisabled;
+  std::string m_locLabelGraphRange;
+  std::string m_locLabelGraphMinutes;
+  std::string m_locLabelGraphOilTemp;
+  std::string m_locLabelGraphNoData;
   std::string m_locLabelGearRatios;
   std::string m_locLabelForward;
   std::string m_locLabelReverse;
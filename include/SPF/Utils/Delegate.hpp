@@ -85,6 +85,8 @@ class Delegate<Return(Args...)> final {
 
   Return operator()(Args... args) const { return Call(std::forward<Args>(args)...); }
 
+  explicit operator bool() const noexcept { return m_function != nullptr; }
+
   bool operator==(const Delegate<Return(Args...)>& other) const noexcept { return (m_function == other.m_function && m_context == other.m_context); }
 };
 
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "SPF/Namespace.hpp"
+
+SPF_NS_BEGIN
+namespace Utils {
+/**
+ * @class MappedFile
+ * @brief A read-only memory mapping of a whole file.
+ *
+ * Uses file mappings on Windows and mmap elsewhere. The mapping stays valid until
+ * Close() is called or the object is destroyed.
+ */
+class MappedFile {
+ public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /**
+   * @brief Maps `path` into memory, replacing any previous mapping.
+   * @return True on success. An empty file maps successfully with a null Data().
+   */
+  bool Open(const std::string& path);
+  void Close();
+
+  bool IsOpen() const { return m_isOpen; }
+  const uint8_t* Data() const { return m_data; }
+  size_t Size() const { return m_size; }
+
+ private:
+  const uint8_t* m_data = nullptr;
+  size_t m_size = 0;
+  bool m_isOpen = false;
+
+#ifdef _WIN32
+  void* m_fileHandle = nullptr;
+  void* m_mappingHandle = nullptr;
+#endif
+};
+}  // namespace Utils
+SPF_NS_END
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "SPF/Namespace.hpp"
+
+SPF_NS_BEGIN
+namespace Utils {
+/**
+ * @class SharedMemory
+ * @brief A named, read-write memory region shared between processes.
+ *
+ * Uses named file mappings ("Local\<name>") on Windows and POSIX shared memory
+ * ("/<name>") elsewhere. The creator owns the name: on POSIX the object is unlinked
+ * again when the creating SharedMemory is closed.
+ */
+class SharedMemory {
+ public:
+  SharedMemory() = default;
+  ~SharedMemory();
+
+  SharedMemory(const SharedMemory&) = delete;
+  SharedMemory& operator=(const SharedMemory&) = delete;
+
+  /**
+   * @brief Creates (or re-opens and resizes) the region `name` with `size` bytes, zero-filled on creation.
+   */
+  bool Create(const std::string& name, size_t size);
+
+  /**
+   * @brief Opens an existing region. `size` must not exceed the size it was created with.
+   */
+  bool Open(const std::string& name, size_t size, bool writable);
+  void Close();
+
+  bool IsOpen() const { return m_data != nullptr; }
+  uint8_t* Data() const { return m_data; }
+  size_t Size() const { return m_size; }
+
+ private:
+  bool Map(const std::string& name, size_t size, bool create, bool writable);
+
+  uint8_t* m_data = nullptr;
+  size_t m_size = 0;
+
+#ifdef _WIN32
+  void* m_mappingHandle = nullptr;
+#else
+  std::string m_unlinkName;  // Set when this instance created the object.
+#endif
+};
+
+/**
+ * @class NamedSemaphore
+ * @brief A counting semaphore that can be shared between processes by name.
+ *
+ * Post() does not block and does not allocate, so it is safe to call on the game thread.
+ */
+class NamedSemaphore {
+ public:
+  NamedSemaphore() = default;
+  ~NamedSemaphore();
+
+  NamedSemaphore(const NamedSemaphore&) = delete;
+  NamedSemaphore& operator=(const NamedSemaphore&) = delete;
+
+  bool Create(const std::string& name);
+  bool Open(const std::string& name);
+  void Close();
+
+  bool IsOpen() const { return m_handle != nullptr; }
+  void Post(uint32_t count = 1);
+
+  /**
+   * @brief Waits until the semaphore is posted or `timeoutMs` elapses.
+   * @return True if the semaphore was acquired.
+   */
+  bool Wait(uint32_t timeoutMs);
+
+ private:
+  void* m_handle = nullptr;
+#ifndef _WIN32
+  std::string m_unlinkName;
+#endif
+};
+}  // namespace Utils
+SPF_NS_END
@@ -1,7 +1,8 @@
 #pragma once
 
-#include <vector>
 #include <algorithm>
+#include <cstdint>
+#include <vector>
 
 #include "SPF/Namespace.hpp"
 
@@ -21,6 +22,10 @@ class Sink;
  * @brief Signal handler used to notify multiple delegates.
  *        Based on ry-core project by Piotr Krupa (https://github.com/Hary309/hry-core).
  *
+ * Calling does not allocate. Delegates connected during a call are first called by the next
+ * call; delegates disconnected during a call are not called anymore, and their slots are
+ * compacted once the outermost call returns.
+ *
  * @tparam Return Return type of a delegate function
  * @tparam Args Types of arguments of a delegate function
  */
@@ -31,27 +36,69 @@ class Signal<Return(Args...)> final {
  private:
   using Delegate_t = Delegate<Return(Args...)>;
 
+  struct Slot {
+    Delegate_t delegate;
+    uint64_t id;  // Given by Add() in increasing order, so the list stays sorted by id
+  };
+
  private:
-  std::vector<Delegate_t> m_calls;
+  std::vector<Slot> m_calls;
+  uint64_t m_nextId = 0;
+  uint32_t m_callDepth = 0;       // Nesting of Call(), > 0 while delegates are being called
+  bool m_hasRemovedSlots = false;  // Slots emptied during a call, to erase afterwards
 
  public:
   void Call(Args... args) noexcept {
-    // Create a copy of the delegates to call, in case a delegate modifies the list during iteration.
-    auto callsCopy = m_calls;
-    for (Delegate_t& delegate : callsCopy) {
-      delegate.Call(std::forward<Args>(args)...);
+    // Only the delegates connected when the call starts are called. Each one is copied out
+    // before it runs, since connecting from a delegate may reallocate the list.
+    ++m_callDepth;
+    const size_t count = m_calls.size();
+    for (size_t i = 0; i < count; ++i) {
+      const Delegate_t delegate = m_calls[i].delegate;
+      if (delegate) {
+        delegate.Call(std::forward<Args>(args)...);
+      }
+    }
+
+    if (--m_callDepth == 0 && m_hasRemovedSlots) {
+      m_hasRemovedSlots = false;
+      EraseRemovedSlots();
     }
   }
 
  private:
-  void Add(Delegate_t delegate) noexcept { m_calls.push_back(delegate); }
+  // Returns the id that identifies the slot to Remove().
+  uint64_t Add(Delegate_t delegate) noexcept {
+    m_calls.push_back({delegate, m_nextId});
+    return m_nextId++;
+  }
+
+  // Removes the slots with the given ids, which must be ascending: each search starts where
+  // the previous one ended, then the list is compacted once.
+  void Remove(const std::vector<uint64_t>& ids) noexcept {
+    bool removed = false;
+    auto slot = m_calls.begin();
+    for (const uint64_t id : ids) {
+      slot = std::lower_bound(slot, m_calls.end(), id, [](const Slot& s, uint64_t value) { return s.id < value; });
+      if (slot == m_calls.end()) break;
+      if (slot->id == id && slot->delegate) {
+        slot->delegate.Reset();
+        removed = true;
+      }
+    }
 
-  void Remove(Delegate_t delegate) noexcept {
-    auto it = std::find_if(m_calls.begin(), m_calls.end(), [&delegate](const Delegate_t& a) { return a == delegate; });
+    if (removed) {
+      EraseRemovedSlots();
+    }
+  }
 
-    if (it != m_calls.end()) {
-      m_calls.erase(it);
+  void EraseRemovedSlots() noexcept {
+    // A running call indexes into the list, so the slots stay until the outermost call returns.
+    if (m_callDepth > 0) {
+      m_hasRemovedSlots = true;
+      return;
     }
+    std::erase_if(m_calls, [](const Slot& slot) { return !slot.delegate; });
   }
 };
 
@@ -70,7 +117,7 @@ class Sink<Return(Args...)> final {
 
  private:
   Signal_t* m_signal;
-  std::vector<Delegate_t> m_internalCalls;
+  std::vector<uint64_t> m_slotIds;  // Ascending, as the signal hands them out
 
  public:
   Sink(Signal_t& signal) noexcept : m_signal(&signal) {}
@@ -80,8 +127,8 @@ class Sink<Return(Args...)> final {
   Sink& operator=(const Sink&) noexcept = default;
 
   ~Sink() noexcept {
-    for (auto& delegate : m_internalCalls) {
-      m_signal->Remove(delegate);
+    if (!m_slotIds.empty()) {
+      m_signal->Remove(m_slotIds);
     }
   }
 
@@ -90,8 +137,7 @@ class Sink<Return(Args...)> final {
     Delegate_t delegate;
     delegate.template Connect<FuncAddr>();
 
-    m_signal->Add(delegate);
-    m_internalCalls.push_back(delegate);
+    m_slotIds.push_back(m_signal->Add(delegate));
   }
 
   template <auto MethodAddr, typename T>
@@ -99,16 +145,15 @@ class Sink<Return(Args...)> final {
     Delegate_t delegate;
     delegate.template Connect<MethodAddr>(content);
 
-    m_signal->Add(delegate);
-    m_internalCalls.push_back(delegate);
+    m_slotIds.push_back(m_signal->Add(delegate));
   }
 
   void Clear() {
-    for (auto& delegate : m_internalCalls) {
-      m_signal->Remove(delegate);
+    if (!m_slotIds.empty()) {
+      m_signal->Remove(m_slotIds);
     }
 
-    m_internalCalls.clear();
+    m_slotIds.clear();
   }
 };
 
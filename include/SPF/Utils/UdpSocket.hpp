@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "SPF/Namespace.hpp"
+
+SPF_NS_BEGIN
+namespace Utils {
+/**
+ * @struct UdpEndpoint
+ * @brief An IPv4 address and port, both in host byte order.
+ */
+struct UdpEndpoint {
+  uint32_t address = 0;
+  uint16_t port = 0;
+
+  bool operator==(const UdpEndpoint&) const = default;
+};
+
+/**
+ * @class UdpSocket
+ * @brief A bound IPv4 datagram socket.
+ *
+ * Uses Winsock on Windows and BSD sockets elsewhere. Sending never blocks: a datagram the
+ * network stack has no room for is dropped, as UDP allows.
+ */
+class UdpSocket {
+ public:
+  UdpSocket() = default;
+  ~UdpSocket();
+
+  UdpSocket(const UdpSocket&) = delete;
+  UdpSocket& operator=(const UdpSocket&) = delete;
+
+  /**
+   * @brief Opens the socket and binds it to `address` ("127.0.0.1", "0.0.0.0", ...) and
+   *        `port` (0 picks a free one).
+   * @return False on failure (see GetLastError).
+   */
+  bool Open(const std::string& address, uint16_t port);
+  void Close();
+
+  bool IsOpen() const;
+  uint16_t GetLocalPort() const { return m_localPort; }
+  const std::string& GetLastError() const { return m_lastError; }
+
+  bool SendTo(const UdpEndpoint& to, const void* data, size_t size);
+
+  /**
+   * @brief Receives one datagram, waiting up to `timeoutMs` for it (0 only checks).
+   * @return The size of the datagram (truncated to `capacity`), or 0 if none arrived.
+   */
+  size_t ReceiveFrom(void* buffer, size_t capacity, UdpEndpoint& from, uint32_t timeoutMs);
+
+  /**
+   * @brief Parses a dotted IPv4 address.
+   */
+  static bool ParseAddress(const std::string& text, uint32_t& address);
+
+ private:
+  uintptr_t m_socket = ~uintptr_t{0};  // SOCKET / file descriptor
+  uint16_t m_localPort = 0;
+  std::string m_lastError;
+#ifdef _WIN32
+  bool m_winsockStarted = false;
+#endif
+};
+}  // namespace Utils
+SPF_NS_END
@@ -980,8 +980,9 @@ void ConfigService::SetValue(const std::string& componentName, const std::string
 
     }
 
-    // After any successful change, fire an event so other systems can react.
-    m_eventManager.System.OnSettingWasChanged.Call({systemName, componentName, keyPath, value});
+    // After any successful change, fire an event so other systems can react. Inside a batch
+    // (resets, plugin loads) it is coalesced to the last value per key and fired when the batch ends.
+    m_eventManager.Coalesced.OnSettingWasChanged.Post({systemName, componentName, keyPath, value});
   } catch (const std::exception& e) {
     auto logger = LoggerFactory::GetInstance().GetLogger("ConfigService");
     if (logger) logger->Error("Failed to set value for path '{}': {}", jsonPath, e.what());
@@ -1177,7 +1178,7 @@ void ConfigService::UpdateBinding(const std::string& actionFullName, const nlohm
         _DeleteBindingInternal(conflictingAction, bindingJsonToClear);
     }
 
-    m_eventManager.System.OnKeybindsModified.Call({});
+    m_eventManager.Coalesced.OnKeybindsModified.Post({});
 }
 
 bool ConfigService::_DeleteBindingInternal(const std::string& actionFullName, const nlohmann::json& bindingToDelete) {
@@ -1228,7 +1229,7 @@ bool ConfigService::_DeleteBindingInternal(const std::string& actionFullName, co
 
 void ConfigService::DeleteBinding(const std::string& actionFullName, const nlohmann::json& bindingToDelete) {
     if (_DeleteBindingInternal(actionFullName, bindingToDelete)) {
-        m_eventManager.System.OnKeybindsModified.Call({});
+        m_eventManager.Coalesced.OnKeybindsModified.Post({});
     }
 }
 
@@ -1263,7 +1264,7 @@ void ConfigService::UpdateBindingProperty(const std::string& actionFullName, con
                         if (storedInput && storedInput->IsSameAs(*inputToFind)) {
                             binding[propertyName] = newValue;
                             m_dirtyComponents.insert(componentName);
-                            m_eventManager.System.OnKeybindsModified.Call({});
+                            m_eventManager.Coalesced.OnKeybindsModified.Post({});
                             if (logger) logger->Info("UpdateBindingProperty: Updated property '{}' for binding in action '{}'.", propertyName, actionFullName);
                             return;
                         }
@@ -2,12 +2,14 @@
 #include <SPF/Core/Core.hpp>
 
 // --- Standard Library ---
+#include <chrono>
 #include <debugapi.h>
 #include <exception>
 #include <memory>
 #include <minwindef.h>
 #include <set>
 #include <vector>
+#include <fmt/chrono.h>
 
 // --- Framework ---
 #include <SPF/Config/ConfigService.hpp>
@@ -39,6 +41,9 @@
 // ADDED: Telemetry module includes
 #include <SPF/Telemetry/GameContext.hpp>
 #include <SPF/Telemetry/SCSTelemetryService.hpp>
+#include <SPF/Telemetry/Recording/TelemetryRecorder.hpp>
+#include <SPF/Telemetry/Export/SharedMemoryExporter.hpp>
+#include <SPF/Telemetry/Export/TelemetryStreamServer.hpp>
 #include <SPF/Modules/IInputService.hpp>
 #include <SPF/Input/SCS/SCSInputService.hpp>
 #include <SPF/GameConsole/GameConsole.hpp>
@@ -172,11 +177,14 @@ void Core::OnInputInit(const scs_input_init_params_t* const params) {
 void Core::OnTelemetryShutdown() {
   m_logger->Info("SDK Telemetry is shutting down, triggering framework reset...");
   Reset();
+  // The DLL may be unloaded next, and the writer threads cannot be joined from DllMain.
+  LoggerFactory::GetInstance().StopAsyncWriters();
 }
 
 void Core::OnInputShutdown() {
   m_logger->Info("SDK Input is shutting down, triggering framework reset...");
   Reset();
+  LoggerFactory::GetInstance().StopAsyncWriters();
 }
 
 void Core::TryStartInitialization() {
@@ -186,6 +194,8 @@ void Core::TryStartInitialization() {
   }
 
   m_lifecycleState = LifecycleState::Initializing;
+  // Logging is synchronous until here: Preload runs inside DllMain, where threads cannot start.
+  LoggerFactory::GetInstance().StartAsyncWriters();
   m_logger->Info("--- All SDK services are ready. Initializing framework... ---");
 
   // Clear the list of configurable services to remove any dangling pointers from a previous session (after a Reset).
@@ -260,7 +270,7 @@ void Core::Reset() {
   m_logger->Info("--- Core Reset sequence finished. Framework is now in Preloaded state. ---");
 }
 
-void Core::FullShutdown() {
+void Core::FullShutdown(bool processTerminating) {
   if (m_lifecycleState == LifecycleState::Stopped || m_lifecycleState == LifecycleState::ShuttingDown) {
     return;
   }
@@ -303,7 +313,10 @@ void Core::FullShutdown() {
 
   // Step 7: The logger factory is the very last thing to be shut down.
   // This is called last because all previous steps may want to log messages.
-  LoggerFactory::GetInstance().Shutdown();
+  if (const uint64_t dropped = LoggerFactory::GetInstance().GetDroppedMessageCount(); dropped > 0) {
+    m_logger->Warn("{} log messages were dropped because the log queue was full.", dropped);
+  }
+  LoggerFactory::GetInstance().Shutdown(processTerminating);
 }
 
 void Core::InitFeatureHooks() {
@@ -351,7 +364,16 @@ void Core::InitServices() {
 
   // Phase 3: Initialize the logger factory now that config is available.
   const auto* loggingConfigs = m_configService->GetAllComponentSettings("logging");
-  auto loggerReport = LoggerFactory::GetInstance().Initialize(PathManager::GetLogsPath(), loggingConfigs ? loggingConfigs->at("framework") : nlohmann::json{});
+  std::optional<Sinks::AsyncSinkOptions> asyncLogging;
+  if (m_configService->GetValue("framework", "settings.async_logging.enabled", true).get<bool>()) {
+    asyncLogging.emplace();
+    asyncLogging->capacity = m_configService->GetValue("framework", "settings.async_logging.queue_size", asyncLogging->capacity).get<size_t>();
+    asyncLogging->flushInterval = std::chrono::milliseconds(m_configService->GetValue("framework", "settings.async_logging.flush_interval_ms", 200).get<int64_t>());
+    if (m_configService->GetValue("framework", "settings.async_logging.overflow", "drop").get<std::string>() == "block") {
+      asyncLogging->overflow = Sinks::AsyncSinkOptions::Overflow::Block;
+    }
+  }
+  auto loggerReport = LoggerFactory::GetInstance().Initialize(PathManager::GetLogsPath(), loggingConfigs ? loggingConfigs->at("framework") : nlohmann::json{}, asyncLogging);
   m_configurableServices.push_back(&LoggerFactory::GetInstance());
   m_logger = LoggerFactory::GetInstance().GetLogger("Core");  // Logger is assigned here.
 
@@ -369,6 +391,10 @@ void Core::InitServices() {
   hookManager.RegisterFeatureHook(&GameLogHook::GetInstance());
   hookManager.RegisterFeatureHook(&GameConsole::GetInstance());
   InitFeatureHooks();
+
+  // Phase 5: Size the queue of events posted from other threads.
+  m_eventManager->Deferred.SetCapacity(m_configService->GetValue("framework", "settings.deferred_events.capacity", Events::DeferredEventQueue::DefaultCapacity).get<uint32_t>());
+  m_deferredEventBudget = std::chrono::microseconds(m_configService->GetValue("framework", "settings.deferred_events.drain_budget_us", 1000).get<int64_t>());
   m_logger->Info("--- Core Services Initialized ---");
 }
 
@@ -585,6 +611,12 @@ void Core::ShutdownServices() {
   m_onUpdateCheckFailedSink.reset();
   m_onPatronsFetchCompletedSink.reset();
 
+  // Events still queued have nobody left to handle them.
+  const auto deferredStats = m_eventManager->Deferred.GetStats();
+  m_eventManager->Deferred.Clear();
+  m_logger->Info("    -> Deferred events: {} posted, {} dispatched, {} dropped, {} discarded, at most {} pending, longest drain {} us.", deferredStats.posted, deferredStats.dispatched,
+                 deferredStats.dropped, deferredStats.pending, deferredStats.maxPending, deferredStats.maxDrainUs);
+
   // Config service is last, saving all pending changes to disk.
   m_logger->Info("    -> Saving configuration and shutting down ConfigService...");
   if (m_configService) {
@@ -613,12 +645,18 @@ void Core::LateInit() {
 void Core::Update() {
   // This is the main update loop for logic that is not tied to telemetry frames.
   // It's called by the renderer on every visual frame.
+  // Events posted from other threads are dispatched first, so this frame's logic sees them.
+  m_eventManager->Deferred.Drain(m_deferredEventBudget);
+
   if (m_inputManager) {
     m_inputManager->ProcessButtonActions();
     m_inputManager->ProcessKeyboardActions();
     m_inputManager->ProcessMouseActions();
     m_inputManager->ProcessJoystickActions();
   }
+  if (m_telemetryService) {
+    m_telemetryService->UpdateInterpolatedPlacements();
+  }
   PluginManager::GetInstance().UpdateAllPlugins();
   //  Update UpdateManager to process async results
   if (m_updateManager) {
@@ -754,15 +792,19 @@ std::set<std::string> Core::HandleServiceInitialization(const std::vector<Initia
   bool wasResetNeeded = false;
   std::set<std::string> resetServices;
 
-  for (const auto& report : reports) {
-    if (!report.HasIssues()) continue;
-
-    for (const auto& error : report.Errors) {
-      if (!error.ConfigKeyPath.empty()) {
-        m_logger->Warn("Service '{}' reported an issue with key '{}'. Attempting to reset to default.", report.ServiceName, error.ConfigKeyPath);
-        m_configService->ResetToDefault(report.ServiceName, error.ConfigKeyPath, &resetReport);
-        wasResetNeeded = true;
-        resetServices.insert(report.ServiceName);
+  {
+    // Listeners see each reset key once, when all resets are done.
+    EventManager::CoalescedEvents::Batch batch(m_eventManager->Coalesced);
+    for (const auto& report : reports) {
+      if (!report.HasIssues()) continue;
+
+      for (const auto& error : report.Errors) {
+        if (!error.ConfigKeyPath.empty()) {
+          m_logger->Warn("Service '{}' reported an issue with key '{}'. Attempting to reset to default.", report.ServiceName, error.ConfigKeyPath);
+          m_configService->ResetToDefault(report.ServiceName, error.ConfigKeyPath, &resetReport);
+          wasResetNeeded = true;
+          resetServices.insert(report.ServiceName);
+        }
       }
     }
   }
@@ -942,6 +984,25 @@ void Core::OnTelemetryFrameStart() {
   if (GameCameraManager::GetInstance().IsInstalled()) {
     GameCameraManager::GetInstance().Update(dt);
   }
+
+  if (m_telemetryExporter) {
+    m_telemetryExporter->Publish(*m_telemetryService);
+  }
+
+  if (m_telemetryStream) {
+    // Keep the channels of whatever the stream clients selected registered.
+    const uint64_t revision = m_telemetryStream->GetSelectionRevision();
+    if (revision != m_streamSelectionRevision) {
+      m_streamSelectionRevision = revision;
+      const auto selected = m_telemetryStream->GetSelectedFields();
+      Telemetry::ChannelGroupMask groups;
+      for (size_t i = 0; i < Telemetry::FieldCount; ++i) {
+        if (selected.test(i)) groups |= Telemetry::ChannelGroupsForField(static_cast<Telemetry::Field>(i));
+      }
+      m_streamChannels = m_telemetryService->AcquireChannels(groups);
+    }
+    m_telemetryStream->Publish(*m_telemetryService->GetSnapshot());
+  }
 }
 void Core::InitTelemetry(const scs_telemetry_init_params_t* params) {
   m_logger->Info("--- Initializing Telemetry Module ---");
@@ -955,16 +1016,101 @@ void Core::InitTelemetry(const scs_telemetry_init_params_t* params) {
 
   m_telemetryService = std::make_unique<Telemetry::SCSTelemetryService>(*m_logger, *m_gameContext, *m_eventManager);
 
+  // When recording is enabled, the service registers through the recorder, which captures
+  // the raw SDK stream before forwarding it.
+  const scs_telemetry_init_params_t* serviceParams = params;
+  if (m_configService->GetValue("framework", "settings.telemetry_recording.enabled", false).get<bool>()) {
+    const auto keyframeInterval = m_configService->GetValue("framework", "settings.telemetry_recording.keyframe_interval", 60).get<uint32_t>();
+    const auto now = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+    const auto path = PathManager::GetLogsPath() / fmt::format("telemetry_{:%Y%m%d_%H%M%S}.spftrec", now);
+
+    m_telemetryRecorder = std::make_unique<Telemetry::Recording::TelemetryRecorder>();
+    if (const auto* recordingParams = m_telemetryRecorder->Start(path.string(), versioned_params, keyframeInterval)) {
+      serviceParams = recordingParams;
+      m_logger->Info("Recording telemetry to '{}'.", path.string());
+    } else {
+      m_logger->Error("Failed to start telemetry recording: {}", m_telemetryRecorder->GetLastError());
+      m_telemetryRecorder.reset();
+    }
+  }
+
   // Initialize the telemetry service, which will register for SDK events.
-  m_telemetryService->Initialize(params);
+  m_telemetryService->Initialize(serviceParams);
+
+  if (m_configService->GetValue("framework", "settings.telemetry_export.enabled", false).get<bool>()) {
+    const auto name = m_configService->GetValue("framework", "settings.telemetry_export.name", SPF_TELEMETRY_SHM_DEFAULT_NAME).get<std::string>();
+
+    m_telemetryExporter = std::make_unique<Telemetry::Export::SharedMemoryExporter>();
+    if (m_telemetryExporter->Start(name)) {
+      m_logger->Info("Exporting telemetry to shared memory '{}'.", name);
+    } else {
+      m_logger->Error("Failed to start telemetry export: {}", m_telemetryExporter->GetLastError());
+      m_telemetryExporter.reset();
+    }
+  }
+
+  if (m_configService->GetValue("framework", "settings.telemetry_stream.enabled", false).get<bool>()) {
+    const auto address = m_configService->GetValue("framework", "settings.telemetry_stream.address", "127.0.0.1").get<std::string>();
+    const auto port = m_configService->GetValue("framework", "settings.telemetry_stream.port", SPF_TELEMETRY_STREAM_DEFAULT_PORT).get<uint16_t>();
+    const auto keyframeInterval = m_configService->GetValue("framework", "settings.telemetry_stream.keyframe_interval", 60).get<uint32_t>();
+
+    m_telemetryStream = std::make_unique<Telemetry::Export::TelemetryStreamServer>();
+    if (m_telemetryStream->Start(address, port, keyframeInterval)) {
+      m_logger->Info("Streaming telemetry over UDP on {}:{}.", address, m_telemetryStream->GetPort());
+    } else {
+      m_logger->Error("Failed to start the telemetry stream: {}", m_telemetryStream->GetLastError());
+      m_telemetryStream.reset();
+    }
+  }
+
+  // Recordings and exported frames are complete snapshots, so every channel group stays registered.
+  if (m_telemetryRecorder || m_telemetryExporter) {
+    m_fullTelemetryChannels = m_telemetryService->AcquireChannels(Telemetry::AllChannelGroups());
+  }
+
+  // The route is otherwise only recorded from the first time a plugin uses it.
+  if (m_configService->GetValue("framework", "settings.route_history.always_record", false).get<bool>()) {
+    m_routeChannels = m_telemetryService->AcquireChannels(Telemetry::MakeChannelGroupMask(Telemetry::ChannelGroup::TruckMotion));
+  }
 }
 
 void Core::ShutdownTelemetry() {
   m_logger->Info("--- Shutting Down Telemetry Module ---");
+  m_fullTelemetryChannels.Reset();
+  m_routeChannels.Reset();
+  m_streamChannels.Reset();
+  if (m_telemetryService && m_configService->GetValue("framework", "settings.route_history.save_on_exit", false).get<bool>()) {
+    auto& route = m_telemetryService->GetRouteStore();
+    if (route.GetStats().points > 0) {
+      const auto now = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+      const auto path = PathManager::GetLogsPath() / fmt::format("route_{:%Y%m%d_%H%M%S}.spfroute", now);
+      if (route.Save(path.string())) {
+        m_logger->Info("Route saved to '{}'.", path.string());
+      } else {
+        m_logger->Error("Failed to save the route to '{}'.", path.string());
+      }
+    }
+  }
   if (m_telemetryService) {
     m_telemetryService->Shutdown();
   }
   m_telemetryService.reset();
+  if (m_telemetryExporter) {
+    m_telemetryExporter->Stop();
+    m_logger->Info("Telemetry export stopped after {} frames.", m_telemetryExporter->GetFramesPublished());
+    m_telemetryExporter.reset();
+  }
+  if (m_telemetryStream) {
+    const auto stats = m_telemetryStream->GetStats();
+    m_telemetryStream->Stop();
+    m_logger->Info("Telemetry stream stopped: {} frames queued, {} dropped, {} packets, {} bytes.", stats.framesQueued, stats.framesDropped, stats.packetsSent, stats.bytesSent);
+    m_telemetryStream.reset();
+  }
+  if (m_telemetryRecorder) {
+    m_telemetryRecorder->Stop();
+    m_logger->Info("Telemetry recording finished: {} frames, {} bytes.", m_telemetryRecorder->GetFrameCount(), m_telemetryRecorder->GetBytesWritten());
+    m_telemetryRecorder.reset();
+  }
   m_gameContext.reset();
 }
 
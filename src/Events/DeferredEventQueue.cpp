@@ -0,0 +1,108 @@
+#include "SPF/Events/DeferredEventQueue.hpp"
+
+SPF_NS_BEGIN
+namespace Events {
+DeferredEventQueue::~DeferredEventQueue() { Clear(); }
+
+bool DeferredEventQueue::Reserve() {
+  const uint32_t pending = m_pending.fetch_add(1, std::memory_order_relaxed) + 1;
+  if (pending > m_capacity.load(std::memory_order_relaxed)) {
+    m_pending.fetch_sub(1, std::memory_order_relaxed);
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  uint32_t maxPending = m_maxPending.load(std::memory_order_relaxed);
+  while (pending > maxPending && !m_maxPending.compare_exchange_weak(maxPending, pending, std::memory_order_relaxed)) {
+  }
+  m_postedCount.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+void DeferredEventQueue::Push(Node* node) {
+  node->next = m_posted.load(std::memory_order_relaxed);
+  while (!m_posted.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+  }
+}
+
+void DeferredEventQueue::TakePosted() {
+  Node* posted = m_posted.exchange(nullptr, std::memory_order_acquire);
+  if (!posted) return;
+
+  // The stack is newest first; reverse it so events are dispatched in posting order.
+  Node* first = nullptr;
+  Node* last = posted;
+  while (posted) {
+    Node* next = posted->next;
+    posted->next = first;
+    first = posted;
+    posted = next;
+  }
+
+  if (m_readyTail) {
+    m_readyTail->next = first;
+  } else {
+    m_readyHead = first;
+  }
+  m_readyTail = last;
+}
+
+void DeferredEventQueue::Release(Node* node) {
+  node->destroy(node);
+  m_pending.fetch_sub(1, std::memory_order_relaxed);
+}
+
+size_t DeferredEventQueue::Drain(std::chrono::microseconds budget) {
+  using Clock = std::chrono::steady_clock;
+  const auto start = Clock::now();
+
+  TakePosted();
+  size_t dispatched = 0;
+  while (m_readyHead) {
+    if (dispatched > 0 && budget.count() > 0 && Clock::now() - start >= budget) {
+      m_budgetExhausted.fetch_add(1, std::memory_order_relaxed);
+      break;
+    }
+
+    // Unlink first: a listener may post, which only touches the posted stack, but the node
+    // must not be reachable once it is destroyed.
+    Node* node = m_readyHead;
+    m_readyHead = node->next;
+    if (!m_readyHead) m_readyTail = nullptr;
+
+    node->dispatch(node);
+    Release(node);
+    ++dispatched;
+  }
+
+  const auto elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count());
+  m_dispatched.fetch_add(dispatched, std::memory_order_relaxed);
+  m_lastDrainUs.store(elapsed, std::memory_order_relaxed);
+  if (elapsed > m_maxDrainUs.load(std::memory_order_relaxed)) m_maxDrainUs.store(elapsed, std::memory_order_relaxed);
+  return dispatched;
+}
+
+void DeferredEventQueue::Clear() {
+  TakePosted();
+  while (m_readyHead) {
+    Node* node = m_readyHead;
+    m_readyHead = node->next;
+    Release(node);
+  }
+  m_readyTail = nullptr;
+}
+
+DeferredEventStats DeferredEventQueue::GetStats() const {
+  DeferredEventStats stats;
+  stats.posted = m_postedCount.load(std::memory_order_relaxed);
+  stats.dispatched = m_dispatched.load(std::memory_order_relaxed);
+  stats.dropped = m_dropped.load(std::memory_order_relaxed);
+  stats.pending = m_pending.load(std::memory_order_relaxed);
+  stats.maxPending = m_maxPending.load(std::memory_order_relaxed);
+  stats.budgetExhausted = m_budgetExhausted.load(std::memory_order_relaxed);
+  stats.lastDrainUs = m_lastDrainUs.load(std::memory_order_relaxed);
+  stats.maxDrainUs = m_maxDrainUs.load(std::memory_order_relaxed);
+  return stats;
+}
+}  // namespace Events
+SPF_NS_END
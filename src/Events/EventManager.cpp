@@ -23,6 +23,24 @@ EventDispatcher::EventDispatcher(EventManager& manager)
       OnRequestBindingUpdate(manager.System.OnRequestBindingUpdate),
       OnRequestDeleteBinding(manager.System.OnRequestDeleteBinding) {}
 
+// --- Coalesced Events ---
+namespace {
+std::string SettingKey(const UI::OnSettingWasChanged& e) { return e.systemName + '\n' + e.componentName + '\n' + e.keyPath; }
+}  // namespace
+
+EventManager::CoalescedEvents::CoalescedEvents(SystemEvents& system) : OnSettingWasChanged(system.OnSettingWasChanged, &SettingKey), OnKeybindsModified(system.OnKeybindsModified) {}
+
+EventManager::CoalescedEvents::Batch::Batch(CoalescedEvents& events) : m_events(events) {
+  m_events.OnSettingWasChanged.BeginBatch();
+  m_events.OnKeybindsModified.BeginBatch();
+}
+
+EventManager::CoalescedEvents::Batch::~Batch() {
+  // Settings first: a listener may change keybinds in response.
+  m_events.OnSettingWasChanged.EndBatch();
+  m_events.OnKeybindsModified.EndBatch();
+}
+
 // --- EventManager Implementation ---
 void EventManager::Init(Rendering::Renderer& renderer) { m_proxies.emplace_back(std::make_unique<Proxies::WndProcEventProxy>(*this, renderer)); }
 
@@ -123,8 +123,10 @@ void WndProcEventProxy::OnWndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lP
     // Handle non-input messages we care about.
     case WM_SIZE: {
       UI::ResizeEvent event{.width = LOWORD(lParam), .height = HIWORD(lParam)};
-      m_logger->Trace("WM_SIZE detected. Calling OnWindowResize with {}x{}", event.width, event.height);
-      m_eventManager.System.OnWindowResize.Call(event);
+      // The window procedure may run on another thread than the frame, so listeners get the
+      // event from the next Core::Update.
+      m_logger->Trace("WM_SIZE detected. Posting OnWindowResize with {}x{}", event.width, event.height);
+      m_eventManager.Deferred.Post(m_eventManager.System.OnWindowResize, event);
       break;
     }
   }
@@ -6,6 +6,12 @@ SPF_NS_BEGIN
 
 namespace Logging {
 
+namespace {
+// The lowest level a sink receives from a logger at `loggerLevel`. Sinks that ignore the
+// logger level (the UI sink) take their own level, or the logger's where that is lower.
+LogLevel AcceptedLevel(const ILogSink& sink, LogLevel loggerLevel) { return sink.ShouldFilterByLevel() ? loggerLevel : std::min(loggerLevel, sink.GetMinLevel()); }
+}  // namespace
+
 bool TryParseLogLevel(const std::string& levelStr, LogLevel& outLevel) {
   std::string lowerLevelStr = levelStr;
   std::transform(lowerLevelStr.begin(), lowerLevelStr.end(), lowerLevelStr.begin(), [](unsigned char c) { return std::tolower(c); });
@@ -80,24 +86,46 @@ std::vector<std::shared_ptr<ILogSink>> Logger::GetSinks() const {
 void Logger::AddSink(std::shared_ptr<ILogSink> sink) {
   std::lock_guard<std::mutex> lock(m_mutex);
   m_sinks.push_back(std::move(sink));
+  UpdateMinSinkLevel_unlocked();
 }
 
 void Logger::RemoveSink(const std::shared_ptr<ILogSink>& sink) {
   std::lock_guard<std::mutex> lock(m_mutex);
   m_sinks.erase(std::remove(m_sinks.begin(), m_sinks.end(), sink), m_sinks.end());
+  UpdateMinSinkLevel_unlocked();
 }
 
 void Logger::AddSinks(const std::vector<std::shared_ptr<ILogSink>>& newSinks) {
   std::lock_guard<std::mutex> lock(m_mutex);
   m_sinks.insert(m_sinks.end(), newSinks.begin(), newSinks.end());
+  UpdateMinSinkLevel_unlocked();
 }
 
 void Logger::SetSinks(const std::vector<std::shared_ptr<ILogSink>>& sinks) {
   std::lock_guard<std::mutex> lock(m_mutex);
   m_sinks = sinks;
+  UpdateMinSinkLevel_unlocked();
 }
 
-void Logger::SetLevel(LogLevel level) { m_level.store(level, std::memory_order_relaxed); }
+void Logger::SetLevel(LogLevel level) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_level.store(level, std::memory_order_relaxed);
+  UpdateMinSinkLevel_unlocked();
+}
+
+void Logger::RefreshSinkLevels() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  UpdateMinSinkLevel_unlocked();
+}
+
+void Logger::UpdateMinSinkLevel_unlocked() {
+  const LogLevel loggerLevel = m_level.load(std::memory_order_relaxed);
+  LogLevel minLevel = LogLevel::Unknown;
+  for (const auto& sink : m_sinks) {
+    minLevel = std::min(minLevel, AcceptedLevel(*sink, loggerLevel));
+  }
+  m_minSinkLevel.store(minLevel, std::memory_order_relaxed);
+}
 
 LogLevel Logger::GetLevel() const { return m_level.load(std::memory_order_relaxed); }
 
@@ -107,7 +135,13 @@ size_t Logger::SinkCount() const {
 }
 
 void Logger::LogV(LogLevel level, fmt::string_view format_str, fmt::format_args args) {
-  // The log level is now checked per-sink, not globally at the start.
+  if (!ShouldLog(level)) return;
+
+  Dispatch(level, format_str, args);
+}
+
+void Logger::Dispatch(LogLevel level, fmt::string_view format_str, fmt::format_args args) {
+  // The level is checked once more per sink, as not every sink accepts every level that passed ShouldLog().
 
   // Format the message into a buffer using the pre-packed arguments
   fmt::memory_buffer buffer;
@@ -119,16 +153,17 @@ void Logger::LogV(LogLevel level, fmt::string_view format_str, fmt::format_args
 
   // Lock the mutex and dispatch the message to all sinks
   std::lock_guard<std::mutex> lock(m_mutex);
+  const LogLevel loggerLevel = m_level.load(std::memory_order_relaxed);
   for (const auto& sink : m_sinks) {
-    if (sink->ShouldFilterByLevel() && msg.level < m_level.load(std::memory_order_relaxed)) {
-      continue;  // Skip this sink if it filters and the level is too low
+    if (msg.level < AcceptedLevel(*sink, loggerLevel)) {
+      continue;  // Skip this sink if the level is too low for it
     }
     sink->Log(msg);
   }
 }
 
 void Logger::LogThrottledManual(LogLevel level, const char* throttle_key, std::chrono::milliseconds duration, fmt::string_view message) {
-    if (!throttle_key) return;
+    if (!throttle_key || !ShouldLog(level)) return;
 
     // Generate a unique key from the provided string literal
     size_t key_hash = std::hash<const char*>{}(throttle_key);
@@ -148,7 +183,8 @@ void Logger::LogThrottledManual(LogLevel level, const char* throttle_key, std::c
         }
     }
 
-    Log(level, message);
+    // The message is plugin text, not a format string.
+    Log(level, "{}", message);
 }
 
 }  // namespace Logging
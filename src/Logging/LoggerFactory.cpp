@@ -4,6 +4,9 @@
 #include <algorithm>
 #include <memory>
 
+// --- Windows ---
+#include <Windows.h>
+
 // --- Framework ---
 #include <SPF/Core/InitializationReport.hpp>
 #include <SPF/Logging/Sinks/FileSink.hpp>
@@ -17,6 +20,18 @@ using namespace SPF::Core;
 using namespace SPF::System;
 using namespace SPF::Logging::Sinks;
 
+namespace {
+LPTOP_LEVEL_EXCEPTION_FILTER g_previousExceptionFilter = nullptr;
+bool g_crashFlushInstalled = false;
+
+// Gets the queued log messages to disk before the process dies, then lets the previous filter
+// (the game's crash handler, if any) decide what happens.
+LONG WINAPI FlushLogsOnCrash(EXCEPTION_POINTERS* exceptionInfo) {
+  LoggerFactory::GetInstance().TryFlush();
+  return g_previousExceptionFilter ? g_previousExceptionFilter(exceptionInfo) : EXCEPTION_CONTINUE_SEARCH;
+}
+}  // namespace
+
 // --- Singleton ---
 LoggerFactory& LoggerFactory::GetInstance() {
   static LoggerFactory instance;
@@ -24,7 +39,8 @@ LoggerFactory& LoggerFactory::GetInstance() {
 }
 
 // --- Lifecycle ---
-Core::InitializationReport LoggerFactory::Initialize(const std::filesystem::path& log_dir, const nlohmann::json& framework_config) {
+Core::InitializationReport LoggerFactory::Initialize(const std::filesystem::path& log_dir, const nlohmann::json& framework_config,
+                                                     const std::optional<AsyncSinkOptions>& async_options) {
   std::lock_guard<std::mutex> lock(m_mutex);
   InitializationReport report;
   report.ServiceName = "LoggerFactory";
@@ -35,7 +51,12 @@ Core::InitializationReport LoggerFactory::Initialize(const std::filesystem::path
   }
 
   m_logDirectory = log_dir;
+  m_asyncOptions = async_options;
   report.InfoMessages.push_back("Log directory set to: " + m_logDirectory.string());
+  if (m_asyncOptions) {
+    report.InfoMessages.push_back(fmt::format("Asynchronous file logging enabled (queue {}, flush every {} ms, {} on overflow).", m_asyncOptions->capacity,
+                                              m_asyncOptions->flushInterval.count(), m_asyncOptions->overflow == AsyncSinkOptions::Overflow::Drop ? "drop" : "block"));
+  }
 
   // Create a logger for the factory itself, but with no sinks yet.
   m_logger = std::make_shared<Logger>("LoggerFactory");
@@ -51,12 +72,14 @@ Core::InitializationReport LoggerFactory::Initialize(const std::filesystem::path
   // Now that we have sinks, give them to the factory's own logger.
   m_logger->SetSinks(m_globalSinks);
 
+  InstallCrashFlush();
+
   m_isInitialized = true;
   m_logger->Info("Logging system initialized with {} global sinks.", m_globalSinks.size());
   return report;
 }
 
-void LoggerFactory::Shutdown() {
+void LoggerFactory::Shutdown(bool processTerminating) {
   std::lock_guard<std::mutex> lock(m_mutex);
   if (!m_isInitialized) {
     return;
@@ -64,6 +87,21 @@ void LoggerFactory::Shutdown() {
 
   if (m_logger) m_logger->Info("Shutting down logging system...");
 
+  // Write out everything queued and stop the writer threads; loggers still held elsewhere keep
+  // working synchronously. Normally StopAsyncWriters() has already run and Stop() only flushes.
+  RemoveCrashFlush();
+  for (auto& sink : m_asyncSinks) {
+    if (processTerminating) {
+      sink->Abandon();
+    } else {
+      sink->Stop();
+    }
+  }
+  FlushSinks_unlocked(processTerminating);
+  m_asyncSinks.clear();
+  m_asyncWritersRunning = false;
+  m_fileSinks.clear();
+
   m_loggers.clear();
   m_globalSinks.clear();
   m_uiSink.reset();
@@ -80,6 +118,43 @@ std::shared_ptr<Logger> LoggerFactory::GetLogger(const std::string& name) {
   return GetLogger_unlocked(name);
 }
 
+void LoggerFactory::StartAsyncWriters() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_asyncWritersRunning = true;
+  for (auto& sink : m_asyncSinks) {
+    sink->Start();
+  }
+}
+
+void LoggerFactory::StopAsyncWriters() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_asyncWritersRunning = false;
+  for (auto& sink : m_asyncSinks) {
+    sink->Stop();
+  }
+}
+
+void LoggerFactory::Flush() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  FlushSinks_unlocked(false);
+}
+
+bool LoggerFactory::TryFlush() {
+  std::unique_lock<std::mutex> lock(m_mutex, std::try_to_lock);
+  if (!lock.owns_lock()) return false;
+  FlushSinks_unlocked(true);
+  return true;
+}
+
+uint64_t LoggerFactory::GetDroppedMessageCount() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  uint64_t dropped = m_retiredDroppedCount;
+  for (const auto& sink : m_asyncSinks) {
+    dropped += sink->GetDroppedCount();
+  }
+  return dropped;
+}
+
 std::shared_ptr<Sinks::LoggerWindowSink> LoggerFactory::GetUISink() const {
   std::lock_guard<std::mutex> lock(m_mutex);
   return m_uiSink;
@@ -141,6 +216,10 @@ bool LoggerFactory::OnSettingChanged(const std::string& systemName, const std::s
     if (newValue.is_string() && TryParseLogLevel(newValue.get<std::string>(), newLevel)) {
       logger->SetLevel(newLevel);
       //m_logger->Debug("Updated log level for '{}' to {}", componentName, LogLevelToString(newLevel));
+      if (componentName == "framework") {
+        m_frameworkLogLevel = newLevel;
+        SetUISinkLevel_unlocked(newLevel);
+      }
     }
   } else if (keyPath == "sinks.file") {
       if (newValue.is_boolean()) {
@@ -152,6 +231,7 @@ bool LoggerFactory::OnSettingChanged(const std::string& systemName, const std::s
           // Create and add UI sink if it doesn't exist
           m_logger->Info("Creating and adding global UI sink via settings change.");
           m_uiSink = std::make_shared<LoggerWindowSink>();
+          m_uiSink->SetLevel(m_frameworkLogLevel);
           AddGlobalSink(m_uiSink);
       } else if (!newValue.get<bool>() && m_uiSink) {
           // Remove UI sink if it exists
@@ -221,7 +301,7 @@ void LoggerFactory::CreateGlobalSinks(const nlohmann::json& framework_config, Co
             try {
                 auto logFilePath = m_logDirectory / "framework.log";
                 m_logger->Info("Creating GLOBAL file sink at path '{}'", logFilePath.string());
-                m_frameworkFileSink = std::make_shared<FileSink>(logFilePath, "file_framework");
+                m_frameworkFileSink = MakeFileSink(logFilePath, "file_framework");
                 AddGlobalSink(m_frameworkFileSink);
             } catch (const std::exception& e) {
                 m_logger->Error("Failed to create framework file sink. Error: {}", e.what());
@@ -242,11 +322,25 @@ void LoggerFactory::CreateGlobalSinks(const nlohmann::json& framework_config, Co
         if (uiSinkEnabled) {
             m_logger->Info("Creating GLOBAL UI sink.");
             m_uiSink = std::make_shared<LoggerWindowSink>();
+            m_uiSink->SetLevel(m_frameworkLogLevel);
             AddGlobalSink(m_uiSink);
         }
     }
 }
 
+void LoggerFactory::SetUISinkLevel_unlocked(LogLevel level) {
+    if (!m_uiSink) return;
+
+    m_uiSink->SetLevel(level);
+    // Every logger caches the lowest level its sinks accept.
+    for (auto& [name, logger] : m_loggers) {
+        logger->RefreshSinkLevels();
+    }
+    if (m_logger) {
+        m_logger->RefreshSinkLevels();
+    }
+}
+
 void LoggerFactory::AddGlobalSink(const std::shared_ptr<ILogSink>& sink) {
     m_globalSinks.push_back(sink);
     // Propagate to all existing loggers
@@ -279,12 +373,11 @@ void LoggerFactory::ManagePrivateFileSink(const std::string& componentName, bool
 
     std::string sinkName = "file_" + componentName;
 
-    // Find if this logger already has a private file sink
-    std::shared_ptr<FileSink> existingFileSink;
+    // Find if this logger already has a private file sink (possibly wrapped in an AsyncSink)
+    std::shared_ptr<ILogSink> existingFileSink;
     for(const auto& sink : logger->GetSinks()) {
-        auto fileSink = std::dynamic_pointer_cast<FileSink>(sink);
-        if (fileSink && fileSink->GetName() == sinkName) {
-            existingFileSink = fileSink;
+        if (sink->GetName() == sinkName) {
+            existingFileSink = sink;
             break;
         }
     }
@@ -295,15 +388,67 @@ void LoggerFactory::ManagePrivateFileSink(const std::string& componentName, bool
             std::filesystem::create_directories(logFilePath.parent_path());
 
             m_logger->Info("Creating PRIVATE file sink for component: '{}' at path '{}'", componentName, logFilePath.string());
-            auto privateFileSink = std::make_shared<FileSink>(logFilePath, sinkName);
-            logger->AddSink(privateFileSink);
+            logger->AddSink(MakeFileSink(logFilePath, sinkName));
         } catch (const std::exception& e) {
             m_logger->Error("Failed to create private file sink for '{}'. Error: {}", componentName, e.what());
         }
     } else if (!wantsFileSink && existingFileSink) {
         m_logger->Info("Removing PRIVATE file sink for component: '{}'", componentName);
         logger->RemoveSink(existingFileSink);
+        m_fileSinks.erase(std::remove(m_fileSinks.begin(), m_fileSinks.end(), existingFileSink), m_fileSinks.end());
+
+        auto asyncIt = std::find(m_asyncSinks.begin(), m_asyncSinks.end(), existingFileSink);
+        if (asyncIt != m_asyncSinks.end()) {
+            (*asyncIt)->Stop();
+            m_retiredDroppedCount += (*asyncIt)->GetDroppedCount();
+            m_asyncSinks.erase(asyncIt);
+        }
+    }
+}
+
+std::shared_ptr<ILogSink> LoggerFactory::MakeFileSink(const std::filesystem::path& path, const std::string& name) {
+    auto fileSink = std::make_shared<FileSink>(path, name);
+    if (!m_asyncOptions) {
+        m_fileSinks.push_back(fileSink);
+        return fileSink;
+    }
+
+    auto asyncSink = std::make_shared<AsyncSink>(fileSink, *m_asyncOptions);
+    if (m_asyncWritersRunning) {
+        asyncSink->Start();
+    }
+    m_asyncSinks.push_back(asyncSink);
+    m_fileSinks.push_back(asyncSink);
+    return asyncSink;
+}
+
+void LoggerFactory::FlushSinks_unlocked(bool crashing) {
+    // Only file sinks buffer anything. They are flushed from this list rather than through the
+    // loggers, whose locks a crashing thread may hold. Async sinks write out their queue first.
+    for (const auto& sink : m_fileSinks) {
+        if (crashing) {
+            sink->TryFlush();
+        } else {
+            sink->Flush();
+        }
+    }
+}
+
+void LoggerFactory::InstallCrashFlush() {
+    if (g_crashFlushInstalled) return;
+    g_previousExceptionFilter = SetUnhandledExceptionFilter(&FlushLogsOnCrash);
+    g_crashFlushInstalled = true;
+}
+
+void LoggerFactory::RemoveCrashFlush() {
+    if (!g_crashFlushInstalled) return;
+    // If another filter was installed after ours, it stays in place.
+    const auto current = SetUnhandledExceptionFilter(g_previousExceptionFilter);
+    if (current != &FlushLogsOnCrash) {
+        SetUnhandledExceptionFilter(current);
     }
+    g_previousExceptionFilter = nullptr;
+    g_crashFlushInstalled = false;
 }
 
 // --- Constructor / Destructor ---
@@ -0,0 +1,200 @@
+#include <SPF/Logging/Sinks/AsyncSink.hpp>
+#include <algorithm>
+#include <bit>
+
+SPF_NS_BEGIN
+
+namespace Logging::Sinks {
+
+AsyncSink::AsyncSink(std::shared_ptr<ILogSink> target, const AsyncSinkOptions& options) : m_target(std::move(target)), m_options(options) {
+  const size_t capacity = std::bit_ceil(std::max<size_t>(options.capacity, 2));
+  m_cells = std::make_unique<Cell[]>(capacity);
+  m_mask = capacity - 1;
+  for (size_t i = 0; i < capacity; ++i) {
+    m_cells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+AsyncSink::~AsyncSink() { Stop(); }
+
+void AsyncSink::Log(const LogMessage& msg) {
+  if (!m_async.load(std::memory_order_acquire)) {
+    WriteDirect(msg);
+    return;
+  }
+
+  while (!TryPush(msg)) {
+    if (m_options.overflow == AsyncSinkOptions::Overflow::Drop || !m_async.load(std::memory_order_acquire)) {
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    m_wake.notify_one();
+    std::this_thread::yield();
+  }
+
+  // Errors should reach the file before a possible crash; a filling queue needs the writer too.
+  const size_t queued = m_enqueuePos.load(std::memory_order_relaxed) - m_dequeuePos.load(std::memory_order_relaxed);
+  if (msg.level >= LogLevel::Error || queued > m_mask / 2) {
+    m_wake.notify_one();
+  }
+}
+
+bool AsyncSink::TryPush(const LogMessage& msg) {
+  size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+  Cell* cell = nullptr;
+  while (true) {
+    cell = &m_cells[pos & m_mask];
+    const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+    const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+    if (diff == 0) {
+      if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+    } else if (diff < 0) {
+      return false;  // The writer has not consumed this cell yet: the ring is full.
+    } else {
+      pos = m_enqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+
+  cell->timestamp = msg.timestamp;
+  cell->level = msg.level;
+  cell->threadId = msg.thread_id;
+  cell->loggerNameSize = static_cast<uint8_t>(std::min(msg.logger_name.size(), cell->loggerName.size()));
+  std::copy_n(msg.logger_name.data(), cell->loggerNameSize, cell->loggerName.data());
+  // The cell's buffer keeps its capacity, so after warm-up this does not allocate.
+  cell->message.clear();
+  cell->message.append(msg.formatted_message.data(), msg.formatted_message.data() + msg.formatted_message.size());
+  cell->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+void AsyncSink::WriteDirect(const LogMessage& msg) {
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_writeOwner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+  // Messages queued before the writer stopped go first.
+  Drain_unlocked();
+  m_target->Log(msg);
+  m_writeOwner.store(std::thread::id(), std::memory_order_relaxed);
+}
+
+void AsyncSink::Start() {
+  std::lock_guard<std::mutex> lock(m_stateMutex);
+  if (m_thread.joinable()) return;
+
+  m_stopping = false;
+  m_async.store(true, std::memory_order_release);
+  m_thread = std::thread(&AsyncSink::Run, this);
+}
+
+void AsyncSink::Run() {
+  while (true) {
+    bool stopping = false;
+    {
+      std::unique_lock<std::mutex> lock(m_stateMutex);
+      if (!m_stopping) {
+        m_wake.wait_for(lock, m_options.flushInterval);
+      }
+      stopping = m_stopping;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_writeMutex);
+      m_writeOwner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+      if (Drain_unlocked()) {
+        m_target->Flush();
+      }
+      m_writeOwner.store(std::thread::id(), std::memory_order_relaxed);
+    }
+    if (stopping) break;
+  }
+}
+
+bool AsyncSink::Drain_unlocked() {
+  bool wrote = false;
+  while (true) {
+    const size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+    Cell& cell = m_cells[pos & m_mask];
+    if (cell.sequence.load(std::memory_order_acquire) != pos + 1) break;
+
+    m_scratch.timestamp = cell.timestamp;
+    m_scratch.level = cell.level;
+    m_scratch.thread_id = cell.threadId;
+    std::copy_n(cell.loggerName.data(), cell.loggerNameSize, m_scratchName.data());
+    m_scratch.logger_name = fmt::string_view(m_scratchName.data(), cell.loggerNameSize);
+    m_scratch.formatted_message.clear();
+    m_scratch.formatted_message.append(cell.message.data(), cell.message.data() + cell.message.size());
+    cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+    m_dequeuePos.store(pos + 1, std::memory_order_relaxed);
+
+    m_target->Log(m_scratch);
+    wrote = true;
+  }
+
+  return ReportDropped_unlocked() || wrote;
+}
+
+bool AsyncSink::ReportDropped_unlocked() {
+  const uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+  if (dropped == m_reportedDropped) return false;
+
+  m_scratch.timestamp = std::chrono::system_clock::now();
+  m_scratch.level = LogLevel::Warn;
+  m_scratch.thread_id = std::this_thread::get_id();
+  m_scratch.logger_name = "Logging";
+  m_scratch.formatted_message.clear();
+  fmt::format_to(std::back_inserter(m_scratch.formatted_message), "{} log messages were dropped because the log queue was full.", dropped - m_reportedDropped);
+  m_target->Log(m_scratch);
+  m_reportedDropped = dropped;
+  return true;
+}
+
+void AsyncSink::Flush() {
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_writeOwner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+  Drain_unlocked();
+  m_target->Flush();
+  m_writeOwner.store(std::thread::id(), std::memory_order_relaxed);
+}
+
+bool AsyncSink::TryFlush() {
+  // A crash inside a write on this thread leaves the lock held and the target mid-line; waiting
+  // would deadlock and writing would interleave, so such a sink is skipped.
+  if (m_writeOwner.load(std::memory_order_relaxed) == std::this_thread::get_id()) return false;
+
+  std::unique_lock<std::mutex> lock(m_writeMutex, std::try_to_lock);
+  if (!lock.owns_lock()) return false;
+  Drain_unlocked();
+  m_target->TryFlush();
+  return true;
+}
+
+void AsyncSink::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+    if (!m_thread.joinable()) return;
+    m_async.store(false, std::memory_order_release);
+    m_stopping = true;
+  }
+  m_wake.notify_one();
+  m_thread.join();
+
+  // Messages pushed while the writer was finishing.
+  Flush();
+}
+
+void AsyncSink::Abandon() {
+  m_async.store(false, std::memory_order_release);
+  {
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+    // Only called when the process is exiting: Windows has terminated every other thread
+    // before DLL_PROCESS_DETACH, so the writer can no longer touch this sink.
+    if (m_thread.joinable()) {
+      m_thread.detach();
+    }
+  }
+  // The writer may have been terminated holding the lock; then the queue is lost.
+  TryFlush();
+}
+
+}  // namespace Logging::Sinks
+
+SPF_NS_END
@@ -26,19 +26,48 @@ fmt::string_view FileSink::GetName() const {
 }
 
 void FileSink::Log(const LogMessage& msg) {
+  std::lock_guard<std::mutex> lock(m_mutex);
   if (!m_file.is_open()) {
     return;
   }
+  m_writeOwner.store(std::this_thread::get_id(), std::memory_order_relaxed);
 
   // Pass the time_point directly to fmt::format for correct millisecond formatting.
   // The fmt/chrono.h header handles the %e specifier.
-  std::string formatted_log = fmt::format(fmt::runtime(m_formatter_pattern),
-                                          fmt::arg("timestamp", msg.timestamp),
-                                          fmt::arg("level", LogLevelToString(msg.level)),
-                                          fmt::arg("logger_name", msg.logger_name),
-                                          fmt::arg("message", fmt::to_string(msg.formatted_message)));
+  m_line.clear();
+  fmt::format_to(std::back_inserter(m_line), fmt::runtime(m_formatter_pattern),
+                 fmt::arg("timestamp", msg.timestamp),
+                 fmt::arg("level", LogLevelToString(msg.level)),
+                 fmt::arg("logger_name", msg.logger_name),
+                 fmt::arg("message", fmt::string_view(msg.formatted_message.data(), msg.formatted_message.size())));
+  m_line.push_back('\n');
+  m_file.write(m_line.data(), static_cast<std::streamsize>(m_line.size()));
 
-  m_file << formatted_log << std::endl;
+  // Flushing every line costs a write syscall each; errors are flushed right away so they
+  // survive a crash, everything else when Flush() is called.
+  if (msg.level >= LogLevel::Error) {
+    m_file.flush();
+  }
+  m_writeOwner.store(std::thread::id(), std::memory_order_relaxed);
+}
+
+void FileSink::Flush() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_file.is_open()) {
+    m_file.flush();
+  }
+}
+
+bool FileSink::TryFlush() {
+  // A crash inside Log() on this thread leaves the lock held and the line half written.
+  if (m_writeOwner.load(std::memory_order_relaxed) == std::this_thread::get_id()) return false;
+
+  std::unique_lock<std::mutex> lock(m_mutex, std::try_to_lock);
+  if (!lock.owns_lock()) return false;
+  if (m_file.is_open()) {
+    m_file.flush();
+  }
+  return true;
 }
 
 }  // namespace Logging::Sinks
@@ -31,7 +31,8 @@ SPF_Logger_Handle* LoggerApi::L_GetLogger(const char* pluginName) {
 void LoggerApi::L_Log(SPF_Logger_Handle* handle, SPF_LogLevel level, const char* message) {
     auto* loggerHandle = reinterpret_cast<LoggerHandle*>(handle);
     if (loggerHandle && loggerHandle->logger && message) {
-        loggerHandle->logger->Log(static_cast<LogLevel>(level), message);
+        // The message is plugin text, not a format string: braces in it must not be interpreted.
+        loggerHandle->logger->Log(static_cast<LogLevel>(level), "{}", message);
     }
 }
 
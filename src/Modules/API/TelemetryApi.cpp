@@ -11,7 +11,9 @@
 #include "SPF/Telemetry/SCS/Controls.hpp"
 #include "SPF/Telemetry/SCS/Events.hpp"
 #include "SPF/Telemetry/SCS/Gearbox.hpp"
+#include "SPF/Telemetry/CDataConversion.hpp"
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 
 SPF_NS_BEGIN
@@ -19,20 +21,167 @@ namespace Modules::API {
 
 using namespace Telemetry::SCS;
 
-// Helper to convert Game enum to string
-const char* GameToString(SPF::Game game) {
-  switch (game) {
-    case SPF::Game::ETS2:
-      return "ETS2";
-    case SPF::Game::ATS:
-      return "ATS";
-    case SPF::Game::Unknown:
-      return "Unknown";
-    default:
-      return "Invalid";
-  }
+namespace {
+// --- C++ -> C Conversion ---
+// The converters themselves live in Telemetry/CDataConversion. They are only called
+// through the conversion cache below, so every struct is converted at most once per
+// data revision no matter how many plugins read it.
+using namespace Telemetry::Conversion;
+
+/// A converted list of trailers. `GetTrailers` exposes every slot, the trailers
+/// callback only the active ones (connected or configured).
+struct TrailerList {
+    SPF_Trailer trailers[SPF_TELEMETRY_TRAILER_MAX_COUNT];
+    uint32_t count = 0;
+};
+
+void ConvertTrailers(const std::vector<Trailer>& cpp_trailers, TrailerList& all, TrailerList& active) {
+    all.count = static_cast<uint32_t>(std::min<size_t>(cpp_trailers.size(), SPF_TELEMETRY_TRAILER_MAX_COUNT));
+    active.count = 0;
+    for (uint32_t i = 0; i < all.count; ++i) {
+        const auto& trailer = cpp_trailers[i];
+        ConvertTrailer(trailer, all.trailers[i]);
+        if (trailer.data.connected || !trailer.constants.id.empty()) {
+            active.trailers[active.count++] = all.trailers[i];
+        }
+    }
+}
+
+// --- Conversion Cache ---
+
+#if SPF_TELEMETRY_TIMING
+/// Time spent converting C++ data into the cached C structs, across all struct types.
+Telemetry::TimingHistogram* ConversionTiming() {
+    static const auto histogram = Telemetry::TimingRegistry::GetInstance().Add("API: C struct conversion");
+    return histogram.get();
+}
+#endif
+
+/**
+ * @brief One converted C struct, stamped with the data revision and the C++ object it was built from.
+ *
+ * The entry is rebuilt lazily on first access after the telemetry service publishes a new
+ * revision. Keying on the source object as well keeps per-instance payloads apart (e.g. the
+ * constants of different trailers delivered within one revision).
+ */
+template <typename CType>
+struct CachedConversion {
+    CType data{};
+    const void* source = nullptr;
+    uint64_t revision = 0;
+    bool valid = false;
+
+    template <typename CppType, typename ConvertFunc>
+    const CType& Get(const CppType& cpp_data, uint64_t current_revision, ConvertFunc&& convert) {
+        if (!valid || revision != current_revision || source != &cpp_data) {
+            SPF_TELEMETRY_TIME_SCOPE(ConversionTiming());
+            convert(cpp_data, data);
+            source = &cpp_data;
+            revision = current_revision;
+            valid = true;
+        }
+        return data;
+    }
+};
+
+/**
+ * @brief Shared C-API views of the current telemetry data.
+ *
+ * All plugin callbacks and T_Get* calls read from here, so each struct (including all of
+ * its string copies) is converted at most once per data revision. Telemetry is produced
+ * and consumed on the game thread, so the cache is not synchronized.
+ */
+struct ConversionCache {
+    CachedConversion<SPF_GameState> gameState;
+    CachedConversion<SPF_Timestamps> timestamps;
+    CachedConversion<SPF_CommonData> commonData;
+    CachedConversion<SPF_TruckConstants> truckConstants;
+    CachedConversion<SPF_TrailerConstants> trailerConstants;
+    CachedConversion<SPF_TruckData> truckData;
+    CachedConversion<TrailerList> allTrailers;
+    TrailerList activeTrailers;
+    CachedConversion<SPF_JobConstants> jobConstants;
+    CachedConversion<SPF_JobData> jobData;
+    CachedConversion<SPF_NavigationData> navigationData;
+    CachedConversion<SPF_Controls> controls;
+    CachedConversion<SPF_SpecialEvents> specialEvents;
+    CachedConversion<SPF_GameplayEvents> gameplayEvents;
+    CachedConversion<SPF_GearboxConstants> gearboxConstants;
+    CachedConversion<SPF_DerivedData> derivedData;
+
+    // The view handed out by GetView. Rebuilt once per frame rather than per revision, so
+    // the pointer plugins hold stays unchanged until the next frame starts.
+    std::unique_ptr<SPF_TelemetryView> view;
+    uint64_t viewFrame = 0;
+};
+
+ConversionCache& GetCache() {
+    static ConversionCache cache;
+    return cache;
+}
+
+uint64_t CurrentRevision() {
+    auto* telemetry = PluginManager::GetInstance().GetTelemetryService();
+    return telemetry ? telemetry->GetDataRevision() : 0;
+}
+
+const SPF_TruckData& GetConvertedTruckData(const TruckData& cpp_data) {
+    return GetCache().truckData.Get(cpp_data, CurrentRevision(), [](const TruckData& data, SPF_TruckData& out) {
+        ConvertTruckData(data, PluginManager::GetInstance().GetTelemetryService()->GetTruckConstants(), out);
+    });
+}
+
+/// Converts all trailer slots and refreshes the active-trailer list alongside them.
+const TrailerList& GetConvertedTrailers(const std::vector<Trailer>& cpp_trailers, const TrailerList** out_active = nullptr) {
+    auto& cache = GetCache();
+    const auto& all = cache.allTrailers.Get(cpp_trailers, CurrentRevision(), [&cache](const std::vector<Trailer>& data, TrailerList& out) {
+        ConvertTrailers(data, out, cache.activeTrailers);
+    });
+    if (out_active) *out_active = &cache.activeTrailers;
+    return all;
 }
 
+// --- Channel Demand ---
+// The service only registers the SDK channels someone reads. Polling getters add the
+// groups behind their struct to the plugin handle's lease; subscriptions hold their own.
+using Telemetry::ChannelGroup;
+using Telemetry::ChannelGroupMask;
+using Telemetry::MakeChannelGroupMask;
+
+const ChannelGroupMask kTruckChannels = MakeChannelGroupMask(ChannelGroup::Truck, ChannelGroup::TruckMotion, ChannelGroup::TruckWheels);
+const ChannelGroupMask kTrailerChannels = MakeChannelGroupMask(ChannelGroup::Trailers);
+const ChannelGroupMask kJobChannels = MakeChannelGroupMask(ChannelGroup::Job);
+const ChannelGroupMask kNavigationChannels = MakeChannelGroupMask(ChannelGroup::Navigation);
+const ChannelGroupMask kControlsChannels = MakeChannelGroupMask(ChannelGroup::Controls);
+
+void DemandChannels(SPF_Telemetry_Handle* handle, const ChannelGroupMask& groups) {
+    auto& lease = reinterpret_cast<Handles::TelemetryHandle*>(handle)->m_polledChannels;
+    if ((lease.GetGroups() & groups) == groups) return;
+
+    if (lease.GetGroups().none()) {
+        lease = PluginManager::GetInstance().GetTelemetryService()->AcquireChannels(groups);
+    } else {
+        lease.Extend(groups);
+    }
+}
+
+/// Returns the handler that was just added to the plugin's handle; with SPF_TELEMETRY_TIMING
+/// its callbacks are timed as "<plugin>: <kind>".
+SPF_Telemetry_Callback_Handle* TrackSubscription(Handles::TelemetryHandle* telemetryHandle, [[maybe_unused]] const char* kind) {
+    auto& handler = telemetryHandle->m_subscriptionHandlers.back();
+#if SPF_TELEMETRY_TIMING
+    handler->m_timing = Telemetry::TimingRegistry::GetInstance().Add(telemetryHandle->pluginName + ": " + kind);
+#endif
+    return reinterpret_cast<SPF_Telemetry_Callback_Handle*>(handler.get());
+}
+
+/// Holds `groups` for the handler that was just added to the plugin's handle.
+SPF_Telemetry_Callback_Handle* LeaseChannels(Handles::TelemetryHandle* telemetryHandle, const ChannelGroupMask& groups, const char* kind) {
+    telemetryHandle->m_subscriptionHandlers.back()->m_channels = PluginManager::GetInstance().GetTelemetryService()->AcquireChannels(groups);
+    return TrackSubscription(telemetryHandle, kind);
+}
+}  // namespace
+
 SPF_Telemetry_Handle* TelemetryApi::T_GetContext(const char* pluginName) {
     auto& pm = PluginManager::GetInstance();
     if (!pluginName || !pm.GetHandleManager()) return nullptr;
@@ -44,270 +193,46 @@ void TelemetryApi::T_GetGameState(SPF_Telemetry_Handle* handle, SPF_GameState* o
     auto& pm = PluginManager::GetInstance();
     if (!handle || !out_data || !pm.GetTelemetryService()) return;
 
-    const auto& cpp_data = pm.GetTelemetryService()->GetGameState();
-
-    strcpy_s(out_data->game_id, SPF_TELEMETRY_ID_MAX_SIZE, GameToString(cpp_data.game_id));
-    strcpy_s(out_data->game_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.game_name.c_str());
-    
-    out_data->scs_game_version_major = cpp_data.scs_game_version_major;
-    out_data->scs_game_version_minor = cpp_data.scs_game_version_minor;
-    
-    out_data->telemetry_plugin_version_major = cpp_data.telemetry_plugin_version_major;
-    out_data->telemetry_plugin_version_minor = cpp_data.telemetry_plugin_version_minor;
-
-    out_data->telemetry_game_version_major = cpp_data.telemetry_game_version_major;
-    out_data->telemetry_game_version_minor = cpp_data.telemetry_game_version_minor;
-
-    out_data->paused = cpp_data.paused;
-    out_data->scale = cpp_data.scale;
-    out_data->multiplayer_time_offset = cpp_data.multiplayer_time_offset;
+    *out_data = GetCache().gameState.Get(pm.GetTelemetryService()->GetGameState(), CurrentRevision(), ConvertGameState);
 }
 
 void TelemetryApi::T_GetTimestamps(SPF_Telemetry_Handle* handle, SPF_Timestamps* out_data) {
     auto& pm = PluginManager::GetInstance();
     if (!handle || !out_data || !pm.GetTelemetryService()) return;
 
-    const auto& cpp_data = pm.GetTelemetryService()->GetTimestamps();
-    out_data->simulation = cpp_data.simulation;
-    out_data->render = cpp_data.render;
-    out_data->paused_simulation = cpp_data.paused_simulation;
+    *out_data = GetCache().timestamps.Get(pm.GetTelemetryService()->GetTimestamps(), CurrentRevision(), ConvertTimestamps);
 }
 
 void TelemetryApi::T_GetCommonData(SPF_Telemetry_Handle* handle, SPF_CommonData* out_data) {
     auto& pm = PluginManager::GetInstance();
     if (!handle || !out_data || !pm.GetTelemetryService()) return;
 
-    const auto& cpp_data = pm.GetTelemetryService()->GetCommonData();
-    out_data->game_time = cpp_data.game_time;
-    out_data->next_rest_stop = cpp_data.next_rest_stop;
-    out_data->next_rest_stop_time.DayOfWeek = cpp_data.next_rest_stop_time.DayOfWeek;
-    out_data->next_rest_stop_time.Hour = cpp_data.next_rest_stop_time.Hour;
-    out_data->next_rest_stop_time.Minute = cpp_data.next_rest_stop_time.Minute;
-    out_data->next_rest_stop_real_minutes = cpp_data.next_rest_stop_real_minutes;
-
-    out_data->substance_count = static_cast<uint32_t>(std::min<size_t>(cpp_data.substances.size(), SPF_TELEMETRY_SUBSTANCE_MAX_COUNT));
-    for (uint32_t i = 0; i < out_data->substance_count; ++i) {
-        strcpy_s(out_data->substances[i], SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.substances[i].c_str());
-    }
+    *out_data = GetCache().commonData.Get(pm.GetTelemetryService()->GetCommonData(), CurrentRevision(), ConvertCommonData);
 }
 
 void TelemetryApi::T_GetTruckConstants(SPF_Telemetry_Handle* handle, SPF_TruckConstants* out_data) {
     auto& pm = PluginManager::GetInstance();
     if (!handle || !out_data || !pm.GetTelemetryService()) return;
 
-    const auto& cpp_data = pm.GetTelemetryService()->GetTruckConstants();
-
-    strcpy_s(out_data->brand_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.brand_id.c_str());
-    strcpy_s(out_data->brand, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.brand.c_str());
-    strcpy_s(out_data->id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.id.c_str());
-    strcpy_s(out_data->name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.name.c_str());
-    strcpy_s(out_data->license_plate, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.license_plate.c_str());
-    strcpy_s(out_data->license_plate_country_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.license_plate_country_id.c_str());
-    strcpy_s(out_data->license_plate_country, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.license_plate_country.c_str());
-
-    out_data->fuel_capacity = cpp_data.fuel_capacity;
-    out_data->fuel_warning_factor = cpp_data.fuel_warning_factor;
-    out_data->adblue_capacity = cpp_data.adblue_capacity;
-    out_data->adblue_warning_factor = cpp_data.adblue_warning_factor;
-    out_data->air_pressure_warning = cpp_data.air_pressure_warning;
-    out_data->air_pressure_emergency = cpp_data.air_pressure_emergency;
-    out_data->oil_pressure_warning = cpp_data.oil_pressure_warning;
-    out_data->water_temperature_warning = cpp_data.water_temperature_warning;
-    out_data->battery_voltage_warning = cpp_data.battery_voltage_warning;
-    out_data->rpm_limit = cpp_data.rpm_limit;
-    out_data->forward_gear_count = cpp_data.forward_gear_count;
-    out_data->reverse_gear_count = cpp_data.reverse_gear_count;
-    out_data->retarder_step_count = cpp_data.retarder_step_count;
-    out_data->selector_count = cpp_data.selector_count;
-    out_data->differential_ratio = cpp_data.differential_ratio;
-
-    out_data->cabin_position = {cpp_data.cabin_position.x, cpp_data.cabin_position.y, cpp_data.cabin_position.z};
-    out_data->head_position = {cpp_data.head_position.x, cpp_data.head_position.y, cpp_data.head_position.z};
-    out_data->hook_position = {cpp_data.hook_position.x, cpp_data.hook_position.y, cpp_data.hook_position.z};
-
-    out_data->wheel_count = std::min<uint32_t>(cpp_data.wheel_count, SPF_TELEMETRY_WHEEL_MAX_COUNT);
-    for (uint32_t i = 0; i < out_data->wheel_count; ++i) {
-        out_data->wheels[i].simulated = cpp_data.wheels[i].simulated;
-        out_data->wheels[i].powered = cpp_data.wheels[i].powered;
-        out_data->wheels[i].steerable = cpp_data.wheels[i].steerable;
-        out_data->wheels[i].liftable = cpp_data.wheels[i].liftable;
-        out_data->wheels[i].radius = cpp_data.wheels[i].radius;
-        out_data->wheels[i].position = {cpp_data.wheels[i].position.x, cpp_data.wheels[i].position.y, cpp_data.wheels[i].position.z};
-    }
-
-    uint32_t forward_gears_to_copy = std::min<uint32_t>(cpp_data.forward_gear_count, SPF_TELEMETRY_GEAR_MAX_COUNT);
-    memcpy(out_data->gear_ratios_forward, cpp_data.gear_ratios_forward.data(), forward_gears_to_copy * sizeof(float));
-
-    uint32_t reverse_gears_to_copy = std::min<uint32_t>(cpp_data.reverse_gear_count, SPF_TELEMETRY_GEAR_MAX_COUNT);
-    memcpy(out_data->gear_ratios_reverse, cpp_data.gear_ratios_reverse.data(), reverse_gears_to_copy * sizeof(float));
+    *out_data = GetCache().truckConstants.Get(pm.GetTelemetryService()->GetTruckConstants(), CurrentRevision(), ConvertTruckConstants);
 }
 
 void TelemetryApi::T_GetTruckData(SPF_Telemetry_Handle* handle, SPF_TruckData* out_data) {
     auto& pm = PluginManager::GetInstance();
     if (!handle || !out_data || !pm.GetTelemetryService()) return;
+    DemandChannels(handle, kTruckChannels);
 
-    const auto& cpp_data = pm.GetTelemetryService()->GetTruckData();
-    const auto& cpp_consts = pm.GetTelemetryService()->GetTruckConstants();
-
-    // Placements and vectors
-    out_data->world_placement = {{cpp_data.world_placement.position.x, cpp_data.world_placement.position.y, cpp_data.world_placement.position.z},
-                               {cpp_data.world_placement.orientation.heading, cpp_data.world_placement.orientation.pitch, cpp_data.world_placement.orientation.roll}};
-    out_data->local_linear_velocity = {cpp_data.local_linear_velocity.x, cpp_data.local_linear_velocity.y, cpp_data.local_linear_velocity.z};
-    out_data->local_angular_velocity = {cpp_data.local_angular_velocity.x, cpp_data.local_angular_velocity.y, cpp_data.local_angular_velocity.z};
-    out_data->local_linear_acceleration = {cpp_data.local_linear_acceleration.x, cpp_data.local_linear_acceleration.y, cpp_data.local_linear_acceleration.z};
-    out_data->local_angular_acceleration = {cpp_data.local_angular_acceleration.x, cpp_data.local_angular_acceleration.y, cpp_data.local_angular_acceleration.z};
-    out_data->cabin_offset = {{cpp_data.cabin_offset.position.x, cpp_data.cabin_offset.position.y, cpp_data.cabin_offset.position.z},
-                            {cpp_data.cabin_offset.orientation.heading, cpp_data.cabin_offset.orientation.pitch, cpp_data.cabin_offset.orientation.roll}};
-    out_data->cabin_angular_velocity = {cpp_data.cabin_angular_velocity.x, cpp_data.cabin_angular_velocity.y, cpp_data.cabin_angular_velocity.z};
-    out_data->cabin_angular_acceleration = {cpp_data.cabin_angular_acceleration.x, cpp_data.cabin_angular_acceleration.y, cpp_data.cabin_angular_acceleration.z};
-    out_data->head_offset = {{cpp_data.head_offset.position.x, cpp_data.head_offset.position.y, cpp_data.head_offset.position.z},
-                           {cpp_data.head_offset.orientation.heading, cpp_data.head_offset.orientation.pitch, cpp_data.head_offset.orientation.roll}};
-
-    // Simple values
-    out_data->speed = cpp_data.speed;
-    out_data->engine_rpm = cpp_data.engine_rpm;
-    out_data->gear = cpp_data.gear;
-    out_data->displayed_gear = cpp_data.displayed_gear;
-    out_data->input_steering = cpp_data.input_steering;
-    out_data->input_throttle = cpp_data.input_throttle;
-    out_data->input_brake = cpp_data.input_brake;
-    out_data->input_clutch = cpp_data.input_clutch;
-    out_data->effective_steering = cpp_data.effective_steering;
-    out_data->effective_throttle = cpp_data.effective_throttle;
-    out_data->effective_brake = cpp_data.effective_brake;
-    out_data->effective_clutch = cpp_data.effective_clutch;
-    out_data->cruise_control_speed = cpp_data.cruise_control_speed;
-    out_data->hshifter_slot = cpp_data.hshifter_slot;
-    out_data->parking_brake = cpp_data.parking_brake;
-    out_data->motor_brake = cpp_data.motor_brake;
-    out_data->retarder_level = cpp_data.retarder_level;
-    out_data->air_pressure = cpp_data.air_pressure;
-    out_data->air_pressure_warning = cpp_data.air_pressure_warning;
-    out_data->air_pressure_emergency = cpp_data.air_pressure_emergency;
-    out_data->brake_temperature = cpp_data.brake_temperature;
-    out_data->fuel_amount = cpp_data.fuel_amount;
-    out_data->fuel_warning = cpp_data.fuel_warning;
-    out_data->fuel_average_consumption = cpp_data.fuel_average_consumption;
-    out_data->fuel_range = cpp_data.fuel_range;
-    out_data->adblue_amount = cpp_data.adblue_amount;
-    out_data->adblue_warning = cpp_data.adblue_warning;
-    out_data->adblue_average_consumption = cpp_data.adblue_average_consumption;
-    out_data->oil_pressure = cpp_data.oil_pressure;
-    out_data->oil_pressure_warning = cpp_data.oil_pressure_warning;
-    out_data->oil_temperature = cpp_data.oil_temperature;
-    out_data->water_temperature = cpp_data.water_temperature;
-    out_data->water_temperature_warning = cpp_data.water_temperature_warning;
-    out_data->battery_voltage = cpp_data.battery_voltage;
-    out_data->battery_voltage_warning = cpp_data.battery_voltage_warning;
-    out_data->electric_enabled = cpp_data.electric_enabled;
-    out_data->engine_enabled = cpp_data.engine_enabled;
-    out_data->wipers = cpp_data.wipers;
-    out_data->differential_lock = cpp_data.differential_lock;
-    out_data->lift_axle = cpp_data.lift_axle;
-    out_data->lift_axle_indicator = cpp_data.lift_axle_indicator;
-    out_data->trailer_lift_axle = cpp_data.trailer_lift_axle;
-    out_data->trailer_lift_axle_indicator = cpp_data.trailer_lift_axle_indicator;
-    out_data->lblinker = cpp_data.lblinker;
-    out_data->rblinker = cpp_data.rblinker;
-    out_data->hazard_warning = cpp_data.hazard_warning;
-    out_data->light_lblinker = cpp_data.light_lblinker;
-    out_data->light_rblinker = cpp_data.light_rblinker;
-    out_data->light_parking = cpp_data.light_parking;
-    out_data->light_low_beam = cpp_data.light_low_beam;
-    out_data->light_high_beam = cpp_data.light_high_beam;
-    out_data->light_aux_front = cpp_data.light_aux_front;
-    out_data->light_aux_roof = cpp_data.light_aux_roof;
-    out_data->light_beacon = cpp_data.light_beacon;
-    out_data->light_brake = cpp_data.light_brake;
-    out_data->light_reverse = cpp_data.light_reverse;
-    out_data->dashboard_backlight = cpp_data.dashboard_backlight;
-    out_data->wear_engine = cpp_data.wear_engine;
-    out_data->wear_transmission = cpp_data.wear_transmission;
-    out_data->wear_cabin = cpp_data.wear_cabin;
-    out_data->wear_chassis = cpp_data.wear_chassis;
-    out_data->wear_wheels = cpp_data.wear_wheels;
-    out_data->odometer = cpp_data.odometer;
-
-    // Arrays
-    uint32_t selectors_to_copy = std::min<uint32_t>(cpp_consts.selector_count, SPF_TELEMETRY_SELECTOR_MAX_COUNT);
-    for (uint32_t i = 0; i < selectors_to_copy; ++i) {
-        out_data->hshifter_selector[i] = cpp_data.hshifter_selector[i];
-    }
-
-    uint32_t wheels_to_copy = std::min<uint32_t>(cpp_consts.wheel_count, SPF_TELEMETRY_WHEEL_MAX_COUNT);
-    for (uint32_t i = 0; i < wheels_to_copy; ++i) {
-        out_data->wheels[i].suspension_deflection = cpp_data.wheels[i].suspension_deflection;
-        out_data->wheels[i].on_ground = cpp_data.wheels[i].on_ground;
-        out_data->wheels[i].substance = cpp_data.wheels[i].substance;
-        out_data->wheels[i].angular_velocity = cpp_data.wheels[i].angular_velocity;
-        out_data->wheels[i].steering = cpp_data.wheels[i].steering;
-        out_data->wheels[i].rotation = cpp_data.wheels[i].rotation;
-        out_data->wheels[i].lift = cpp_data.wheels[i].lift;
-        out_data->wheels[i].lift_offset = cpp_data.wheels[i].lift_offset;
-    }
+    *out_data = GetConvertedTruckData(pm.GetTelemetryService()->GetTruckData());
 }
 
 void TelemetryApi::T_GetTrailers(SPF_Telemetry_Handle* handle, SPF_Trailer* out_trailers, uint32_t* in_out_count) {
     auto& pm = PluginManager::GetInstance();
     if (!handle || !out_trailers || !in_out_count || !pm.GetTelemetryService()) return;
+    DemandChannels(handle, kTrailerChannels);
 
-    const auto& cpp_trailers = pm.GetTelemetryService()->GetTrailers();
-    uint32_t max_count = *in_out_count;
-    uint32_t trailers_to_copy = std::min<uint32_t>(static_cast<uint32_t>(cpp_trailers.size()), max_count);
-
-    for (uint32_t i = 0; i < trailers_to_copy; ++i) {
-        const auto& cpp_trailer = cpp_trailers[i];
-        SPF_Trailer& c_trailer = out_trailers[i];
-
-        // Copy constants
-        auto& cpp_consts = cpp_trailer.constants;
-        auto& c_consts = c_trailer.constants;
-        strcpy_s(c_consts.id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.id.c_str());
-        strcpy_s(c_consts.cargo_accessory_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.cargo_accessory_id.c_str());
-        strcpy_s(c_consts.brand_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.brand_id.c_str());
-        strcpy_s(c_consts.brand, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_consts.brand.c_str());
-        strcpy_s(c_consts.name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_consts.name.c_str());
-        strcpy_s(c_consts.chain_type, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.chain_type.c_str());
-        strcpy_s(c_consts.body_type, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.body_type.c_str());
-        strcpy_s(c_consts.license_plate, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.license_plate.c_str());
-        strcpy_s(c_consts.license_plate_country_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.license_plate_country_id.c_str());
-        strcpy_s(c_consts.license_plate_country, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_consts.license_plate_country.c_str());
-        c_consts.hook_position = {cpp_consts.hook_position.x, cpp_consts.hook_position.y, cpp_consts.hook_position.z};
-        c_consts.wheel_count = std::min<uint32_t>(cpp_consts.wheel_count, SPF_TELEMETRY_WHEEL_MAX_COUNT);
-        for (uint32_t j = 0; j < c_consts.wheel_count; ++j) {
-            c_consts.wheels[j].simulated = cpp_consts.wheels[j].simulated;
-            c_consts.wheels[j].powered = cpp_consts.wheels[j].powered;
-            c_consts.wheels[j].steerable = cpp_consts.wheels[j].steerable;
-            c_consts.wheels[j].liftable = cpp_consts.wheels[j].liftable;
-            c_consts.wheels[j].radius = cpp_consts.wheels[j].radius;
-            c_consts.wheels[j].position = {cpp_consts.wheels[j].position.x, cpp_consts.wheels[j].position.y, cpp_consts.wheels[j].position.z};
-        }
-
-        // Copy data
-        auto& cpp_data = cpp_trailer.data;
-        auto& c_data = c_trailer.data;
-        c_data.connected = cpp_data.connected;
-        c_data.cargo_damage = cpp_data.cargo_damage;
-        c_data.world_placement = {{cpp_data.world_placement.position.x, cpp_data.world_placement.position.y, cpp_data.world_placement.position.z},
-                                  {cpp_data.world_placement.orientation.heading, cpp_data.world_placement.orientation.pitch, cpp_data.world_placement.orientation.roll}};
-        c_data.local_linear_velocity = {cpp_data.local_linear_velocity.x, cpp_data.local_linear_velocity.y, cpp_data.local_linear_velocity.z};
-        c_data.local_angular_velocity = {cpp_data.local_angular_velocity.x, cpp_data.local_angular_velocity.y, cpp_data.local_angular_velocity.z};
-        c_data.local_linear_acceleration = {cpp_data.local_linear_acceleration.x, cpp_data.local_linear_acceleration.y, cpp_data.local_linear_acceleration.z};
-        c_data.local_angular_acceleration = {cpp_data.local_angular_acceleration.x, cpp_data.local_angular_acceleration.y, cpp_data.local_angular_acceleration.z};
-        c_data.wear_body = cpp_data.wear_body;
-        c_data.wear_chassis = cpp_data.wear_chassis;
-        c_data.wear_wheels = cpp_data.wear_wheels;
-        for (uint32_t j = 0; j < c_consts.wheel_count; ++j) {
-            c_data.wheels[j].suspension_deflection = cpp_data.wheels[j].suspension_deflection;
-            c_data.wheels[j].on_ground = cpp_data.wheels[j].on_ground;
-            c_data.wheels[j].substance = cpp_data.wheels[j].substance;
-            c_data.wheels[j].angular_velocity = cpp_data.wheels[j].angular_velocity;
-            c_data.wheels[j].steering = cpp_data.wheels[j].steering;
-            c_data.wheels[j].rotation = cpp_data.wheels[j].rotation;
-            c_data.wheels[j].lift = cpp_data.wheels[j].lift;
-            c_data.wheels[j].lift_offset = cpp_data.wheels[j].lift_offset;
-        }
-    }
+    const auto& all = GetConvertedTrailers(pm.GetTelemetryService()->GetTrailers());
+    uint32_t trailers_to_copy = std::min<uint32_t>(all.count, *in_out_count);
+    std::copy_n(all.trailers, trailers_to_copy, out_trailers);
 
     *in_out_count = trailers_to_copy;
 }
@@ -316,132 +241,94 @@ void TelemetryApi::T_GetJobConstants(SPF_Telemetry_Handle* handle, SPF_JobConsta
     auto& pm = PluginManager::GetInstance();
     if (!handle || !out_data || !pm.GetTelemetryService()) return;
 
-    const auto& cpp_data = pm.GetTelemetryService()->GetJobConstants();
-
-    out_data->income = cpp_data.income;
-    out_data->delivery_time = cpp_data.delivery_time;
-    out_data->planned_distance_km = cpp_data.planned_distance_km;
-    out_data->is_cargo_loaded = cpp_data.is_cargo_loaded;
-    out_data->is_special_job = cpp_data.is_special_job;
-    strcpy_s(out_data->job_market, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.job_market.c_str());
-    strcpy_s(out_data->cargo_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.cargo_id.c_str());
-    strcpy_s(out_data->cargo_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.cargo_name.c_str());
-    out_data->cargo_mass = cpp_data.cargo_mass;
-    out_data->cargo_unit_count = cpp_data.cargo_unit_count;
-    out_data->cargo_unit_mass = cpp_data.cargo_unit_mass;
-    strcpy_s(out_data->destination_city_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.destination_city_id.c_str());
-    strcpy_s(out_data->destination_city, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.destination_city.c_str());
-    strcpy_s(out_data->destination_company_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.destination_company_id.c_str());
-    strcpy_s(out_data->destination_company, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.destination_company.c_str());
-    strcpy_s(out_data->source_city_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.source_city_id.c_str());
-    strcpy_s(out_data->source_city, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.source_city.c_str());
-    strcpy_s(out_data->source_company_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.source_company_id.c_str());
-    strcpy_s(out_data->source_company, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.source_company.c_str());
+    *out_data = GetCache().jobConstants.Get(pm.GetTelemetryService()->GetJobConstants(), CurrentRevision(), ConvertJobConstants);
 }
 
 void TelemetryApi::T_GetJobData(SPF_Telemetry_Handle* handle, SPF_JobData* out_data) {
     auto& pm = PluginManager::GetInstance();
     if (!handle || !out_data || !pm.GetTelemetryService()) return;
+    DemandChannels(handle, kJobChannels);
 
-    const auto& cpp_data = pm.GetTelemetryService()->GetJobData();
-    out_data->on_job = cpp_data.on_job;
-    out_data->cargo_damage = cpp_data.cargo_damage;
-    out_data->remaining_delivery_minutes = cpp_data.remaining_delivery_minutes;
+    *out_data = GetCache().jobData.Get(pm.GetTelemetryService()->GetJobData(), CurrentRevision(), ConvertJobData);
 }
 
 void TelemetryApi::T_GetNavigationData(SPF_Telemetry_Handle* handle, SPF_NavigationData* out_data) {
     auto& pm = PluginManager::GetInstance();
     if (!handle || !out_data || !pm.GetTelemetryService()) return;
+    DemandChannels(handle, kNavigationChannels);
 
-    const auto& cpp_data = pm.GetTelemetryService()->GetNavigationData();
-    out_data->navigation_distance = cpp_data.navigation_distance;
-    out_data->navigation_time = cpp_data.navigation_time;
-    out_data->navigation_speed_limit = cpp_data.navigation_speed_limit;
-    out_data->navigation_time_real_seconds = cpp_data.navigation_time_real_seconds;
+    *out_data = GetCache().navigationData.Get(pm.GetTelemetryService()->GetNavigationData(), CurrentRevision(), ConvertNavigationData);
 }
 
 void TelemetryApi::T_GetControls(SPF_Telemetry_Handle* handle, SPF_Controls* out_data) {
     auto& pm = PluginManager::GetInstance();
     if (!handle || !out_data || !pm.GetTelemetryService()) return;
+    DemandChannels(handle, kControlsChannels);
 
-    const auto& cpp_data = pm.GetTelemetryService()->GetControls();
-    out_data->userInput.steering = cpp_data.userInput.steering;
-    out_data->userInput.throttle = cpp_data.userInput.throttle;
-    out_data->userInput.brake = cpp_data.userInput.brake;
-    out_data->userInput.clutch = cpp_data.userInput.clutch;
-    out_data->effectiveInput.steering = cpp_data.effectiveInput.steering;
-    out_data->effectiveInput.throttle = cpp_data.effectiveInput.throttle;
-    out_data->effectiveInput.brake = cpp_data.effectiveInput.brake;
-    out_data->effectiveInput.clutch = cpp_data.effectiveInput.clutch;
+    *out_data = GetCache().controls.Get(pm.GetTelemetryService()->GetControls(), CurrentRevision(), ConvertControls);
 }
 
 void TelemetryApi::T_GetSpecialEvents(SPF_Telemetry_Handle* handle, SPF_SpecialEvents* out_data) {
     auto& pm = PluginManager::GetInstance();
     if (!handle || !out_data || !pm.GetTelemetryService()) return;
 
-    const auto& cpp_data = pm.GetTelemetryService()->GetSpecialEvents();
-    out_data->job_delivered = cpp_data.job_delivered;
-    out_data->job_cancelled = cpp_data.job_cancelled;
-    out_data->fined = cpp_data.fined;
-    out_data->tollgate = cpp_data.tollgate;
-    out_data->ferry = cpp_data.ferry;
-    out_data->train = cpp_data.train;
+    *out_data = GetCache().specialEvents.Get(pm.GetTelemetryService()->GetSpecialEvents(), CurrentRevision(), ConvertSpecialEvents);
 }
 
 void TelemetryApi::T_GetGameplayEvents(SPF_Telemetry_Handle* handle, SPF_GameplayEvents* out_data) {
     auto& pm = PluginManager::GetInstance();
     if (!handle || !out_data || !pm.GetTelemetryService()) return;
 
-    const auto& cpp_data = pm.GetTelemetryService()->GetGameplayEvents();
-
-    // Job Delivered
-    out_data->job_delivered.revenue = cpp_data.job_delivered.revenue;
-    out_data->job_delivered.earned_xp = cpp_data.job_delivered.earned_xp;
-    out_data->job_delivered.cargo_damage = cpp_data.job_delivered.cargo_damage;
-    out_data->job_delivered.distance_km = cpp_data.job_delivered.distance_km;
-    out_data->job_delivered.delivery_time = cpp_data.job_delivered.delivery_time;
-    out_data->job_delivered.auto_park_used = cpp_data.job_delivered.auto_park_used;
-    out_data->job_delivered.auto_load_used = cpp_data.job_delivered.auto_load_used;
-
-    // Job Cancelled
-    out_data->job_cancelled.penalty = cpp_data.job_cancelled.penalty;
-
-    // Player Fined
-    out_data->player_fined.fine_amount = cpp_data.player_fined.fine_amount;
-    strcpy_s(out_data->player_fined.fine_offence, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.player_fined.fine_offence.c_str());
-
-    // Tollgate Paid
-    out_data->tollgate_paid.pay_amount = cpp_data.tollgate_paid.pay_amount;
+    *out_data = GetCache().gameplayEvents.Get(pm.GetTelemetryService()->GetGameplayEvents(), CurrentRevision(), ConvertGameplayEvents);
+}
 
-    // Ferry Used
-    out_data->ferry_used.pay_amount = cpp_data.ferry_used.pay_amount;
-    strcpy_s(out_data->ferry_used.source_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.ferry_used.source_name.c_str());
-    strcpy_s(out_data->ferry_used.target_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.ferry_used.target_name.c_str());
-    strcpy_s(out_data->ferry_used.source_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.ferry_used.source_id.c_str());
-    strcpy_s(out_data->ferry_used.target_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.ferry_used.target_id.c_str());
+void TelemetryApi::T_GetGearboxConstants(SPF_Telemetry_Handle* handle, SPF_GearboxConstants* out_data) {
+    auto& pm = PluginManager::GetInstance();
+    if (!handle || !out_data || !pm.GetTelemetryService()) return;
 
-    // Train Used
-    out_data->train_used.pay_amount = cpp_data.train_used.pay_amount;
-    strcpy_s(out_data->train_used.source_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.train_used.source_name.c_str());
-    strcpy_s(out_data->train_used.target_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.train_used.target_name.c_str());
-    strcpy_s(out_data->train_used.source_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.train_used.source_id.c_str());
-    strcpy_s(out_data->train_used.target_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.train_used.target_id.c_str());
+    *out_data = GetCache().gearboxConstants.Get(pm.GetTelemetryService()->GetGearboxConstants(), CurrentRevision(), ConvertGearboxConstants);
 }
 
-void TelemetryApi::T_GetGearboxConstants(SPF_Telemetry_Handle* handle, SPF_GearboxConstants* out_data) {
+void TelemetryApi::T_GetDerivedData(SPF_Telemetry_Handle* handle, SPF_DerivedData* out_data) {
     auto& pm = PluginManager::GetInstance();
     if (!handle || !out_data || !pm.GetTelemetryService()) return;
+    DemandChannels(handle, kTruckChannels);
 
-    const auto& cpp_data = pm.GetTelemetryService()->GetGearboxConstants();
+    *out_data = GetCache().derivedData.Get(pm.GetTelemetryService()->GetDerivedData(), CurrentRevision(), ConvertDerivedData);
+}
 
-    strcpy_s(out_data->shifter_type, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.shifter_type.c_str());
+const SPF_TelemetryView* TelemetryApi::T_GetView(SPF_Telemetry_Handle* handle, uint32_t version, uint64_t* out_frame_sequence) {
+    auto& pm = PluginManager::GetInstance();
+    if (!handle || version != SPF_TELEMETRY_VIEW_VERSION || !pm.GetTelemetryService()) return nullptr;
+    // Plugins that never declared what they read get every group, as the view holds them all.
+    if (!reinterpret_cast<Handles::TelemetryHandle*>(handle)->m_declaredViewChannels) {
+        DemandChannels(handle, Telemetry::AllChannelGroups());
+    }
 
-    out_data->slot_count = static_cast<uint32_t>(std::min<size_t>(cpp_data.slot_gear.size(), SPF_TELEMETRY_HSHIFTER_MAX_SLOTS));
-    for (uint32_t i = 0; i < out_data->slot_count; ++i) {
-        out_data->slot_gear[i] = cpp_data.slot_gear[i];
-        out_data->slot_handle_position[i] = cpp_data.slot_handle_position[i];
-        out_data->slot_selectors[i] = cpp_data.slot_selectors[i];
+    auto& cache = GetCache();
+    const auto snapshot = pm.GetTelemetryService()->GetSnapshot();
+    if (!cache.view || cache.viewFrame != snapshot->frameId) {
+        if (!cache.view) cache.view = std::make_unique<SPF_TelemetryView>();
+        SPF_TELEMETRY_TIME_SCOPE(ConversionTiming());
+        ConvertTelemetryView(*snapshot, *cache.view);
+        cache.viewFrame = snapshot->frameId;
     }
+
+    if (out_frame_sequence) *out_frame_sequence = cache.view->frame_sequence;
+    return cache.view.get();
+}
+
+void TelemetryApi::T_DemandChannelGroups(SPF_Telemetry_Handle* handle, uint32_t groups) {
+    auto& pm = PluginManager::GetInstance();
+    if (!handle || !pm.GetTelemetryService()) return;
+    // The C flags are the ChannelGroup bits; Common is always registered.
+    static_assert(SPF_TELEMETRY_CHANNEL_GROUP_JOB == 1u << static_cast<uint32_t>(ChannelGroup::Job));
+    static_assert(SPF_TELEMETRY_CHANNEL_GROUP_TRAILERS == 1u << static_cast<uint32_t>(ChannelGroup::Trailers));
+    static_assert(SPF_TELEMETRY_CHANNEL_GROUP_ALL == (((1u << Telemetry::ChannelGroupCount) - 1) & ~1u));
+
+    reinterpret_cast<Handles::TelemetryHandle*>(handle)->m_declaredViewChannels = true;
+    const ChannelGroupMask mask(groups & SPF_TELEMETRY_CHANNEL_GROUP_ALL);
+    if (mask.any()) DemandChannels(handle, mask);
 }
 
 int TelemetryApi::T_GetLastGameplayEventId(SPF_Telemetry_Handle* handle, char* out_buffer, int buffer_size) {
@@ -458,434 +345,239 @@ int TelemetryApi::T_GetLastGameplayEventId(SPF_Telemetry_Handle* handle, char* o
     }
 }
 
-// --- Event-Driven Callback Invocation & Conversion ---
-void TelemetryApi::InvokeGameStateCallback(const GameState& cpp_data, SPF_Telemetry_GameState_Callback callback, void* user_data) {
-    // Create a C-style struct for output
-    SPF_GameState c_data;
-    // Perform conversion from cpp_data to c_data
-    strcpy_s(c_data.game_id, SPF_TELEMETRY_ID_MAX_SIZE, GameToString(cpp_data.game_id));
-    strcpy_s(c_data.game_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.game_name.c_str());
-    
-    c_data.scs_game_version_major = cpp_data.scs_game_version_major;
-    c_data.scs_game_version_minor = cpp_data.scs_game_version_minor;
-    
-    c_data.telemetry_plugin_version_major = cpp_data.telemetry_plugin_version_major;
-    c_data.telemetry_plugin_version_minor = cpp_data.telemetry_plugin_version_minor;
+// --- Timing ---
+namespace {
+void ConvertTimingStats(const Telemetry::TimingStats& stats, SPF_Telemetry_TimingStats& c_stats) {
+    c_stats.sample_count = stats.count;
+    c_stats.p50_us = stats.p50Us;
+    c_stats.p99_us = stats.p99Us;
+    c_stats.max_us = stats.maxUs;
+}
+}  // namespace
+
+uint32_t TelemetryApi::T_GetTimingStats(SPF_Telemetry_Handle* handle, SPF_Telemetry_TimingStats* out_stats, uint32_t max_count) {
+    if (!handle) return 0;
+
+    const auto entries = Telemetry::TimingRegistry::GetInstance().GetStats();
+    if (out_stats) {
+        const uint32_t count = std::min<uint32_t>(max_count, static_cast<uint32_t>(entries.size()));
+        for (uint32_t i = 0; i < count; ++i) {
+            strncpy_s(out_stats[i].name, SPF_TELEMETRY_STRING_MAX_SIZE, entries[i].name.c_str(), _TRUNCATE);
+            ConvertTimingStats(entries[i].stats, out_stats[i]);
+        }
+    }
+    return static_cast<uint32_t>(entries.size());
+}
 
-    c_data.telemetry_game_version_major = cpp_data.telemetry_game_version_major;
-    c_data.telemetry_game_version_minor = cpp_data.telemetry_game_version_minor;
+bool TelemetryApi::T_GetCallbackTiming(SPF_Telemetry_Handle* handle, SPF_Telemetry_Callback_Handle* callback_handle, SPF_Telemetry_TimingStats* out_stats) {
+    if (!handle || !callback_handle || !out_stats) return false;
+
+    Handles::TelemetryHandle* telemetryHandle = reinterpret_cast<Handles::TelemetryHandle*>(handle);
+    auto* target = reinterpret_cast<BaseSubscriptionHandler*>(callback_handle);
+    const auto it = std::find_if(telemetryHandle->m_subscriptionHandlers.begin(), telemetryHandle->m_subscriptionHandlers.end(),
+                                 [target](const auto& handler) { return handler.get() == target; });
+    if (it == telemetryHandle->m_subscriptionHandlers.end() || !target->m_timing) return false;
+
+    out_stats->name[0] = '\0';
+    ConvertTimingStats(target->m_timing->GetStats(), *out_stats);
+    return true;
+}
 
-    c_data.paused = cpp_data.paused;
-    c_data.scale = cpp_data.scale;
-    c_data.multiplayer_time_offset = cpp_data.multiplayer_time_offset;
+// --- Gameplay Event History ---
+uint64_t TelemetryApi::T_GetLatestGameplayEventSequence(SPF_Telemetry_Handle* handle) {
+    auto& pm = PluginManager::GetInstance();
+    if (!handle || !pm.GetTelemetryService()) return 0;
 
-    // Invoke the plugin's callback
-    callback(&c_data, user_data);
+    return pm.GetTelemetryService()->GetGameplayEventHistory().GetLatestSequence();
 }
 
-void TelemetryApi::InvokeTimestampsCallback(const Timestamps& cpp_data, SPF_Telemetry_Timestamps_Callback callback, void* user_data) {
-    SPF_Timestamps c_data;
-    c_data.simulation = cpp_data.simulation;
-    c_data.render = cpp_data.render;
-    c_data.paused_simulation = cpp_data.paused_simulation; // Added missing line
-    callback(&c_data, user_data);
+uint32_t TelemetryApi::T_ReadGameplayEvents(SPF_Telemetry_Handle* handle, SPF_GameplayEventRecord* out_events, uint32_t max_count, uint64_t* out_missed) {
+    auto& pm = PluginManager::GetInstance();
+    if (out_missed) *out_missed = 0;
+    if (!handle || !out_events || max_count == 0 || !pm.GetTelemetryService()) return 0;
+
+    auto* telemetryHandle = reinterpret_cast<Handles::TelemetryHandle*>(handle);
+    uint32_t count = 0;
+    pm.GetTelemetryService()->GetGameplayEventHistory().Read(
+        telemetryHandle->m_gameplayEventCursor,
+        [&](const Telemetry::RecordedEvent& event) {
+            ConvertRecordedEvent(event, out_events[count]);
+            return ++count < max_count;
+        },
+        out_missed);
+    return count;
 }
 
-void TelemetryApi::InvokeCommonDataCallback(const CommonData& cpp_data, SPF_Telemetry_CommonData_Callback callback, void* user_data) {
-    SPF_CommonData c_data;
-    c_data.game_time = cpp_data.game_time;
-    c_data.next_rest_stop = cpp_data.next_rest_stop;
-    c_data.next_rest_stop_time.DayOfWeek = cpp_data.next_rest_stop_time.DayOfWeek;
-    c_data.next_rest_stop_time.Hour = cpp_data.next_rest_stop_time.Hour;
-    c_data.next_rest_stop_time.Minute = cpp_data.next_rest_stop_time.Minute;
-    c_data.next_rest_stop_real_minutes = cpp_data.next_rest_stop_real_minutes;
-
-    c_data.substance_count = static_cast<uint32_t>(std::min<size_t>(cpp_data.substances.size(), SPF_TELEMETRY_SUBSTANCE_MAX_COUNT));
-    for (uint32_t i = 0; i < c_data.substance_count; ++i) {
-        strcpy_s(c_data.substances[i], SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.substances[i].c_str());
-    }
-    callback(&c_data, user_data);
+void TelemetryApi::T_SetGameplayEventCursor(SPF_Telemetry_Handle* handle, uint64_t sequence) {
+    if (!handle) return;
+    reinterpret_cast<Handles::TelemetryHandle*>(handle)->m_gameplayEventCursor = sequence;
 }
 
-void TelemetryApi::InvokeTruckConstantsCallback(const TruckConstants& cpp_data, SPF_Telemetry_TruckConstants_Callback callback, void* user_data) {
-    SPF_TruckConstants c_data;
-
-    strcpy_s(c_data.brand_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.brand_id.c_str());
-    strcpy_s(c_data.brand, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.brand.c_str());
-    strcpy_s(c_data.id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.id.c_str());
-    strcpy_s(c_data.name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.name.c_str());
-    strcpy_s(c_data.license_plate, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.license_plate.c_str());
-    strcpy_s(c_data.license_plate_country_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.license_plate_country_id.c_str());
-    strcpy_s(c_data.license_plate_country, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.license_plate_country.c_str());
-
-    c_data.fuel_capacity = cpp_data.fuel_capacity;
-    c_data.fuel_warning_factor = cpp_data.fuel_warning_factor;
-    c_data.adblue_capacity = cpp_data.adblue_capacity;
-    c_data.adblue_warning_factor = cpp_data.adblue_warning_factor;
-    c_data.air_pressure_warning = cpp_data.air_pressure_warning;
-    c_data.air_pressure_emergency = cpp_data.air_pressure_emergency;
-    c_data.oil_pressure_warning = cpp_data.oil_pressure_warning;
-    c_data.water_temperature_warning = cpp_data.water_temperature_warning;
-    c_data.battery_voltage_warning = cpp_data.battery_voltage_warning;
-    c_data.rpm_limit = cpp_data.rpm_limit;
-    c_data.forward_gear_count = cpp_data.forward_gear_count;
-    c_data.reverse_gear_count = cpp_data.reverse_gear_count;
-    c_data.retarder_step_count = cpp_data.retarder_step_count;
-    c_data.selector_count = cpp_data.selector_count;
-    c_data.differential_ratio = cpp_data.differential_ratio;
-
-    c_data.cabin_position = {cpp_data.cabin_position.x, cpp_data.cabin_position.y, cpp_data.cabin_position.z};
-    c_data.head_position = {cpp_data.head_position.x, cpp_data.head_position.y, cpp_data.head_position.z};
-    c_data.hook_position = {cpp_data.hook_position.x, cpp_data.hook_position.y, cpp_data.hook_position.z};
-
-    c_data.wheel_count = std::min<uint32_t>(cpp_data.wheel_count, SPF_TELEMETRY_WHEEL_MAX_COUNT);
-    for (uint32_t i = 0; i < c_data.wheel_count; ++i) {
-        c_data.wheels[i].simulated = cpp_data.wheels[i].simulated;
-        c_data.wheels[i].powered = cpp_data.wheels[i].powered;
-        c_data.wheels[i].steerable = cpp_data.wheels[i].steerable;
-        c_data.wheels[i].liftable = cpp_data.wheels[i].liftable;
-        c_data.wheels[i].radius = cpp_data.wheels[i].radius;
-        c_data.wheels[i].position = {cpp_data.wheels[i].position.x, cpp_data.wheels[i].position.y, cpp_data.wheels[i].position.z};
-    }
+uint32_t TelemetryApi::T_QueryGameplayEvents(SPF_Telemetry_Handle* handle, uint64_t after_sequence, const char* event_id, SPF_GameplayEventRecord* out_events, uint32_t max_count) {
+    auto& pm = PluginManager::GetInstance();
+    if (!handle || !out_events || max_count == 0 || !pm.GetTelemetryService()) return 0;
+
+    uint32_t count = 0;
+    pm.GetTelemetryService()->GetGameplayEventHistory().Query(after_sequence, event_id ? event_id : "", [&](const Telemetry::RecordedEvent& event) {
+        ConvertRecordedEvent(event, out_events[count]);
+        return ++count < max_count;
+    });
+    return count;
+}
+
+void TelemetryApi::T_GetInterpolatedPlacements(SPF_Telemetry_Handle* handle, SPF_InterpolatedPlacements* out_data) {
+    auto& pm = PluginManager::GetInstance();
+    if (!handle || !out_data || !pm.GetTelemetryService()) return;
+    DemandChannels(handle, MakeChannelGroupMask(ChannelGroup::TruckMotion));
+
+    ConvertInterpolatedPlacements(pm.GetTelemetryService()->GetInterpolatedPlacements(), *out_data);
+}
 
-    uint32_t forward_gears_to_copy = std::min<uint32_t>(cpp_data.forward_gear_count, SPF_TELEMETRY_GEAR_MAX_COUNT);
-    memcpy(c_data.gear_ratios_forward, cpp_data.gear_ratios_forward.data(), forward_gears_to_copy * sizeof(float));
+// --- Route ---
+// The route is sampled from the truck motion channels, so using it keeps them registered.
+void TelemetryApi::T_GetRouteInfo(SPF_Telemetry_Handle* handle, SPF_RouteInfo* out_info) {
+    auto& pm = PluginManager::GetInstance();
+    if (!handle || !out_info || !pm.GetTelemetryService()) return;
+    DemandChannels(handle, MakeChannelGroupMask(ChannelGroup::TruckMotion));
 
-    uint32_t reverse_gears_to_copy = std::min<uint32_t>(cpp_data.reverse_gear_count, SPF_TELEMETRY_GEAR_MAX_COUNT);
-    memcpy(c_data.gear_ratios_reverse, cpp_data.gear_ratios_reverse.data(), reverse_gears_to_copy * sizeof(float));
-    
-    callback(&c_data, user_data);
+    const auto stats = pm.GetTelemetryService()->GetRouteStore().GetStats();
+    *out_info = {stats.samples, stats.points, stats.tracks, stats.memoryBytes, stats.length};
 }
 
-void TelemetryApi::InvokeTrailerConstantsCallback(const TrailerConstants& cpp_data, SPF_Telemetry_TrailerConstants_Callback callback, void* user_data) {
-    SPF_TrailerConstants c_data;
-
-    strcpy_s(c_data.id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.id.c_str());
-    strcpy_s(c_data.cargo_accessory_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.cargo_accessory_id.c_str());
-    strcpy_s(c_data.brand_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.brand_id.c_str());
-    strcpy_s(c_data.brand, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.brand.c_str());
-    strcpy_s(c_data.name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.name.c_str());
-    strcpy_s(c_data.chain_type, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.chain_type.c_str());
-    strcpy_s(c_data.body_type, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.body_type.c_str());
-    strcpy_s(c_data.license_plate, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.license_plate.c_str());
-    strcpy_s(c_data.license_plate_country_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.license_plate_country_id.c_str());
-    strcpy_s(c_data.license_plate_country, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.license_plate_country.c_str());
-    c_data.hook_position = {cpp_data.hook_position.x, cpp_data.hook_position.y, cpp_data.hook_position.z};
-    c_data.wheel_count = std::min<uint32_t>(cpp_data.wheel_count, SPF_TELEMETRY_WHEEL_MAX_COUNT);
-    for (uint32_t i = 0; i < c_data.wheel_count; ++i) {
-        c_data.wheels[i].simulated = cpp_data.wheels[i].simulated;
-        c_data.wheels[i].powered = cpp_data.wheels[i].powered;
-        c_data.wheels[i].steerable = cpp_data.wheels[i].steerable;
-        c_data.wheels[i].liftable = cpp_data.wheels[i].liftable;
-        c_data.wheels[i].radius = cpp_data.wheels[i].radius;
-        c_data.wheels[i].position = {cpp_data.wheels[i].position.x, cpp_data.wheels[i].position.y, cpp_data.wheels[i].position.z};
+bool TelemetryApi::T_FindNearestRoutePoint(SPF_Telemetry_Handle* handle, double x, double z, double max_distance, SPF_RoutePoint* out_point, double* out_distance) {
+    auto& pm = PluginManager::GetInstance();
+    if (!handle || !out_point || !pm.GetTelemetryService()) return false;
+    if (!std::isfinite(x) || !std::isfinite(z) || std::isnan(max_distance)) return false;
+    DemandChannels(handle, MakeChannelGroupMask(ChannelGroup::TruckMotion));
+
+    const auto match = pm.GetTelemetryService()->GetRouteStore().FindNearest(x, z, max_distance);
+    if (!match) return false;
+
+    ConvertRoutePoint(match->point, *out_point);
+    if (out_distance) *out_distance = match->distance;
+    return true;
+}
+
+uint32_t TelemetryApi::T_GetRoutePointsInBox(SPF_Telemetry_Handle* handle, double min_x, double min_z, double max_x, double max_z, SPF_RoutePoint* out_points, uint32_t max_count) {
+    auto& pm = PluginManager::GetInstance();
+    if (!handle || (!out_points && max_count > 0) || !pm.GetTelemetryService()) return 0;
+    if (std::isnan(min_x) || std::isnan(min_z) || std::isnan(max_x) || std::isnan(max_z)) return 0;
+    DemandChannels(handle, MakeChannelGroupMask(ChannelGroup::TruckMotion));
+
+    std::vector<SPF::Telemetry::RoutePoint> points;
+    const size_t found = pm.GetTelemetryService()->GetRouteStore().FindInBox(min_x, min_z, max_x, max_z, points, max_count);
+    for (size_t i = 0; i < points.size(); ++i) {
+        ConvertRoutePoint(points[i], out_points[i]);
     }
+    return static_cast<uint32_t>(std::min<size_t>(found, UINT32_MAX));
+}
+
+bool TelemetryApi::T_SaveRoute(SPF_Telemetry_Handle* handle, const char* path) {
+    auto& pm = PluginManager::GetInstance();
+    if (!handle || !path || !pm.GetTelemetryService()) return false;
 
-    callback(&c_data, user_data);
+    return pm.GetTelemetryService()->GetRouteStore().Save(path);
 }
 
-void TelemetryApi::InvokeTruckDataCallback(const TruckData& cpp_data, SPF_Telemetry_TruckData_Callback callback, void* user_data) {
-    SPF_TruckData c_data;
+// --- Field History ---
+bool TelemetryApi::T_RecordFieldHistory(SPF_Telemetry_Handle* handle, const SPF_Telemetry_Field* fields, uint32_t count) {
     auto& pm = PluginManager::GetInstance();
-    const auto& cpp_consts = pm.GetTelemetryService()->GetTruckConstants(); // Need constants for array sizes
-
-    // Placements and vectors
-    c_data.world_placement = {{cpp_data.world_placement.position.x, cpp_data.world_placement.position.y, cpp_data.world_placement.position.z},
-                              {cpp_data.world_placement.orientation.heading, cpp_data.world_placement.orientation.pitch, cpp_data.world_placement.orientation.roll}};
-    c_data.local_linear_velocity = {cpp_data.local_linear_velocity.x, cpp_data.local_linear_velocity.y, cpp_data.local_linear_velocity.z};
-    c_data.local_angular_velocity = {cpp_data.local_angular_velocity.x, cpp_data.local_angular_velocity.y, cpp_data.local_angular_velocity.z};
-    c_data.local_linear_acceleration = {cpp_data.local_linear_acceleration.x, cpp_data.local_linear_acceleration.y, cpp_data.local_linear_acceleration.z};
-    c_data.local_angular_acceleration = {cpp_data.local_angular_acceleration.x, cpp_data.local_angular_acceleration.y, cpp_data.local_angular_acceleration.z};
-    c_data.cabin_offset = {{cpp_data.cabin_offset.position.x, cpp_data.cabin_offset.position.y, cpp_data.cabin_offset.position.z},
-                           {cpp_data.cabin_offset.orientation.heading, cpp_data.cabin_offset.orientation.pitch, cpp_data.cabin_offset.orientation.roll}};
-    c_data.cabin_angular_velocity = {cpp_data.cabin_angular_velocity.x, cpp_data.cabin_angular_velocity.y, cpp_data.cabin_angular_velocity.z};
-    c_data.cabin_angular_acceleration = {cpp_data.cabin_angular_acceleration.x, cpp_data.cabin_angular_acceleration.y, cpp_data.cabin_angular_acceleration.z};
-    c_data.head_offset = {{cpp_data.head_offset.position.x, cpp_data.head_offset.position.y, cpp_data.head_offset.position.z},
-                          {cpp_data.head_offset.orientation.heading, cpp_data.head_offset.orientation.pitch, cpp_data.head_offset.orientation.roll}};
-
-    // Simple values
-    c_data.speed = cpp_data.speed;
-    c_data.engine_rpm = cpp_data.engine_rpm;
-    c_data.gear = cpp_data.gear;
-    c_data.displayed_gear = cpp_data.displayed_gear;
-    c_data.input_steering = cpp_data.input_steering;
-    c_data.input_throttle = cpp_data.input_throttle;
-    c_data.input_brake = cpp_data.input_brake;
-    c_data.input_clutch = cpp_data.input_clutch;
-    c_data.effective_steering = cpp_data.effective_steering;
-    c_data.effective_throttle = cpp_data.effective_throttle;
-    c_data.effective_brake = cpp_data.effective_brake;
-    c_data.effective_clutch = cpp_data.effective_clutch;
-    c_data.cruise_control_speed = cpp_data.cruise_control_speed;
-    c_data.hshifter_slot = cpp_data.hshifter_slot;
-    c_data.parking_brake = cpp_data.parking_brake;
-    c_data.motor_brake = cpp_data.motor_brake;
-    c_data.retarder_level = cpp_data.retarder_level;
-    c_data.air_pressure = cpp_data.air_pressure;
-    c_data.air_pressure_warning = cpp_data.air_pressure_warning;
-    c_data.air_pressure_emergency = cpp_data.air_pressure_emergency;
-    c_data.brake_temperature = cpp_data.brake_temperature;
-    c_data.fuel_amount = cpp_data.fuel_amount;
-    c_data.fuel_warning = cpp_data.fuel_warning;
-    c_data.fuel_average_consumption = cpp_data.fuel_average_consumption;
-    c_data.fuel_range = cpp_data.fuel_range;
-    c_data.adblue_amount = cpp_data.adblue_amount;
-    c_data.adblue_warning = cpp_data.adblue_warning;
-    c_data.adblue_average_consumption = cpp_data.adblue_average_consumption;
-    c_data.oil_pressure = cpp_data.oil_pressure;
-    c_data.oil_pressure_warning = cpp_data.oil_pressure_warning;
-    c_data.oil_temperature = cpp_data.oil_temperature;
-    c_data.water_temperature = cpp_data.water_temperature;
-    c_data.water_temperature_warning = cpp_data.water_temperature_warning;
-    c_data.battery_voltage = cpp_data.battery_voltage;
-    c_data.battery_voltage_warning = cpp_data.battery_voltage_warning;
-    c_data.electric_enabled = cpp_data.electric_enabled;
-    c_data.engine_enabled = cpp_data.engine_enabled;
-    c_data.wipers = cpp_data.wipers;
-    c_data.differential_lock = cpp_data.differential_lock;
-    c_data.lift_axle = cpp_data.lift_axle;
-    c_data.lift_axle_indicator = cpp_data.lift_axle_indicator;
-    c_data.trailer_lift_axle = cpp_data.trailer_lift_axle;
-    c_data.trailer_lift_axle_indicator = cpp_data.trailer_lift_axle_indicator;
-    c_data.lblinker = cpp_data.lblinker;
-    c_data.rblinker = cpp_data.rblinker;
-    c_data.hazard_warning = cpp_data.hazard_warning;
-    c_data.light_lblinker = cpp_data.light_lblinker;
-    c_data.light_rblinker = cpp_data.light_rblinker;
-    c_data.light_parking = cpp_data.light_parking;
-    c_data.light_low_beam = cpp_data.light_low_beam;
-    c_data.light_high_beam = cpp_data.light_high_beam;
-    c_data.light_aux_front = cpp_data.light_aux_front;
-    c_data.light_aux_roof = cpp_data.light_aux_roof;
-    c_data.light_beacon = cpp_data.light_beacon;
-    c_data.light_brake = cpp_data.light_brake;
-    c_data.light_reverse = cpp_data.light_reverse;
-    c_data.dashboard_backlight = cpp_data.dashboard_backlight;
-    c_data.wear_engine = cpp_data.wear_engine;
-    c_data.wear_transmission = cpp_data.wear_transmission;
-    c_data.wear_cabin = cpp_data.wear_cabin;
-    c_data.wear_chassis = cpp_data.wear_chassis;
-    c_data.wear_wheels = cpp_data.wear_wheels;
-    c_data.odometer = cpp_data.odometer;
-
-    // Arrays
-    uint32_t selectors_to_copy = std::min<uint32_t>(cpp_consts.selector_count, SPF_TELEMETRY_SELECTOR_MAX_COUNT);
-    for (uint32_t i = 0; i < selectors_to_copy; ++i) {
-        c_data.hshifter_selector[i] = cpp_data.hshifter_selector[i];
+    if (!handle || !fields || count == 0 || !pm.GetTelemetryService()) return false;
+
+    std::vector<SPF::Telemetry::Field> cppFields;
+    cppFields.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        if (fields[i] < 0 || fields[i] >= SPF_TELEMETRY_FIELD_COUNT) return false;
+        cppFields.push_back(static_cast<SPF::Telemetry::Field>(fields[i]));
     }
 
-    uint32_t wheels_to_copy = std::min<uint32_t>(cpp_consts.wheel_count, SPF_TELEMETRY_WHEEL_MAX_COUNT);
-    for (uint32_t i = 0; i < wheels_to_copy; ++i) {
-        c_data.wheels[i].suspension_deflection = cpp_data.wheels[i].suspension_deflection;
-        c_data.wheels[i].on_ground = cpp_data.wheels[i].on_ground;
-        c_data.wheels[i].substance = cpp_data.wheels[i].substance;
-        c_data.wheels[i].angular_velocity = cpp_data.wheels[i].angular_velocity;
-        c_data.wheels[i].steering = cpp_data.wheels[i].steering;
-        c_data.wheels[i].rotation = cpp_data.wheels[i].rotation;
-        c_data.wheels[i].lift = cpp_data.wheels[i].lift;
-        c_data.wheels[i].lift_offset = cpp_data.wheels[i].lift_offset;
+    auto lease = pm.GetTelemetryService()->RecordFieldHistory(cppFields);
+    if (!lease) return false;
+    reinterpret_cast<Handles::TelemetryHandle*>(handle)->m_historyLeases.push_back(std::move(lease));
+    return true;
+}
+
+uint32_t TelemetryApi::T_GetFieldHistory(SPF_Telemetry_Handle* handle, SPF_Telemetry_Field field, uint64_t from_time, uint64_t to_time, SPF_Telemetry_HistoryPoint* out_points, uint32_t max_points) {
+    auto& pm = PluginManager::GetInstance();
+    if (!handle || !out_points || max_points < 3 || field < 0 || field >= SPF_TELEMETRY_FIELD_COUNT || !pm.GetTelemetryService()) return 0;
+
+    std::vector<SPF::Telemetry::HistoryPoint> points;
+    pm.GetTelemetryService()->GetFieldHistory().Query(static_cast<SPF::Telemetry::Field>(field), from_time, to_time, max_points, points);
+    for (size_t i = 0; i < points.size(); ++i) {
+        out_points[i] = {points[i].time, points[i].value, points[i].min, points[i].max};
     }
+    return static_cast<uint32_t>(points.size());
+}
 
-    callback(&c_data, user_data);
+// --- Event-Driven Callback Invocation & Conversion ---
+// Every subscriber of a signal receives a pointer to the same cached C struct.
+void TelemetryApi::InvokeGameStateCallback(const GameState& cpp_data, SPF_Telemetry_GameState_Callback callback, void* user_data) {
+    callback(&GetCache().gameState.Get(cpp_data, CurrentRevision(), ConvertGameState), user_data);
+}
+
+void TelemetryApi::InvokeTimestampsCallback(const Timestamps& cpp_data, SPF_Telemetry_Timestamps_Callback callback, void* user_data) {
+    callback(&GetCache().timestamps.Get(cpp_data, CurrentRevision(), ConvertTimestamps), user_data);
+}
+
+void TelemetryApi::InvokeCommonDataCallback(const CommonData& cpp_data, SPF_Telemetry_CommonData_Callback callback, void* user_data) {
+    callback(&GetCache().commonData.Get(cpp_data, CurrentRevision(), ConvertCommonData), user_data);
+}
+
+void TelemetryApi::InvokeTruckConstantsCallback(const TruckConstants& cpp_data, SPF_Telemetry_TruckConstants_Callback callback, void* user_data) {
+    callback(&GetCache().truckConstants.Get(cpp_data, CurrentRevision(), ConvertTruckConstants), user_data);
+}
+
+void TelemetryApi::InvokeTrailerConstantsCallback(const TrailerConstants& cpp_data, SPF_Telemetry_TrailerConstants_Callback callback, void* user_data) {
+    callback(&GetCache().trailerConstants.Get(cpp_data, CurrentRevision(), ConvertTrailerConstants), user_data);
+}
+
+void TelemetryApi::InvokeTruckDataCallback(const TruckData& cpp_data, SPF_Telemetry_TruckData_Callback callback, void* user_data) {
+    callback(&GetConvertedTruckData(cpp_data), user_data);
 }
 
 void TelemetryApi::InvokeTrailersCallback(const std::vector<Trailer>& cpp_trailers, SPF_Telemetry_Trailers_Callback callback, void* user_data) {
-    // Filter the list of trailers to include only 'active' ones.
-    // An active trailer is one that is either connected or has a valid ID.
-    std::vector<Trailer> active_trailers;
-    for (const auto& trailer : cpp_trailers) {
-        if (trailer.data.connected || !trailer.constants.id.empty()) {
-            active_trailers.push_back(trailer);
-        }
-    }
+    // Only 'active' trailers are reported: those that are connected or have a valid ID.
+    const TrailerList* active = nullptr;
+    GetConvertedTrailers(cpp_trailers, &active);
 
-    if (active_trailers.empty()) {
+    if (active->count == 0) {
         callback(nullptr, 0, user_data);
         return;
     }
-
-    // Create a C-style array for output from the filtered list.
-    auto c_trailers = std::make_unique<SPF_Trailer[]>(active_trailers.size());
-    uint32_t trailer_count = static_cast<uint32_t>(active_trailers.size());
-
-    for (uint32_t i = 0; i < trailer_count; ++i) {
-        const auto& cpp_trailer = active_trailers[i];
-        SPF_Trailer& c_trailer = c_trailers[i];
-
-        // Copy constants
-        const auto& cpp_consts = cpp_trailer.constants;
-        auto& c_consts = c_trailer.constants;
-        strcpy_s(c_consts.id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.id.c_str());
-        strcpy_s(c_consts.cargo_accessory_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.cargo_accessory_id.c_str());
-        strcpy_s(c_consts.brand_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.brand_id.c_str());
-        strcpy_s(c_consts.brand, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_consts.brand.c_str());
-        strcpy_s(c_consts.name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_consts.name.c_str());
-        strcpy_s(c_consts.chain_type, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.chain_type.c_str());
-        strcpy_s(c_consts.body_type, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.body_type.c_str());
-        strcpy_s(c_consts.license_plate, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.license_plate.c_str());
-        strcpy_s(c_consts.license_plate_country_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.license_plate_country_id.c_str());
-        strcpy_s(c_consts.license_plate_country, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_consts.license_plate_country.c_str());
-        c_consts.hook_position = {cpp_consts.hook_position.x, cpp_consts.hook_position.y, cpp_consts.hook_position.z};
-        c_consts.wheel_count = std::min<uint32_t>(cpp_consts.wheel_count, SPF_TELEMETRY_WHEEL_MAX_COUNT);
-        for (uint32_t j = 0; j < c_consts.wheel_count; ++j) {
-            c_consts.wheels[j].simulated = cpp_consts.wheels[j].simulated;
-            c_consts.wheels[j].powered = cpp_consts.wheels[j].powered;
-            c_consts.wheels[j].steerable = cpp_consts.wheels[j].steerable;
-            c_consts.wheels[j].liftable = cpp_consts.wheels[j].liftable;
-            c_consts.wheels[j].radius = cpp_consts.wheels[j].radius;
-            c_consts.wheels[j].position = {cpp_consts.wheels[j].position.x, cpp_consts.wheels[j].position.y, cpp_consts.wheels[j].position.z};
-        }
-
-        // Copy data
-        const auto& cpp_data = cpp_trailer.data;
-        auto& c_data = c_trailer.data;
-        c_data.connected = cpp_data.connected;
-        c_data.cargo_damage = cpp_data.cargo_damage;
-        c_data.world_placement = {{cpp_data.world_placement.position.x, cpp_data.world_placement.position.y, cpp_data.world_placement.position.z},
-                                  {cpp_data.world_placement.orientation.heading, cpp_data.world_placement.orientation.pitch, cpp_data.world_placement.orientation.roll}};
-        c_data.local_linear_velocity = {cpp_data.local_linear_velocity.x, cpp_data.local_linear_velocity.y, cpp_data.local_linear_velocity.z};
-        c_data.local_angular_velocity = {cpp_data.local_angular_velocity.x, cpp_data.local_angular_velocity.y, cpp_data.local_angular_velocity.z};
-        c_data.local_linear_acceleration = {cpp_data.local_linear_acceleration.x, cpp_data.local_linear_acceleration.y, cpp_data.local_linear_acceleration.z};
-        c_data.local_angular_acceleration = {cpp_data.local_angular_acceleration.x, cpp_data.local_angular_acceleration.y, cpp_data.local_angular_acceleration.z};
-        c_data.wear_body = cpp_data.wear_body;
-        c_data.wear_chassis = cpp_data.wear_chassis;
-        c_data.wear_wheels = cpp_data.wear_wheels;
-        for (uint32_t j = 0; j < c_consts.wheel_count; ++j) {
-            c_data.wheels[j].suspension_deflection = cpp_data.wheels[j].suspension_deflection;
-            c_data.wheels[j].on_ground = cpp_data.wheels[j].on_ground;
-            c_data.wheels[j].substance = cpp_data.wheels[j].substance;
-            c_data.wheels[j].angular_velocity = cpp_data.wheels[j].angular_velocity;
-            c_data.wheels[j].steering = cpp_data.wheels[j].steering;
-            c_data.wheels[j].rotation = cpp_data.wheels[j].rotation;
-            c_data.wheels[j].lift = cpp_data.wheels[j].lift;
-            c_data.wheels[j].lift_offset = cpp_data.wheels[j].lift_offset;
-        }
-    }
-    
-    callback(c_trailers.get(), trailer_count, user_data);
+    callback(active->trailers, active->count, user_data);
 }
 
 void TelemetryApi::InvokeJobConstantsCallback(const JobConstants& cpp_data, SPF_Telemetry_JobConstants_Callback callback, void* user_data) {
-    SPF_JobConstants c_data;
-    
-    c_data.income = cpp_data.income;
-    c_data.delivery_time = cpp_data.delivery_time;
-    c_data.planned_distance_km = cpp_data.planned_distance_km;
-    c_data.is_cargo_loaded = cpp_data.is_cargo_loaded;
-    c_data.is_special_job = cpp_data.is_special_job;
-    strcpy_s(c_data.job_market, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.job_market.c_str());
-    strcpy_s(c_data.cargo_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.cargo_id.c_str());
-    strcpy_s(c_data.cargo_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.cargo_name.c_str());
-    c_data.cargo_mass = cpp_data.cargo_mass;
-    c_data.cargo_unit_count = cpp_data.cargo_unit_count;
-    c_data.cargo_unit_mass = cpp_data.cargo_unit_mass;
-    strcpy_s(c_data.destination_city_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.destination_city_id.c_str());
-    strcpy_s(c_data.destination_city, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.destination_city.c_str());
-    strcpy_s(c_data.destination_company_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.destination_company_id.c_str());
-    strcpy_s(c_data.destination_company, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.destination_company.c_str());
-    strcpy_s(c_data.source_city_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.source_city_id.c_str());
-    strcpy_s(c_data.source_city, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.source_city.c_str());
-    strcpy_s(c_data.source_company_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.source_company_id.c_str());
-    strcpy_s(c_data.source_company, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.source_company.c_str());
-
-    callback(&c_data, user_data);
+    callback(&GetCache().jobConstants.Get(cpp_data, CurrentRevision(), ConvertJobConstants), user_data);
 }
 
 void TelemetryApi::InvokeJobDataCallback(const JobData& cpp_data, SPF_Telemetry_JobData_Callback callback, void* user_data) {
-    SPF_JobData c_data;
-    c_data.on_job = cpp_data.on_job;
-    c_data.cargo_damage = cpp_data.cargo_damage;
-    c_data.remaining_delivery_minutes = cpp_data.remaining_delivery_minutes;
-    callback(&c_data, user_data);
+    callback(&GetCache().jobData.Get(cpp_data, CurrentRevision(), ConvertJobData), user_data);
 }
 
 void TelemetryApi::InvokeNavigationDataCallback(const NavigationData& cpp_data, SPF_Telemetry_NavigationData_Callback callback, void* user_data) {
-    SPF_NavigationData c_data;
-    c_data.navigation_distance = cpp_data.navigation_distance;
-    c_data.navigation_time = cpp_data.navigation_time;
-    c_data.navigation_speed_limit = cpp_data.navigation_speed_limit;
-    c_data.navigation_time_real_seconds = cpp_data.navigation_time_real_seconds;
-    callback(&c_data, user_data);
+    callback(&GetCache().navigationData.Get(cpp_data, CurrentRevision(), ConvertNavigationData), user_data);
 }
 
 void TelemetryApi::InvokeControlsCallback(const Controls& cpp_data, SPF_Telemetry_Controls_Callback callback, void* user_data) {
-    SPF_Controls c_data;
-    c_data.userInput.steering = cpp_data.userInput.steering;
-    c_data.userInput.throttle = cpp_data.userInput.throttle;
-    c_data.userInput.brake = cpp_data.userInput.brake;
-    c_data.userInput.clutch = cpp_data.userInput.clutch;
-    c_data.effectiveInput.steering = cpp_data.effectiveInput.steering;
-    c_data.effectiveInput.throttle = cpp_data.effectiveInput.throttle;
-    c_data.effectiveInput.brake = cpp_data.effectiveInput.brake;
-    c_data.effectiveInput.clutch = cpp_data.effectiveInput.clutch;
-    callback(&c_data, user_data);
+    callback(&GetCache().controls.Get(cpp_data, CurrentRevision(), ConvertControls), user_data);
 }
 
 void TelemetryApi::InvokeSpecialEventsCallback(const SpecialEvents& cpp_data, SPF_Telemetry_SpecialEvents_Callback callback, void* user_data) {
-    SPF_SpecialEvents c_data;
-    c_data.job_delivered = cpp_data.job_delivered;
-    c_data.job_cancelled = cpp_data.job_cancelled;
-    c_data.fined = cpp_data.fined;
-    c_data.tollgate = cpp_data.tollgate;
-    c_data.ferry = cpp_data.ferry;
-    c_data.train = cpp_data.train;
-    callback(&c_data, user_data);
+    callback(&GetCache().specialEvents.Get(cpp_data, CurrentRevision(), ConvertSpecialEvents), user_data);
 }
 
 void TelemetryApi::InvokeGameplayEventsCallback(const char* event_id, const GameplayEvents& cpp_data, SPF_Telemetry_GameplayEvents_Callback callback, void* user_data) {
-    SPF_GameplayEvents c_data;
-
-    // Job Delivered
-    c_data.job_delivered.revenue = cpp_data.job_delivered.revenue;
-    c_data.job_delivered.earned_xp = cpp_data.job_delivered.earned_xp;
-    c_data.job_delivered.cargo_damage = cpp_data.job_delivered.cargo_damage;
-    c_data.job_delivered.distance_km = cpp_data.job_delivered.distance_km;
-    c_data.job_delivered.delivery_time = cpp_data.job_delivered.delivery_time;
-    c_data.job_delivered.auto_park_used = cpp_data.job_delivered.auto_park_used;
-    c_data.job_delivered.auto_load_used = cpp_data.job_delivered.auto_load_used;
-
-    // Job Cancelled
-    c_data.job_cancelled.penalty = cpp_data.job_cancelled.penalty;
-
-    // Player Fined
-    c_data.player_fined.fine_amount = cpp_data.player_fined.fine_amount;
-    strcpy_s(c_data.player_fined.fine_offence, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.player_fined.fine_offence.c_str());
-
-    // Tollgate Paid
-    c_data.tollgate_paid.pay_amount = cpp_data.tollgate_paid.pay_amount;
-
-    // Ferry Used
-    c_data.ferry_used.pay_amount = cpp_data.ferry_used.pay_amount;
-    strcpy_s(c_data.ferry_used.source_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.ferry_used.source_name.c_str());
-    strcpy_s(c_data.ferry_used.target_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.ferry_used.target_name.c_str());
-    strcpy_s(c_data.ferry_used.source_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.ferry_used.source_id.c_str());
-    strcpy_s(c_data.ferry_used.target_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.ferry_used.target_id.c_str());
-
-    // Train Used
-    c_data.train_used.pay_amount = cpp_data.train_used.pay_amount;
-    strcpy_s(c_data.train_used.source_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.train_used.source_name.c_str());
-    strcpy_s(c_data.train_used.target_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.train_used.target_name.c_str());
-    strcpy_s(c_data.train_used.source_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.train_used.source_id.c_str());
-    strcpy_s(c_data.train_used.target_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.train_used.target_id.c_str());
-
-    callback(event_id, &c_data, user_data);
+    callback(event_id, &GetCache().gameplayEvents.Get(cpp_data, CurrentRevision(), ConvertGameplayEvents), user_data);
 }
 
 void TelemetryApi::InvokeGearboxConstantsCallback(const GearboxConstants& cpp_data, SPF_Telemetry_GearboxConstants_Callback callback, void* user_data) {
-    SPF_GearboxConstants c_data;
-
-    strcpy_s(c_data.shifter_type, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.shifter_type.c_str());
-
-    c_data.slot_count = static_cast<uint32_t>(std::min<size_t>(cpp_data.slot_gear.size(), SPF_TELEMETRY_HSHIFTER_MAX_SLOTS));
-    for (uint32_t i = 0; i < c_data.slot_count; ++i) {
-        c_data.slot_gear[i] = cpp_data.slot_gear[i];
-        c_data.slot_handle_position[i] = cpp_data.slot_handle_position[i];
-        c_data.slot_selectors[i] = cpp_data.slot_selectors[i];
-    }
-    
-    callback(&c_data, user_data);
+    callback(&GetCache().gearboxConstants.Get(cpp_data, CurrentRevision(), ConvertGearboxConstants), user_data);
 }
 
+void TelemetryApi::InvokeDerivedDataCallback(const SPF::Telemetry::DerivedData& cpp_data, SPF_Telemetry_DerivedData_Callback callback, void* user_data) {
+    callback(&GetCache().derivedData.Get(cpp_data, CurrentRevision(), ConvertDerivedData), user_data);
+}
 
 
 void TelemetryApi::FillTelemetryApi(SPF_Telemetry_API* api) {
@@ -906,6 +598,7 @@ void TelemetryApi::FillTelemetryApi(SPF_Telemetry_API* api) {
     api->GetGameplayEvents = &TelemetryApi::T_GetGameplayEvents;
     api->GetGearboxConstants = &TelemetryApi::T_GetGearboxConstants;
     api->GetLastGameplayEventId = &TelemetryApi::T_GetLastGameplayEventId;
+    api->GetDerivedData = &TelemetryApi::T_GetDerivedData;
 
     // Assign new RAII-based event subscription functions
     api->RegisterForGameState = &TelemetryApi::T_RegisterForGameState;
@@ -922,6 +615,27 @@ void TelemetryApi::FillTelemetryApi(SPF_Telemetry_API* api) {
     api->RegisterForSpecialEvents = &TelemetryApi::T_RegisterForSpecialEvents;
     api->RegisterForGameplayEvents = &TelemetryApi::T_RegisterForGameplayEvents;
     api->RegisterForGearboxConstants = &TelemetryApi::T_RegisterForGearboxConstants;
+    api->RegisterForFieldChanges = &TelemetryApi::T_RegisterForFieldChanges;
+    api->RegisterForFieldAggregates = &TelemetryApi::T_RegisterForFieldAggregates;
+    api->SetCallbackRate = &TelemetryApi::T_SetCallbackRate;
+    api->RegisterForDerivedData = &TelemetryApi::T_RegisterForDerivedData;
+    api->GetView = &TelemetryApi::T_GetView;
+    api->GetLatestGameplayEventSequence = &TelemetryApi::T_GetLatestGameplayEventSequence;
+    api->ReadGameplayEvents = &TelemetryApi::T_ReadGameplayEvents;
+    api->SetGameplayEventCursor = &TelemetryApi::T_SetGameplayEventCursor;
+    api->QueryGameplayEvents = &TelemetryApi::T_QueryGameplayEvents;
+    api->GetTimingStats = &TelemetryApi::T_GetTimingStats;
+    api->GetCallbackTiming = &TelemetryApi::T_GetCallbackTiming;
+    api->GetInterpolatedPlacements = &TelemetryApi::T_GetInterpolatedPlacements;
+    api->RegisterForChannel = &TelemetryApi::T_RegisterForChannel;
+    api->RegisterForTrigger = &TelemetryApi::T_RegisterForTrigger;
+    api->GetRouteInfo = &TelemetryApi::T_GetRouteInfo;
+    api->FindNearestRoutePoint = &TelemetryApi::T_FindNearestRoutePoint;
+    api->GetRoutePointsInBox = &TelemetryApi::T_GetRoutePointsInBox;
+    api->SaveRoute = &TelemetryApi::T_SaveRoute;
+    api->RecordFieldHistory = &TelemetryApi::T_RecordFieldHistory;
+    api->GetFieldHistory = &TelemetryApi::T_GetFieldHistory;
+    api->DemandChannelGroups = &TelemetryApi::T_DemandChannelGroups;
 
 
 }
@@ -948,7 +662,7 @@ SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForGameState(SPF_Telemetr
             user_data
         )
     );
-    return reinterpret_cast<SPF_Telemetry_Callback_Handle*>(telemetryHandle->m_subscriptionHandlers.back().get());
+    return TrackSubscription(telemetryHandle, "GameState");
 }
 
 SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForTimestamps(SPF_Telemetry_Handle* handle, SPF_Telemetry_Timestamps_Callback callback, void* user_data) {
@@ -972,7 +686,7 @@ SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForTimestamps(SPF_Telemet
             user_data
         )
     );
-    return reinterpret_cast<SPF_Telemetry_Callback_Handle*>(telemetryHandle->m_subscriptionHandlers.back().get());
+    return TrackSubscription(telemetryHandle, "Timestamps");
 }
 
 SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForCommonData(SPF_Telemetry_Handle* handle, SPF_Telemetry_CommonData_Callback callback, void* user_data) {
@@ -996,7 +710,7 @@ SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForCommonData(SPF_Telemet
             user_data
         )
     );
-    return reinterpret_cast<SPF_Telemetry_Callback_Handle*>(telemetryHandle->m_subscriptionHandlers.back().get());
+    return TrackSubscription(telemetryHandle, "CommonData");
 }
 
 SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForTruckConstants(SPF_Telemetry_Handle* handle, SPF_Telemetry_TruckConstants_Callback callback, void* user_data) {
@@ -1020,7 +734,7 @@ SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForTruckConstants(SPF_Tel
             user_data
         )
     );
-    return reinterpret_cast<SPF_Telemetry_Callback_Handle*>(telemetryHandle->m_subscriptionHandlers.back().get());
+    return TrackSubscription(telemetryHandle, "TruckConstants");
 }
 
 SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForTrailerConstants(SPF_Telemetry_Handle* handle, SPF_Telemetry_TrailerConstants_Callback callback, void* user_data) {
@@ -1044,7 +758,7 @@ SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForTrailerConstants(SPF_T
             user_data
         )
     );
-    return reinterpret_cast<SPF_Telemetry_Callback_Handle*>(telemetryHandle->m_subscriptionHandlers.back().get());
+    return TrackSubscription(telemetryHandle, "TrailerConstants");
 }
 
 SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForTruckData(SPF_Telemetry_Handle* handle, SPF_Telemetry_TruckData_Callback callback, void* user_data) {
@@ -1068,7 +782,7 @@ SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForTruckData(SPF_Telemetr
             user_data
         )
     );
-    return reinterpret_cast<SPF_Telemetry_Callback_Handle*>(telemetryHandle->m_subscriptionHandlers.back().get());
+    return LeaseChannels(telemetryHandle, kTruckChannels, "TruckData");
 }
 
 SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForTrailers(SPF_Telemetry_Handle* handle, SPF_Telemetry_Trailers_Callback callback, void* user_data) {
@@ -1092,7 +806,7 @@ SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForTrailers(SPF_Telemetry
             user_data
         )
     );
-    return reinterpret_cast<SPF_Telemetry_Callback_Handle*>(telemetryHandle->m_subscriptionHandlers.back().get());
+    return LeaseChannels(telemetryHandle, kTrailerChannels, "Trailers");
 }
 
 SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForJobConstants(SPF_Telemetry_Handle* handle, SPF_Telemetry_JobConstants_Callback callback, void* user_data) {
@@ -1116,7 +830,7 @@ SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForJobConstants(SPF_Telem
             user_data
         )
     );
-    return reinterpret_cast<SPF_Telemetry_Callback_Handle*>(telemetryHandle->m_subscriptionHandlers.back().get());
+    return TrackSubscription(telemetryHandle, "JobConstants");
 }
 
 SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForJobData(SPF_Telemetry_Handle* handle, SPF_Telemetry_JobData_Callback callback, void* user_data) {
@@ -1140,7 +854,7 @@ SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForJobData(SPF_Telemetry_
             user_data
         )
     );
-    return reinterpret_cast<SPF_Telemetry_Callback_Handle*>(telemetryHandle->m_subscriptionHandlers.back().get());
+    return LeaseChannels(telemetryHandle, kJobChannels, "JobData");
 }
 
 SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForNavigationData(SPF_Telemetry_Handle* handle, SPF_Telemetry_NavigationData_Callback callback, void* user_data) {
@@ -1164,7 +878,7 @@ SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForNavigationData(SPF_Tel
             user_data
         )
     );
-    return reinterpret_cast<SPF_Telemetry_Callback_Handle*>(telemetryHandle->m_subscriptionHandlers.back().get());
+    return LeaseChannels(telemetryHandle, kNavigationChannels, "NavigationData");
 }
 
 SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForControls(SPF_Telemetry_Handle* handle, SPF_Telemetry_Controls_Callback callback, void* user_data) {
@@ -1188,7 +902,7 @@ SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForControls(SPF_Telemetry
             user_data
         )
     );
-    return reinterpret_cast<SPF_Telemetry_Callback_Handle*>(telemetryHandle->m_subscriptionHandlers.back().get());
+    return LeaseChannels(telemetryHandle, kControlsChannels, "Controls");
 }
 
 SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForSpecialEvents(SPF_Telemetry_Handle* handle, SPF_Telemetry_SpecialEvents_Callback callback, void* user_data) {
@@ -1212,7 +926,7 @@ SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForSpecialEvents(SPF_Tele
             user_data
         )
     );
-    return reinterpret_cast<SPF_Telemetry_Callback_Handle*>(telemetryHandle->m_subscriptionHandlers.back().get());
+    return TrackSubscription(telemetryHandle, "SpecialEvents");
 }
 
 SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForGameplayEvents(SPF_Telemetry_Handle* handle, SPF_Telemetry_GameplayEvents_Callback callback, void* user_data) {
@@ -1236,7 +950,7 @@ SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForGameplayEvents(SPF_Tel
             user_data
         )
     );
-    return reinterpret_cast<SPF_Telemetry_Callback_Handle*>(telemetryHandle->m_subscriptionHandlers.back().get());
+    return TrackSubscription(telemetryHandle, "GameplayEvents");
 }
 
 SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForGearboxConstants(SPF_Telemetry_Handle* handle, SPF_Telemetry_GearboxConstants_Callback callback, void* user_data) {
@@ -1260,9 +974,289 @@ SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForGearboxConstants(SPF_T
             user_data
         )
     );
-    return reinterpret_cast<SPF_Telemetry_Callback_Handle*>(telemetryHandle->m_subscriptionHandlers.back().get());
+    return TrackSubscription(telemetryHandle, "GearboxConstants");
 }
 
+SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForDerivedData(SPF_Telemetry_Handle* handle, SPF_Telemetry_DerivedData_Callback callback, void* user_data) {
+    auto& pm = PluginManager::GetInstance();
+    if (!handle || !callback || !pm.GetTelemetryService()) return nullptr;
+
+    Handles::TelemetryHandle* telemetryHandle = reinterpret_cast<Handles::TelemetryHandle*>(handle);
+    if (!telemetryHandle) {
+        return nullptr;
+    }
+
+    SubscriptionHandler<SPF::Telemetry::DerivedData>::InvokerFunction invoker =
+        [callback](const SPF::Telemetry::DerivedData& cpp_data, void* ud) {
+        TelemetryApi::InvokeDerivedDataCallback(cpp_data, callback, ud);
+    };
+
+    telemetryHandle->m_subscriptionHandlers.emplace_back(
+        std::make_unique<SubscriptionHandler<SPF::Telemetry::DerivedData>>(
+            pm.GetTelemetryService()->GetDerivedDataSignal(),
+            invoker,
+            user_data
+        )
+    );
+    return LeaseChannels(telemetryHandle, kTruckChannels, "DerivedData");
+}
+
+static_assert(SPF_TELEMETRY_FIELD_COUNT == SPF::Telemetry::FieldCount, "SPF_Telemetry_Field must mirror SPF::Telemetry::Field");
+
+// --- Rate Limiting ---
+bool TelemetryApi::BaseSubscriptionHandler::PassesRateLimit() {
+    if (m_minIntervalUs == 0) return true;
+
+    auto* telemetry = PluginManager::GetInstance().GetTelemetryService();
+    const uint64_t now = telemetry ? telemetry->GetTimestamps().render : 0;
+
+    // The first event, and any event after the render clock restarted, opens a new schedule.
+    if (!m_hasDelivered || now + m_minIntervalUs < m_nextDeliveryUs) {
+        m_hasDelivered = true;
+        m_nextDeliveryUs = now + m_minIntervalUs;
+        return true;
+    }
+    if (now < m_nextDeliveryUs) return false;
+
+    m_nextDeliveryUs += m_minIntervalUs;
+    if (m_nextDeliveryUs <= now) {
+        // Fell behind (e.g. a long frame or a pause without frames); don't burst to catch up.
+        m_nextDeliveryUs = now + m_minIntervalUs;
+    }
+    return true;
+}
+
+bool TelemetryApi::T_SetCallbackRate(SPF_Telemetry_Handle* handle, SPF_Telemetry_Callback_Handle* callback_handle, float rate_hz) {
+    if (!handle || !callback_handle || !(rate_hz >= 0.0f)) return false;
+
+    Handles::TelemetryHandle* telemetryHandle = reinterpret_cast<Handles::TelemetryHandle*>(handle);
+    auto* target = reinterpret_cast<BaseSubscriptionHandler*>(callback_handle);
+    const auto it = std::find_if(telemetryHandle->m_subscriptionHandlers.begin(), telemetryHandle->m_subscriptionHandlers.end(),
+                                 [target](const auto& handler) { return handler.get() == target; });
+    if (it == telemetryHandle->m_subscriptionHandlers.end() || !target->SupportsRateLimit()) return false;
+
+    target->m_minIntervalUs = rate_hz > 0.0f ? static_cast<uint64_t>(1000000.0 / rate_hz) : 0;
+    target->m_hasDelivered = false;
+    return true;
+}
+
+// --- Field Change Subscriptions ---
+TelemetryApi::FieldSubscriptionHandler::FieldSubscriptionHandler(
+    Utils::Signal<void(const SPF::Telemetry::TelemetrySnapshot&, const SPF::Telemetry::FieldMask&)>& signal,
+    std::vector<WatchedField> fields,
+    SPF_Telemetry_FieldChanges_Callback callback,
+    void* user_data_ptr)
+    : m_fields(std::move(fields)), m_callback(callback), m_user_data_ptr(user_data_ptr), m_sink(signal) {
+    for (const auto& watched : m_fields) {
+        m_interest.set(static_cast<size_t>(watched.field));
+    }
+    m_changes.reserve(m_fields.size());
+    m_sink.template Connect<&FieldSubscriptionHandler::OnEvent>(this);
+}
+
+void TelemetryApi::FieldSubscriptionHandler::OnEvent(const SPF::Telemetry::TelemetrySnapshot& snapshot, const SPF::Telemetry::FieldMask& changed) {
+    m_pending |= changed & m_interest;
+    if (m_pending.none() || !PassesRateLimit()) return;
+    SPF_TELEMETRY_TIME_SCOPE(m_timing);
+
+    m_changes.clear();
+    for (auto& watched : m_fields) {
+        if (!m_pending.test(static_cast<size_t>(watched.field))) continue;
+
+        const double value = SPF::Telemetry::ReadFieldValue(snapshot, watched.field);
+        const double delta = std::fabs(value - watched.lastReported);
+        bool report;
+        switch (watched.mode) {
+            case SPF_TELEMETRY_DEADBAND_ABSOLUTE:
+                report = delta > watched.deadband;
+                break;
+            case SPF_TELEMETRY_DEADBAND_RELATIVE:
+                report = delta > watched.deadband * std::fabs(watched.lastReported);
+                break;
+            default:
+                report = value != watched.lastReported;
+                break;
+        }
+        // Values inside the deadband keep the old baseline, so slow drifts are still caught.
+        if (!report) continue;
+
+        m_changes.push_back({static_cast<SPF_Telemetry_Field>(watched.field), value, watched.lastReported});
+        watched.lastReported = value;
+    }
+    m_pending.reset();
+
+    if (!m_changes.empty()) {
+        m_callback(m_changes.data(), static_cast<uint32_t>(m_changes.size()), m_user_data_ptr);
+    }
+}
+
+SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForFieldChanges(SPF_Telemetry_Handle* handle, const SPF_Telemetry_FieldSubscription* subscriptions, uint32_t count, SPF_Telemetry_FieldChanges_Callback callback, void* user_data) {
+    auto& pm = PluginManager::GetInstance();
+    if (!handle || !subscriptions || count == 0 || !callback || !pm.GetTelemetryService()) return nullptr;
+
+    Handles::TelemetryHandle* telemetryHandle = reinterpret_cast<Handles::TelemetryHandle*>(handle);
+    if (!telemetryHandle) {
+        return nullptr;
+    }
+
+    // The current values are the baseline; the plugin is only told about later changes.
+    const auto snapshot = pm.GetTelemetryService()->GetSnapshot();
+    std::vector<FieldSubscriptionHandler::WatchedField> fields;
+    fields.reserve(count);
+    ChannelGroupMask groups;
+    for (uint32_t i = 0; i < count; ++i) {
+        const auto& subscription = subscriptions[i];
+        if (subscription.field < 0 || subscription.field >= SPF_TELEMETRY_FIELD_COUNT) return nullptr;
+        if (subscription.deadband_mode < SPF_TELEMETRY_DEADBAND_NONE || subscription.deadband_mode > SPF_TELEMETRY_DEADBAND_RELATIVE) return nullptr;
+        if (!(subscription.deadband >= 0.0) && subscription.deadband_mode != SPF_TELEMETRY_DEADBAND_NONE) return nullptr;
+
+        const auto field = static_cast<SPF::Telemetry::Field>(subscription.field);
+        fields.push_back({field, subscription.deadband_mode, subscription.deadband, SPF::Telemetry::ReadFieldValue(*snapshot, field)});
+        groups |= SPF::Telemetry::ChannelGroupsForField(field);
+    }
+
+    telemetryHandle->m_subscriptionHandlers.emplace_back(
+        std::make_unique<FieldSubscriptionHandler>(
+            pm.GetTelemetryService()->GetFieldsChangedSignal(),
+            std::move(fields),
+            callback,
+            user_data
+        )
+    );
+    return LeaseChannels(telemetryHandle, groups, "FieldChanges");
+}
+
+// --- Windowed Aggregate Subscriptions ---
+TelemetryApi::FieldAggregateSubscriptionHandler::FieldAggregateSubscriptionHandler(
+    SPF::Telemetry::FieldAggregator& aggregator,
+    std::vector<SPF::Telemetry::Field> fields,
+    uint32_t window_ms,
+    SPF_Telemetry_FieldAggregates_Callback callback,
+    void* user_data_ptr)
+    : m_aggregator(aggregator),
+      m_fields(std::move(fields)),
+      m_window(aggregator.Acquire(window_ms, m_fields)),
+      m_callback(callback),
+      m_user_data_ptr(user_data_ptr),
+      m_sink(m_window.GetClosedSignal()) {
+    m_results.resize(m_fields.size());
+    m_sink.template Connect<&FieldAggregateSubscriptionHandler::OnEvent>(this);
+}
+
+TelemetryApi::FieldAggregateSubscriptionHandler::~FieldAggregateSubscriptionHandler() {
+    // Disconnect before releasing, the window may be dropped once no one uses it.
+    m_sink.Clear();
+    m_aggregator.Release(m_window, m_fields);
+}
+
+void TelemetryApi::FieldAggregateSubscriptionHandler::OnEvent(const SPF::Telemetry::AggregateWindow& window) {
+    SPF_TELEMETRY_TIME_SCOPE(m_timing);
+    for (size_t i = 0; i < m_fields.size(); ++i) {
+        const auto& stats = window.GetStats(m_fields[i]);
+        m_results[i] = {static_cast<SPF_Telemetry_Field>(m_fields[i]), stats.min, stats.max, stats.mean, stats.last, stats.samples};
+    }
+    m_callback(m_results.data(), static_cast<uint32_t>(m_results.size()), window.GetClosedStart(), window.GetClosedEnd(), m_user_data_ptr);
+}
+
+SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForFieldAggregates(SPF_Telemetry_Handle* handle, const SPF_Telemetry_Field* fields, uint32_t count, uint32_t window_ms, SPF_Telemetry_FieldAggregates_Callback callback, void* user_data) {
+    auto& pm = PluginManager::GetInstance();
+    if (!handle || !fields || count == 0 || window_ms == 0 || !callback || !pm.GetTelemetryService()) return nullptr;
+
+    Handles::TelemetryHandle* telemetryHandle = reinterpret_cast<Handles::TelemetryHandle*>(handle);
+    if (!telemetryHandle) {
+        return nullptr;
+    }
+
+    std::vector<SPF::Telemetry::Field> cppFields;
+    cppFields.reserve(count);
+    ChannelGroupMask groups;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (fields[i] < 0 || fields[i] >= SPF_TELEMETRY_FIELD_COUNT) return nullptr;
+        cppFields.push_back(static_cast<SPF::Telemetry::Field>(fields[i]));
+        groups |= SPF::Telemetry::ChannelGroupsForField(cppFields.back());
+    }
+
+    telemetryHandle->m_subscriptionHandlers.emplace_back(
+        std::make_unique<FieldAggregateSubscriptionHandler>(
+            pm.GetTelemetryService()->GetFieldAggregator(),
+            std::move(cppFields),
+            window_ms,
+            callback,
+            user_data
+        )
+    );
+    return LeaseChannels(telemetryHandle, groups, "FieldAggregates");
+}
+
+void TelemetryApi::ChannelSubscriptionHandler::OnValue(const SPF::Telemetry::ChannelValue& value) {
+    SPF_TELEMETRY_TIME_SCOPE(m_timing);
+    SPF_Telemetry_ChannelValue c_value;
+    ConvertChannelValue(value, c_value);
+    m_callback(&c_value, m_user_data_ptr);
+}
+
+SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForChannel(SPF_Telemetry_Handle* handle, const char* channel, uint32_t index, bool changes_only, SPF_Telemetry_Channel_Callback callback, void* user_data) {
+    auto& pm = PluginManager::GetInstance();
+    if (!handle || !channel || !callback || !pm.GetTelemetryService()) return nullptr;
+
+    Handles::TelemetryHandle* telemetryHandle = reinterpret_cast<Handles::TelemetryHandle*>(handle);
+    if (!telemetryHandle) {
+        return nullptr;
+    }
+
+    auto handler = std::make_unique<ChannelSubscriptionHandler>(callback, user_data);
+    auto* target = handler.get();
+    handler->m_subscription = pm.GetTelemetryService()->SubscribeToChannel(
+        channel, index, [target](const SPF::Telemetry::ChannelValue& value) { target->OnValue(value); }, changes_only);
+    if (!handler->m_subscription) return nullptr;
+
+    telemetryHandle->m_subscriptionHandlers.push_back(std::move(handler));
+    return TrackSubscription(telemetryHandle, (std::string("Channel ") + channel).c_str());
+}
+
+// --- Triggers ---
+void TelemetryApi::TriggerSubscriptionHandler::OnTransition(const SPF::Telemetry::TriggerEvent& event) {
+    SPF_TELEMETRY_TIME_SCOPE(m_timing);
+    const SPF_Telemetry_TriggerEvent c_event = {event.active, event.renderTime, event.previousDuration};
+    m_callback(&c_event, m_user_data_ptr);
+}
+
+SPF_Telemetry_Callback_Handle* TelemetryApi::T_RegisterForTrigger(SPF_Telemetry_Handle* handle, const SPF_Telemetry_TriggerCondition* conditions, uint32_t count, const SPF_Telemetry_TriggerOptions* options, SPF_Telemetry_Trigger_Callback callback, void* user_data) {
+    auto& pm = PluginManager::GetInstance();
+    if (!handle || !conditions || count == 0 || !callback || !pm.GetTelemetryService()) return nullptr;
+
+    Handles::TelemetryHandle* telemetryHandle = reinterpret_cast<Handles::TelemetryHandle*>(handle);
+    if (!telemetryHandle) {
+        return nullptr;
+    }
+
+    std::vector<SPF::Telemetry::TriggerCondition> cppConditions;
+    cppConditions.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        const auto& condition = conditions[i];
+        if (condition.field < 0 || condition.field >= SPF_TELEMETRY_FIELD_COUNT) return nullptr;
+        if (condition.op < SPF_TELEMETRY_COMPARE_GREATER || condition.op > SPF_TELEMETRY_COMPARE_NOT_EQUAL) return nullptr;
+        if (!(condition.hysteresis >= 0.0)) return nullptr;
+        cppConditions.push_back({static_cast<SPF::Telemetry::Field>(condition.field), static_cast<SPF::Telemetry::CompareOp>(condition.op), condition.threshold, condition.hysteresis});
+    }
+
+    SPF::Telemetry::TriggerOptions cppOptions;
+    if (options) {
+        if (options->edge < SPF_TELEMETRY_TRIGGER_EDGE_RISING || options->edge > SPF_TELEMETRY_TRIGGER_EDGE_BOTH) return nullptr;
+        cppOptions.holdMs = options->hold_ms;
+        cppOptions.releaseMs = options->release_ms;
+        cppOptions.edge = static_cast<SPF::Telemetry::TriggerEdge>(options->edge);
+    }
+
+    auto handler = std::make_unique<TriggerSubscriptionHandler>(callback, user_data);
+    auto* target = handler.get();
+    handler->m_subscription = pm.GetTelemetryService()->AddTrigger(
+        cppConditions, cppOptions, [target](const SPF::Telemetry::TriggerEvent& event) { target->OnTransition(event); });
+    if (!handler->m_subscription) return nullptr;
+
+    telemetryHandle->m_subscriptionHandlers.push_back(std::move(handler));
+    return TrackSubscription(telemetryHandle, "Trigger");
+}
 
 } // namespace Modules::API
 SPF_NS_END
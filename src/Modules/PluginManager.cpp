@@ -273,6 +273,8 @@ void PluginManager::LoadPlugin(const std::string& pluginName) {
   m_eventManager->System.OnPluginWillBeLoaded.Call({plugin->name});
   if (plugin->exports.OnLoad) {
     logger->Debug("    -> Calling OnLoad() for plugin '{}'...", plugin->name);
+    // Settings the plugin writes while loading are announced once each, when OnLoad returns.
+    EventManager::CoalescedEvents::Batch batch(m_eventManager->Coalesced);
     plugin->exports.OnLoad(&m_loadAPI);
   }
 
@@ -0,0 +1,536 @@
+#include "SPF/Telemetry/CDataConversion.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "SPF/Telemetry/TelemetrySnapshot.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry::Conversion {
+
+using namespace SCS;
+
+const char* GameToString(SPF::Game game) {
+  switch (game) {
+    case SPF::Game::ETS2:
+      return "ETS2";
+    case SPF::Game::ATS:
+      return "ATS";
+    case SPF::Game::Unknown:
+      return "Unknown";
+    default:
+      return "Invalid";
+  }
+}
+
+void ConvertGameState(const GameState& cpp_data, SPF_GameState& c_data) {
+    strcpy_s(c_data.game_id, SPF_TELEMETRY_ID_MAX_SIZE, GameToString(cpp_data.game_id));
+    strcpy_s(c_data.game_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.game_name.c_str());
+
+    c_data.scs_game_version_major = cpp_data.scs_game_version_major;
+    c_data.scs_game_version_minor = cpp_data.scs_game_version_minor;
+
+    c_data.telemetry_plugin_version_major = cpp_data.telemetry_plugin_version_major;
+    c_data.telemetry_plugin_version_minor = cpp_data.telemetry_plugin_version_minor;
+
+    c_data.telemetry_game_version_major = cpp_data.telemetry_game_version_major;
+    c_data.telemetry_game_version_minor = cpp_data.telemetry_game_version_minor;
+
+    c_data.paused = cpp_data.paused;
+    c_data.scale = cpp_data.scale;
+    c_data.multiplayer_time_offset = cpp_data.multiplayer_time_offset;
+}
+
+void ConvertTimestamps(const Timestamps& cpp_data, SPF_Timestamps& c_data) {
+    c_data.simulation = cpp_data.simulation;
+    c_data.render = cpp_data.render;
+    c_data.paused_simulation = cpp_data.paused_simulation;
+}
+
+void ConvertCommonData(const CommonData& cpp_data, SPF_CommonData& c_data) {
+    c_data.game_time = cpp_data.game_time;
+    c_data.next_rest_stop = cpp_data.next_rest_stop;
+    c_data.next_rest_stop_time.DayOfWeek = cpp_data.next_rest_stop_time.DayOfWeek;
+    c_data.next_rest_stop_time.Hour = cpp_data.next_rest_stop_time.Hour;
+    c_data.next_rest_stop_time.Minute = cpp_data.next_rest_stop_time.Minute;
+    c_data.next_rest_stop_real_minutes = cpp_data.next_rest_stop_real_minutes;
+
+    c_data.substance_count = static_cast<uint32_t>(std::min<size_t>(cpp_data.substances.size(), SPF_TELEMETRY_SUBSTANCE_MAX_COUNT));
+    for (uint32_t i = 0; i < c_data.substance_count; ++i) {
+        strcpy_s(c_data.substances[i], SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.substances[i].c_str());
+    }
+}
+
+void ConvertWheelConstants(const std::vector<WheelConstants>& cpp_wheels, uint32_t count, SPF_WheelConstants* c_wheels) {
+    for (uint32_t i = 0; i < count; ++i) {
+        c_wheels[i].simulated = cpp_wheels[i].simulated;
+        c_wheels[i].powered = cpp_wheels[i].powered;
+        c_wheels[i].steerable = cpp_wheels[i].steerable;
+        c_wheels[i].liftable = cpp_wheels[i].liftable;
+        c_wheels[i].radius = cpp_wheels[i].radius;
+        c_wheels[i].position = ToC(cpp_wheels[i].position);
+    }
+}
+
+void ConvertWheelData(const WheelDataStore& cpp_wheels, uint32_t count, SPF_WheelData* c_wheels) {
+    count = std::min<uint32_t>(count, static_cast<uint32_t>(cpp_wheels.size()));
+    // Member by member: each pass reads one contiguous array of the store.
+    for (uint32_t i = 0; i < count; ++i) c_wheels[i].suspension_deflection = cpp_wheels.suspension_deflection[i];
+    for (uint32_t i = 0; i < count; ++i) c_wheels[i].angular_velocity = cpp_wheels.angular_velocity[i];
+    for (uint32_t i = 0; i < count; ++i) c_wheels[i].steering = cpp_wheels.steering[i];
+    for (uint32_t i = 0; i < count; ++i) c_wheels[i].rotation = cpp_wheels.rotation[i];
+    for (uint32_t i = 0; i < count; ++i) c_wheels[i].lift = cpp_wheels.lift[i];
+    for (uint32_t i = 0; i < count; ++i) c_wheels[i].lift_offset = cpp_wheels.lift_offset[i];
+    for (uint32_t i = 0; i < count; ++i) c_wheels[i].substance = cpp_wheels.substance[i];
+    for (uint32_t i = 0; i < count; ++i) c_wheels[i].on_ground = cpp_wheels.on_ground.test(i);
+}
+
+void ConvertTruckConstants(const TruckConstants& cpp_data, SPF_TruckConstants& c_data) {
+    strcpy_s(c_data.brand_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.brand_id.c_str());
+    strcpy_s(c_data.brand, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.brand.c_str());
+    strcpy_s(c_data.id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.id.c_str());
+    strcpy_s(c_data.name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.name.c_str());
+    strcpy_s(c_data.license_plate, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.license_plate.c_str());
+    strcpy_s(c_data.license_plate_country_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.license_plate_country_id.c_str());
+    strcpy_s(c_data.license_plate_country, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.license_plate_country.c_str());
+
+    c_data.fuel_capacity = cpp_data.fuel_capacity;
+    c_data.fuel_warning_factor = cpp_data.fuel_warning_factor;
+    c_data.adblue_capacity = cpp_data.adblue_capacity;
+    c_data.adblue_warning_factor = cpp_data.adblue_warning_factor;
+    c_data.air_pressure_warning = cpp_data.air_pressure_warning;
+    c_data.air_pressure_emergency = cpp_data.air_pressure_emergency;
+    c_data.oil_pressure_warning = cpp_data.oil_pressure_warning;
+    c_data.water_temperature_warning = cpp_data.water_temperature_warning;
+    c_data.battery_voltage_warning = cpp_data.battery_voltage_warning;
+    c_data.rpm_limit = cpp_data.rpm_limit;
+    c_data.forward_gear_count = cpp_data.forward_gear_count;
+    c_data.reverse_gear_count = cpp_data.reverse_gear_count;
+    c_data.retarder_step_count = cpp_data.retarder_step_count;
+    c_data.selector_count = cpp_data.selector_count;
+    c_data.differential_ratio = cpp_data.differential_ratio;
+
+    c_data.cabin_position = ToC(cpp_data.cabin_position);
+    c_data.head_position = ToC(cpp_data.head_position);
+    c_data.hook_position = ToC(cpp_data.hook_position);
+
+    c_data.wheel_count = std::min<uint32_t>(cpp_data.wheel_count, SPF_TELEMETRY_WHEEL_MAX_COUNT);
+    ConvertWheelConstants(cpp_data.wheels, c_data.wheel_count, c_data.wheels);
+
+    uint32_t forward_gears_to_copy = std::min<uint32_t>(cpp_data.forward_gear_count, SPF_TELEMETRY_GEAR_MAX_COUNT);
+    memcpy(c_data.gear_ratios_forward, cpp_data.gear_ratios_forward.data(), forward_gears_to_copy * sizeof(float));
+
+    uint32_t reverse_gears_to_copy = std::min<uint32_t>(cpp_data.reverse_gear_count, SPF_TELEMETRY_GEAR_MAX_COUNT);
+    memcpy(c_data.gear_ratios_reverse, cpp_data.gear_ratios_reverse.data(), reverse_gears_to_copy * sizeof(float));
+}
+
+void ConvertTruckData(const TruckData& cpp_data, const TruckConstants& cpp_consts, SPF_TruckData& c_data) {
+    // Placements and vectors
+    c_data.world_placement = ToC(cpp_data.world_placement);
+    c_data.local_linear_velocity = ToC(cpp_data.local_linear_velocity);
+    c_data.local_angular_velocity = ToC(cpp_data.local_angular_velocity);
+    c_data.local_linear_acceleration = ToC(cpp_data.local_linear_acceleration);
+    c_data.local_angular_acceleration = ToC(cpp_data.local_angular_acceleration);
+    c_data.cabin_offset = ToC(cpp_data.cabin_offset);
+    c_data.cabin_angular_velocity = ToC(cpp_data.cabin_angular_velocity);
+    c_data.cabin_angular_acceleration = ToC(cpp_data.cabin_angular_acceleration);
+    c_data.head_offset = ToC(cpp_data.head_offset);
+
+    // Simple values
+    c_data.speed = cpp_data.speed;
+    c_data.engine_rpm = cpp_data.engine_rpm;
+    c_data.gear = cpp_data.gear;
+    c_data.displayed_gear = cpp_data.displayed_gear;
+    c_data.input_steering = cpp_data.input_steering;
+    c_data.input_throttle = cpp_data.input_throttle;
+    c_data.input_brake = cpp_data.input_brake;
+    c_data.input_clutch = cpp_data.input_clutch;
+    c_data.effective_steering = cpp_data.effective_steering;
+    c_data.effective_throttle = cpp_data.effective_throttle;
+    c_data.effective_brake = cpp_data.effective_brake;
+    c_data.effective_clutch = cpp_data.effective_clutch;
+    c_data.cruise_control_speed = cpp_data.cruise_control_speed;
+    c_data.hshifter_slot = cpp_data.hshifter_slot;
+    c_data.parking_brake = cpp_data.parking_brake;
+    c_data.motor_brake = cpp_data.motor_brake;
+    c_data.retarder_level = cpp_data.retarder_level;
+    c_data.air_pressure = cpp_data.air_pressure;
+    c_data.air_pressure_warning = cpp_data.air_pressure_warning;
+    c_data.air_pressure_emergency = cpp_data.air_pressure_emergency;
+    c_data.brake_temperature = cpp_data.brake_temperature;
+    c_data.fuel_amount = cpp_data.fuel_amount;
+    c_data.fuel_warning = cpp_data.fuel_warning;
+    c_data.fuel_average_consumption = cpp_data.fuel_average_consumption;
+    c_data.fuel_range = cpp_data.fuel_range;
+    c_data.adblue_amount = cpp_data.adblue_amount;
+    c_data.adblue_warning = cpp_data.adblue_warning;
+    c_data.adblue_average_consumption = cpp_data.adblue_average_consumption;
+    c_data.oil_pressure = cpp_data.oil_pressure;
+    c_data.oil_pressure_warning = cpp_data.oil_pressure_warning;
+    c_data.oil_temperature = cpp_data.oil_temperature;
+    c_data.water_temperature = cpp_data.water_temperature;
+    c_data.water_temperature_warning = cpp_data.water_temperature_warning;
+    c_data.battery_voltage = cpp_data.battery_voltage;
+    c_data.battery_voltage_warning = cpp_data.battery_voltage_warning;
+    c_data.electric_enabled = cpp_data.electric_enabled;
+    c_data.engine_enabled = cpp_data.engine_enabled;
+    c_data.wipers = cpp_data.wipers;
+    c_data.differential_lock = cpp_data.differential_lock;
+    c_data.lift_axle = cpp_data.lift_axle;
+    c_data.lift_axle_indicator = cpp_data.lift_axle_indicator;
+    c_data.trailer_lift_axle = cpp_data.trailer_lift_axle;
+    c_data.trailer_lift_axle_indicator = cpp_data.trailer_lift_axle_indicator;
+    c_data.lblinker = cpp_data.lblinker;
+    c_data.rblinker = cpp_data.rblinker;
+    c_data.hazard_warning = cpp_data.hazard_warning;
+    c_data.light_lblinker = cpp_data.light_lblinker;
+    c_data.light_rblinker = cpp_data.light_rblinker;
+    c_data.light_parking = cpp_data.light_parking;
+    c_data.light_low_beam = cpp_data.light_low_beam;
+    c_data.light_high_beam = cpp_data.light_high_beam;
+    c_data.light_aux_front = cpp_data.light_aux_front;
+    c_data.light_aux_roof = cpp_data.light_aux_roof;
+    c_data.light_beacon = cpp_data.light_beacon;
+    c_data.light_brake = cpp_data.light_brake;
+    c_data.light_reverse = cpp_data.light_reverse;
+    c_data.dashboard_backlight = cpp_data.dashboard_backlight;
+    c_data.wear_engine = cpp_data.wear_engine;
+    c_data.wear_transmission = cpp_data.wear_transmission;
+    c_data.wear_cabin = cpp_data.wear_cabin;
+    c_data.wear_chassis = cpp_data.wear_chassis;
+    c_data.wear_wheels = cpp_data.wear_wheels;
+    c_data.odometer = cpp_data.odometer;
+
+    // Arrays
+    uint32_t selectors_to_copy = std::min<uint32_t>(cpp_consts.selector_count, SPF_TELEMETRY_SELECTOR_MAX_COUNT);
+    selectors_to_copy = std::min<uint32_t>(selectors_to_copy, static_cast<uint32_t>(cpp_data.hshifter_selector.size()));
+    for (uint32_t i = 0; i < selectors_to_copy; ++i) {
+        c_data.hshifter_selector[i] = cpp_data.hshifter_selector[i];
+    }
+
+    ConvertWheelData(cpp_data.wheels, std::min<uint32_t>(cpp_consts.wheel_count, SPF_TELEMETRY_WHEEL_MAX_COUNT), c_data.wheels);
+}
+
+void ConvertTrailerConstants(const TrailerConstants& cpp_consts, SPF_TrailerConstants& c_consts) {
+    strcpy_s(c_consts.id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.id.c_str());
+    strcpy_s(c_consts.cargo_accessory_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.cargo_accessory_id.c_str());
+    strcpy_s(c_consts.brand_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.brand_id.c_str());
+    strcpy_s(c_consts.brand, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_consts.brand.c_str());
+    strcpy_s(c_consts.name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_consts.name.c_str());
+    strcpy_s(c_consts.chain_type, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.chain_type.c_str());
+    strcpy_s(c_consts.body_type, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.body_type.c_str());
+    strcpy_s(c_consts.license_plate, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.license_plate.c_str());
+    strcpy_s(c_consts.license_plate_country_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_consts.license_plate_country_id.c_str());
+    strcpy_s(c_consts.license_plate_country, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_consts.license_plate_country.c_str());
+    c_consts.hook_position = ToC(cpp_consts.hook_position);
+    c_consts.wheel_count = std::min<uint32_t>(cpp_consts.wheel_count, SPF_TELEMETRY_WHEEL_MAX_COUNT);
+    ConvertWheelConstants(cpp_consts.wheels, c_consts.wheel_count, c_consts.wheels);
+}
+
+void ConvertTrailer(const Trailer& cpp_trailer, SPF_Trailer& c_trailer) {
+    ConvertTrailerConstants(cpp_trailer.constants, c_trailer.constants);
+
+    const auto& cpp_data = cpp_trailer.data;
+    auto& c_data = c_trailer.data;
+    c_data.connected = cpp_data.connected;
+    c_data.cargo_damage = cpp_data.cargo_damage;
+    c_data.world_placement = ToC(cpp_data.world_placement);
+    c_data.local_linear_velocity = ToC(cpp_data.local_linear_velocity);
+    c_data.local_angular_velocity = ToC(cpp_data.local_angular_velocity);
+    c_data.local_linear_acceleration = ToC(cpp_data.local_linear_acceleration);
+    c_data.local_angular_acceleration = ToC(cpp_data.local_angular_acceleration);
+    c_data.wear_body = cpp_data.wear_body;
+    c_data.wear_chassis = cpp_data.wear_chassis;
+    c_data.wear_wheels = cpp_data.wear_wheels;
+    ConvertWheelData(cpp_data.wheels, c_trailer.constants.wheel_count, c_data.wheels);
+}
+
+void ConvertJobConstants(const JobConstants& cpp_data, SPF_JobConstants& c_data) {
+    c_data.income = cpp_data.income;
+    c_data.delivery_time = cpp_data.delivery_time;
+    c_data.planned_distance_km = cpp_data.planned_distance_km;
+    c_data.is_cargo_loaded = cpp_data.is_cargo_loaded;
+    c_data.is_special_job = cpp_data.is_special_job;
+    strcpy_s(c_data.job_market, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.job_market.c_str());
+    strcpy_s(c_data.cargo_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.cargo_id.c_str());
+    strcpy_s(c_data.cargo_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.cargo_name.c_str());
+    c_data.cargo_mass = cpp_data.cargo_mass;
+    c_data.cargo_unit_count = cpp_data.cargo_unit_count;
+    c_data.cargo_unit_mass = cpp_data.cargo_unit_mass;
+    strcpy_s(c_data.destination_city_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.destination_city_id.c_str());
+    strcpy_s(c_data.destination_city, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.destination_city.c_str());
+    strcpy_s(c_data.destination_company_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.destination_company_id.c_str());
+    strcpy_s(c_data.destination_company, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.destination_company.c_str());
+    strcpy_s(c_data.source_city_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.source_city_id.c_str());
+    strcpy_s(c_data.source_city, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.source_city.c_str());
+    strcpy_s(c_data.source_company_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.source_company_id.c_str());
+    strcpy_s(c_data.source_company, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.source_company.c_str());
+}
+
+void ConvertJobData(const JobData& cpp_data, SPF_JobData& c_data) {
+    c_data.on_job = cpp_data.on_job;
+    c_data.cargo_damage = cpp_data.cargo_damage;
+    c_data.remaining_delivery_minutes = cpp_data.remaining_delivery_minutes;
+}
+
+void ConvertNavigationData(const NavigationData& cpp_data, SPF_NavigationData& c_data) {
+    c_data.navigation_distance = cpp_data.navigation_distance;
+    c_data.navigation_time = cpp_data.navigation_time;
+    c_data.navigation_speed_limit = cpp_data.navigation_speed_limit;
+    c_data.navigation_time_real_seconds = cpp_data.navigation_time_real_seconds;
+}
+
+void ConvertControls(const Controls& cpp_data, SPF_Controls& c_data) {
+    c_data.userInput.steering = cpp_data.userInput.steering;
+    c_data.userInput.throttle = cpp_data.userInput.throttle;
+    c_data.userInput.brake = cpp_data.userInput.brake;
+    c_data.userInput.clutch = cpp_data.userInput.clutch;
+    c_data.effectiveInput.steering = cpp_data.effectiveInput.steering;
+    c_data.effectiveInput.throttle = cpp_data.effectiveInput.throttle;
+    c_data.effectiveInput.brake = cpp_data.effectiveInput.brake;
+    c_data.effectiveInput.clutch = cpp_data.effectiveInput.clutch;
+}
+
+void ConvertSpecialEvents(const SpecialEvents& cpp_data, SPF_SpecialEvents& c_data) {
+    c_data.job_delivered = cpp_data.job_delivered;
+    c_data.job_cancelled = cpp_data.job_cancelled;
+    c_data.fined = cpp_data.fined;
+    c_data.tollgate = cpp_data.tollgate;
+    c_data.ferry = cpp_data.ferry;
+    c_data.train = cpp_data.train;
+}
+
+void ConvertGameplayEvents(const GameplayEvents& cpp_data, SPF_GameplayEvents& c_data) {
+    // Job Delivered
+    c_data.job_delivered.revenue = cpp_data.job_delivered.revenue;
+    c_data.job_delivered.earned_xp = cpp_data.job_delivered.earned_xp;
+    c_data.job_delivered.cargo_damage = cpp_data.job_delivered.cargo_damage;
+    c_data.job_delivered.distance_km = cpp_data.job_delivered.distance_km;
+    c_data.job_delivered.delivery_time = cpp_data.job_delivered.delivery_time;
+    c_data.job_delivered.auto_park_used = cpp_data.job_delivered.auto_park_used;
+    c_data.job_delivered.auto_load_used = cpp_data.job_delivered.auto_load_used;
+
+    // Job Cancelled
+    c_data.job_cancelled.penalty = cpp_data.job_cancelled.penalty;
+
+    // Player Fined
+    c_data.player_fined.fine_amount = cpp_data.player_fined.fine_amount;
+    strcpy_s(c_data.player_fined.fine_offence, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.player_fined.fine_offence.c_str());
+
+    // Tollgate Paid
+    c_data.tollgate_paid.pay_amount = cpp_data.tollgate_paid.pay_amount;
+
+    // Ferry Used
+    c_data.ferry_used.pay_amount = cpp_data.ferry_used.pay_amount;
+    strcpy_s(c_data.ferry_used.source_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.ferry_used.source_name.c_str());
+    strcpy_s(c_data.ferry_used.target_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.ferry_used.target_name.c_str());
+    strcpy_s(c_data.ferry_used.source_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.ferry_used.source_id.c_str());
+    strcpy_s(c_data.ferry_used.target_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.ferry_used.target_id.c_str());
+
+    // Train Used
+    c_data.train_used.pay_amount = cpp_data.train_used.pay_amount;
+    strcpy_s(c_data.train_used.source_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.train_used.source_name.c_str());
+    strcpy_s(c_data.train_used.target_name, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_data.train_used.target_name.c_str());
+    strcpy_s(c_data.train_used.source_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.train_used.source_id.c_str());
+    strcpy_s(c_data.train_used.target_id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.train_used.target_id.c_str());
+}
+
+void ConvertGearboxConstants(const GearboxConstants& cpp_data, SPF_GearboxConstants& c_data) {
+    strcpy_s(c_data.shifter_type, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.shifter_type.c_str());
+
+    c_data.slot_count = static_cast<uint32_t>(std::min<size_t>(cpp_data.slot_gear.size(), SPF_TELEMETRY_HSHIFTER_MAX_SLOTS));
+    for (uint32_t i = 0; i < c_data.slot_count; ++i) {
+        c_data.slot_gear[i] = cpp_data.slot_gear[i];
+        c_data.slot_handle_position[i] = cpp_data.slot_handle_position[i];
+        c_data.slot_selectors[i] = cpp_data.slot_selectors[i];
+    }
+}
+
+static_assert(DerivedWheelMaxCount == SPF_TELEMETRY_WHEEL_MAX_COUNT, "DerivedData arrays must match the C wheel arrays");
+
+void ConvertDerivedData(const DerivedData& cpp_data, SPF_DerivedData& c_data) {
+    c_data.longitudinal_g = cpp_data.longitudinal_g;
+    c_data.lateral_g = cpp_data.lateral_g;
+    c_data.vertical_g = cpp_data.vertical_g;
+    c_data.jerk = cpp_data.jerk;
+
+    c_data.wheel_count = cpp_data.wheel_count;
+    std::copy(cpp_data.wheel_slip.begin(), cpp_data.wheel_slip.end(), c_data.wheel_slip);
+    c_data.max_wheel_slip = cpp_data.max_wheel_slip;
+
+    c_data.fuel_economy = cpp_data.fuel_economy;
+    c_data.trip_fuel_economy = cpp_data.trip_fuel_economy;
+    c_data.trip_distance = cpp_data.trip_distance;
+    c_data.trip_fuel_used = cpp_data.trip_fuel_used;
+    c_data.fuel_rate = cpp_data.fuel_rate;
+    c_data.time_to_empty = cpp_data.time_to_empty;
+
+    c_data.axle_count = cpp_data.axle_count;
+    std::copy(cpp_data.axle_suspension_deflection.begin(), cpp_data.axle_suspension_deflection.end(), c_data.axle_suspension_deflection);
+}
+
+static void ConvertEventAttribute(const RecordedEventAttribute& cpp_attr, SPF_GameplayEventAttribute& c_attr) {
+    strcpy_s(c_attr.name, SPF_TELEMETRY_ID_MAX_SIZE, cpp_attr.name.c_str());
+    c_attr.index = cpp_attr.index;
+    c_attr.value_string[0] = '\0';
+
+    const scs_value_t& value = cpp_attr.value;
+    switch (value.type) {
+        case SCS_VALUE_TYPE_bool:
+            c_attr.type = SPF_TELEMETRY_ATTRIBUTE_TYPE_BOOL;
+            c_attr.value.value_bool = value.value_bool.value != 0;
+            break;
+        case SCS_VALUE_TYPE_s32:
+            c_attr.type = SPF_TELEMETRY_ATTRIBUTE_TYPE_S32;
+            c_attr.value.value_s32 = value.value_s32.value;
+            break;
+        case SCS_VALUE_TYPE_u32:
+            c_attr.type = SPF_TELEMETRY_ATTRIBUTE_TYPE_U32;
+            c_attr.value.value_u32 = value.value_u32.value;
+            break;
+        case SCS_VALUE_TYPE_s64:
+            c_attr.type = SPF_TELEMETRY_ATTRIBUTE_TYPE_S64;
+            c_attr.value.value_s64 = value.value_s64.value;
+            break;
+        case SCS_VALUE_TYPE_u64:
+            c_attr.type = SPF_TELEMETRY_ATTRIBUTE_TYPE_U64;
+            c_attr.value.value_u64 = value.value_u64.value;
+            break;
+        case SCS_VALUE_TYPE_float:
+            c_attr.type = SPF_TELEMETRY_ATTRIBUTE_TYPE_FLOAT;
+            c_attr.value.value_float = value.value_float.value;
+            break;
+        case SCS_VALUE_TYPE_double:
+            c_attr.type = SPF_TELEMETRY_ATTRIBUTE_TYPE_DOUBLE;
+            c_attr.value.value_double = value.value_double.value;
+            break;
+        case SCS_VALUE_TYPE_string:
+            c_attr.type = SPF_TELEMETRY_ATTRIBUTE_TYPE_STRING;
+            c_attr.value.value_u64 = 0;
+            strcpy_s(c_attr.value_string, SPF_TELEMETRY_STRING_MAX_SIZE, cpp_attr.text.c_str());
+            break;
+        default:
+            c_attr.type = SPF_TELEMETRY_ATTRIBUTE_TYPE_NONE;
+            c_attr.value.value_u64 = 0;
+            break;
+    }
+}
+
+void ConvertRecordedEvent(const RecordedEvent& cpp_data, SPF_GameplayEventRecord& c_data) {
+    c_data.sequence = cpp_data.sequence;
+    strcpy_s(c_data.id, SPF_TELEMETRY_ID_MAX_SIZE, cpp_data.id.c_str());
+    ConvertTimestamps(cpp_data.timestamps, c_data.timestamps);
+    c_data.game_time = cpp_data.gameTime;
+    ConvertSpecialEvents(cpp_data.specialEvents, c_data.special_events);
+
+    c_data.attribute_count = static_cast<uint32_t>(std::min<size_t>(cpp_data.attributes.size(), SPF_TELEMETRY_EVENT_ATTRIBUTE_MAX_COUNT));
+    for (uint32_t i = 0; i < c_data.attribute_count; ++i) {
+        ConvertEventAttribute(cpp_data.attributes[i], c_data.attributes[i]);
+    }
+}
+
+void ConvertInterpolatedPlacements(const InterpolatedPlacements& cpp_data, SPF_InterpolatedPlacements& c_data) {
+    c_data.world_placement = ToC(cpp_data.world_placement);
+    c_data.cabin_offset = ToC(cpp_data.cabin_offset);
+    c_data.head_offset = ToC(cpp_data.head_offset);
+    c_data.render_time = cpp_data.render_time;
+    c_data.alpha = cpp_data.alpha;
+    c_data.valid = cpp_data.valid;
+}
+
+void ConvertRoutePoint(const RoutePoint& cpp_data, SPF_RoutePoint& c_data) {
+    c_data.position = {cpp_data.x, cpp_data.y, cpp_data.z};
+    c_data.heading = cpp_data.heading;
+    c_data.time = cpp_data.time;
+}
+
+void ConvertChannelValue(const ChannelValue& cpp_data, SPF_Telemetry_ChannelValue& c_data) {
+    c_data.index = cpp_data.index;
+    c_data.changed = cpp_data.changed;
+
+    const scs_value_t& value = cpp_data.value;
+    switch (value.type) {
+        case SCS_VALUE_TYPE_bool:
+            c_data.type = SPF_TELEMETRY_CHANNEL_TYPE_BOOL;
+            c_data.value.value_bool = value.value_bool.value != 0;
+            break;
+        case SCS_VALUE_TYPE_s32:
+            c_data.type = SPF_TELEMETRY_CHANNEL_TYPE_S32;
+            c_data.value.value_s32 = value.value_s32.value;
+            break;
+        case SCS_VALUE_TYPE_u32:
+            c_data.type = SPF_TELEMETRY_CHANNEL_TYPE_U32;
+            c_data.value.value_u32 = value.value_u32.value;
+            break;
+        case SCS_VALUE_TYPE_u64:
+            c_data.type = SPF_TELEMETRY_CHANNEL_TYPE_U64;
+            c_data.value.value_u64 = value.value_u64.value;
+            break;
+        case SCS_VALUE_TYPE_s64:
+            c_data.type = SPF_TELEMETRY_CHANNEL_TYPE_S64;
+            c_data.value.value_s64 = value.value_s64.value;
+            break;
+        case SCS_VALUE_TYPE_float:
+            c_data.type = SPF_TELEMETRY_CHANNEL_TYPE_FLOAT;
+            c_data.value.value_float = value.value_float.value;
+            break;
+        case SCS_VALUE_TYPE_double:
+            c_data.type = SPF_TELEMETRY_CHANNEL_TYPE_DOUBLE;
+            c_data.value.value_double = value.value_double.value;
+            break;
+        case SCS_VALUE_TYPE_fvector:
+            c_data.type = SPF_TELEMETRY_CHANNEL_TYPE_FVECTOR;
+            c_data.value.value_fvector = ToC(value.value_fvector);
+            break;
+        case SCS_VALUE_TYPE_dvector:
+            c_data.type = SPF_TELEMETRY_CHANNEL_TYPE_DVECTOR;
+            c_data.value.value_dvector = {value.value_dvector.x, value.value_dvector.y, value.value_dvector.z};
+            break;
+        case SCS_VALUE_TYPE_euler:
+            c_data.type = SPF_TELEMETRY_CHANNEL_TYPE_EULER;
+            c_data.value.value_euler = {value.value_euler.heading, value.value_euler.pitch, value.value_euler.roll};
+            break;
+        case SCS_VALUE_TYPE_fplacement:
+            c_data.type = SPF_TELEMETRY_CHANNEL_TYPE_FPLACEMENT;
+            c_data.value.value_fplacement = ToC(value.value_fplacement);
+            break;
+        case SCS_VALUE_TYPE_dplacement:
+            c_data.type = SPF_TELEMETRY_CHANNEL_TYPE_DPLACEMENT;
+            c_data.value.value_dplacement = ToC(value.value_dplacement);
+            break;
+        default:
+            c_data.type = SPF_TELEMETRY_CHANNEL_TYPE_NONE;
+            c_data.value.value_u64 = 0;
+            break;
+    }
+}
+
+void ConvertTelemetryView(const TelemetrySnapshot& snapshot, SPF_TelemetryView& c_view) {
+    c_view.header.size = sizeof(SPF_TelemetryView);
+    c_view.header.version = SPF_TELEMETRY_VIEW_VERSION;
+    c_view.frame_sequence = snapshot.frameId;
+
+    ConvertGameState(snapshot.gameState, c_view.game_state);
+    ConvertTimestamps(snapshot.timestamps, c_view.timestamps);
+    ConvertCommonData(snapshot.commonData, c_view.common_data);
+    ConvertTruckConstants(snapshot.truckConstants, c_view.truck_constants);
+    ConvertTruckData(snapshot.truckData, snapshot.truckConstants, c_view.truck_data);
+
+    c_view.trailer_count = static_cast<uint32_t>(std::min<size_t>(snapshot.trailers.size(), SPF_TELEMETRY_TRAILER_MAX_COUNT));
+    for (uint32_t i = 0; i < c_view.trailer_count; ++i) {
+        ConvertTrailer(snapshot.trailers[i], c_view.trailers[i]);
+    }
+
+    ConvertJobConstants(snapshot.jobConstants, c_view.job_constants);
+    ConvertJobData(snapshot.jobData, c_view.job_data);
+    ConvertNavigationData(snapshot.navigationData, c_view.navigation_data);
+    ConvertControls(snapshot.controls, c_view.controls);
+    ConvertSpecialEvents(snapshot.specialEvents, c_view.special_events);
+    ConvertGameplayEvents(snapshot.gameplayEvents, c_view.gameplay_events);
+    ConvertGearboxConstants(snapshot.gearboxConstants, c_view.gearbox_constants);
+    ConvertDerivedData(snapshot.derived, c_view.derived_data);
+    strcpy_s(c_view.last_gameplay_event_id, SPF_TELEMETRY_ID_MAX_SIZE, snapshot.lastGameplayEventId.c_str());
+}
+
+}  // namespace Telemetry::Conversion
+SPF_NS_END
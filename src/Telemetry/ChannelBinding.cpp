@@ -0,0 +1,53 @@
+#include "SPF/Telemetry/ChannelBinding.hpp"
+
+#include <cstddef>
+
+SPF_NS_BEGIN
+namespace Telemetry {
+namespace {
+/// Bytes of the scs_value_t union that hold a value of the given type.
+size_t ValueSize(scs_value_type_t type) {
+  switch (type) {
+    case SCS_VALUE_TYPE_bool: return sizeof(scs_value_bool_t);
+    case SCS_VALUE_TYPE_s32: return sizeof(scs_value_s32_t);
+    case SCS_VALUE_TYPE_u32: return sizeof(scs_value_u32_t);
+    case SCS_VALUE_TYPE_u64: return sizeof(scs_value_u64_t);
+    case SCS_VALUE_TYPE_float: return sizeof(scs_value_float_t);
+    case SCS_VALUE_TYPE_double: return sizeof(scs_value_double_t);
+    case SCS_VALUE_TYPE_fvector: return sizeof(scs_value_fvector_t);
+    case SCS_VALUE_TYPE_dvector: return sizeof(scs_value_dvector_t);
+    case SCS_VALUE_TYPE_euler: return sizeof(scs_value_euler_t);
+    case SCS_VALUE_TYPE_fplacement: return sizeof(scs_value_fplacement_t);
+    case SCS_VALUE_TYPE_dplacement: return offsetof(scs_value_dplacement_t, _padding);
+    case SCS_VALUE_TYPE_s64: return sizeof(scs_value_s64_t);
+    default: return 0;
+  }
+}
+}  // namespace
+
+void ChannelTap::Capture(scs_u32_t index, const scs_value_t& value) {
+  const size_t slotIndex = SlotIndex(index);
+  if (slotIndex >= slots.size()) return;
+
+  auto& slot = slots[slotIndex];
+  // Only the bytes of the active union member are compared; the rest is left unspecified by the SDK.
+  if (slot.received && slot.value.type == value.type && std::memcmp(&slot.value.value_bool, &value.value_bool, ValueSize(value.type)) == 0) return;
+  slot.value = value;
+  slot.received = true;
+  slot.changed = true;
+}
+
+void ChannelBinding::StaticChannelCallback(const scs_string_t, const scs_u32_t index, const scs_value_t* value, scs_context_t context) {
+  if (!context || !value) return;
+
+  const auto* binding = static_cast<const ChannelBinding*>(context);
+  if (binding->write(binding->target, index, *value)) {
+    if (binding->changes) MarkChanged(*binding->changes, binding->field);
+    if (binding->trailerChanges) binding->trailerChanges->set(binding->trailer);
+  }
+  if (binding->notify) binding->notify(binding->owner);
+  if (binding->tap) binding->tap->Capture(index, *value);
+}
+
+}  // namespace Telemetry
+SPF_NS_END
@@ -0,0 +1,90 @@
+#include "SPF/Telemetry/ChannelGroups.hpp"
+
+#include <utility>
+
+SPF_NS_BEGIN
+namespace Telemetry {
+ChannelGroupMask ChannelGroupsForField(Field field) {
+  switch (field) {
+    case Field::DerivedLongitudinalG:
+    case Field::DerivedLateralG:
+    case Field::DerivedVerticalG:
+    case Field::DerivedJerk:
+      return MakeChannelGroupMask(ChannelGroup::TruckMotion);
+    case Field::DerivedMaxWheelSlip:
+      return MakeChannelGroupMask(ChannelGroup::Truck, ChannelGroup::TruckWheels);
+    case Field::DerivedFuelEconomy:
+    case Field::DerivedTripFuelEconomy:
+    case Field::DerivedFuelRate:
+    case Field::DerivedTimeToEmpty:
+      return MakeChannelGroupMask(ChannelGroup::Truck);
+    default:
+      break;
+  }
+
+  // The remaining fields are grouped by their position in the enum.
+  if (field >= Field::NavigationDistance) return MakeChannelGroupMask(ChannelGroup::Navigation);
+  if (field >= Field::JobCargoDamage) return MakeChannelGroupMask(ChannelGroup::Job);
+  if (field >= Field::UserSteering) return MakeChannelGroupMask(ChannelGroup::Controls);
+  if (field >= Field::TruckSpeed) return MakeChannelGroupMask(ChannelGroup::Truck);
+  return MakeChannelGroupMask(ChannelGroup::Common);
+}
+
+// --- ChannelDemand ---
+
+void ChannelDemand::Acquire(const ChannelGroupMask& groups) {
+  std::lock_guard lock(m_mutex);
+  for (size_t i = 0; i < ChannelGroupCount; ++i) {
+    if (groups.test(i) && m_refs[i]++ == 0) m_revision.fetch_add(1, std::memory_order_release);
+  }
+}
+
+void ChannelDemand::Release(const ChannelGroupMask& groups) {
+  std::lock_guard lock(m_mutex);
+  for (size_t i = 0; i < ChannelGroupCount; ++i) {
+    if (groups.test(i) && m_refs[i] > 0 && --m_refs[i] == 0) m_revision.fetch_add(1, std::memory_order_release);
+  }
+}
+
+ChannelGroupMask ChannelDemand::GetGroups() const {
+  std::lock_guard lock(m_mutex);
+  ChannelGroupMask groups;
+  for (size_t i = 0; i < ChannelGroupCount; ++i) {
+    groups.set(i, m_refs[i] > 0);
+  }
+  return groups;
+}
+
+// --- ChannelLease ---
+
+ChannelLease::ChannelLease(std::shared_ptr<ChannelDemand> demand, const ChannelGroupMask& groups) : m_demand(std::move(demand)), m_groups(groups) {
+  if (m_demand) m_demand->Acquire(m_groups);
+}
+
+ChannelLease::~ChannelLease() { Reset(); }
+
+ChannelLease::ChannelLease(ChannelLease&& other) noexcept : m_demand(std::move(other.m_demand)), m_groups(std::exchange(other.m_groups, {})) {}
+
+ChannelLease& ChannelLease::operator=(ChannelLease&& other) noexcept {
+  if (this != &other) {
+    Reset();
+    m_demand = std::move(other.m_demand);
+    m_groups = std::exchange(other.m_groups, {});
+  }
+  return *this;
+}
+
+void ChannelLease::Extend(const ChannelGroupMask& groups) {
+  if (!m_demand) return;
+  const ChannelGroupMask added = groups & ~m_groups;
+  m_demand->Acquire(added);
+  m_groups |= added;
+}
+
+void ChannelLease::Reset() {
+  if (m_demand) m_demand->Release(m_groups);
+  m_demand.reset();
+  m_groups.reset();
+}
+}  // namespace Telemetry
+SPF_NS_END
@@ -0,0 +1,144 @@
+#include "SPF/Telemetry/ChannelSubscriptions.hpp"
+
+#include <algorithm>
+
+SPF_NS_BEGIN
+namespace Telemetry {
+// --- ChannelSubscriptionRegistry ---
+
+void ChannelSubscriptionRegistry::ClearChannels() {
+  std::lock_guard lock(m_mutex);
+  m_channels.clear();
+  m_channelIds.clear();
+}
+
+void ChannelSubscriptionRegistry::AddChannel(ChannelInfo info) {
+  std::lock_guard lock(m_mutex);
+  m_channelIds.emplace(info.name, static_cast<ChannelId>(m_channels.size()));
+  m_channels.push_back(std::move(info));
+}
+
+std::optional<ChannelSubscriptionRegistry::ChannelId> ChannelSubscriptionRegistry::FindChannel(std::string_view name) const {
+  std::lock_guard lock(m_mutex);
+  const auto it = m_channelIds.find(std::string(name));
+  if (it == m_channelIds.end()) return std::nullopt;
+  return it->second;
+}
+
+std::shared_ptr<ChannelSubscriptionRegistry::Subscriber> ChannelSubscriptionRegistry::Add(ChannelId channel, scs_u32_t index, ChannelCallback callback, bool changesOnly) {
+  auto subscriber = std::make_shared<Subscriber>();
+  subscriber->channel = channel;
+  subscriber->index = index;
+  subscriber->callback = std::move(callback);
+  subscriber->changesOnly = changesOnly;
+
+  std::lock_guard lock(m_mutex);
+  m_pendingAdds.push_back(subscriber);
+  m_hasPending.store(true, std::memory_order_release);
+  return subscriber;
+}
+
+void ChannelSubscriptionRegistry::Remove(const std::shared_ptr<Subscriber>& subscriber) {
+  if (!subscriber) return;
+  subscriber->active.store(false, std::memory_order_release);
+
+  std::lock_guard lock(m_mutex);
+  m_pendingRemoves.push_back(subscriber);
+  m_hasPending.store(true, std::memory_order_release);
+}
+
+void ChannelSubscriptionRegistry::Apply(const std::function<void(const ChannelInfo&, scs_u32_t index)>& refresh) {
+  if (!m_hasPending.load(std::memory_order_acquire)) return;
+
+  std::vector<std::shared_ptr<Subscriber>> adds;
+  std::vector<std::shared_ptr<Subscriber>> removes;
+  {
+    std::lock_guard lock(m_mutex);
+    adds.swap(m_pendingAdds);
+    removes.swap(m_pendingRemoves);
+    m_hasPending.store(false, std::memory_order_relaxed);
+  }
+
+  // Removals first: a subscriber added and removed since the last call is never installed.
+  for (const auto& subscriber : removes) {
+    if (!subscriber->tap) continue;
+    std::erase(m_active, subscriber);
+    Release(*subscriber);
+  }
+
+  for (const auto& subscriber : adds) {
+    if (!subscriber->active.load(std::memory_order_acquire)) continue;
+
+    const auto& info = m_channels[subscriber->channel];
+    auto& state = m_taps[info.binding];
+    if (!state) {
+      state = std::make_unique<TapState>();
+      info.binding->tap = &state->tap;
+    }
+    ++state->subscribers;
+
+    const size_t slotIndex = ChannelTap::SlotIndex(subscriber->index);
+    if (state->tap.slots.size() <= slotIndex) state->tap.slots.resize(slotIndex + 1);
+    subscriber->tap = &state->tap;
+    m_active.push_back(subscriber);
+
+    // Channels are only sent on change, so a value that arrived before the tap existed would never come again.
+    if (!state->tap.slots[slotIndex].received && refresh) refresh(info, subscriber->index);
+  }
+}
+
+void ChannelSubscriptionRegistry::Release(Subscriber& subscriber) {
+  ChannelBinding* binding = m_channels[subscriber.channel].binding;
+  const auto it = m_taps.find(binding);
+  subscriber.tap = nullptr;
+  if (it == m_taps.end() || --it->second->subscribers > 0) return;
+
+  binding->tap = nullptr;
+  m_taps.erase(it);
+}
+
+void ChannelSubscriptionRegistry::Dispatch() {
+  if (m_active.empty()) return;
+
+  // Subscribers added from a callback are queued until the next Apply(), so m_active is stable here.
+  for (const auto& subscriber : m_active) {
+    if (!subscriber->active.load(std::memory_order_acquire)) continue;
+
+    const auto& slot = subscriber->tap->slots[ChannelTap::SlotIndex(subscriber->index)];
+    if (!slot.received) continue;
+
+    const bool changed = slot.changed || !subscriber->delivered;
+    if (subscriber->changesOnly && !changed) continue;
+
+    subscriber->delivered = true;
+    subscriber->callback(ChannelValue{subscriber->index, slot.value, changed});
+  }
+
+  for (auto& [binding, state] : m_taps) state->tap.ClearChanges();
+}
+
+// --- ChannelSubscription ---
+
+ChannelSubscription::ChannelSubscription(std::shared_ptr<ChannelSubscriptionRegistry> registry, std::shared_ptr<ChannelSubscriptionRegistry::Subscriber> subscriber, ChannelLease channels)
+    : m_registry(std::move(registry)), m_subscriber(std::move(subscriber)), m_channels(std::move(channels)) {}
+
+ChannelSubscription::~ChannelSubscription() { Reset(); }
+
+ChannelSubscription& ChannelSubscription::operator=(ChannelSubscription&& other) noexcept {
+  if (this != &other) {
+    Reset();
+    m_registry = std::move(other.m_registry);
+    m_subscriber = std::move(other.m_subscriber);
+    m_channels = std::move(other.m_channels);
+  }
+  return *this;
+}
+
+void ChannelSubscription::Reset() {
+  if (m_registry && m_subscriber) m_registry->Remove(m_subscriber);
+  m_registry.reset();
+  m_subscriber.reset();
+  m_channels.Reset();
+}
+}  // namespace Telemetry
+SPF_NS_END
@@ -3,82 +3,74 @@
 
 SPF_NS_BEGIN
 namespace Telemetry {
-ConfigAttributeReader::ConfigAttributeReader(const scs_named_value_t* attributes) : m_attributes(attributes) {}
+namespace {
+/// FNV-1a over the name, mixed with the element index.
+uint32_t HashAttribute(const char* name, uint32_t index) {
+  uint32_t hash = 2166136261u;
+  for (const char* c = name; *c; ++c) {
+    hash = (hash ^ static_cast<uint8_t>(*c)) * 16777619u;
+  }
+  return (hash ^ index) * 16777619u;
+}
+}  // namespace
 
-const scs_named_value_t* ConfigAttributeReader::FindAttribute(const char* name, uint32_t index) const {
-  if (!m_attributes) return nullptr;
+ConfigAttributeReader::ConfigAttributeReader(const scs_named_value_t* attributes) : m_attributes(attributes) {
+  if (!m_attributes) return;
 
+  size_t count = 0;
   for (const scs_named_value_t* current = m_attributes; current->name != nullptr; ++current) {
-    if (current->index == index && strcmp(current->name, name) == 0) {
-      return current;
-    }
+    ++count;
   }
-  return nullptr;
-}
 
-std::optional<bool> ConfigAttributeReader::GetBool(const char* name, uint32_t index) const {
-  const auto* attr = FindAttribute(name, index);
-  if (attr && attr->value.type == SCS_VALUE_TYPE_bool) {
-    return attr->value.value_bool.value != 0;
-  }
-  return std::nullopt;
-}
+  // At most half full, so probe sequences stay short.
+  size_t capacity = 16;
+  while (capacity < count * 2) capacity *= 2;
+  m_index.resize(capacity);
 
-std::optional<int32_t> ConfigAttributeReader::GetS32(const char* name, uint32_t index) const {
-  const auto* attr = FindAttribute(name, index);
-  if (attr && attr->value.type == SCS_VALUE_TYPE_s32) {
-    return attr->value.value_s32.value;
+  const size_t mask = capacity - 1;
+  for (const scs_named_value_t* current = m_attributes; current->name != nullptr; ++current) {
+    const uint32_t hash = HashAttribute(current->name, current->index);
+    for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+      auto& entry = m_index[slot];
+      if (!entry.attribute) {
+        entry = {hash, current};
+        break;
+      }
+      // Keep the first occurrence of a duplicate, as the linear search did.
+      if (entry.hash == hash && entry.attribute->index == current->index && strcmp(entry.attribute->name, current->name) == 0) break;
+    }
   }
-  return std::nullopt;
 }
 
-std::optional<uint32_t> ConfigAttributeReader::GetU32(const char* name, uint32_t index) const {
-  const auto* attr = FindAttribute(name, index);
-  if (attr && attr->value.type == SCS_VALUE_TYPE_u32) {
-    return attr->value.value_u32.value;
-  }
-  return std::nullopt;
-}
+const scs_named_value_t* ConfigAttributeReader::FindAttribute(const char* name, uint32_t index) const {
+  if (m_index.empty()) return nullptr;
 
-std::optional<int64_t> ConfigAttributeReader::GetS64(const char* name, uint32_t index) const {
-  const auto* attr = FindAttribute(name, index);
-  if (attr && attr->value.type == SCS_VALUE_TYPE_s64) {
-    return attr->value.value_s64.value;
+  const uint32_t hash = HashAttribute(name, index);
+  const size_t mask = m_index.size() - 1;
+  for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+    const auto& entry = m_index[slot];
+    if (!entry.attribute) return nullptr;
+    if (entry.hash == hash && entry.attribute->index == index && strcmp(entry.attribute->name, name) == 0) {
+      return entry.attribute;
+    }
   }
-  return std::nullopt;
 }
 
-std::optional<uint64_t> ConfigAttributeReader::GetU64(const char* name, uint32_t index) const {
-  const auto* attr = FindAttribute(name, index);
-  if (attr && attr->value.type == SCS_VALUE_TYPE_u64) {
-    return attr->value.value_u64.value;
-  }
-  return std::nullopt;
-}
+std::optional<bool> ConfigAttributeReader::GetBool(const char* name, uint32_t index) const { return Get<bool>(name, index); }
 
-std::optional<float> ConfigAttributeReader::GetFloat(const char* name, uint32_t index) const {
-  const auto* attr = FindAttribute(name, index);
-  if (attr && attr->value.type == SCS_VALUE_TYPE_float) {
-    return attr->value.value_float.value;
-  }
-  return std::nullopt;
-}
+std::optional<int32_t> ConfigAttributeReader::GetS32(const char* name, uint32_t index) const { return Get<int32_t>(name, index); }
 
-std::optional<std::string> ConfigAttributeReader::GetString(const char* name, uint32_t index) const {
-  const auto* attr = FindAttribute(name, index);
-  if (attr && attr->value.type == SCS_VALUE_TYPE_string) {
-    return std::string(attr->value.value_string.value);
-  }
-  return std::nullopt;
-}
+std::optional<uint32_t> ConfigAttributeReader::GetU32(const char* name, uint32_t index) const { return Get<uint32_t>(name, index); }
 
-std::optional<scs_value_fvector_t> ConfigAttributeReader::GetFVector(const char* name, uint32_t index) const {
-  const auto* attr = FindAttribute(name, index);
-  if (attr && attr->value.type == SCS_VALUE_TYPE_fvector) {
-    return attr->value.value_fvector;
-  }
-  return std::nullopt;
-}
+std::optional<int64_t> ConfigAttributeReader::GetS64(const char* name, uint32_t index) const { return Get<int64_t>(name, index); }
+
+std::optional<uint64_t> ConfigAttributeReader::GetU64(const char* name, uint32_t index) const { return Get<uint64_t>(name, index); }
+
+std::optional<float> ConfigAttributeReader::GetFloat(const char* name, uint32_t index) const { return Get<float>(name, index); }
+
+std::optional<std::string> ConfigAttributeReader::GetString(const char* name, uint32_t index) const { return Get<std::string>(name, index); }
+
+std::optional<scs_value_fvector_t> ConfigAttributeReader::GetFVector(const char* name, uint32_t index) const { return Get<scs_value_fvector_t>(name, index); }
 
 std::vector<float> ConfigAttributeReader::GetFloatArray(const char* name, uint32_t count) const {
   std::vector<float> result;
@@ -120,5 +112,11 @@ std::vector<scs_value_fvector_t> ConfigAttributeReader::GetFVectorArray(const ch
   return result;
 }
 
+void ConfigAttributeReader::Read(std::span<const AttributeBinding> bindings) const {
+  for (const auto& binding : bindings) {
+    binding.read(*this, binding.name, binding.target);
+  }
+}
+
 }  // namespace Telemetry
 SPF_NS_END
\ No newline at end of file
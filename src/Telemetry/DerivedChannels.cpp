@@ -0,0 +1,309 @@
+#include "SPF/Telemetry/DerivedChannels.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+SPF_NS_BEGIN
+namespace Telemetry {
+namespace {
+constexpr float kGravity = 9.80665f;
+constexpr float kTwoPi = 6.28318530718f;
+
+void Set(float& target, float value, Field field, FieldMask& changes) {
+  if (target != value) {
+    target = value;
+    MarkChanged(changes, field);
+  }
+}
+
+// --- Built-in Channels ---
+
+class GForceChannel final : public DerivedChannel {
+ public:
+  GForceChannel() : DerivedChannel("g_force", MakeInputMask(DerivedInput::LinearAcceleration)) {}
+
+  void Evaluate(const DerivedFrame& frame, DerivedData& out, FieldMask& changes) override {
+    // The truck's local frame has +x to the right, +y up and -z forward.
+    const auto& a = frame.truck.local_linear_acceleration;
+    Set(out.longitudinal_g, -a.z / kGravity, Field::DerivedLongitudinalG, changes);
+    Set(out.lateral_g, a.x / kGravity, Field::DerivedLateralG, changes);
+    Set(out.vertical_g, a.y / kGravity, Field::DerivedVerticalG, changes);
+  }
+};
+
+class JerkChannel final : public DerivedChannel {
+ public:
+  JerkChannel() : DerivedChannel("jerk", MakeInputMask(DerivedInput::LinearAcceleration, DerivedInput::SimulationTime)) {}
+
+  void Evaluate(const DerivedFrame& frame, DerivedData& out, FieldMask& changes) override {
+    const auto& a = frame.truck.local_linear_acceleration;
+    if (frame.simulationDeltaUs > 0) {
+      const float dx = a.x - m_previous.x;
+      const float dy = a.y - m_previous.y;
+      const float dz = a.z - m_previous.z;
+      const float dt = static_cast<float>(frame.simulationDeltaUs) * 1e-6f;
+      Set(out.jerk, std::sqrt(dx * dx + dy * dy + dz * dz) / dt, Field::DerivedJerk, changes);
+    }
+    m_previous = a;
+  }
+
+ private:
+  scs_value_fvector_t m_previous = {};
+};
+
+class WheelSlipChannel final : public DerivedChannel {
+ public:
+  WheelSlipChannel() : DerivedChannel("wheel_slip", MakeInputMask(DerivedInput::Speed, DerivedInput::Wheels, DerivedInput::WheelConstants)) {}
+
+  void Evaluate(const DerivedFrame& frame, DerivedData& out, FieldMask& changes) override {
+    const float speed = frame.truck.speed;
+    const float invReference = 1.0f / std::max(std::fabs(speed), 1.0f);
+    const uint32_t count = frame.wheelCount;
+
+    // Plain loops over contiguous arrays; the compiler vectorizes both.
+    float maxSlip = 0.0f;
+    for (uint32_t i = 0; i < count; ++i) {
+      const float surfaceSpeed = frame.wheelAngularVelocity[i] * kTwoPi * frame.wheelRadius[i];
+      out.wheel_slip[i] = frame.wheelRadius[i] > 0.0f ? (surfaceSpeed - speed) * invReference : 0.0f;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+      maxSlip = std::max(maxSlip, std::fabs(out.wheel_slip[i]) * frame.wheelOnGround[i]);
+    }
+    std::fill(out.wheel_slip.begin() + count, out.wheel_slip.end(), 0.0f);
+    out.wheel_count = count;
+    Set(out.max_wheel_slip, maxSlip, Field::DerivedMaxWheelSlip, changes);
+  }
+};
+
+class FuelEconomyChannel final : public DerivedChannel {
+ public:
+  FuelEconomyChannel() : DerivedChannel("fuel_economy", MakeInputMask(DerivedInput::FuelAmount, DerivedInput::Odometer)) {}
+
+  void Evaluate(const DerivedFrame& frame, DerivedData& out, FieldMask& changes) override {
+    const float fuel = frame.truck.fuel_amount;
+    const float odometer = frame.truck.odometer;
+    if (!m_initialized) {
+      m_initialized = true;
+      m_lastFuel = fuel;
+      m_lastOdometer = odometer;
+      return;
+    }
+
+    const float used = std::max(m_lastFuel - fuel, 0.0f);  // Refuelling is not consumption
+    const float driven = odometer - m_lastOdometer;
+    m_lastFuel = fuel;
+    m_lastOdometer = odometer;
+
+    if (driven < 0.0f || driven > kMaxFrameDistanceKm) {
+      // A different truck or a teleport (ferry, train, job quick travel) starts a new trip.
+      m_windowFuel = m_windowDistance = 0.0f;
+      out.trip_distance = out.trip_fuel_used = 0.0f;
+      Set(out.fuel_economy, 0.0f, Field::DerivedFuelEconomy, changes);
+      Set(out.trip_fuel_economy, 0.0f, Field::DerivedTripFuelEconomy, changes);
+      return;
+    }
+
+    m_windowFuel += used;
+    m_windowDistance += driven;
+    if (m_windowDistance >= kWindowDistanceKm) {
+      Set(out.fuel_economy, m_windowFuel / m_windowDistance * 100.0f, Field::DerivedFuelEconomy, changes);
+      m_windowFuel = m_windowDistance = 0.0f;
+    }
+
+    out.trip_fuel_used += used;
+    out.trip_distance += driven;
+    if (out.trip_distance >= kWindowDistanceKm) {
+      Set(out.trip_fuel_economy, out.trip_fuel_used / out.trip_distance * 100.0f, Field::DerivedTripFuelEconomy, changes);
+    }
+  }
+
+ private:
+  static constexpr float kWindowDistanceKm = 0.1f;
+  static constexpr float kMaxFrameDistanceKm = 1.0f;
+
+  bool m_initialized = false;
+  float m_lastFuel = 0.0f;
+  float m_lastOdometer = 0.0f;
+  float m_windowFuel = 0.0f;
+  float m_windowDistance = 0.0f;
+};
+
+class FuelRateChannel final : public DerivedChannel {
+ public:
+  FuelRateChannel() : DerivedChannel("fuel_rate", MakeInputMask(DerivedInput::FuelAmount, DerivedInput::SimulationTime)) {}
+
+  void Evaluate(const DerivedFrame& frame, DerivedData& out, FieldMask& changes) override {
+    const float fuel = frame.truck.fuel_amount;
+    if (!m_initialized) {
+      m_initialized = true;
+      m_lastFuel = fuel;
+      return;
+    }
+
+    m_windowFuel += std::max(m_lastFuel - fuel, 0.0f);
+    m_windowUs += frame.simulationDeltaUs;
+    m_lastFuel = fuel;
+
+    if (m_windowUs >= kWindowUs) {
+      const float hours = static_cast<float>(m_windowUs) / 3.6e9f;
+      Set(out.fuel_rate, m_windowFuel / hours, Field::DerivedFuelRate, changes);
+      m_windowFuel = 0.0f;
+      m_windowUs = 0;
+    }
+    Set(out.time_to_empty, out.fuel_rate > 0.0f ? fuel / out.fuel_rate * 3600.0f : 0.0f, Field::DerivedTimeToEmpty, changes);
+  }
+
+ private:
+  static constexpr uint64_t kWindowUs = 1000000;
+
+  bool m_initialized = false;
+  float m_lastFuel = 0.0f;
+  float m_windowFuel = 0.0f;
+  uint64_t m_windowUs = 0;
+};
+
+class AxleSuspensionChannel final : public DerivedChannel {
+ public:
+  AxleSuspensionChannel() : DerivedChannel("axle_suspension", MakeInputMask(DerivedInput::Wheels, DerivedInput::WheelConstants)) {}
+
+  void Evaluate(const DerivedFrame& frame, DerivedData& out, FieldMask&) override {
+    const uint32_t count = frame.wheelCount;
+    if (count != m_wheelCount || !std::equal(frame.wheelPositionZ, frame.wheelPositionZ + count, m_positionZ.begin())) {
+      RebuildAxles(frame);
+    }
+
+    std::array<float, DerivedWheelMaxCount> sums = {};
+    for (uint32_t i = 0; i < count; ++i) {
+      sums[m_axleOfWheel[i]] += frame.wheelSuspension[i];
+    }
+    for (uint32_t axle = 0; axle < m_axleCount; ++axle) {
+      out.axle_suspension_deflection[axle] = sums[axle] * m_inverseWheelsPerAxle[axle];
+    }
+    std::fill(out.axle_suspension_deflection.begin() + m_axleCount, out.axle_suspension_deflection.end(), 0.0f);
+    out.axle_count = m_axleCount;
+  }
+
+ private:
+  // Wheels whose positions differ by less than this along the truck belong to one axle.
+  static constexpr float kAxleTolerance = 0.05f;
+
+  void RebuildAxles(const DerivedFrame& frame) {
+    m_wheelCount = frame.wheelCount;
+    std::copy_n(frame.wheelPositionZ, m_wheelCount, m_positionZ.begin());
+
+    // Axle positions sorted front (most negative z) to back.
+    std::array<float, DerivedWheelMaxCount> axleZ = {};
+    m_axleCount = 0;
+    std::array<float, DerivedWheelMaxCount> sorted = m_positionZ;
+    std::sort(sorted.begin(), sorted.begin() + m_wheelCount);
+    for (uint32_t i = 0; i < m_wheelCount; ++i) {
+      if (m_axleCount == 0 || sorted[i] - axleZ[m_axleCount - 1] > kAxleTolerance) {
+        axleZ[m_axleCount++] = sorted[i];
+      }
+    }
+
+    std::array<uint32_t, DerivedWheelMaxCount> wheelsPerAxle = {};
+    for (uint32_t i = 0; i < m_wheelCount; ++i) {
+      uint32_t axle = 0;
+      while (axle + 1 < m_axleCount && m_positionZ[i] - axleZ[axle] > kAxleTolerance) ++axle;
+      m_axleOfWheel[i] = axle;
+      ++wheelsPerAxle[axle];
+    }
+    for (uint32_t axle = 0; axle < m_axleCount; ++axle) {
+      m_inverseWheelsPerAxle[axle] = 1.0f / static_cast<float>(wheelsPerAxle[axle]);
+    }
+  }
+
+  uint32_t m_wheelCount = 0;
+  uint32_t m_axleCount = 0;
+  std::array<float, DerivedWheelMaxCount> m_positionZ = {};
+  std::array<uint32_t, DerivedWheelMaxCount> m_axleOfWheel = {};
+  std::array<float, DerivedWheelMaxCount> m_inverseWheelsPerAxle = {};
+};
+
+template <typename T>
+bool Assign(T& target, T value) {
+  if (target == value) return false;
+  target = value;
+  return true;
+}
+}  // namespace
+
+// --- DerivedChannelRegistry ---
+
+DerivedChannelRegistry::DerivedChannelRegistry() {
+  Register(std::make_unique<GForceChannel>());
+  Register(std::make_unique<JerkChannel>());
+  Register(std::make_unique<WheelSlipChannel>());
+  Register(std::make_unique<FuelEconomyChannel>());
+  Register(std::make_unique<FuelRateChannel>());
+  Register(std::make_unique<AxleSuspensionChannel>());
+}
+
+void DerivedChannelRegistry::Register(std::unique_ptr<DerivedChannel> channel) { m_channels.push_back(std::move(channel)); }
+
+void DerivedChannelRegistry::GatherWheels(const SCS::TruckConstants& constants, const SCS::TruckData& truck, DerivedInputMask& changed) {
+  const auto& wheels = truck.wheels;
+  const auto count = static_cast<uint32_t>(std::min({wheels.size(), constants.wheels.size(), DerivedWheelMaxCount}));
+  bool constantsChanged = Assign(m_wheelCount, count);
+
+  // The per-wheel data is already stored as contiguous arrays; only compare and keep a copy.
+  bool wheelsChanged = !std::equal(wheels.angular_velocity.begin(), wheels.angular_velocity.begin() + count, m_previousAngularVelocity.begin()) ||
+                       !std::equal(wheels.suspension_deflection.begin(), wheels.suspension_deflection.begin() + count, m_previousSuspension.begin());
+  if (wheelsChanged || constantsChanged) {
+    std::copy_n(wheels.angular_velocity.begin(), count, m_previousAngularVelocity.begin());
+    std::copy_n(wheels.suspension_deflection.begin(), count, m_previousSuspension.begin());
+  }
+  for (uint32_t i = 0; i < count; ++i) {
+    wheelsChanged |= Assign(m_wheelOnGround[i], wheels.on_ground.test(i) ? 1.0f : 0.0f);
+  }
+
+  for (uint32_t i = 0; i < count; ++i) {
+    const auto& consts = constants.wheels[i];
+    constantsChanged |= Assign(m_wheelRadius[i], consts.simulated ? consts.radius : 0.0f);
+    constantsChanged |= Assign(m_wheelPositionZ[i], consts.position.z);
+  }
+
+  changed.set(static_cast<size_t>(DerivedInput::Wheels), wheelsChanged || constantsChanged);
+  changed.set(static_cast<size_t>(DerivedInput::WheelConstants), constantsChanged);
+}
+
+void DerivedChannelRegistry::Evaluate(const SCS::TruckConstants& constants, const SCS::TruckData& truck, const SCS::Timestamps& timestamps, FieldMask& changes) {
+  DerivedInputMask changed;
+  GatherWheels(constants, truck, changed);
+
+  const auto& acceleration = truck.local_linear_acceleration;
+  const bool accelerationChanged = !m_hasPrevious || acceleration.x != m_previousAcceleration.x || acceleration.y != m_previousAcceleration.y ||
+                                   acceleration.z != m_previousAcceleration.z;
+  const uint64_t simulationDeltaUs = (m_hasPrevious && timestamps.simulation > m_previousSimulationUs) ? timestamps.simulation - m_previousSimulationUs : 0;
+
+  changed.set(static_cast<size_t>(DerivedInput::LinearAcceleration), accelerationChanged);
+  changed.set(static_cast<size_t>(DerivedInput::Speed), !m_hasPrevious || changes.test(static_cast<size_t>(Field::TruckSpeed)));
+  changed.set(static_cast<size_t>(DerivedInput::FuelAmount), !m_hasPrevious || changes.test(static_cast<size_t>(Field::TruckFuelAmount)));
+  changed.set(static_cast<size_t>(DerivedInput::Odometer), !m_hasPrevious || changes.test(static_cast<size_t>(Field::TruckOdometer)));
+  changed.set(static_cast<size_t>(DerivedInput::SimulationTime), simulationDeltaUs > 0);
+
+  m_hasPrevious = true;
+  m_previousAcceleration = acceleration;
+  m_previousSimulationUs = timestamps.simulation;
+  if (changed.none()) return;
+
+  const DerivedFrame frame{constants,
+                           truck,
+                           timestamps,
+                           simulationDeltaUs,
+                           m_wheelCount,
+                           truck.wheels.angular_velocity.data(),
+                           truck.wheels.suspension_deflection.data(),
+                           m_wheelOnGround.data(),
+                           m_wheelRadius.data(),
+                           m_wheelPositionZ.data()};
+
+  for (const auto& channel : m_channels) {
+    if ((channel->GetInputs() & changed).any()) {
+      channel->Evaluate(frame, m_data, changes);
+    }
+  }
+}
+}  // namespace Telemetry
+SPF_NS_END
@@ -25,15 +25,16 @@ void EventsProcessor::HandleFrameStart() {
   memset(&m_specialEvents, 0, sizeof(m_specialEvents));
 }
 
-void EventsProcessor::HandleGameplayEvent(const scs_telemetry_gameplay_event_t* info) {
+void EventsProcessor::HandleGameplayEvent(const scs_telemetry_gameplay_event_t* info, const SCS::Timestamps& timestamps, uint32_t gameTime) {
   if (!info || !info->id) return;
 
   m_lastGameplayEventId = info->id;
   ConfigAttributeReader reader(info->attributes);
+  SCS::SpecialEvents raised;
 
   if (strcmp(info->id, SCS_TELEMETRY_GAMEPLAY_EVENT_job_delivered) == 0) {
     m_logger.Info("[Event] Job Delivered");
-    m_specialEvents.job_delivered = true;
+    raised.job_delivered = true;
 
     auto& data = m_gameplayEvents.job_delivered;
     data.revenue = reader.GetS64(SCS_TELEMETRY_GAMEPLAY_EVENT_ATTRIBUTE_revenue).value_or(0);
@@ -45,26 +46,26 @@ void EventsProcessor::HandleGameplayEvent(const scs_telemetry_gameplay_event_t*
     data.auto_load_used = reader.GetBool(SCS_TELEMETRY_GAMEPLAY_EVENT_ATTRIBUTE_auto_load_used).value_or(false);
   } else if (strcmp(info->id, SCS_TELEMETRY_GAMEPLAY_EVENT_job_cancelled) == 0) {
     m_logger.Info("[Event] Job Cancelled");
-    m_specialEvents.job_cancelled = true;
+    raised.job_cancelled = true;
 
     auto& data = m_gameplayEvents.job_cancelled;
     data.penalty = reader.GetS64(SCS_TELEMETRY_GAMEPLAY_EVENT_ATTRIBUTE_cancel_penalty).value_or(0);
   } else if (strcmp(info->id, SCS_TELEMETRY_GAMEPLAY_EVENT_player_fined) == 0) {
     m_logger.Info("[Event] Player Fined");
-    m_specialEvents.fined = true;
+    raised.fined = true;
 
     auto& data = m_gameplayEvents.player_fined;
     data.fine_amount = reader.GetS64(SCS_TELEMETRY_GAMEPLAY_EVENT_ATTRIBUTE_fine_amount).value_or(0);
     data.fine_offence = reader.GetString(SCS_TELEMETRY_GAMEPLAY_EVENT_ATTRIBUTE_fine_offence).value_or("");
   } else if (strcmp(info->id, SCS_TELEMETRY_GAMEPLAY_EVENT_player_tollgate_paid) == 0) {
     m_logger.Info("[Event] Tollgate Paid");
-    m_specialEvents.tollgate = true;
+    raised.tollgate = true;
 
     auto& data = m_gameplayEvents.tollgate_paid;
     data.pay_amount = reader.GetS64(SCS_TELEMETRY_GAMEPLAY_EVENT_ATTRIBUTE_pay_amount).value_or(0);
   } else if (strcmp(info->id, SCS_TELEMETRY_GAMEPLAY_EVENT_player_use_ferry) == 0) {
     m_logger.Info("[Event] Ferry Used");
-    m_specialEvents.ferry = true;
+    raised.ferry = true;
 
     auto& data = m_gameplayEvents.ferry_used;
     data.pay_amount = reader.GetS64(SCS_TELEMETRY_GAMEPLAY_EVENT_ATTRIBUTE_pay_amount).value_or(0);
@@ -74,7 +75,7 @@ void EventsProcessor::HandleGameplayEvent(const scs_telemetry_gameplay_event_t*
     data.target_id = reader.GetString(SCS_TELEMETRY_GAMEPLAY_EVENT_ATTRIBUTE_target_id).value_or("");
   } else if (strcmp(info->id, SCS_TELEMETRY_GAMEPLAY_EVENT_player_use_train) == 0) {
     m_logger.Info("[Event] Train Used");
-    m_specialEvents.train = true;
+    raised.train = true;
 
     auto& data = m_gameplayEvents.train_used;
     data.pay_amount = reader.GetS64(SCS_TELEMETRY_GAMEPLAY_EVENT_ATTRIBUTE_pay_amount).value_or(0);
@@ -84,6 +85,15 @@ void EventsProcessor::HandleGameplayEvent(const scs_telemetry_gameplay_event_t*
     data.target_id = reader.GetString(SCS_TELEMETRY_GAMEPLAY_EVENT_ATTRIBUTE_target_id).value_or("");
   }
 
+  // Flags raised earlier in the same frame stay set until the next frame starts.
+  m_specialEvents.job_cancelled |= raised.job_cancelled;
+  m_specialEvents.job_delivered |= raised.job_delivered;
+  m_specialEvents.fined |= raised.fined;
+  m_specialEvents.tollgate |= raised.tollgate;
+  m_specialEvents.ferry |= raised.ferry;
+  m_specialEvents.train |= raised.train;
+
+  m_history.Record(*info, raised, timestamps, gameTime);
 }
 
 }  // namespace Telemetry
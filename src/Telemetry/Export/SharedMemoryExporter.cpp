@@ -0,0 +1,84 @@
+#include "SPF/Telemetry/Export/SharedMemoryExporter.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "SPF/Modules/ITelemetryService.hpp"
+#include "SPF/Telemetry/CDataConversion.hpp"
+#include "SPF/Telemetry/Export/TelemetryShmProtocol.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry::Export {
+using namespace Conversion;
+
+SharedMemoryExporter::~SharedMemoryExporter() { Stop(); }
+
+bool SharedMemoryExporter::Start(const std::string& name) {
+  Stop();
+
+  if (!m_memory.Create(name, sizeof(SPF_TelemetryShmRegion))) {
+    m_lastError = "Could not create shared memory '" + name + "'";
+    return false;
+  }
+  if (!m_frameSemaphore.Create(name + ".frame")) {
+    m_lastError = "Could not create frame semaphore '" + name + ".frame'";
+    m_memory.Close();
+    return false;
+  }
+
+  m_staging = std::make_unique<SPF_TelemetryShmFrame>();
+  std::memset(m_staging.get(), 0, sizeof(SPF_TelemetryShmFrame));
+  m_region = reinterpret_cast<SPF_TelemetryShmRegion*>(m_memory.Data());
+  InitializeRegion(*m_region);
+  m_framesPublished = 0;
+  return true;
+}
+
+void SharedMemoryExporter::Stop() {
+  if (m_region) {
+    WriterActive(m_region->header).store(0, std::memory_order_release);
+    // Release readers blocked on the semaphore so they can notice the writer is gone.
+    m_frameSemaphore.Post(Waiters(m_region->header).load(std::memory_order_acquire));
+  }
+  m_region = nullptr;
+  m_frameSemaphore.Close();
+  m_memory.Close();
+  m_staging.reset();
+}
+
+void SharedMemoryExporter::Publish(const Modules::ITelemetryService& telemetry) {
+  if (!m_region) return;
+
+  auto& frame = *m_staging;
+  frame.frame_id = ++m_framesPublished;
+
+  ConvertGameState(telemetry.GetGameState(), frame.game_state);
+  ConvertTimestamps(telemetry.GetTimestamps(), frame.timestamps);
+  ConvertCommonData(telemetry.GetCommonData(), frame.common_data);
+  ConvertTruckConstants(telemetry.GetTruckConstants(), frame.truck_constants);
+  ConvertTruckData(telemetry.GetTruckData(), telemetry.GetTruckConstants(), frame.truck_data);
+
+  const auto& trailers = telemetry.GetTrailers();
+  frame.trailer_count = static_cast<uint32_t>(std::min<size_t>(trailers.size(), SPF_TELEMETRY_TRAILER_MAX_COUNT));
+  for (uint32_t i = 0; i < frame.trailer_count; ++i) {
+    ConvertTrailer(trailers[i], frame.trailers[i]);
+  }
+
+  ConvertJobConstants(telemetry.GetJobConstants(), frame.job_constants);
+  ConvertJobData(telemetry.GetJobData(), frame.job_data);
+  ConvertNavigationData(telemetry.GetNavigationData(), frame.navigation_data);
+  ConvertControls(telemetry.GetControls(), frame.controls);
+  ConvertSpecialEvents(telemetry.GetSpecialEvents(), frame.special_events);
+  ConvertGameplayEvents(telemetry.GetGameplayEvents(), frame.gameplay_events);
+  ConvertGearboxConstants(telemetry.GetGearboxConstants(), frame.gearbox_constants);
+
+  const auto& eventId = telemetry.GetLastGameplayEventId();
+  const size_t idLength = std::min(eventId.size(), sizeof(frame.last_gameplay_event_id) - 1);
+  std::memcpy(frame.last_gameplay_event_id, eventId.data(), idLength);
+  frame.last_gameplay_event_id[idLength] = '\0';
+
+  frame.frame_id_end = frame.frame_id;
+  PublishFrame(*m_region, frame, m_frameSemaphore);
+}
+}  // namespace Telemetry::Export
+SPF_NS_END
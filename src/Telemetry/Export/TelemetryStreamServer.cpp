@@ -0,0 +1,248 @@
+#include "SPF/Telemetry/Export/TelemetryStreamServer.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#include "SPF/Telemetry/Export/TelemetryStreamProtocol.hpp"
+#include "SPF/Telemetry/TelemetrySnapshot.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry::Export {
+namespace {
+// How long the server thread sleeps without frames before it checks for requests again.
+constexpr auto IdleWait = std::chrono::milliseconds(10);
+constexpr auto ClientTimeout = std::chrono::milliseconds(SPF_TELEMETRY_STREAM_CLIENT_TIMEOUT_MS);
+}  // namespace
+
+TelemetryStreamServer::~TelemetryStreamServer() { Stop(); }
+
+bool TelemetryStreamServer::Start(const std::string& address, uint16_t port, uint32_t keyframeInterval) {
+  Stop();
+  if (!m_socket.Open(address, port)) {
+    m_lastError = m_socket.GetLastError();
+    return false;
+  }
+
+  m_keyframeInterval = std::clamp<uint32_t>(keyframeInterval, 1, UINT16_MAX);
+  {
+    std::lock_guard lock(m_mutex);
+    m_stopping = false;
+    m_queueHead = 0;
+    m_queueCount = 0;
+    m_framesQueued = 0;
+    m_framesDropped = 0;
+  }
+  m_packetsSent.store(0, std::memory_order_relaxed);
+  m_bytesSent.store(0, std::memory_order_relaxed);
+  m_thread = std::thread(&TelemetryStreamServer::Run, this);
+  return true;
+}
+
+void TelemetryStreamServer::Stop() {
+  if (m_thread.joinable()) {
+    {
+      std::lock_guard lock(m_mutex);
+      m_stopping = true;
+    }
+    m_wake.notify_one();
+    m_thread.join();
+  }
+  m_socket.Close();
+  m_clients.clear();
+  UpdateSelection();
+}
+
+void TelemetryStreamServer::Publish(const TelemetrySnapshot& snapshot) {
+  if (m_clientCount.load(std::memory_order_acquire) == 0) return;
+  const auto publishTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now().time_since_epoch()).count();
+
+  {
+    std::lock_guard lock(m_mutex);
+    if (m_queueCount == QueueCapacity) {
+      m_queueHead = (m_queueHead + 1) % QueueCapacity;
+      --m_queueCount;
+      ++m_framesDropped;
+    }
+
+    auto& frame = m_queue[(m_queueHead + m_queueCount) % QueueCapacity];
+    frame.frameId = snapshot.frameId;
+    frame.renderTime = snapshot.timestamps.render;
+    frame.publishTime = static_cast<uint64_t>(publishTime);
+    for (size_t i = 0; i < FieldCount; ++i) {
+      if (m_selectedFields.test(i)) frame.values[i] = static_cast<float>(ReadFieldValue(snapshot, static_cast<Field>(i)));
+    }
+    ++m_queueCount;
+    ++m_framesQueued;
+  }
+  m_wake.notify_one();
+}
+
+FieldMask TelemetryStreamServer::GetSelectedFields() const {
+  std::lock_guard lock(m_mutex);
+  return m_selectedFields;
+}
+
+StreamStats TelemetryStreamServer::GetStats() const {
+  StreamStats stats;
+  stats.clients = m_clientCount.load(std::memory_order_relaxed);
+  stats.packetsSent = m_packetsSent.load(std::memory_order_relaxed);
+  stats.bytesSent = m_bytesSent.load(std::memory_order_relaxed);
+  std::lock_guard lock(m_mutex);
+  stats.framesQueued = m_framesQueued;
+  stats.framesDropped = m_framesDropped;
+  return stats;
+}
+
+void TelemetryStreamServer::Run() {
+  std::vector<QueuedFrame> frames;
+  frames.reserve(QueueCapacity);
+
+  while (true) {
+    {
+      std::unique_lock lock(m_mutex);
+      m_wake.wait_for(lock, IdleWait, [this] { return m_stopping || m_queueCount > 0; });
+      if (m_stopping) return;
+
+      frames.clear();
+      for (; m_queueCount > 0; --m_queueCount) {
+        frames.push_back(m_queue[m_queueHead]);
+        m_queueHead = (m_queueHead + 1) % QueueCapacity;
+      }
+    }
+
+    ReceiveRequests();
+    DropExpiredClients();
+    for (const auto& frame : frames) {
+      for (auto& client : m_clients) SendFrame(client, frame);
+    }
+  }
+}
+
+// --- Client requests ---
+
+void TelemetryStreamServer::ReceiveRequests() {
+  Utils::UdpEndpoint from;
+  while (const size_t size = m_socket.ReceiveFrom(m_receiveBuffer.data(), m_receiveBuffer.size(), from, 0)) {
+    switch (ReadPacketType(m_receiveBuffer.data(), size)) {
+      case SPF_TELEMETRY_STREAM_PACKET_SUBSCRIBE:
+        HandleSubscribe(from, m_receiveBuffer.data(), size);
+        break;
+      case SPF_TELEMETRY_STREAM_PACKET_UNSUBSCRIBE:
+        DropClient(from);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+void TelemetryStreamServer::HandleSubscribe(const Utils::UdpEndpoint& from, const uint8_t* data, size_t size) {
+  Recording::Reader reader(data, size, sizeof(SPF_TelemetryStreamHeader));
+  uint16_t flags = 0;
+  uint16_t count = 0;
+  reader.ReadBytes(&flags, sizeof(flags));
+  reader.ReadBytes(&count, sizeof(count));
+  if (reader.Failed() || count > SPF_TELEMETRY_STREAM_MAX_FIELDS) return;
+
+  // Unknown and repeated fields are dropped; the schema tells the client what was accepted.
+  std::vector<uint16_t> fields;
+  FieldMask seen;
+  for (uint16_t i = 0; i < count; ++i) {
+    uint16_t field = 0;
+    reader.ReadBytes(&field, sizeof(field));
+    if (field >= FieldCount || seen.test(field)) continue;
+    seen.set(field);
+    fields.push_back(field);
+  }
+  if (reader.Failed()) return;
+
+  auto it = std::find_if(m_clients.begin(), m_clients.end(), [&](const Client& client) { return client.endpoint == from; });
+  const bool added = it == m_clients.end();
+  if (added) {
+    if (m_clients.size() >= MaxClients) return;
+    it = m_clients.emplace(m_clients.end());
+    it->endpoint = from;
+  }
+
+  Client& client = *it;
+  client.lastSeen = Clock::now();
+  if (flags & SPF_TELEMETRY_STREAM_SUBSCRIBE_RESYNC) client.needsKeyframe = true;
+  if (!added && fields == client.fields) return;
+
+  client.fields = std::move(fields);
+  client.sent.assign(client.fields.size(), 0);
+  client.schemaId = m_nextSchemaId++;
+  client.needsKeyframe = true;
+  SendSchema(client);
+  UpdateSelection();
+}
+
+void TelemetryStreamServer::DropClient(const Utils::UdpEndpoint& from) {
+  if (std::erase_if(m_clients, [&](const Client& client) { return client.endpoint == from; }) > 0) UpdateSelection();
+}
+
+void TelemetryStreamServer::DropExpiredClients() {
+  const auto now = Clock::now();
+  if (std::erase_if(m_clients, [&](const Client& client) { return now - client.lastSeen > ClientTimeout; }) > 0) UpdateSelection();
+}
+
+void TelemetryStreamServer::UpdateSelection() {
+  FieldMask selected;
+  for (const auto& client : m_clients) {
+    for (const uint16_t field : client.fields) selected.set(field);
+  }
+
+  std::lock_guard lock(m_mutex);
+  m_selectedFields = selected;
+  m_clientCount.store(static_cast<uint32_t>(m_clients.size()), std::memory_order_release);
+  m_selectionRevision.fetch_add(1, std::memory_order_acq_rel);
+}
+
+// --- Sending ---
+
+void TelemetryStreamServer::SendSchema(const Client& client) {
+  BeginPacket(m_packet, SPF_TELEMETRY_STREAM_PACKET_SCHEMA);
+  AppendPod(m_packet, SPF_TelemetryStreamSchema{client.schemaId, static_cast<uint16_t>(FieldCount), static_cast<uint16_t>(m_keyframeInterval), static_cast<uint16_t>(client.fields.size())});
+  for (const uint16_t field : client.fields) AppendPod(m_packet, field);
+  Send(client.endpoint);
+}
+
+void TelemetryStreamServer::SendFrame(Client& client, const QueuedFrame& frame) {
+  const bool keyframe = client.needsKeyframe || client.framesSinceKeyframe + 1 >= m_keyframeInterval;
+
+  BeginPacket(m_packet, SPF_TELEMETRY_STREAM_PACKET_FRAME);
+  AppendPod(m_packet, SPF_TelemetryStreamFrame{client.schemaId, client.sequence++, frame.frameId, frame.renderTime, frame.publishTime,
+                                               static_cast<uint8_t>(keyframe ? SPF_TELEMETRY_STREAM_FRAME_KEYFRAME : 0)});
+
+  if (keyframe) {
+    for (size_t i = 0; i < client.fields.size(); ++i) {
+      const float value = frame.values[client.fields[i]];
+      AppendPod(m_packet, value);
+      client.sent[i] = std::bit_cast<uint32_t>(value);
+    }
+    client.needsKeyframe = false;
+    client.framesSinceKeyframe = 0;
+  } else {
+    // Changed-field bitmap, then the XOR deltas of the changed fields.
+    const size_t maskOffset = m_packet.size();
+    m_packet.resize(maskOffset + (client.fields.size() + 7) / 8, 0);
+    for (size_t i = 0; i < client.fields.size(); ++i) {
+      const uint32_t bits = std::bit_cast<uint32_t>(frame.values[client.fields[i]]);
+      const uint32_t delta = bits ^ client.sent[i];
+      if (delta == 0) continue;
+      m_packet[maskOffset + i / 8] |= static_cast<uint8_t>(1u << (i % 8));
+      Recording::WriteVarint(m_packet, delta);
+      client.sent[i] = bits;
+    }
+    ++client.framesSinceKeyframe;
+  }
+  Send(client.endpoint);
+}
+
+void TelemetryStreamServer::Send(const Utils::UdpEndpoint& to) {
+  if (!m_socket.SendTo(to, m_packet.data(), m_packet.size())) return;
+  m_packetsSent.fetch_add(1, std::memory_order_relaxed);
+  m_bytesSent.fetch_add(m_packet.size(), std::memory_order_relaxed);
+}
+}  // namespace Telemetry::Export
+SPF_NS_END
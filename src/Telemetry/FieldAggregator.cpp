@@ -0,0 +1,129 @@
+#include "SPF/Telemetry/FieldAggregator.hpp"
+
+#include <algorithm>
+
+#include "SPF/Telemetry/TelemetrySnapshot.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+// --- AggregateWindow ---
+
+AggregateWindow::AggregateWindow(uint64_t lengthUs) : m_lengthUs(lengthUs) {}
+
+void AggregateWindow::Acquire(Field field) {
+  auto& accumulator = m_accumulators[static_cast<size_t>(field)];
+  if (accumulator.refs++ == 0) {
+    accumulator = {1};
+    m_activeFields.push_back(field);
+  }
+}
+
+void AggregateWindow::Release(Field field) {
+  auto& accumulator = m_accumulators[static_cast<size_t>(field)];
+  if (accumulator.refs == 0 || --accumulator.refs > 0) return;
+  m_activeFields.erase(std::find(m_activeFields.begin(), m_activeFields.end(), field));
+}
+
+void AggregateWindow::Sample(const TelemetrySnapshot& snapshot, uint64_t nowUs) {
+  if (m_hasLastSample && nowUs < m_lastSampleUs) {
+    // The render clock restarted (e.g. a new game session); drop the partial window.
+    m_open = false;
+    m_hasLastSample = false;
+  }
+  if (m_open && nowUs >= m_windowStartUs + m_lengthUs) {
+    Close();
+  }
+  if (!m_open) {
+    m_windowStartUs = nowUs - nowUs % m_lengthUs;
+    for (const Field field : m_activeFields) {
+      auto& accumulator = m_accumulators[static_cast<size_t>(field)];
+      accumulator = {accumulator.refs};
+    }
+    m_open = true;
+  }
+
+  // Each sample stands for the render time elapsed since the previous frame.
+  const double weight = m_hasLastSample ? static_cast<double>(std::min(nowUs - m_lastSampleUs, m_lengthUs)) : 0.0;
+  m_lastSampleUs = nowUs;
+  m_hasLastSample = true;
+
+  for (const Field field : m_activeFields) {
+    const double value = ReadFieldValue(snapshot, field);
+    auto& accumulator = m_accumulators[static_cast<size_t>(field)];
+    if (accumulator.samples == 0) {
+      accumulator.min = value;
+      accumulator.max = value;
+    } else {
+      accumulator.min = std::min(accumulator.min, value);
+      accumulator.max = std::max(accumulator.max, value);
+    }
+    accumulator.weightedSum += value * weight;
+    accumulator.weight += weight;
+    accumulator.plainSum += value;
+    accumulator.last = value;
+    ++accumulator.samples;
+  }
+}
+
+void AggregateWindow::Close() {
+  bool hasSamples = false;
+  for (const Field field : m_activeFields) {
+    const auto& accumulator = m_accumulators[static_cast<size_t>(field)];
+    auto& stats = m_closed[static_cast<size_t>(field)];
+    stats.min = accumulator.min;
+    stats.max = accumulator.max;
+    stats.last = accumulator.last;
+    stats.samples = accumulator.samples;
+    if (accumulator.samples == 0) {
+      stats.mean = 0.0;
+    } else if (accumulator.weight > 0.0) {
+      stats.mean = accumulator.weightedSum / accumulator.weight;
+    } else {
+      stats.mean = accumulator.plainSum / accumulator.samples;
+    }
+    hasSamples |= accumulator.samples > 0;
+  }
+  m_closedStartUs = m_windowStartUs;
+  m_open = false;
+
+  if (hasSamples) {
+    m_closedSignal.Call(*this);
+  }
+}
+
+// --- FieldAggregator ---
+
+AggregateWindow& FieldAggregator::Acquire(uint32_t windowMs, std::span<const Field> fields) {
+  const uint64_t lengthUs = static_cast<uint64_t>(std::max<uint32_t>(windowMs, 1)) * 1000;
+
+  auto it = std::find_if(m_windows.begin(), m_windows.end(), [lengthUs](const auto& window) { return window->GetLength() == lengthUs; });
+  if (it == m_windows.end()) {
+    m_windows.push_back(std::make_unique<AggregateWindow>(lengthUs));
+    it = std::prev(m_windows.end());
+  }
+
+  for (const Field field : fields) {
+    (*it)->Acquire(field);
+  }
+  return **it;
+}
+
+void FieldAggregator::Release(AggregateWindow& window, std::span<const Field> fields) {
+  // Unused windows are only destroyed in Sample(), because a release may happen from
+  // inside a callback of the window's own closed signal.
+  for (const Field field : fields) {
+    window.Release(field);
+  }
+}
+
+void FieldAggregator::Sample(const TelemetrySnapshot& snapshot) {
+  std::erase_if(m_windows, [](const auto& window) { return window->IsUnused(); });
+
+  // Indexed, because subscribers may acquire new windows from a closed-signal callback.
+  const uint64_t nowUs = snapshot.timestamps.render;
+  for (size_t i = 0; i < m_windows.size(); ++i) {
+    m_windows[i]->Sample(snapshot, nowUs);
+  }
+}
+}  // namespace Telemetry
+SPF_NS_END
@@ -0,0 +1,312 @@
+#include "SPF/Telemetry/FieldHistory.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "SPF/Telemetry/TelemetrySnapshot.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+namespace {
+constexpr float Missing = std::numeric_limits<float>::quiet_NaN();
+}  // namespace
+
+// --- FieldHistory ---
+
+FieldHistory::FieldHistory() {
+  for (size_t tier = 0; tier < TierCount; ++tier) m_rings[tier].time.resize(Capacity[tier]);
+}
+
+void FieldHistory::Acquire(std::span<const Field> fields) {
+  std::lock_guard lock(m_mutex);
+  for (const Field field : fields) {
+    const size_t index = static_cast<size_t>(field);
+    if (m_refs[index]++ > 0) continue;
+
+    m_fields.push_back(field);
+    for (size_t tier = 0; tier < TierCount; ++tier) {
+      auto& ring = m_rings[tier];
+      auto& column = ring.columns[index];
+      column.value.assign(Capacity[tier], Missing);
+      if (tier != static_cast<size_t>(Tier::Raw)) {
+        column.min.assign(Capacity[tier], Missing);
+        column.max.assign(Capacity[tier], Missing);
+      }
+      ring.pending[index] = {};
+    }
+  }
+}
+
+void FieldHistory::Release(std::span<const Field> fields) {
+  std::lock_guard lock(m_mutex);
+  for (const Field field : fields) {
+    const size_t index = static_cast<size_t>(field);
+    if (m_refs[index] == 0 || --m_refs[index] > 0) continue;
+
+    std::erase(m_fields, field);
+    for (auto& ring : m_rings) ring.columns[index] = {};
+  }
+}
+
+bool FieldHistory::IsRecording(Field field) const {
+  std::lock_guard lock(m_mutex);
+  return m_refs[static_cast<size_t>(field)] > 0;
+}
+
+void FieldHistory::Sample(const TelemetrySnapshot& snapshot) {
+  std::lock_guard lock(m_mutex);
+  if (m_fields.empty()) return;
+
+  const uint64_t nowUs = snapshot.timestamps.render;
+  // The render clock restarted (e.g. a new game session); the old times no longer compare.
+  if (m_hasLastSample && nowUs < m_lastSampleUs) ClearLocked();
+  if (m_hasLastSample && nowUs == m_lastSampleUs) return;
+  m_lastSampleUs = nowUs;
+  m_hasLastSample = true;
+
+  const size_t slot = Append(Tier::Raw, nowUs);
+  auto& raw = GetRing(Tier::Raw);
+  for (const Field field : m_fields) {
+    const size_t index = static_cast<size_t>(field);
+    const float value = static_cast<float>(ReadFieldValue(snapshot, field));
+    raw.columns[index].value[slot] = value;
+    m_frame[index] = Accumulator{value, value, value, 1};
+  }
+  Feed(Tier::Seconds, nowUs, m_frame);
+}
+
+size_t FieldHistory::Append(Tier tier, uint64_t time) {
+  auto& ring = GetRing(tier);
+  const size_t capacity = Capacity[static_cast<size_t>(tier)];
+  const size_t slot = ring.head;
+  ring.time[slot] = time;
+  ring.head = (slot + 1) % capacity;
+  ring.count = std::min(ring.count + 1, capacity);
+  return slot;
+}
+
+void FieldHistory::Feed(Tier tier, uint64_t time, const std::array<Accumulator, FieldCount>& samples) {
+  auto& ring = GetRing(tier);
+  const uint64_t length = BucketLength[static_cast<size_t>(tier)];
+  if (ring.open && time >= ring.openStart + length) Close(tier);
+
+  if (!ring.open) {
+    ring.open = true;
+    ring.openStart = time - time % length;
+    for (const Field field : m_fields) ring.pending[static_cast<size_t>(field)] = samples[static_cast<size_t>(field)];
+    return;
+  }
+
+  for (const Field field : m_fields) {
+    const auto& sample = samples[static_cast<size_t>(field)];
+    if (sample.count == 0) continue;
+    auto& pending = ring.pending[static_cast<size_t>(field)];
+    if (pending.count == 0) {
+      pending = sample;
+      continue;
+    }
+    pending.min = std::min(pending.min, sample.min);
+    pending.max = std::max(pending.max, sample.max);
+    pending.sum += sample.sum;
+    pending.count += sample.count;
+  }
+}
+
+void FieldHistory::Close(Tier tier) {
+  auto& ring = GetRing(tier);
+  const size_t slot = Append(tier, ring.openStart);
+  for (const Field field : m_fields) {
+    const size_t index = static_cast<size_t>(field);
+    const auto& pending = ring.pending[index];
+    auto& column = ring.columns[index];
+    column.value[slot] = pending.count > 0 ? static_cast<float>(pending.sum / pending.count) : Missing;
+    column.min[slot] = pending.count > 0 ? pending.min : Missing;
+    column.max[slot] = pending.count > 0 ? pending.max : Missing;
+  }
+  ring.open = false;
+
+  const auto next = static_cast<size_t>(tier) + 1;
+  if (next < TierCount) Feed(static_cast<Tier>(next), ring.openStart, ring.pending);
+  for (const Field field : m_fields) ring.pending[static_cast<size_t>(field)] = {};
+}
+
+void FieldHistory::Clear() {
+  std::lock_guard lock(m_mutex);
+  ClearLocked();
+}
+
+void FieldHistory::ClearLocked() {
+  for (auto& ring : m_rings) {
+    ring.head = 0;
+    ring.count = 0;
+    ring.open = false;
+  }
+  m_hasLastSample = false;
+  m_lastSampleUs = 0;
+}
+
+uint64_t FieldHistory::GetLatestTime() const {
+  std::lock_guard lock(m_mutex);
+  return m_hasLastSample ? m_lastSampleUs : 0;
+}
+
+size_t FieldHistory::Query(Field field, uint64_t fromUs, uint64_t toUs, size_t maxPoints, std::vector<HistoryPoint>& out) const {
+  out.clear();
+  maxPoints = std::max<size_t>(maxPoints, 3);
+
+  std::lock_guard lock(m_mutex);
+  const size_t index = static_cast<size_t>(field);
+  if (m_refs[index] == 0 || toUs < fromUs) return 0;
+
+  // Logical position i (0 = oldest) of a ring to its slot.
+  auto slotOf = [](const Ring& ring, size_t tier, size_t i) { return (ring.head + Capacity[tier] - ring.count + i) % Capacity[tier]; };
+  // First logical position whose bucket ends after `time`.
+  auto firstAfter = [&](const Ring& ring, size_t tier, uint64_t time) {
+    size_t low = 0;
+    size_t high = ring.count;
+    while (low < high) {
+      const size_t mid = (low + high) / 2;
+      const uint64_t start = ring.time[slotOf(ring, tier, mid)];
+      const bool before = BucketLength[tier] == 0 ? start < time : start + BucketLength[tier] <= time;
+      if (before) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return low;
+  };
+  // First logical position whose bucket starts after `time`.
+  auto firstStartingAfter = [&](const Ring& ring, size_t tier, uint64_t time) {
+    size_t low = 0;
+    size_t high = ring.count;
+    while (low < high) {
+      const size_t mid = (low + high) / 2;
+      if (ring.time[slotOf(ring, tier, mid)] <= time) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return low;
+  };
+
+  // The finest tier that reaches back to `fromUs`, unless a coarser one that does still
+  // has a point per pixel; a range older than every tier falls back to the coarsest.
+  size_t chosen = TierCount;
+  size_t begin = 0;
+  size_t end = 0;
+  for (size_t tier = 0; tier < TierCount; ++tier) {
+    const auto& ring = m_rings[tier];
+    if (ring.count == 0) continue;
+    const bool wrapped = ring.count == Capacity[tier];
+    const bool reaches = !wrapped || ring.time[slotOf(ring, tier, 0)] <= fromUs;
+    if (!reaches && tier + 1 < TierCount) continue;
+
+    const size_t first = firstAfter(ring, tier, fromUs);
+    const size_t last = firstStartingAfter(ring, tier, toUs);
+    const size_t points = last > first ? last - first : 0;
+    if (chosen == TierCount || points >= maxPoints) {
+      chosen = tier;
+      begin = first;
+      end = last;
+    }
+  }
+  if (chosen == TierCount || end <= begin) return 0;
+
+  const auto& ring = m_rings[chosen];
+  const auto& column = ring.columns[index];
+  const bool raw = chosen == static_cast<size_t>(Tier::Raw);
+  out.reserve(end - begin);
+  for (size_t i = begin; i < end; ++i) {
+    const size_t slot = slotOf(ring, chosen, i);
+    const float value = column.value[slot];
+    if (std::isnan(value)) continue;
+    out.push_back(HistoryPoint{ring.time[slot], value, raw ? value : column.min[slot], raw ? value : column.max[slot]});
+  }
+
+  Decimate(out, maxPoints);
+  return out.size();
+}
+
+void FieldHistory::Decimate(std::vector<HistoryPoint>& points, size_t target) {
+  const size_t count = points.size();
+  if (count <= target || target < 3) return;
+
+  // Largest-Triangle-Three-Buckets: the first and last points are kept, the others are
+  // split into target - 2 buckets, and each bucket keeps the point forming the largest
+  // triangle with the previously kept point and the mean of the next bucket. Kept points
+  // are written over the front of the vector, which every bucket reads past.
+  const double every = static_cast<double>(count - 2) / static_cast<double>(target - 2);
+  const double origin = static_cast<double>(points.front().time);
+  auto timeOf = [&](const HistoryPoint& point) { return static_cast<double>(point.time) - origin; };
+  auto bucketStart = [&](size_t bucket) { return std::min(static_cast<size_t>(bucket * every) + 1, count - 1); };
+
+  HistoryPoint previous = points.front();
+  size_t written = 1;
+  for (size_t bucket = 0; bucket < target - 2; ++bucket) {
+    const size_t start = bucketStart(bucket);
+    const size_t end = std::max(bucketStart(bucket + 1), start + 1);
+    const size_t nextEnd = bucket + 3 < target ? std::max(bucketStart(bucket + 2), end + 1) : count;
+
+    double nextTime = 0.0;
+    double nextValue = 0.0;
+    for (size_t i = end; i < nextEnd; ++i) {
+      nextTime += timeOf(points[i]);
+      nextValue += points[i].value;
+    }
+    nextTime /= static_cast<double>(nextEnd - end);
+    nextValue /= static_cast<double>(nextEnd - end);
+
+    const double previousTime = timeOf(previous);
+    size_t best = start;
+    double bestArea = -1.0;
+    float min = points[start].min;
+    float max = points[start].max;
+    for (size_t i = start; i < end; ++i) {
+      const double area = std::abs((previousTime - nextTime) * (points[i].value - previous.value) - (previousTime - timeOf(points[i])) * (nextValue - previous.value));
+      if (area > bestArea) {
+        bestArea = area;
+        best = i;
+      }
+      min = std::min(min, points[i].min);
+      max = std::max(max, points[i].max);
+    }
+
+    previous = points[best];
+    previous.min = min;
+    previous.max = max;
+    points[written++] = previous;
+  }
+  points[written++] = points[count - 1];
+  points.resize(written);
+}
+
+// --- FieldHistoryLease ---
+
+FieldHistoryLease::FieldHistoryLease(std::shared_ptr<FieldHistory> history, std::vector<Field> fields, ChannelLease channels)
+    : m_history(std::move(history)), m_fields(std::move(fields)), m_channels(std::move(channels)) {
+  if (m_history) m_history->Acquire(m_fields);
+}
+
+FieldHistoryLease::~FieldHistoryLease() { Reset(); }
+
+FieldHistoryLease& FieldHistoryLease::operator=(FieldHistoryLease&& other) noexcept {
+  if (this != &other) {
+    Reset();
+    m_history = std::move(other.m_history);
+    m_fields = std::move(other.m_fields);
+    m_channels = std::move(other.m_channels);
+  }
+  return *this;
+}
+
+void FieldHistoryLease::Reset() {
+  if (m_history) m_history->Release(m_fields);
+  m_history.reset();
+  m_fields.clear();
+  m_channels.Reset();
+}
+}  // namespace Telemetry
+SPF_NS_END
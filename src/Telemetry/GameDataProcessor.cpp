@@ -66,24 +66,6 @@ void GameDataProcessor::HandleConfiguration(const scs_telemetry_configuration_t*
   }
 }
 
-void GameDataProcessor::HandleChannelUpdate(const scs_string_t name, const scs_u32_t, const scs_value_t* value) {
-  if (!value || !name) return;
-
-  if (strcmp(name, SCS_TELEMETRY_CHANNEL_game_time) == 0) {
-    m_commonData.game_time = value->value_u32.value;
-    RecalculateRestStopTime();
-  } else if (strcmp(name, SCS_TELEMETRY_CHANNEL_local_scale) == 0) {
-    m_gameState.scale = value->value_float.value;
-    RecalculateRealTimeDurations();
-  } else if (strcmp(name, SCS_TELEMETRY_CHANNEL_next_rest_stop) == 0) {
-    m_commonData.next_rest_stop = value->value_s32.value;
-    RecalculateRestStopTime();
-    RecalculateRealTimeDurations();
-  } else if (strcmp(name, SCS_TELEMETRY_CHANNEL_multiplayer_time_offset) == 0) {
-    m_gameState.multiplayer_time_offset = value->value_s32.value;
-  }
-}
-
 void GameDataProcessor::HandleFrameStart(const scs_telemetry_frame_start_t* const info) {
   if (!info) return;
   m_timestamps.simulation = info->simulation_time;
@@ -97,9 +79,15 @@ void GameDataProcessor::HandleFrameStart(const scs_telemetry_frame_start_t* cons
   }
 }
 
-void GameDataProcessor::HandlePaused() { m_gameState.paused = true; }
+void GameDataProcessor::HandlePaused() {
+  if (!m_gameState.paused) MarkChanged(m_changedFields, Field::GamePaused);
+  m_gameState.paused = true;
+}
 
-void GameDataProcessor::HandleStarted() { m_gameState.paused = false; }
+void GameDataProcessor::HandleStarted() {
+  if (m_gameState.paused) MarkChanged(m_changedFields, Field::GamePaused);
+  m_gameState.paused = false;
+}
 
 void GameDataProcessor::RecalculateRestStopTime() {
   if (m_commonData.next_rest_stop < 0) {
@@ -0,0 +1,62 @@
+#include "SPF/Telemetry/GameplayEventHistory.hpp"
+
+#include <algorithm>
+
+SPF_NS_BEGIN
+namespace Telemetry {
+const RecordedEventAttribute* RecordedEvent::FindAttribute(std::string_view name, uint32_t index) const {
+  for (const auto& attr : attributes) {
+    if (attr.index == index && attr.name == name) return &attr;
+  }
+  return nullptr;
+}
+
+GameplayEventHistory::GameplayEventHistory(size_t capacity) : m_slots(std::max<size_t>(capacity, 1)) {}
+
+void GameplayEventHistory::Record(const scs_telemetry_gameplay_event_t& info, const SCS::SpecialEvents& raised, const SCS::Timestamps& timestamps, uint32_t gameTime) {
+  std::lock_guard lock(m_mutex);
+  const uint64_t sequence = m_latest + 1;
+  auto& event = m_slots[(sequence - 1) % m_slots.size()];
+
+  event.sequence = sequence;
+  event.id = info.id ? info.id : "";
+  event.timestamps = timestamps;
+  event.gameTime = gameTime;
+  event.specialEvents = raised;
+
+  // Reuse the attribute entries of the overwritten event instead of reallocating them.
+  size_t count = 0;
+  for (const scs_named_value_t* attr = info.attributes; attr && attr->name; ++attr) {
+    if (count == event.attributes.size()) event.attributes.emplace_back();
+    auto& recorded = event.attributes[count++];
+    recorded.name = attr->name;
+    recorded.index = attr->index;
+    recorded.value = attr->value;
+    if (attr->value.type == SCS_VALUE_TYPE_string) {
+      recorded.text = attr->value.value_string.value ? attr->value.value_string.value : "";
+      recorded.value.value_string.value = nullptr;
+    } else {
+      recorded.text.clear();
+    }
+  }
+  event.attributes.resize(count);
+
+  m_latest = sequence;
+}
+
+uint64_t GameplayEventHistory::GetLatestSequence() const {
+  std::lock_guard lock(m_mutex);
+  return m_latest;
+}
+
+uint64_t GameplayEventHistory::GetOldestSequence() const {
+  std::lock_guard lock(m_mutex);
+  return m_latest == 0 ? 0 : FirstAfter(0);
+}
+
+uint64_t GameplayEventHistory::FirstAfter(uint64_t after) const {
+  const uint64_t oldest = m_latest > m_slots.size() ? m_latest - m_slots.size() + 1 : 1;
+  return std::max(after + 1, oldest);
+}
+}  // namespace Telemetry
+SPF_NS_END
@@ -56,20 +56,5 @@ void JobProcessor::HandleConfiguration(const scs_telemetry_configuration_t* info
   m_jobData.on_job = !m_jobConstants.job_market.empty();
 }
 
-void JobProcessor::HandleChannelUpdate(const scs_string_t name, const scs_u32_t index, const scs_value_t* value) {
-  if (!value || !name) return;
-
-  if (strcmp(name, SCS_TELEMETRY_JOB_CHANNEL_cargo_damage) == 0) {
-    m_jobData.cargo_damage = value->value_float.value;
-  } else if (strcmp(name, SCS_TELEMETRY_TRUCK_CHANNEL_navigation_distance) == 0)  // Note: SDK uses truck channel for this
-  {
-    m_navigationData.navigation_distance = value->value_float.value;
-  } else if (strcmp(name, SCS_TELEMETRY_TRUCK_CHANNEL_navigation_time) == 0) {
-    m_navigationData.navigation_time = value->value_float.value;
-  } else if (strcmp(name, SCS_TELEMETRY_TRUCK_CHANNEL_navigation_speed_limit) == 0) {
-    m_navigationData.navigation_speed_limit = value->value_float.value;
-  }
-}
-
 }  // namespace Telemetry
 SPF_NS_END
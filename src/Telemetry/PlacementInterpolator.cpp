@@ -0,0 +1,102 @@
+#include "SPF/Telemetry/PlacementInterpolator.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+SPF_NS_BEGIN
+namespace Telemetry {
+namespace {
+// SDK angles are in turns: heading in <0,1), pitch in <-0.25,0.25> and roll in <-0.5,0.5).
+template <typename T>
+T LerpTurns(T from, T to, float alpha) {
+  T delta = to - from;
+  delta -= std::round(delta);  // Shortest way around
+  return from + delta * alpha;
+}
+
+template <typename T>
+T WrapHeading(T heading) {
+  return heading - std::floor(heading);
+}
+
+template <typename T>
+T WrapRoll(T roll) {
+  return roll - std::floor(roll + T(0.5));
+}
+
+template <typename Placement>
+Placement Blend(const Placement& from, const Placement& to, float alpha) {
+  Placement result;
+  result.position.x = from.position.x + (to.position.x - from.position.x) * alpha;
+  result.position.y = from.position.y + (to.position.y - from.position.y) * alpha;
+  result.position.z = from.position.z + (to.position.z - from.position.z) * alpha;
+  result.orientation.heading = WrapHeading(LerpTurns(from.orientation.heading, to.orientation.heading, alpha));
+  result.orientation.pitch = from.orientation.pitch + (to.orientation.pitch - from.orientation.pitch) * alpha;
+  result.orientation.roll = WrapRoll(LerpTurns(from.orientation.roll, to.orientation.roll, alpha));
+  return result;
+}
+}  // namespace
+
+void PlacementInterpolator::AddSample(const SCS::Timestamps& timestamps, const SCS::TruckData& truck) {
+  std::lock_guard lock(m_mutex);
+  m_renderTime = timestamps.render;
+
+  // Several rendered frames can share one simulation step; only a new step makes a new sample.
+  if (m_sampleCount > 0 && timestamps.simulation <= m_samples[1].simulationTime) {
+    if (timestamps.simulation < m_samples[1].simulationTime) m_sampleCount = 0;  // Timer went backwards
+    else return;
+  }
+
+  m_samples[0] = m_samples[1];
+  auto& sample = m_samples[1];
+  sample.simulationTime = timestamps.simulation;
+  sample.world_placement = truck.world_placement;
+  sample.cabin_offset = truck.cabin_offset;
+  sample.head_offset = truck.head_offset;
+  m_sampleCount = std::min<size_t>(m_sampleCount + 1, 2);
+}
+
+void PlacementInterpolator::Update() {
+  std::lock_guard lock(m_mutex);
+  if (m_sampleCount == 0) {
+    m_result = {};
+    return;
+  }
+
+  const auto& older = m_samples[0];
+  const auto& newer = m_samples[1];
+  const uint64_t interval = newer.simulationTime - older.simulationTime;
+
+  float alpha = 1.0f;
+  if (m_sampleCount == 2 && interval > 0 && interval <= MaxSampleInterval) {
+    const double elapsed = static_cast<double>(m_renderTime) - static_cast<double>(older.simulationTime);
+    alpha = static_cast<float>(std::clamp(elapsed / static_cast<double>(interval), 0.0, 1.0 + MaxExtrapolation));
+  }
+
+  m_result.render_time = m_renderTime;
+  m_result.alpha = alpha;
+  m_result.valid = true;
+  if (alpha == 1.0f) {
+    m_result.world_placement = newer.world_placement;
+    m_result.cabin_offset = newer.cabin_offset;
+    m_result.head_offset = newer.head_offset;
+  } else {
+    m_result.world_placement = Blend(older.world_placement, newer.world_placement, alpha);
+    m_result.cabin_offset = Blend(older.cabin_offset, newer.cabin_offset, alpha);
+    m_result.head_offset = Blend(older.head_offset, newer.head_offset, alpha);
+  }
+}
+
+void PlacementInterpolator::Reset() {
+  std::lock_guard lock(m_mutex);
+  m_sampleCount = 0;
+  m_renderTime = 0;
+  m_result = {};
+}
+
+InterpolatedPlacements PlacementInterpolator::Get() const {
+  std::lock_guard lock(m_mutex);
+  return m_result;
+}
+}  // namespace Telemetry
+SPF_NS_END
@@ -0,0 +1,124 @@
+#include "SPF/Telemetry/Recording/RecordingFormat.hpp"
+
+#include <cstring>
+
+SPF_NS_BEGIN
+namespace Telemetry::Recording {
+
+size_t ValuePayloadSize(scs_value_type_t type) {
+  switch (type) {
+    case SCS_VALUE_TYPE_bool:
+      return sizeof(scs_u8_t);
+    case SCS_VALUE_TYPE_s32:
+    case SCS_VALUE_TYPE_u32:
+    case SCS_VALUE_TYPE_float:
+      return 4;
+    case SCS_VALUE_TYPE_u64:
+    case SCS_VALUE_TYPE_s64:
+    case SCS_VALUE_TYPE_double:
+      return 8;
+    case SCS_VALUE_TYPE_fvector:
+    case SCS_VALUE_TYPE_euler:
+      return 12;
+    case SCS_VALUE_TYPE_dvector:
+    case SCS_VALUE_TYPE_fplacement:
+      return 24;
+    case SCS_VALUE_TYPE_dplacement:
+      return 36;  // dvector + euler, without the trailing padding
+    default:
+      return 0;
+  }
+}
+
+void WriteVarint(std::vector<uint8_t>& out, uint64_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<uint8_t>(value) | 0x80);
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+void WriteString(std::vector<uint8_t>& out, const char* str) {
+  const size_t length = str ? strlen(str) : 0;
+  WriteVarint(out, length);
+  out.insert(out.end(), str, str + length);
+}
+
+void WriteValue(std::vector<uint8_t>& out, const scs_value_t& value) {
+  out.push_back(static_cast<uint8_t>(value.type));
+  if (value.type == SCS_VALUE_TYPE_string) {
+    WriteString(out, value.value_string.value);
+    return;
+  }
+  // All union members start at the same address, so the payload can be copied from any of them.
+  const auto* bytes = reinterpret_cast<const uint8_t*>(&value.value_bool);
+  out.insert(out.end(), bytes, bytes + ValuePayloadSize(value.type));
+}
+
+void WriteAttributes(std::vector<uint8_t>& out, const scs_named_value_t* attributes) {
+  size_t count = 0;
+  for (const auto* attr = attributes; attr && attr->name; ++attr) ++count;
+
+  WriteVarint(out, count);
+  for (size_t i = 0; i < count; ++i) {
+    WriteString(out, attributes[i].name);
+    WriteVarint(out, attributes[i].index);
+    WriteValue(out, attributes[i].value);
+  }
+}
+
+// --- Reader ---
+
+uint8_t Reader::ReadByte() {
+  if (m_offset >= m_size) {
+    m_failed = true;
+    return 0;
+  }
+  return m_data[m_offset++];
+}
+
+uint64_t Reader::ReadVarint() {
+  uint64_t result = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    const uint8_t byte = ReadByte();
+    result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) return result;
+  }
+  m_failed = true;
+  return 0;
+}
+
+std::string Reader::ReadString() {
+  const uint64_t length = ReadVarint();
+  if (m_failed || length > m_size - m_offset) {
+    m_failed = true;
+    return {};
+  }
+  std::string result(reinterpret_cast<const char*>(m_data + m_offset), static_cast<size_t>(length));
+  m_offset += static_cast<size_t>(length);
+  return result;
+}
+
+void Reader::ReadBytes(void* out, size_t size) {
+  if (size > m_size - m_offset) {
+    m_failed = true;
+    memset(out, 0, size);
+    return;
+  }
+  memcpy(out, m_data + m_offset, size);
+  m_offset += size;
+}
+
+void ReadValue(Reader& reader, scs_value_t& value, std::string& storage) {
+  memset(&value, 0, sizeof(value));
+  value.type = reader.ReadByte();
+  if (value.type == SCS_VALUE_TYPE_string) {
+    storage = reader.ReadString();
+    value.value_string.value = storage.c_str();
+    return;
+  }
+  reader.ReadBytes(&value.value_bool, ValuePayloadSize(value.type));
+}
+
+}  // namespace Telemetry::Recording
+SPF_NS_END
@@ -0,0 +1,261 @@
+#include "SPF/Telemetry/Recording/TelemetryRecorder.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+SPF_NS_BEGIN
+namespace Telemetry::Recording {
+namespace {
+// Records are collected in memory and written in large chunks.
+constexpr size_t FlushThreshold = 256 * 1024;
+
+void CopyTruncated(char* dest, size_t size, const char* src) {
+  memset(dest, 0, size);
+  if (src) memcpy(dest, src, std::min(strlen(src), size - 1));
+}
+}  // namespace
+
+TelemetryRecorder* TelemetryRecorder::s_active = nullptr;
+
+TelemetryRecorder::~TelemetryRecorder() {
+  Stop();
+  if (s_active == this) s_active = nullptr;
+}
+
+const scs_telemetry_init_params_v100_t* TelemetryRecorder::Start(const std::string& path, const scs_telemetry_init_params_v100_t* gameParams,
+                                                                 uint32_t keyframeInterval) {
+  if (!gameParams) {
+    m_lastError = "No init params to record.";
+    return nullptr;
+  }
+  if (s_active && s_active != this) {
+    m_lastError = "Another telemetry recorder is already active.";
+    return nullptr;
+  }
+
+  m_file.open(path, std::ios::binary | std::ios::trunc);
+  if (!m_file.is_open()) {
+    m_lastError = "Could not create recording file: " + path;
+    return nullptr;
+  }
+
+  m_gameParams = gameParams;
+  m_keyframeInterval = keyframeInterval > 0 ? keyframeInterval : Format::DefaultKeyframeInterval;
+  m_frame = 0;
+  m_fileOffset = 0;
+  m_index.clear();
+  m_buffer.clear();
+  m_buffer.reserve(FlushThreshold * 2);
+
+  FileHeader header = {};
+  memcpy(header.magic, Format::HeaderMagic, sizeof(header.magic));
+  header.version = Format::Version;
+  header.keyframeInterval = m_keyframeInterval;
+  header.gameVersion = gameParams->common.game_version;
+  CopyTruncated(header.gameId, sizeof(header.gameId), gameParams->common.game_id);
+  CopyTruncated(header.gameName, sizeof(header.gameName), gameParams->common.game_name);
+  const auto* headerBytes = reinterpret_cast<const uint8_t*>(&header);
+  m_buffer.insert(m_buffer.end(), headerBytes, headerBytes + sizeof(header));
+
+  // The consumer sees the game's params with the registration functions replaced.
+  m_params = *gameParams;
+  m_params.register_for_event = RegisterForEvent;
+  m_params.unregister_from_event = UnregisterFromEvent;
+  m_params.register_for_channel = RegisterForChannel;
+  m_params.unregister_from_channel = UnregisterFromChannel;
+
+  s_active = this;
+  return &m_params;
+}
+
+void TelemetryRecorder::Stop() {
+  if (!m_file.is_open()) return;
+
+  // Trailing keyframe index and footer make the file seekable without a scan.
+  Flush();
+  FileFooter footer = {};
+  footer.indexOffset = m_fileOffset;
+  footer.indexCount = m_index.size();
+  memcpy(footer.magic, Format::FooterMagic, sizeof(footer.magic));
+
+  if (!m_index.empty()) m_file.write(reinterpret_cast<const char*>(m_index.data()), m_index.size() * sizeof(IndexEntry));
+  m_file.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+  m_file.close();
+}
+
+// --- Interposed SDK functions ---
+
+SCSAPI_RESULT TelemetryRecorder::RegisterForEvent(const scs_event_t event, const scs_telemetry_event_callback_t callback, const scs_context_t context) {
+  auto* self = s_active;
+  if (!self || event >= self->m_eventTaps.size()) return SCS_RESULT_unsupported;
+
+  auto& tap = self->m_eventTaps[event];
+  tap = {self, event, callback, context};
+  return self->m_gameParams->register_for_event(event, EventTrampoline, &tap);
+}
+
+SCSAPI_RESULT TelemetryRecorder::UnregisterFromEvent(const scs_event_t event) {
+  auto* self = s_active;
+  if (!self) return SCS_RESULT_not_found;
+  if (event < self->m_eventTaps.size()) self->m_eventTaps[event].callback = nullptr;
+  return self->m_gameParams->unregister_from_event(event);
+}
+
+SCSAPI_RESULT TelemetryRecorder::RegisterForChannel(const scs_string_t name, const scs_u32_t index, const scs_value_type_t type, const scs_u32_t flags,
+                                                    const scs_telemetry_channel_callback_t callback, const scs_context_t context) {
+  auto* self = s_active;
+  if (!self || !name) return SCS_RESULT_invalid_parameter;
+
+  auto& tap = self->m_channelTaps.emplace_back();
+  tap.recorder = self;
+  tap.id = static_cast<uint32_t>(self->m_channelTaps.size() - 1);
+  tap.name = name;
+  tap.index = index;
+  tap.type = type;
+  tap.callback = callback;
+  tap.context = context;
+
+  const scs_result_t result = self->m_gameParams->register_for_channel(name, index, type, flags, ChannelTrampoline, &tap);
+  if (result != SCS_RESULT_ok) {
+    self->m_channelTaps.pop_back();
+    return result;
+  }
+
+  tap.active = true;
+  if (self->IsRecording()) {
+    auto& out = self->m_buffer;
+    out.push_back(static_cast<uint8_t>(RecordType::ChannelRegistered));
+    WriteVarint(out, tap.id);
+    WriteString(out, name);
+    WriteVarint(out, index);
+    WriteVarint(out, type);
+    WriteVarint(out, flags);
+  }
+  return result;
+}
+
+SCSAPI_RESULT TelemetryRecorder::UnregisterFromChannel(const scs_string_t name, const scs_u32_t index, const scs_value_type_t type) {
+  auto* self = s_active;
+  if (!self || !name) return SCS_RESULT_invalid_parameter;
+
+  for (auto& tap : self->m_channelTaps) {
+    if (tap.active && tap.index == index && tap.type == type && tap.name == name) {
+      tap.active = false;
+      if (self->IsRecording()) {
+        self->m_buffer.push_back(static_cast<uint8_t>(RecordType::ChannelUnregistered));
+        WriteVarint(self->m_buffer, tap.id);
+      }
+      break;
+    }
+  }
+  return self->m_gameParams->unregister_from_channel(name, index, type);
+}
+
+SCSAPI_VOID TelemetryRecorder::EventTrampoline(const scs_event_t event, const void* const event_info, const scs_context_t context) {
+  const auto* tap = static_cast<const EventTap*>(context);
+  if (!tap) return;
+
+  if (tap->recorder->IsRecording()) tap->recorder->RecordEvent(event, event_info);
+  if (tap->callback) tap->callback(event, event_info, tap->context);
+}
+
+SCSAPI_VOID TelemetryRecorder::ChannelTrampoline(const scs_string_t name, const scs_u32_t index, const scs_value_t* const value, const scs_context_t context) {
+  auto* tap = static_cast<ChannelTap*>(context);
+  if (!tap) return;
+
+  if (tap->recorder->IsRecording()) tap->recorder->RecordChannelValue(*tap, value);
+  if (tap->callback) tap->callback(name, index, value, tap->context);
+}
+
+// --- Record writers ---
+
+void TelemetryRecorder::RecordEvent(scs_event_t event, const void* eventInfo) {
+  auto& out = m_buffer;
+  switch (event) {
+    case SCS_TELEMETRY_EVENT_frame_start: {
+      if (m_frame % m_keyframeInterval == 0) WriteKeyframe();
+      const auto* info = static_cast<const scs_telemetry_frame_start_t*>(eventInfo);
+      const scs_telemetry_frame_start_t frame = info ? *info : scs_telemetry_frame_start_t{};
+      out.push_back(static_cast<uint8_t>(RecordType::FrameStart));
+      WriteVarint(out, frame.flags);
+      WriteVarint(out, ZigZag(static_cast<int64_t>(frame.render_time - m_previousFrame.render_time)));
+      WriteVarint(out, ZigZag(static_cast<int64_t>(frame.simulation_time - m_previousFrame.simulation_time)));
+      WriteVarint(out, ZigZag(static_cast<int64_t>(frame.paused_simulation_time - m_previousFrame.paused_simulation_time)));
+      m_previousFrame = frame;
+      ++m_frame;
+      break;
+    }
+    case SCS_TELEMETRY_EVENT_frame_end:
+      out.push_back(static_cast<uint8_t>(RecordType::FrameEnd));
+      // Frame end is the natural point to hand a full buffer to the OS.
+      FlushIfNeeded();
+      break;
+    case SCS_TELEMETRY_EVENT_paused:
+      out.push_back(static_cast<uint8_t>(RecordType::Paused));
+      break;
+    case SCS_TELEMETRY_EVENT_started:
+      out.push_back(static_cast<uint8_t>(RecordType::Started));
+      break;
+    case SCS_TELEMETRY_EVENT_configuration:
+    case SCS_TELEMETRY_EVENT_gameplay: {
+      // Configuration and gameplay event infos share the same {id, attributes} layout.
+      const auto* info = static_cast<const scs_telemetry_configuration_t*>(eventInfo);
+      out.push_back(static_cast<uint8_t>(event == SCS_TELEMETRY_EVENT_configuration ? RecordType::Configuration : RecordType::Gameplay));
+      WriteString(out, info ? info->id : nullptr);
+      WriteAttributes(out, info ? info->attributes : nullptr);
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void TelemetryRecorder::RecordChannelValue(ChannelTap& tap, const scs_value_t* value) {
+  auto& out = m_buffer;
+  out.push_back(static_cast<uint8_t>(RecordType::ChannelValue));
+  WriteVarint(out, tap.id);
+
+  if (!value) {
+    out.push_back(static_cast<uint8_t>(SCS_VALUE_TYPE_INVALID));
+    return;
+  }
+
+  out.push_back(static_cast<uint8_t>(value->type));
+  if (value->type == SCS_VALUE_TYPE_string) {
+    WriteString(out, value->value_string.value);
+    return;
+  }
+
+  // XOR each 32-bit word against the previous value of this channel; unchanged words encode as one byte.
+  uint32_t words[10] = {};
+  const size_t size = ValuePayloadSize(value->type);
+  memcpy(words, &value->value_bool, size);
+  const size_t wordCount = (size + 3) / 4;
+  for (size_t i = 0; i < wordCount; ++i) {
+    WriteVarint(out, words[i] ^ tap.previous[i]);
+    tap.previous[i] = words[i];
+  }
+}
+
+void TelemetryRecorder::WriteKeyframe() {
+  m_index.push_back({m_frame, m_fileOffset + m_buffer.size()});
+  m_buffer.push_back(static_cast<uint8_t>(RecordType::Keyframe));
+  WriteVarint(m_buffer, m_frame);
+
+  for (auto& tap : m_channelTaps) tap.previous = {};
+  m_previousFrame = {};
+}
+
+void TelemetryRecorder::FlushIfNeeded() {
+  if (m_buffer.size() >= FlushThreshold) Flush();
+}
+
+void TelemetryRecorder::Flush() {
+  if (!m_file.is_open() || m_buffer.empty()) return;
+  m_file.write(reinterpret_cast<const char*>(m_buffer.data()), m_buffer.size());
+  m_fileOffset += m_buffer.size();
+  m_buffer.clear();
+}
+
+}  // namespace Telemetry::Recording
+SPF_NS_END
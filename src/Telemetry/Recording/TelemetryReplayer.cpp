@@ -0,0 +1,381 @@
+#include "SPF/Telemetry/Recording/TelemetryReplayer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+SPF_NS_BEGIN
+namespace Telemetry::Recording {
+
+TelemetryReplayer* TelemetryReplayer::s_active = nullptr;
+
+TelemetryReplayer::~TelemetryReplayer() { Close(); }
+
+bool TelemetryReplayer::Open(const std::string& path) {
+  Close();
+
+  if (s_active) {
+    m_lastError = "Another telemetry replayer is already active.";
+    return false;
+  }
+  if (!m_file.Open(path)) {
+    m_lastError = "Could not open recording file: " + path;
+    return false;
+  }
+
+  const uint8_t* data = m_file.Data();
+  const size_t size = m_file.Size();
+  if (size < sizeof(FileHeader)) {
+    m_lastError = "File is too small to be a telemetry recording.";
+    m_file.Close();
+    return false;
+  }
+  memcpy(&m_header, data, sizeof(m_header));
+  if (memcmp(m_header.magic, Format::HeaderMagic, sizeof(m_header.magic)) != 0 || m_header.version != Format::Version) {
+    m_lastError = "Not a telemetry recording, or an unsupported version.";
+    m_file.Close();
+    return false;
+  }
+  m_recordsBegin = sizeof(FileHeader);
+
+  // Use the stored keyframe index when the footer is intact, otherwise recover it by scanning.
+  bool hasIndex = false;
+  if (size >= sizeof(FileHeader) + sizeof(FileFooter)) {
+    FileFooter footer;
+    memcpy(&footer, data + size - sizeof(footer), sizeof(footer));
+    const uint64_t indexBytes = footer.indexCount * sizeof(IndexEntry);
+    if (memcmp(footer.magic, Format::FooterMagic, sizeof(footer.magic)) == 0 && footer.indexOffset >= m_recordsBegin &&
+        footer.indexCount <= size / sizeof(IndexEntry) && footer.indexOffset + indexBytes + sizeof(footer) == size) {
+      m_index.resize(static_cast<size_t>(footer.indexCount));
+      if (indexBytes > 0) memcpy(m_index.data(), data + footer.indexOffset, static_cast<size_t>(indexBytes));
+      m_recordsEnd = static_cast<size_t>(footer.indexOffset);
+      hasIndex = true;
+    }
+  }
+  if (!hasIndex) {
+    m_recordsEnd = size;
+    BuildIndexByScanning();
+  }
+
+  // Null-terminated copies, since the header fields are fixed-size.
+  m_gameId.assign(m_header.gameId, strnlen(m_header.gameId, sizeof(m_header.gameId)));
+  m_gameName.assign(m_header.gameName, strnlen(m_header.gameName, sizeof(m_header.gameName)));
+
+  m_params = {};
+  m_params.common.game_name = m_gameName.c_str();
+  m_params.common.game_id = m_gameId.c_str();
+  m_params.common.game_version = m_header.gameVersion;
+  m_params.common.log = Log;
+  m_params.register_for_event = RegisterForEvent;
+  m_params.unregister_from_event = UnregisterFromEvent;
+  m_params.register_for_channel = RegisterForChannel;
+  m_params.unregister_from_channel = UnregisterFromChannel;
+
+  ResetDecoderState();
+  s_active = this;
+  return true;
+}
+
+void TelemetryReplayer::Close() {
+  if (s_active == this) s_active = nullptr;
+  m_file.Close();
+  m_index.clear();
+  m_registrations.clear();
+  m_events = {};
+  m_recordedChannels.clear();
+  m_reader = Reader(nullptr, 0);
+  m_recordsBegin = m_recordsEnd = 0;
+  m_currentFrame = 0;
+}
+
+bool TelemetryReplayer::SeekToFrame(uint64_t frame) {
+  if (!m_file.IsOpen()) return false;
+
+  // Last keyframe at or before the target.
+  const auto it = std::upper_bound(m_index.begin(), m_index.end(), frame, [](uint64_t f, const IndexEntry& e) { return f < e.frame; });
+  const size_t keyframeOffset = it == m_index.begin() ? m_recordsBegin : static_cast<size_t>(std::prev(it)->offset);
+
+  // Channel registrations and configuration state are not repeated at keyframes, so
+  // they are collected from everything recorded before the keyframe.
+  ResetDecoderState();
+  while (m_reader.Offset() < keyframeOffset) {
+    if (!ProcessRecord(Delivery::Configuration)) return false;
+  }
+
+  m_pacing = Pacing::MaxSpeed;
+  while (m_currentFrame < frame) {
+    if (!StepFrame()) return false;
+  }
+  return true;
+}
+
+bool TelemetryReplayer::StepFrame() {
+  RecordType type;
+  while (!AtEnd()) {
+    if (!ProcessRecord(Delivery::All, &type)) return false;
+    if (type == RecordType::FrameEnd) return true;
+  }
+  return false;
+}
+
+uint64_t TelemetryReplayer::Run(Pacing pacing, uint64_t maxFrames) {
+  m_pacing = pacing;
+  m_paceAnchored = false;
+
+  uint64_t delivered = 0;
+  while (delivered < maxFrames && StepFrame()) ++delivered;
+  return delivered;
+}
+
+bool TelemetryReplayer::AtEnd() const { return m_reader.AtEnd() || m_reader.Failed(); }
+
+// --- Replacement SDK functions ---
+
+SCSAPI_RESULT TelemetryReplayer::RegisterForEvent(const scs_event_t event, const scs_telemetry_event_callback_t callback, const scs_context_t context) {
+  auto* self = s_active;
+  if (!self) return SCS_RESULT_generic_error;
+  if (event >= self->m_events.size()) return SCS_RESULT_unsupported;
+  if (self->m_events[event].callback) return SCS_RESULT_already_registered;
+
+  self->m_events[event] = {callback, context};
+  return SCS_RESULT_ok;
+}
+
+SCSAPI_RESULT TelemetryReplayer::UnregisterFromEvent(const scs_event_t event) {
+  auto* self = s_active;
+  if (!self || event >= self->m_events.size() || !self->m_events[event].callback) return SCS_RESULT_not_found;
+
+  self->m_events[event] = {};
+  return SCS_RESULT_ok;
+}
+
+SCSAPI_RESULT TelemetryReplayer::RegisterForChannel(const scs_string_t name, const scs_u32_t index, const scs_value_type_t type, const scs_u32_t flags,
+                                                    const scs_telemetry_channel_callback_t callback, const scs_context_t context) {
+  auto* self = s_active;
+  if (!self) return SCS_RESULT_generic_error;
+  if (!name || !callback) return SCS_RESULT_invalid_parameter;
+
+  for (const auto& reg : self->m_registrations) {
+    if (reg.active && reg.index == index && reg.type == type && reg.name == name) return SCS_RESULT_already_registered;
+  }
+
+  auto& reg = self->m_registrations.emplace_back();
+  reg.name = name;
+  reg.index = index;
+  reg.type = type;
+  reg.flags = flags;
+  reg.callback = callback;
+  reg.context = context;
+  reg.active = true;
+  ++self->m_registrationGeneration;
+  return SCS_RESULT_ok;
+}
+
+SCSAPI_RESULT TelemetryReplayer::UnregisterFromChannel(const scs_string_t name, const scs_u32_t index, const scs_value_type_t type) {
+  auto* self = s_active;
+  if (!self || !name) return SCS_RESULT_not_found;
+
+  for (auto& reg : self->m_registrations) {
+    if (reg.active && reg.index == index && reg.type == type && reg.name == name) {
+      reg.active = false;
+      ++self->m_registrationGeneration;
+      return SCS_RESULT_ok;
+    }
+  }
+  return SCS_RESULT_not_found;
+}
+
+SCSAPI_VOID TelemetryReplayer::Log(const scs_log_type_t type, const scs_string_t message) {
+  const char* prefix = type == SCS_LOG_TYPE_error ? "<ERROR> " : type == SCS_LOG_TYPE_warning ? "<WARNING> " : "";
+  fprintf(stderr, "%s%s\n", prefix, message ? message : "");
+}
+
+// --- Decoding ---
+
+void TelemetryReplayer::ResetDecoderState() {
+  m_reader = Reader(m_file.Data(), m_recordsEnd, m_recordsBegin);
+  m_recordedChannels.clear();
+  m_frame = {};
+  m_currentFrame = 0;
+  m_paceAnchored = false;
+}
+
+bool TelemetryReplayer::BuildIndexByScanning() {
+  m_index.clear();
+  ResetDecoderState();
+
+  // Everything up to the first record that fails to decode is usable; a crash can leave a torn tail.
+  size_t lastGood = m_recordsBegin;
+  RecordType type;
+  while (!m_reader.AtEnd()) {
+    const size_t offset = m_reader.Offset();
+    if (!ProcessRecord(Delivery::None, &type)) break;
+    if (type == RecordType::Keyframe) m_index.push_back({m_currentFrame, offset});
+    lastGood = m_reader.Offset();
+  }
+  m_recordsEnd = lastGood;
+  return !m_index.empty();
+}
+
+bool TelemetryReplayer::ProcessRecord(Delivery delivery, RecordType* outType) {
+  auto& reader = m_reader;
+  const auto type = static_cast<RecordType>(reader.ReadByte());
+  if (outType) *outType = type;
+
+  switch (type) {
+    case RecordType::ChannelRegistered: {
+      const uint64_t id = reader.ReadVarint();
+      std::string name = reader.ReadString();
+      const auto index = static_cast<scs_u32_t>(reader.ReadVarint());
+      const auto valueType = static_cast<scs_value_type_t>(reader.ReadVarint());
+      reader.ReadVarint();  // flags
+      if (reader.Failed() || id > m_recordsEnd) return false;  // Ids are dense; larger ones mean corruption.
+
+      if (id >= m_recordedChannels.size()) m_recordedChannels.resize(static_cast<size_t>(id) + 1);
+      auto& channel = m_recordedChannels[static_cast<size_t>(id)];
+      channel = {};
+      channel.name = std::move(name);
+      channel.index = index;
+      channel.type = valueType;
+      return true;
+    }
+    case RecordType::ChannelUnregistered:
+      reader.ReadVarint();
+      return !reader.Failed();
+    case RecordType::ChannelValue: {
+      const uint64_t id = reader.ReadVarint();
+      const auto valueType = static_cast<scs_value_type_t>(reader.ReadByte());
+      if (reader.Failed() || id >= m_recordedChannels.size()) return false;
+      auto& channel = m_recordedChannels[static_cast<size_t>(id)];
+
+      scs_value_t value;
+      memset(&value, 0, sizeof(value));
+      value.type = valueType;
+      std::string text;
+      if (valueType == SCS_VALUE_TYPE_string) {
+        text = reader.ReadString();
+        value.value_string.value = text.c_str();
+      } else if (valueType != SCS_VALUE_TYPE_INVALID) {
+        uint32_t words[10] = {};
+        const size_t size = ValuePayloadSize(valueType);
+        if (size == 0) return false;
+        const size_t wordCount = (size + 3) / 4;
+        for (size_t i = 0; i < wordCount; ++i) {
+          words[i] = static_cast<uint32_t>(reader.ReadVarint()) ^ channel.previous[i];
+          channel.previous[i] = words[i];
+        }
+        memcpy(&value.value_bool, words, size);
+      }
+      if (reader.Failed()) return false;
+
+      if (delivery == Delivery::All) {
+        if (const auto* reg = ResolveChannel(channel)) {
+          // Only the recorded channel's own strings are passed, as the callback may add registrations.
+          const auto callback = reg->callback;
+          callback(channel.name.c_str(), channel.index, valueType == SCS_VALUE_TYPE_INVALID ? nullptr : &value, reg->context);
+        }
+      }
+      return true;
+    }
+    case RecordType::FrameStart: {
+      m_frame.flags = static_cast<scs_u32_t>(reader.ReadVarint());
+      m_frame.render_time += static_cast<scs_timestamp_t>(UnZigZag(reader.ReadVarint()));
+      m_frame.simulation_time += static_cast<scs_timestamp_t>(UnZigZag(reader.ReadVarint()));
+      m_frame.paused_simulation_time += static_cast<scs_timestamp_t>(UnZigZag(reader.ReadVarint()));
+      if (reader.Failed()) return false;
+      if (delivery != Delivery::All) return true;
+
+      if (m_pacing == Pacing::RealTime) {
+        // Render time is in microseconds. Re-anchor whenever it jumps backwards (e.g. after a seek).
+        if (!m_paceAnchored || m_frame.render_time < m_paceStartRenderTime) {
+          m_paceStart = std::chrono::steady_clock::now();
+          m_paceStartRenderTime = m_frame.render_time;
+          m_paceAnchored = true;
+        }
+        std::this_thread::sleep_until(m_paceStart + std::chrono::microseconds(m_frame.render_time - m_paceStartRenderTime));
+      }
+      DeliverEvent(SCS_TELEMETRY_EVENT_frame_start, &m_frame);
+      return true;
+    }
+    case RecordType::FrameEnd:
+      ++m_currentFrame;
+      if (delivery == Delivery::All) DeliverEvent(SCS_TELEMETRY_EVENT_frame_end, nullptr);
+      return true;
+    case RecordType::Paused:
+    case RecordType::Started:
+      if (delivery != Delivery::None) DeliverEvent(type == RecordType::Paused ? SCS_TELEMETRY_EVENT_paused : SCS_TELEMETRY_EVENT_started, nullptr);
+      return true;
+    case RecordType::Configuration:
+    case RecordType::Gameplay: {
+      const std::string id = reader.ReadString();
+      DecodeAttributes(reader);
+      if (reader.Failed()) return false;
+
+      const bool deliver = type == RecordType::Configuration ? delivery != Delivery::None : delivery == Delivery::All;
+      if (!deliver) return true;
+      if (type == RecordType::Configuration) {
+        const scs_telemetry_configuration_t info = {id.c_str(), m_attributes.data()};
+        DeliverEvent(SCS_TELEMETRY_EVENT_configuration, &info);
+      } else {
+        const scs_telemetry_gameplay_event_t info = {id.c_str(), m_attributes.data()};
+        DeliverEvent(SCS_TELEMETRY_EVENT_gameplay, &info);
+      }
+      return true;
+    }
+    case RecordType::Keyframe: {
+      const uint64_t frame = reader.ReadVarint();
+      if (reader.Failed()) return false;
+      m_currentFrame = frame;
+      for (auto& channel : m_recordedChannels) channel.previous = {};
+      m_frame = {};
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+void TelemetryReplayer::DeliverEvent(scs_event_t event, const void* info) const {
+  if (event >= m_events.size()) return;
+  const auto registration = m_events[event];  // The callback may unregister itself.
+  if (registration.callback) registration.callback(event, info, registration.context);
+}
+
+void TelemetryReplayer::DecodeAttributes(Reader& reader) {
+  m_attributes.clear();
+  m_attributeStrings.clear();
+
+  const uint64_t count = reader.ReadVarint();
+  for (uint64_t i = 0; i < count && !reader.Failed(); ++i) {
+    scs_named_value_t attribute;
+    memset(&attribute, 0, sizeof(attribute));
+    // The deque keeps the strings in place while later attributes are added.
+    attribute.name = m_attributeStrings.emplace_back(reader.ReadString()).c_str();
+    attribute.index = static_cast<scs_u32_t>(reader.ReadVarint());
+    ReadValue(reader, attribute.value, m_attributeStrings.emplace_back());
+    m_attributes.push_back(attribute);
+  }
+
+  scs_named_value_t terminator;
+  memset(&terminator, 0, sizeof(terminator));
+  m_attributes.push_back(terminator);
+}
+
+const TelemetryReplayer::Registration* TelemetryReplayer::ResolveChannel(RecordedChannel& channel) {
+  if (channel.resolvedGeneration != m_registrationGeneration) {
+    channel.registration = -1;
+    channel.resolvedGeneration = m_registrationGeneration;
+    for (size_t i = 0; i < m_registrations.size(); ++i) {
+      const auto& reg = m_registrations[i];
+      if (reg.active && reg.index == channel.index && reg.type == channel.type && reg.name == channel.name) {
+        channel.registration = static_cast<int>(i);
+        break;
+      }
+    }
+  }
+  return channel.registration >= 0 ? &m_registrations[channel.registration] : nullptr;
+}
+
+}  // namespace Telemetry::Recording
+SPF_NS_END
@@ -0,0 +1,353 @@
+#include "SPF/Telemetry/RouteStore.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+SPF_NS_BEGIN
+namespace Telemetry {
+namespace {
+constexpr char FileMagic[8] = {'S', 'P', 'F', 'R', 'O', 'U', 'T', '1'};
+constexpr uint32_t FileVersion = 1;
+
+// Samples buffered by the simplifier before the newest one is kept regardless.
+constexpr size_t MaxWindow = 256;
+
+double HorizontalDistance(const RoutePoint& a, const RoutePoint& b) { return std::hypot(b.x - a.x, b.z - a.z); }
+
+double Distance(const RoutePoint& a, const RoutePoint& b) { return std::sqrt((b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y) + (b.z - a.z) * (b.z - a.z)); }
+
+/// Position of the point of segment a-b closest to (x, z), as a fraction of the segment.
+double ClosestFraction(const RoutePoint& a, const RoutePoint& b, double x, double z) {
+  const double dx = b.x - a.x;
+  const double dz = b.z - a.z;
+  const double lengthSquared = dx * dx + dz * dz;
+  if (lengthSquared <= 0.0) return 0.0;
+  return std::clamp(((x - a.x) * dx + (z - a.z) * dz) / lengthSquared, 0.0, 1.0);
+}
+
+RoutePoint Lerp(const RoutePoint& a, const RoutePoint& b, double t) {
+  float heading = b.heading - a.heading;
+  heading -= std::round(heading);  // Shortest way around
+  heading = a.heading + heading * static_cast<float>(t);
+
+  RoutePoint point;
+  point.x = a.x + (b.x - a.x) * t;
+  point.y = a.y + (b.y - a.y) * t;
+  point.z = a.z + (b.z - a.z) * t;
+  point.heading = heading - std::floor(heading);
+  point.time = a.time + static_cast<uint64_t>((static_cast<double>(b.time) - static_cast<double>(a.time)) * t);
+  return point;
+}
+
+template <typename T>
+void Write(std::ofstream& file, const T& value) {
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool Read(std::ifstream& file, T& value) {
+  return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+}  // namespace
+
+void RouteStore::AddSample(const scs_value_dplacement_t& placement, uint64_t time) {
+  const RoutePoint sample{placement.position.x, placement.position.y, placement.position.z, placement.orientation.heading, time};
+
+  std::lock_guard lock(m_mutex);
+  if (m_lastSample) {
+    const double step = Distance(*m_lastSample, sample);
+    if (step < MinSpacing) return;
+    if (step > BreakDistance) m_breakPending = true;
+  }
+  m_lastSample = sample;
+  ++m_stats.samples;
+
+  if (!m_anchor || m_breakPending) {
+    FlushWindow();
+    Commit(sample, true);
+    m_anchor = sample;
+    m_breakPending = false;
+    return;
+  }
+
+  // The segment from the anchor to the new sample may replace the buffered samples if
+  // none of them is further than Tolerance from it.
+  bool fits = m_window.size() < MaxWindow && HorizontalDistance(*m_anchor, sample) <= MaxSegmentLength;
+  for (size_t i = 0; fits && i < m_window.size(); ++i) {
+    const auto& buffered = m_window[i];
+    const RoutePoint closest = Lerp(*m_anchor, sample, ClosestFraction(*m_anchor, sample, buffered.x, buffered.z));
+    fits = HorizontalDistance(closest, buffered) <= Tolerance;
+  }
+  if (!fits) FlushWindow();
+  m_window.push_back(sample);
+}
+
+void RouteStore::Break() {
+  std::lock_guard lock(m_mutex);
+  FlushWindow();
+  m_breakPending = true;
+}
+
+void RouteStore::Clear() {
+  std::lock_guard lock(m_mutex);
+  m_chunks.clear();
+  m_grid.clear();
+  m_stats = {};
+  m_anchor.reset();
+  m_window.clear();
+  m_lastSample.reset();
+  m_breakPending = false;
+}
+
+void RouteStore::FlushWindow() {
+  if (m_window.empty()) return;
+  const RoutePoint vertex = m_window.back();
+  m_window.clear();
+  Commit(vertex, false);
+  m_anchor = vertex;
+}
+
+bool RouteStore::Fits(const Chunk& chunk, const RoutePoint& point) const {
+  constexpr double MaxOffset = std::numeric_limits<int16_t>::max() * Quantum;
+  return std::abs(point.x - chunk.originX) <= MaxOffset && std::abs(point.y - chunk.originY) <= MaxOffset &&
+         std::abs(point.z - chunk.originZ) <= MaxOffset && point.time >= chunk.startTime &&
+         (point.time - chunk.startTime) / 1000 <= std::numeric_limits<uint32_t>::max();
+}
+
+void RouteStore::Commit(const RoutePoint& point, bool startsTrack) {
+  if (startsTrack || m_chunks.empty() || m_chunks.back().points.size() >= ChunkCapacity || !Fits(m_chunks.back(), point)) {
+    if (m_chunks.size() >= (size_t{1} << (32 - PointBits))) return;  // References exhausted; years of driving
+
+    Chunk chunk;
+    chunk.originX = point.x;
+    chunk.originY = point.y;
+    chunk.originZ = point.z;
+    chunk.startTime = point.time;
+    chunk.continuesPrevious = !startsTrack && !m_chunks.empty();
+    m_chunks.push_back(std::move(chunk));
+    if (startsTrack) ++m_stats.tracks;
+  }
+
+  auto& chunk = m_chunks.back();
+  PackedPoint packed;
+  packed.x = static_cast<int16_t>(std::lround((point.x - chunk.originX) / Quantum));
+  packed.y = static_cast<int16_t>(std::lround((point.y - chunk.originY) / Quantum));
+  packed.z = static_cast<int16_t>(std::lround((point.z - chunk.originZ) / Quantum));
+  packed.heading = static_cast<uint16_t>(std::llround(point.heading * 65536.0) & 0xFFFF);
+  packed.time = static_cast<uint32_t>((point.time - chunk.startTime) / 1000);
+  chunk.points.push_back(packed);
+
+  const PointRef ref = static_cast<PointRef>((m_chunks.size() - 1) << PointBits | (chunk.points.size() - 1));
+  if (const auto previous = Predecessor(ref)) m_stats.length += Distance(Unpack(*previous), Unpack(ref));
+  ++m_stats.points;
+  Index(ref);
+}
+
+void RouteStore::Index(PointRef ref) {
+  const RoutePoint end = Unpack(ref);
+  const auto previous = Predecessor(ref);
+  const RoutePoint start = previous ? Unpack(*previous) : end;
+
+  // The vertex is entered with the segment that leads to it into every cell the segment's box touches.
+  const int64_t minX = CellOf(std::min(start.x, end.x));
+  const int64_t maxX = CellOf(std::max(start.x, end.x));
+  const int64_t minZ = CellOf(std::min(start.z, end.z));
+  const int64_t maxZ = CellOf(std::max(start.z, end.z));
+  for (int64_t cellX = minX; cellX <= maxX; ++cellX) {
+    for (int64_t cellZ = minZ; cellZ <= maxZ; ++cellZ) {
+      m_grid[CellKey(cellX, cellZ)].push_back(ref);
+    }
+  }
+}
+
+RoutePoint RouteStore::Unpack(PointRef ref) const {
+  const auto& chunk = m_chunks[ref >> PointBits];
+  const auto& packed = chunk.points[ref & ((1u << PointBits) - 1)];
+  RoutePoint point;
+  point.x = chunk.originX + packed.x * Quantum;
+  point.y = chunk.originY + packed.y * Quantum;
+  point.z = chunk.originZ + packed.z * Quantum;
+  point.heading = packed.heading / 65536.0f;
+  point.time = chunk.startTime + static_cast<uint64_t>(packed.time) * 1000;
+  return point;
+}
+
+std::optional<RouteStore::PointRef> RouteStore::Predecessor(PointRef ref) const {
+  const uint32_t chunkIndex = ref >> PointBits;
+  if ((ref & ((1u << PointBits) - 1)) > 0) return ref - 1;
+  if (chunkIndex == 0 || !m_chunks[chunkIndex].continuesPrevious) return std::nullopt;
+  return (chunkIndex - 1) << PointBits | static_cast<uint32_t>(m_chunks[chunkIndex - 1].points.size() - 1);
+}
+
+uint64_t RouteStore::CellKey(int64_t cellX, int64_t cellZ) { return static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32 | static_cast<uint32_t>(cellZ); }
+
+int64_t RouteStore::CellOf(double coordinate) {
+  constexpr double limit = static_cast<double>(MaxCell);
+  return static_cast<int64_t>(std::clamp(std::floor(coordinate / CellSize), -limit, limit));
+}
+
+std::optional<RouteMatch> RouteStore::FindNearest(double x, double z, double maxDistance) const {
+  if (std::isnan(x) || std::isnan(z) || std::isnan(maxDistance)) return std::nullopt;
+  std::lock_guard lock(m_mutex);
+  std::optional<RouteMatch> best;
+  const auto consider = [&](const RoutePoint& start, const RoutePoint& end) {
+    const RoutePoint point = Lerp(start, end, ClosestFraction(start, end, x, z));
+    const double distance = std::hypot(point.x - x, point.z - z);
+    if (distance <= maxDistance && (!best || distance < best->distance)) best = RouteMatch{point, distance};
+  };
+  const auto considerCell = [&](const std::vector<PointRef>& refs) {
+    for (const PointRef ref : refs) {
+      const RoutePoint end = Unpack(ref);
+      const auto previous = Predecessor(ref);
+      consider(previous ? Unpack(*previous) : end, end);
+    }
+  };
+
+  // Search rings of cells around the query until nothing closer can be found. Once the rings
+  // would cover more cells than the grid holds, scanning the grid itself is cheaper.
+  const int64_t queryX = CellOf(x);
+  const int64_t queryZ = CellOf(z);
+  // An infinite or huge distance is clamped first; the grid scan below takes over long before.
+  const double ringCount = std::ceil(std::max(maxDistance, 0.0) / CellSize);
+  const int64_t rings = ringCount < static_cast<double>(MaxCell) ? static_cast<int64_t>(ringCount) : MaxCell;
+  for (int64_t ring = 0; ring <= rings; ++ring) {
+    const uint64_t side = static_cast<uint64_t>(2 * ring + 1);
+    if (side * side > m_grid.size()) {
+      for (const auto& [key, refs] : m_grid) considerCell(refs);
+      break;
+    }
+    for (int64_t dx = -ring; dx <= ring; ++dx) {
+      for (int64_t dz = -ring; dz <= ring; ++dz) {
+        if (std::max(std::abs(dx), std::abs(dz)) != ring) continue;
+        if (const auto it = m_grid.find(CellKey(queryX + dx, queryZ + dz)); it != m_grid.end()) considerCell(it->second);
+      }
+    }
+    if (best && best->distance <= ring * CellSize) break;
+  }
+
+  // The stretch driven since the last kept vertex.
+  if (m_anchor && !m_window.empty()) consider(*m_anchor, m_window.back());
+  return best;
+}
+
+size_t RouteStore::FindInBox(double minX, double minZ, double maxX, double maxZ, std::vector<RoutePoint>& out, size_t maxCount) const {
+  if (std::isnan(minX) || std::isnan(minZ) || std::isnan(maxX) || std::isnan(maxZ)) return 0;
+  std::lock_guard lock(m_mutex);
+  size_t found = 0;
+  const auto collect = [&](PointRef ref) {
+    const RoutePoint point = Unpack(ref);
+    if (point.x < minX || point.x > maxX || point.z < minZ || point.z > maxZ) return;
+    if (found++ < maxCount) out.push_back(point);
+  };
+
+  const int64_t firstX = CellOf(minX);
+  const int64_t lastX = CellOf(maxX);
+  const int64_t firstZ = CellOf(minZ);
+  const int64_t lastZ = CellOf(maxZ);
+  if (lastX < firstX || lastZ < firstZ) return 0;
+
+  const double cells = (static_cast<double>(lastX - firstX) + 1.0) * (static_cast<double>(lastZ - firstZ) + 1.0);
+  if (cells > static_cast<double>(m_grid.size())) {
+    for (size_t c = 0; c < m_chunks.size(); ++c) {
+      for (size_t p = 0; p < m_chunks[c].points.size(); ++p) collect(static_cast<PointRef>(c << PointBits | p));
+    }
+    return found;
+  }
+
+  for (int64_t cellX = firstX; cellX <= lastX; ++cellX) {
+    for (int64_t cellZ = firstZ; cellZ <= lastZ; ++cellZ) {
+      const auto it = m_grid.find(CellKey(cellX, cellZ));
+      if (it == m_grid.end()) continue;
+      for (const PointRef ref : it->second) {
+        // A vertex is listed in every cell its segment touches; count it only in its own.
+        const RoutePoint point = Unpack(ref);
+        if (CellOf(point.x) == cellX && CellOf(point.z) == cellZ) collect(ref);
+      }
+    }
+  }
+  return found;
+}
+
+RouteStats RouteStore::GetStats() const {
+  std::lock_guard lock(m_mutex);
+  RouteStats stats = m_stats;
+  stats.memoryBytes = m_chunks.capacity() * sizeof(Chunk);
+  for (const auto& chunk : m_chunks) stats.memoryBytes += chunk.points.capacity() * sizeof(PackedPoint);
+  stats.memoryBytes += m_grid.bucket_count() * sizeof(void*);
+  for (const auto& [key, refs] : m_grid) stats.memoryBytes += sizeof(key) + sizeof(refs) + sizeof(void*) + refs.capacity() * sizeof(PointRef);
+  return stats;
+}
+
+bool RouteStore::Save(const std::string& path) {
+  std::lock_guard lock(m_mutex);
+  FlushWindow();
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) return false;
+
+  file.write(FileMagic, sizeof(FileMagic));
+  Write(file, FileVersion);
+  Write(file, static_cast<uint32_t>(m_chunks.size()));
+  for (const auto& chunk : m_chunks) {
+    Write(file, chunk.originX);
+    Write(file, chunk.originY);
+    Write(file, chunk.originZ);
+    Write(file, chunk.startTime);
+    Write(file, static_cast<uint8_t>(chunk.continuesPrevious));
+    Write(file, static_cast<uint32_t>(chunk.points.size()));
+    file.write(reinterpret_cast<const char*>(chunk.points.data()), static_cast<std::streamsize>(chunk.points.size() * sizeof(PackedPoint)));
+  }
+  return static_cast<bool>(file);
+}
+
+bool RouteStore::Load(const std::string& path) {
+  static_assert(sizeof(PackedPoint) == 12, "The file stores packed points as they are in memory");
+
+  std::ifstream file(path, std::ios::binary);
+  char magic[sizeof(FileMagic)] = {};
+  uint32_t version = 0;
+  uint32_t chunkCount = 0;
+  if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, FileMagic, sizeof(FileMagic)) != 0) return false;
+  if (!Read(file, version) || version != FileVersion || !Read(file, chunkCount)) return false;
+  if (chunkCount > (size_t{1} << (32 - PointBits))) return false;
+
+  std::vector<Chunk> chunks(chunkCount);
+  for (auto& chunk : chunks) {
+    uint8_t continuesPrevious = 0;
+    uint32_t pointCount = 0;
+    if (!Read(file, chunk.originX) || !Read(file, chunk.originY) || !Read(file, chunk.originZ) || !Read(file, chunk.startTime) ||
+        !Read(file, continuesPrevious) || !Read(file, pointCount)) {
+      return false;
+    }
+    if (pointCount == 0 || pointCount > ChunkCapacity) return false;
+    chunk.continuesPrevious = continuesPrevious != 0 && &chunk != &chunks.front();
+    chunk.points.resize(pointCount);
+    if (!file.read(reinterpret_cast<char*>(chunk.points.data()), static_cast<std::streamsize>(pointCount * sizeof(PackedPoint)))) return false;
+  }
+
+  std::lock_guard lock(m_mutex);
+  m_chunks = std::move(chunks);
+  m_grid.clear();
+  m_stats = {};
+  m_anchor.reset();
+  m_window.clear();
+  m_lastSample.reset();
+  m_breakPending = false;
+
+  for (size_t c = 0; c < m_chunks.size(); ++c) {
+    if (!m_chunks[c].continuesPrevious) ++m_stats.tracks;
+    for (size_t p = 0; p < m_chunks[c].points.size(); ++p) {
+      const PointRef ref = static_cast<PointRef>(c << PointBits | p);
+      if (const auto previous = Predecessor(ref)) m_stats.length += Distance(Unpack(*previous), Unpack(ref));
+      ++m_stats.points;
+      Index(ref);
+    }
+  }
+  m_stats.samples = m_stats.points;
+  return true;
+}
+}  // namespace Telemetry
+SPF_NS_END
@@ -1,6 +1,9 @@
 #include "SPF/Telemetry/SCSTelemetryService.hpp"
 
+#include <cstdio>
 #include <cstring>
+#include <iterator>
+#include <string>
 
 #include "SPF/Logging/Logger.hpp"
 #include "SPF/Telemetry/GameContext.hpp"
@@ -28,7 +31,25 @@ SCSTelemetryService::SCSTelemetryService(Logging::Logger& logger, GameContext& c
   m_eventsProcessor = (std::make_unique<EventsProcessor>(logger, context));
   m_controlsProcessor = (std::make_unique<ControlsProcessor>(logger, context));
   m_gearboxProcessor = (std::make_unique<GearboxProcessor>(logger, context));
+  m_derivedChannels = std::make_unique<DerivedChannelRegistry>();
+  m_channelDemand = std::make_shared<ChannelDemand>();
+  m_channelSubscriptions = std::make_shared<ChannelSubscriptionRegistry>();
+  m_triggerEngine = std::make_shared<TriggerEngine>();
+  m_fieldHistory = std::make_shared<FieldHistory>();
+  m_commonChannels = AcquireChannels(MakeChannelGroupMask(ChannelGroup::Common));
   m_lastFrameTime = (std::chrono::steady_clock::now());
+#if SPF_TELEMETRY_TIMING
+  auto& timing = TimingRegistry::GetInstance();
+  m_timing.frameStart = timing.Add("Service: frame start (total)");
+  m_timing.processors = timing.Add("Service: processors");
+  m_timing.derived = timing.Add("Service: derived channels");
+  m_timing.snapshot = timing.Add("Service: snapshot");
+  m_timing.dispatch = timing.Add("Service: signal dispatch");
+  m_timing.channels = timing.Add("Service: channel registration");
+  m_timing.configuration = timing.Add("Service: configuration event");
+  m_timing.gameplayEvent = timing.Add("Service: gameplay event");
+#endif
+  PublishSnapshot();  // Consumers always get a (possibly empty) snapshot, never null.
 
   m_logger.Info("SCSTelemetryService and all its processors created.");
 }
@@ -42,7 +63,6 @@ void SCSTelemetryService::Initialize(const scs_telemetry_init_params_t* const pa
   // Store SDK functions for later use
   m_register_for_channel = versioned_params->register_for_channel;
   m_unregister_from_channel = versioned_params->unregister_from_channel;
-  m_registered_trailer_wheel_counts.resize(SCS_TELEMETRY_trailers_count, 0);
 
   m_gameDataProcessor->Initialize(versioned_params);
   m_truckProcessor->Initialize(versioned_params);
@@ -57,199 +77,416 @@ void SCSTelemetryService::Initialize(const scs_telemetry_init_params_t* const pa
   if (registerForEvent) {
     registerForEvent(SCS_TELEMETRY_EVENT_configuration, StaticConfigurationCallback, this);
     registerForEvent(SCS_TELEMETRY_EVENT_frame_start, StaticFrameStartCallback, this);
+    registerForEvent(SCS_TELEMETRY_EVENT_frame_end, StaticFrameEndCallback, this);
     registerForEvent(SCS_TELEMETRY_EVENT_paused, StaticPausedCallback, this);
     registerForEvent(SCS_TELEMETRY_EVENT_started, StaticStartedCallback, this);
     registerForEvent(SCS_TELEMETRY_EVENT_gameplay, StaticGameplayEventCallback, this);
   }
 
-  // Register for all channels explicitly.
-  auto registerForChannel = versioned_params->register_for_channel;
-  if (registerForChannel) {
-    m_logger.Info("Registering all telemetry channels...");
-
-    // Common Channels
-    registerForChannel(SCS_TELEMETRY_CHANNEL_local_scale, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_CHANNEL_game_time, SCS_U32_NIL, SCS_VALUE_TYPE_u32, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_CHANNEL_multiplayer_time_offset, SCS_U32_NIL, SCS_VALUE_TYPE_s32, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_CHANNEL_next_rest_stop, SCS_U32_NIL, SCS_VALUE_TYPE_s32, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-
-    // Job Channels
-    registerForChannel(SCS_TELEMETRY_JOB_CHANNEL_cargo_damage, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-
-    // Truck Channels (including Controls and Navigation)
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_world_placement, SCS_U32_NIL, SCS_VALUE_TYPE_dplacement, SCS_TELEMETRY_CHANNEL_FLAG_each_frame, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_local_linear_velocity, SCS_U32_NIL, SCS_VALUE_TYPE_fvector, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_local_angular_velocity, SCS_U32_NIL, SCS_VALUE_TYPE_fvector, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_local_linear_acceleration, SCS_U32_NIL, SCS_VALUE_TYPE_fvector, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_local_angular_acceleration, SCS_U32_NIL, SCS_VALUE_TYPE_fvector, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_cabin_offset, SCS_U32_NIL, SCS_VALUE_TYPE_fplacement, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_cabin_angular_velocity, SCS_U32_NIL, SCS_VALUE_TYPE_fvector, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_cabin_angular_acceleration, SCS_U32_NIL, SCS_VALUE_TYPE_fvector, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_head_offset, SCS_U32_NIL, SCS_VALUE_TYPE_fplacement, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_speed, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_engine_rpm, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_engine_gear, SCS_U32_NIL, SCS_VALUE_TYPE_s32, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_displayed_gear, SCS_U32_NIL, SCS_VALUE_TYPE_s32, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_input_steering, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_input_throttle, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_input_brake, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_input_clutch, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_effective_steering, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_effective_throttle, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_effective_brake, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_effective_clutch, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_cruise_control, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_hshifter_slot, SCS_U32_NIL, SCS_VALUE_TYPE_u32, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_parking_brake, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_motor_brake, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_retarder_level, SCS_U32_NIL, SCS_VALUE_TYPE_u32, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_brake_air_pressure, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_brake_air_pressure_warning, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_brake_air_pressure_emergency, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_brake_temperature, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_fuel, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_fuel_warning, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_fuel_average_consumption, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_fuel_range, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-
-    if (strcmp(versioned_params->common.game_id, SCS_GAME_ID_EUT2) == 0) {
-      registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_adblue, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-      registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_adblue_warning, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-      //registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_adblue_average_consumption, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
+  // Everything demanded so far is registered now; later demand is applied at frame start.
+  BindChannels();
+  ApplyChannelDemand();
+}
+
+namespace {
+/**
+ * @brief Where the channel table's values live, resolved against the processors once.
+ */
+struct ChannelTargets {
+  SCS::GameState* gameState;
+  SCS::CommonData* commonData;
+  SCS::TruckData* truck;
+  SCS::Controls* controls;
+  SCS::JobData* job;
+  SCS::NavigationData* navigation;
+  FieldMask* gameDataChanges;
+  FieldMask* truckChanges;
+  FieldMask* controlsChanges;
+  FieldMask* jobChanges;
+  GameDataProcessor* gameDataProcessor;  // Owner passed to notify hooks
+};
+
+/**
+ * @brief Describes one non-indexed channel: its SDK name and type, the group it is
+ * registered with, and how to bind it to its field.
+ */
+struct ChannelDef {
+  using BindFn = ChannelBinding (*)(const ChannelTargets& targets, Field field, ChannelBinding::NotifyFn notify);
+
+  const char* name;
+  scs_value_type_t type;
+  ChannelGroup group;
+  BindFn bind;
+  Field field = Field::Count;  // Field::Count for channels that are not tracked
+  ChannelBinding::NotifyFn notify = nullptr;
+  scs_u32_t flags = SCS_TELEMETRY_CHANNEL_FLAG_none;
+  bool ets2Only = false;
+};
+
+/// Binds `targets.*Root` followed by the member path, tracking changes in `targets.*Changes`.
+template <auto Root, auto Changes, auto... Path>
+ChannelBinding BindTarget(const ChannelTargets& targets, Field field, ChannelBinding::NotifyFn notify) {
+  auto& value = (*(targets.*Root) .* ... .* Path);
+  const ChannelBinding binding = BindField(value, notify ? targets.gameDataProcessor : nullptr, notify);
+  return field == Field::Count ? binding : binding.Track(*(targets.*Changes), field);
+}
+
+template <auto... Path>
+constexpr ChannelDef::BindFn GameStateValue = &BindTarget<&ChannelTargets::gameState, &ChannelTargets::gameDataChanges, Path...>;
+template <auto... Path>
+constexpr ChannelDef::BindFn CommonValue = &BindTarget<&ChannelTargets::commonData, &ChannelTargets::gameDataChanges, Path...>;
+template <auto... Path>
+constexpr ChannelDef::BindFn TruckValue = &BindTarget<&ChannelTargets::truck, &ChannelTargets::truckChanges, Path...>;
+template <auto... Path>
+constexpr ChannelDef::BindFn ControlsValue = &BindTarget<&ChannelTargets::controls, &ChannelTargets::controlsChanges, Path...>;
+template <auto... Path>
+constexpr ChannelDef::BindFn JobValue = &BindTarget<&ChannelTargets::job, &ChannelTargets::jobChanges, Path...>;
+template <auto... Path>
+constexpr ChannelDef::BindFn NavigationValue = &BindTarget<&ChannelTargets::navigation, &ChannelTargets::jobChanges, Path...>;
+
+// Post-write hooks for channels that feed derived values in GameDataProcessor.
+void RecalculateRestStop(void* owner) { static_cast<GameDataProcessor*>(owner)->RecalculateRestStopTime(); }
+void RecalculateRealTime(void* owner) { static_cast<GameDataProcessor*>(owner)->RecalculateRealTimeDurations(); }
+void RecalculateRestStopAndRealTime(void* owner) {
+  auto* processor = static_cast<GameDataProcessor*>(owner);
+  processor->RecalculateRestStopTime();
+  processor->RecalculateRealTimeDurations();
+}
+
+using SCS::TruckData;
+using SCS::ControlValues;
+constexpr scs_u32_t kEachFrame = SCS_TELEMETRY_CHANNEL_FLAG_each_frame;
+
+// clang-format off
+constexpr ChannelDef kChannels[] = {
+    // Common channels
+    {SCS_TELEMETRY_CHANNEL_local_scale, SCS_VALUE_TYPE_float, ChannelGroup::Common, GameStateValue<&SCS::GameState::scale>, Field::GameScale, RecalculateRealTime},
+    {SCS_TELEMETRY_CHANNEL_game_time, SCS_VALUE_TYPE_u32, ChannelGroup::Common, CommonValue<&SCS::CommonData::game_time>, Field::GameTime, RecalculateRestStop},
+    {SCS_TELEMETRY_CHANNEL_multiplayer_time_offset, SCS_VALUE_TYPE_s32, ChannelGroup::Common, GameStateValue<&SCS::GameState::multiplayer_time_offset>, Field::MultiplayerTimeOffset},
+    {SCS_TELEMETRY_CHANNEL_next_rest_stop, SCS_VALUE_TYPE_s32, ChannelGroup::Common, CommonValue<&SCS::CommonData::next_rest_stop>, Field::NextRestStop, RecalculateRestStopAndRealTime},
+
+    // Job channels
+    {SCS_TELEMETRY_JOB_CHANNEL_cargo_damage, SCS_VALUE_TYPE_float, ChannelGroup::Job, JobValue<&SCS::JobData::cargo_damage>, Field::JobCargoDamage},
+
+    // Truck motion channels
+    {SCS_TELEMETRY_TRUCK_CHANNEL_world_placement, SCS_VALUE_TYPE_dplacement, ChannelGroup::TruckMotion, TruckValue<&TruckData::world_placement>, Field::Count, nullptr, kEachFrame},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_local_linear_velocity, SCS_VALUE_TYPE_fvector, ChannelGroup::TruckMotion, TruckValue<&TruckData::local_linear_velocity>},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_local_angular_velocity, SCS_VALUE_TYPE_fvector, ChannelGroup::TruckMotion, TruckValue<&TruckData::local_angular_velocity>},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_local_linear_acceleration, SCS_VALUE_TYPE_fvector, ChannelGroup::TruckMotion, TruckValue<&TruckData::local_linear_acceleration>},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_local_angular_acceleration, SCS_VALUE_TYPE_fvector, ChannelGroup::TruckMotion, TruckValue<&TruckData::local_angular_acceleration>},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_cabin_offset, SCS_VALUE_TYPE_fplacement, ChannelGroup::TruckMotion, TruckValue<&TruckData::cabin_offset>},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_cabin_angular_velocity, SCS_VALUE_TYPE_fvector, ChannelGroup::TruckMotion, TruckValue<&TruckData::cabin_angular_velocity>},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_cabin_angular_acceleration, SCS_VALUE_TYPE_fvector, ChannelGroup::TruckMotion, TruckValue<&TruckData::cabin_angular_acceleration>},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_head_offset, SCS_VALUE_TYPE_fplacement, ChannelGroup::TruckMotion, TruckValue<&TruckData::head_offset>},
+
+    // Truck channels
+    {SCS_TELEMETRY_TRUCK_CHANNEL_speed, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::speed>, Field::TruckSpeed},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_engine_rpm, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::engine_rpm>, Field::TruckEngineRpm},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_engine_gear, SCS_VALUE_TYPE_s32, ChannelGroup::Truck, TruckValue<&TruckData::gear>, Field::TruckGear},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_displayed_gear, SCS_VALUE_TYPE_s32, ChannelGroup::Truck, TruckValue<&TruckData::displayed_gear>, Field::TruckDisplayedGear},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_cruise_control, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::cruise_control_speed>, Field::TruckCruiseControlSpeed},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_hshifter_slot, SCS_VALUE_TYPE_u32, ChannelGroup::Truck, TruckValue<&TruckData::hshifter_slot>, Field::TruckHShifterSlot},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_parking_brake, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::parking_brake>, Field::TruckParkingBrake},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_motor_brake, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::motor_brake>, Field::TruckMotorBrake},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_retarder_level, SCS_VALUE_TYPE_u32, ChannelGroup::Truck, TruckValue<&TruckData::retarder_level>, Field::TruckRetarderLevel},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_brake_air_pressure, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::air_pressure>, Field::TruckAirPressure},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_brake_air_pressure_warning, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::air_pressure_warning>, Field::TruckAirPressureWarning},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_brake_air_pressure_emergency, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::air_pressure_emergency>, Field::TruckAirPressureEmergency},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_brake_temperature, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::brake_temperature>, Field::TruckBrakeTemperature},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_fuel, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::fuel_amount>, Field::TruckFuelAmount},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_fuel_warning, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::fuel_warning>, Field::TruckFuelWarning},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_fuel_average_consumption, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::fuel_average_consumption>, Field::TruckFuelAverageConsumption},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_fuel_range, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::fuel_range>, Field::TruckFuelRange},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_adblue, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::adblue_amount>, Field::TruckAdblueAmount, nullptr, SCS_TELEMETRY_CHANNEL_FLAG_none, true},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_adblue_warning, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::adblue_warning>, Field::TruckAdblueWarning, nullptr, SCS_TELEMETRY_CHANNEL_FLAG_none, true},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_oil_pressure, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::oil_pressure>, Field::TruckOilPressure},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_oil_pressure_warning, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::oil_pressure_warning>, Field::TruckOilPressureWarning},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_oil_temperature, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::oil_temperature>, Field::TruckOilTemperature},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_water_temperature, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::water_temperature>, Field::TruckWaterTemperature},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_water_temperature_warning, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::water_temperature_warning>, Field::TruckWaterTemperatureWarning},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_battery_voltage, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::battery_voltage>, Field::TruckBatteryVoltage},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_battery_voltage_warning, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::battery_voltage_warning>, Field::TruckBatteryVoltageWarning},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_electric_enabled, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::electric_enabled>, Field::TruckElectricEnabled},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_engine_enabled, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::engine_enabled>, Field::TruckEngineEnabled},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wipers, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::wipers>, Field::TruckWipers},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_differential_lock, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::differential_lock>, Field::TruckDifferentialLock},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_lift_axle, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::lift_axle>, Field::TruckLiftAxle},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_lift_axle_indicator, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::lift_axle_indicator>, Field::TruckLiftAxleIndicator},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_trailer_lift_axle, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::trailer_lift_axle>, Field::TruckTrailerLiftAxle},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_trailer_lift_axle_indicator, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::trailer_lift_axle_indicator>, Field::TruckTrailerLiftAxleIndicator},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_lblinker, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::lblinker>, Field::TruckLBlinker},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_rblinker, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::rblinker>, Field::TruckRBlinker},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_hazard_warning, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::hazard_warning>, Field::TruckHazardWarning},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_lblinker, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::light_lblinker>, Field::TruckLightLBlinker},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_rblinker, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::light_rblinker>, Field::TruckLightRBlinker},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_parking, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::light_parking>, Field::TruckLightParking},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_low_beam, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::light_low_beam>, Field::TruckLightLowBeam},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_high_beam, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::light_high_beam>, Field::TruckLightHighBeam},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_aux_front, SCS_VALUE_TYPE_u32, ChannelGroup::Truck, TruckValue<&TruckData::light_aux_front>, Field::TruckLightAuxFront},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_aux_roof, SCS_VALUE_TYPE_u32, ChannelGroup::Truck, TruckValue<&TruckData::light_aux_roof>, Field::TruckLightAuxRoof},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_beacon, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::light_beacon>, Field::TruckLightBeacon},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_brake, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::light_brake>, Field::TruckLightBrake},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_reverse, SCS_VALUE_TYPE_bool, ChannelGroup::Truck, TruckValue<&TruckData::light_reverse>, Field::TruckLightReverse},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_dashboard_backlight, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::dashboard_backlight>, Field::TruckDashboardBacklight},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wear_engine, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::wear_engine>, Field::TruckWearEngine},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wear_transmission, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::wear_transmission>, Field::TruckWearTransmission},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wear_cabin, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::wear_cabin>, Field::TruckWearCabin},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wear_chassis, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::wear_chassis>, Field::TruckWearChassis},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wear_wheels, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::wear_wheels>, Field::TruckWearWheels},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_odometer, SCS_VALUE_TYPE_float, ChannelGroup::Truck, TruckValue<&TruckData::odometer>, Field::TruckOdometer},
+
+    // Input channels are owned by ControlsProcessor.
+    {SCS_TELEMETRY_TRUCK_CHANNEL_input_steering, SCS_VALUE_TYPE_float, ChannelGroup::Controls, ControlsValue<&SCS::Controls::userInput, &ControlValues::steering>, Field::UserSteering},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_input_throttle, SCS_VALUE_TYPE_float, ChannelGroup::Controls, ControlsValue<&SCS::Controls::userInput, &ControlValues::throttle>, Field::UserThrottle},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_input_brake, SCS_VALUE_TYPE_float, ChannelGroup::Controls, ControlsValue<&SCS::Controls::userInput, &ControlValues::brake>, Field::UserBrake},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_input_clutch, SCS_VALUE_TYPE_float, ChannelGroup::Controls, ControlsValue<&SCS::Controls::userInput, &ControlValues::clutch>, Field::UserClutch},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_effective_steering, SCS_VALUE_TYPE_float, ChannelGroup::Controls, ControlsValue<&SCS::Controls::effectiveInput, &ControlValues::steering>, Field::EffectiveSteering},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_effective_throttle, SCS_VALUE_TYPE_float, ChannelGroup::Controls, ControlsValue<&SCS::Controls::effectiveInput, &ControlValues::throttle>, Field::EffectiveThrottle},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_effective_brake, SCS_VALUE_TYPE_float, ChannelGroup::Controls, ControlsValue<&SCS::Controls::effectiveInput, &ControlValues::brake>, Field::EffectiveBrake},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_effective_clutch, SCS_VALUE_TYPE_float, ChannelGroup::Controls, ControlsValue<&SCS::Controls::effectiveInput, &ControlValues::clutch>, Field::EffectiveClutch},
+
+    // Navigation channels are owned by JobProcessor.
+    {SCS_TELEMETRY_TRUCK_CHANNEL_navigation_distance, SCS_VALUE_TYPE_float, ChannelGroup::Navigation, NavigationValue<&SCS::NavigationData::navigation_distance>, Field::NavigationDistance},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_navigation_time, SCS_VALUE_TYPE_float, ChannelGroup::Navigation, NavigationValue<&SCS::NavigationData::navigation_time>, Field::NavigationTime},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_navigation_speed_limit, SCS_VALUE_TYPE_float, ChannelGroup::Navigation, NavigationValue<&SCS::NavigationData::navigation_speed_limit>, Field::NavigationSpeedLimit},
+};
+// clang-format on
+
+/**
+ * @brief Describes one per-trailer channel, registered as "trailer.<index>.<suffix>".
+ */
+struct TrailerChannel {
+  const char* suffix;
+  scs_value_type_t type;
+  ChannelBinding (*bind)(SCS::TrailerData& data);
+};
+
+template <auto Member>
+ChannelBinding BindTrailerValue(SCS::TrailerData& data) {
+  return BindField(data.*Member);
+}
+
+constexpr TrailerChannel kTrailerChannels[SCSTelemetryService::TrailerChannelCount] = {
+    {"connected", SCS_VALUE_TYPE_bool, &BindTrailerValue<&SCS::TrailerData::connected>},
+    {"cargo.damage", SCS_VALUE_TYPE_float, &BindTrailerValue<&SCS::TrailerData::cargo_damage>},
+    {"world.placement", SCS_VALUE_TYPE_dplacement, &BindTrailerValue<&SCS::TrailerData::world_placement>},
+    {"velocity.linear", SCS_VALUE_TYPE_fvector, &BindTrailerValue<&SCS::TrailerData::local_linear_velocity>},
+    {"velocity.angular", SCS_VALUE_TYPE_fvector, &BindTrailerValue<&SCS::TrailerData::local_angular_velocity>},
+    {"acceleration.linear", SCS_VALUE_TYPE_fvector, &BindTrailerValue<&SCS::TrailerData::local_linear_acceleration>},
+    {"acceleration.angular", SCS_VALUE_TYPE_fvector, &BindTrailerValue<&SCS::TrailerData::local_angular_acceleration>},
+    {"wear.body", SCS_VALUE_TYPE_float, &BindTrailerValue<&SCS::TrailerData::wear_body>},
+    {"wear.chassis", SCS_VALUE_TYPE_float, &BindTrailerValue<&SCS::TrailerData::wear_chassis>},
+    {"wear.wheels", SCS_VALUE_TYPE_float, &BindTrailerValue<&SCS::TrailerData::wear_wheels>},
+};
+
+/**
+ * @brief Describes one per-wheel channel. Truck and trailer wheels expose the same
+ * set of channels, so a single table drives both registrations.
+ */
+struct WheelChannel {
+  const char* truck_name;
+  const char* trailer_suffix;  // Appended to "trailer.<index>."
+  scs_value_type_t type;
+  ChannelBinding::WriteFn write;
+};
+
+using namespace ChannelWriters;
+const WheelChannel kWheelChannels[SCSTelemetryService::WheelChannelCount] = {
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wheel_susp_deflection, "wheel.suspension.deflection", SCS_VALUE_TYPE_float, &WriteWheelField<&SCS::WheelDataStore::suspension_deflection>},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wheel_on_ground, "wheel.on_ground", SCS_VALUE_TYPE_bool, &WriteWheelOnGround},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wheel_substance, "wheel.substance", SCS_VALUE_TYPE_u32, &WriteWheelField<&SCS::WheelDataStore::substance>},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wheel_velocity, "wheel.angular_velocity", SCS_VALUE_TYPE_float, &WriteWheelField<&SCS::WheelDataStore::angular_velocity>},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wheel_steering, "wheel.steering", SCS_VALUE_TYPE_float, &WriteWheelField<&SCS::WheelDataStore::steering>},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wheel_rotation, "wheel.rotation", SCS_VALUE_TYPE_float, &WriteWheelField<&SCS::WheelDataStore::rotation>},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wheel_lift, "wheel.lift", SCS_VALUE_TYPE_float, &WriteWheelField<&SCS::WheelDataStore::lift>},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wheel_lift_offset, "wheel.lift.offset", SCS_VALUE_TYPE_float, &WriteWheelField<&SCS::WheelDataStore::lift_offset>},
+};
+}  // namespace
+
+void SCSTelemetryService::BindChannels() {
+  const ChannelTargets targets{&m_gameDataProcessor->GetMutableGameState(),
+                               &m_gameDataProcessor->GetMutableCommonData(),
+                               &m_truckProcessor->GetMutableData(),
+                               &m_controlsProcessor->GetMutableData(),
+                               &m_jobProcessor->GetMutableJobData(),
+                               &m_jobProcessor->GetMutableNavigationData(),
+                               &m_gameDataProcessor->GetMutableChangedFields(),
+                               &m_truckProcessor->GetMutableChangedFields(),
+                               &m_controlsProcessor->GetMutableChangedFields(),
+                               &m_jobProcessor->GetMutableChangedFields(),
+                               m_gameDataProcessor.get()};
+
+  m_channelBindings.clear();
+  m_channelBindings.reserve(std::size(kChannels));
+  for (const auto& channel : kChannels) {
+    m_channelBindings.push_back(channel.bind(targets, channel.field, channel.notify));
+  }
+
+  // Per-wheel and per-selector bindings target the containers rather than single
+  // elements; the writers bounds-check the index the SDK passes in.
+  auto& truck = m_truckProcessor->GetMutableData();
+  for (size_t i = 0; i < WheelChannelCount; ++i) {
+    m_truckWheelBindings[i] = ChannelBinding{&truck.wheels, kWheelChannels[i].write};
+  }
+  m_hshifterSelectorBinding = ChannelBinding{&truck.hshifter_selector, &ChannelWriters::WriteBoolElement};
+
+  auto& trailers = m_trailerProcessor->GetMutableData();
+  auto& changedTrailers = m_trailerProcessor->GetMutableChangedTrailers();
+  m_trailerChannels.clear();
+  m_trailerChannels.resize(trailers.size());
+  for (size_t t = 0; t < trailers.size(); ++t) {
+    auto& channels = m_trailerChannels[t];
+    const std::string prefix = "trailer." + std::to_string(t) + ".";
+    for (size_t i = 0; i < TrailerChannelCount; ++i) {
+      channels.names[i] = prefix + kTrailerChannels[i].suffix;
+      channels.bindings[i] = kTrailerChannels[i].bind(trailers[t].data).TrackTrailer(changedTrailers, static_cast<uint32_t>(t));
+    }
+    for (size_t i = 0; i < WheelChannelCount; ++i) {
+      channels.wheelNames[i] = prefix + kWheelChannels[i].trailer_suffix;
+      channels.wheelBindings[i] = ChannelBinding{&trailers[t].data.wheels, kWheelChannels[i].write}.TrackTrailer(changedTrailers, static_cast<uint32_t>(t));
     }
+  }
+
+  ListSubscribableChannels();
+}
 
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_oil_pressure, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_oil_pressure_warning, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_oil_temperature, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_water_temperature, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_water_temperature_warning, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_battery_voltage, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_battery_voltage_warning, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_electric_enabled, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_engine_enabled, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_wipers, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_differential_lock, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_lift_axle, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_lift_axle_indicator, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_trailer_lift_axle, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_trailer_lift_axle_indicator, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_lblinker, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_rblinker, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_hazard_warning, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_light_lblinker, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_light_rblinker, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_light_parking, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_light_low_beam, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_light_high_beam, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_light_aux_front, SCS_U32_NIL, SCS_VALUE_TYPE_u32, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_light_aux_roof, SCS_U32_NIL, SCS_VALUE_TYPE_u32, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_light_beacon, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_light_brake, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_light_reverse, SCS_U32_NIL, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_dashboard_backlight, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_wear_engine, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_wear_transmission, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_wear_cabin, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_wear_chassis, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_wear_wheels, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_odometer, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_navigation_distance, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_navigation_time, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    registerForChannel(SCS_TELEMETRY_TRUCK_CHANNEL_navigation_speed_limit, SCS_U32_NIL, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
+void SCSTelemetryService::ListSubscribableChannels() {
+  using ChannelInfo = ChannelSubscriptionRegistry::ChannelInfo;
+  auto& registry = *m_channelSubscriptions;
+  registry.ClearChannels();
+
+  const bool isEts2 = m_context.IsETS2();
+  for (size_t i = 0; i < std::size(kChannels); ++i) {
+    const auto& channel = kChannels[i];
+    if (channel.ets2Only && !isEts2) continue;
+    registry.AddChannel(ChannelInfo{channel.name, channel.type, channel.flags, channel.group, false, &m_channelBindings[i]});
+  }
+  for (size_t i = 0; i < WheelChannelCount; ++i) {
+    registry.AddChannel(ChannelInfo{kWheelChannels[i].truck_name, kWheelChannels[i].type, SCS_TELEMETRY_CHANNEL_FLAG_none, ChannelGroup::TruckWheels, true, &m_truckWheelBindings[i]});
+  }
+  registry.AddChannel(ChannelInfo{SCS_TELEMETRY_TRUCK_CHANNEL_hshifter_selector, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, ChannelGroup::Truck, true, &m_hshifterSelectorBinding});
+
+  for (auto& channels : m_trailerChannels) {
+    for (size_t i = 0; i < TrailerChannelCount; ++i) {
+      registry.AddChannel(ChannelInfo{channels.names[i], kTrailerChannels[i].type, SCS_TELEMETRY_CHANNEL_FLAG_none, ChannelGroup::Trailers, false, &channels.bindings[i]});
+    }
+    for (size_t i = 0; i < WheelChannelCount; ++i) {
+      registry.AddChannel(ChannelInfo{channels.wheelNames[i], kWheelChannels[i].type, SCS_TELEMETRY_CHANNEL_FLAG_none, ChannelGroup::Trailers, true, &channels.wheelBindings[i]});
+    }
   }
 }
 
-void SCSTelemetryService::UpdateTrailerWheelChannels(scs_u32_t trailer_index, scs_u32_t wheel_count) {
+void SCSTelemetryService::RefreshChannel(const ChannelSubscriptionRegistry::ChannelInfo& channel, scs_u32_t index) {
   if (!m_register_for_channel || !m_unregister_from_channel) return;
-  if (trailer_index >= m_registered_trailer_wheel_counts.size()) return;
+  // A channel that is not registered yet sends its value once it is.
+  if (m_unregister_from_channel(channel.name.c_str(), index, channel.type) != SCS_RESULT_ok) return;
+  m_register_for_channel(channel.name.c_str(), index, channel.type, channel.flags, ChannelBinding::StaticChannelCallback, channel.binding);
+}
+
+void SCSTelemetryService::ApplyChannelDemand() {
+  if (m_appliedDemandRevision == m_channelDemand->GetRevision() && !m_channelLayoutDirty) return;
+  SPF_TELEMETRY_TIME_SCOPE(m_timing.channels);
+  m_appliedDemandRevision = m_channelDemand->GetRevision();
+  m_channelLayoutDirty = false;
+  ApplyChannelGroups(m_channelDemand->GetGroups());
+}
+
+void SCSTelemetryService::ApplyChannelGroups(const ChannelGroupMask& groups) {
+  if (!m_register_for_channel || !m_unregister_from_channel) return;
+
+  UpdateTableChannels(groups);
+
+  const auto& truckConstants = m_truckProcessor->GetConstants();
+  UpdateTruckWheelChannels(HasChannelGroup(groups, ChannelGroup::TruckWheels) ? truckConstants.wheel_count : 0);
+  UpdateHShifterSelectorChannels(HasChannelGroup(groups, ChannelGroup::Truck) ? truckConstants.selector_count : 0);
 
-  char channel_name[128];
-  scs_u32_t& registered_count = m_registered_trailer_wheel_counts[trailer_index];
+  // Trailer channels are registered once the trailer's configuration has arrived.
+  const auto& trailers = m_trailerProcessor->GetData();
+  const bool trailersDemanded = HasChannelGroup(groups, ChannelGroup::Trailers);
+  for (scs_u32_t t = 0; t < m_trailerChannels.size() && t < trailers.size(); ++t) {
+    const bool registered = trailersDemanded && m_trailerChannels[t].configured;
+    UpdateTrailerChannels(t, registered);
+    UpdateTrailerWheelChannels(t, registered ? trailers[t].constants.wheel_count : 0);
+  }
+}
+
+void SCSTelemetryService::UpdateTableChannels(const ChannelGroupMask& groups) {
+  const ChannelGroupMask changed = groups ^ m_registeredGroups;
+  if (changed.none()) return;
+
+  const bool isEts2 = m_context.IsETS2();
+  for (size_t i = 0; i < std::size(kChannels); ++i) {
+    const auto& channel = kChannels[i];
+    if (!HasChannelGroup(changed, channel.group) || (channel.ets2Only && !isEts2)) continue;
+
+    if (HasChannelGroup(groups, channel.group)) {
+      m_register_for_channel(channel.name, SCS_U32_NIL, channel.type, channel.flags, ChannelBinding::StaticChannelCallback, &m_channelBindings[i]);
+    } else {
+      m_unregister_from_channel(channel.name, SCS_U32_NIL, channel.type);
+    }
+  }
+  m_registeredGroups = groups;
+}
+
+void SCSTelemetryService::UpdateTrailerChannels(scs_u32_t trailer_index, bool registered) {
+  auto& channels = m_trailerChannels[trailer_index];
+  if (channels.registered == registered) return;
+
+  for (size_t i = 0; i < TrailerChannelCount; ++i) {
+    if (registered) {
+      m_register_for_channel(channels.names[i].c_str(), SCS_U32_NIL, kTrailerChannels[i].type, SCS_TELEMETRY_CHANNEL_FLAG_none, ChannelBinding::StaticChannelCallback, &channels.bindings[i]);
+    } else {
+      m_unregister_from_channel(channels.names[i].c_str(), SCS_U32_NIL, kTrailerChannels[i].type);
+    }
+  }
+  channels.registered = registered;
+}
+
+void SCSTelemetryService::UpdateTrailerWheelChannels(scs_u32_t trailer_index, scs_u32_t wheel_count) {
+  auto& channels = m_trailerChannels[trailer_index];
+  scs_u32_t& registered_count = channels.registeredWheelCount;
 
   // Unregister
   while (registered_count > wheel_count) {
     --registered_count;
-    sprintf(channel_name, "trailer.%u.wheel.suspension.deflection", trailer_index);
-    m_unregister_from_channel(channel_name, registered_count, SCS_VALUE_TYPE_float);
-    sprintf(channel_name, "trailer.%u.wheel.on_ground", trailer_index);
-    m_unregister_from_channel(channel_name, registered_count, SCS_VALUE_TYPE_bool);
-    sprintf(channel_name, "trailer.%u.wheel.substance", trailer_index);
-    m_unregister_from_channel(channel_name, registered_count, SCS_VALUE_TYPE_u32);
-    sprintf(channel_name, "trailer.%u.wheel.angular_velocity", trailer_index);
-    m_unregister_from_channel(channel_name, registered_count, SCS_VALUE_TYPE_float);
-    sprintf(channel_name, "trailer.%u.wheel.steering", trailer_index);
-    m_unregister_from_channel(channel_name, registered_count, SCS_VALUE_TYPE_float);
-    sprintf(channel_name, "trailer.%u.wheel.rotation", trailer_index);
-    m_unregister_from_channel(channel_name, registered_count, SCS_VALUE_TYPE_float);
-    sprintf(channel_name, "trailer.%u.wheel.lift", trailer_index);
-    m_unregister_from_channel(channel_name, registered_count, SCS_VALUE_TYPE_float);
-    sprintf(channel_name, "trailer.%u.wheel.lift.offset", trailer_index);
-    m_unregister_from_channel(channel_name, registered_count, SCS_VALUE_TYPE_float);
+    for (size_t i = 0; i < WheelChannelCount; ++i) {
+      m_unregister_from_channel(channels.wheelNames[i].c_str(), registered_count, kWheelChannels[i].type);
+    }
   }
 
   // Register
   while (registered_count < wheel_count) {
-    sprintf(channel_name, "trailer.%u.wheel.suspension.deflection", trailer_index);
-    m_register_for_channel(channel_name, registered_count, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    sprintf(channel_name, "trailer.%u.wheel.on_ground", trailer_index);
-    m_register_for_channel(channel_name, registered_count, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    sprintf(channel_name, "trailer.%u.wheel.substance", trailer_index);
-    m_register_for_channel(channel_name, registered_count, SCS_VALUE_TYPE_u32, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    sprintf(channel_name, "trailer.%u.wheel.angular_velocity", trailer_index);
-    m_register_for_channel(channel_name, registered_count, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    sprintf(channel_name, "trailer.%u.wheel.steering", trailer_index);
-    m_register_for_channel(channel_name, registered_count, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    sprintf(channel_name, "trailer.%u.wheel.rotation", trailer_index);
-    m_register_for_channel(channel_name, registered_count, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    sprintf(channel_name, "trailer.%u.wheel.lift", trailer_index);
-    m_register_for_channel(channel_name, registered_count, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    sprintf(channel_name, "trailer.%u.wheel.lift.offset", trailer_index);
-    m_register_for_channel(channel_name, registered_count, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
+    for (size_t i = 0; i < WheelChannelCount; ++i) {
+      m_register_for_channel(channels.wheelNames[i].c_str(), registered_count, kWheelChannels[i].type, SCS_TELEMETRY_CHANNEL_FLAG_none, ChannelBinding::StaticChannelCallback, &channels.wheelBindings[i]);
+    }
     ++registered_count;
   }
 }
 
 void SCSTelemetryService::UpdateTruckWheelChannels(scs_u32_t wheel_count) {
-  if (!m_register_for_channel || !m_unregister_from_channel) return;
-
   // Unregister channels for wheels that no longer exist.
   while (m_registered_truck_wheel_count > wheel_count) {
     --m_registered_truck_wheel_count;
-    m_unregister_from_channel(SCS_TELEMETRY_TRUCK_CHANNEL_wheel_susp_deflection, m_registered_truck_wheel_count, SCS_VALUE_TYPE_float);
-    m_unregister_from_channel(SCS_TELEMETRY_TRUCK_CHANNEL_wheel_on_ground, m_registered_truck_wheel_count, SCS_VALUE_TYPE_bool);
-    m_unregister_from_channel(SCS_TELEMETRY_TRUCK_CHANNEL_wheel_substance, m_registered_truck_wheel_count, SCS_VALUE_TYPE_u32);
-    m_unregister_from_channel(SCS_TELEMETRY_TRUCK_CHANNEL_wheel_velocity, m_registered_truck_wheel_count, SCS_VALUE_TYPE_float);
-    m_unregister_from_channel(SCS_TELEMETRY_TRUCK_CHANNEL_wheel_steering, m_registered_truck_wheel_count, SCS_VALUE_TYPE_float);
-    m_unregister_from_channel(SCS_TELEMETRY_TRUCK_CHANNEL_wheel_rotation, m_registered_truck_wheel_count, SCS_VALUE_TYPE_float);
-    m_unregister_from_channel(SCS_TELEMETRY_TRUCK_CHANNEL_wheel_lift, m_registered_truck_wheel_count, SCS_VALUE_TYPE_float);
-    m_unregister_from_channel(SCS_TELEMETRY_TRUCK_CHANNEL_wheel_lift_offset, m_registered_truck_wheel_count, SCS_VALUE_TYPE_float);
+    for (const auto& channel : kWheelChannels) {
+      m_unregister_from_channel(channel.truck_name, m_registered_truck_wheel_count, channel.type);
+    }
   }
 
   // Register channels for new wheels.
   while (m_registered_truck_wheel_count < wheel_count) {
-    m_register_for_channel(
-        SCS_TELEMETRY_TRUCK_CHANNEL_wheel_susp_deflection, m_registered_truck_wheel_count, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    m_register_for_channel(
-        SCS_TELEMETRY_TRUCK_CHANNEL_wheel_on_ground, m_registered_truck_wheel_count, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    m_register_for_channel(
-        SCS_TELEMETRY_TRUCK_CHANNEL_wheel_substance, m_registered_truck_wheel_count, SCS_VALUE_TYPE_u32, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    m_register_for_channel(
-        SCS_TELEMETRY_TRUCK_CHANNEL_wheel_velocity, m_registered_truck_wheel_count, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    m_register_for_channel(
-        SCS_TELEMETRY_TRUCK_CHANNEL_wheel_steering, m_registered_truck_wheel_count, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    m_register_for_channel(
-        SCS_TELEMETRY_TRUCK_CHANNEL_wheel_rotation, m_registered_truck_wheel_count, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    m_register_for_channel(
-        SCS_TELEMETRY_TRUCK_CHANNEL_wheel_lift, m_registered_truck_wheel_count, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
-    m_register_for_channel(
-        SCS_TELEMETRY_TRUCK_CHANNEL_wheel_lift_offset, m_registered_truck_wheel_count, SCS_VALUE_TYPE_float, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
+    for (size_t i = 0; i < WheelChannelCount; ++i) {
+      m_register_for_channel(kWheelChannels[i].truck_name,
+                             m_registered_truck_wheel_count,
+                             kWheelChannels[i].type,
+                             SCS_TELEMETRY_CHANNEL_FLAG_none,
+                             ChannelBinding::StaticChannelCallback,
+                             &m_truckWheelBindings[i]);
+    }
     ++m_registered_truck_wheel_count;
   }
 }
 
 void SCSTelemetryService::UpdateHShifterSelectorChannels(scs_u32_t selector_count) {
-  if (!m_register_for_channel || !m_unregister_from_channel) return;
-
   // Unregister channels for selectors that no longer exist.
   while (m_registered_hshifter_selector_count > selector_count) {
     --m_registered_hshifter_selector_count;
@@ -258,15 +495,23 @@ void SCSTelemetryService::UpdateHShifterSelectorChannels(scs_u32_t selector_coun
 
   // Register channels for new selectors.
   while (m_registered_hshifter_selector_count < selector_count) {
-    m_register_for_channel(
-        SCS_TELEMETRY_TRUCK_CHANNEL_hshifter_selector, m_registered_hshifter_selector_count, SCS_VALUE_TYPE_bool, SCS_TELEMETRY_CHANNEL_FLAG_none, StaticChannelCallback, this);
+    m_register_for_channel(SCS_TELEMETRY_TRUCK_CHANNEL_hshifter_selector,
+                           m_registered_hshifter_selector_count,
+                           SCS_VALUE_TYPE_bool,
+                           SCS_TELEMETRY_CHANNEL_FLAG_none,
+                           ChannelBinding::StaticChannelCallback,
+                           &m_hshifterSelectorBinding);
     ++m_registered_hshifter_selector_count;
   }
 }
 
 void SCSTelemetryService::Shutdown() {
   m_logger.Info("SCSTelemetryService shutting down.");
-  // TODO: Unregister channels
+  // Channels are not unregistered here: the game drops every registration once
+  // scs_telemetry_shutdown returns, and Shutdown may also run from the input SDK's
+  // shutdown, where the telemetry functions must not be called.
+  m_register_for_channel = nullptr;
+  m_unregister_from_channel = nullptr;
   m_controlsProcessor->Shutdown();
   m_eventsProcessor->Shutdown();
   m_jobProcessor->Shutdown();
@@ -283,19 +528,21 @@ void SCSTelemetryService::StaticConfigurationCallback(scs_event_t, const void* e
 
 void SCSTelemetryService::HandleConfiguration(const scs_telemetry_configuration_t* info) {
   if (!info || !info->id) return;
+  SPF_TELEMETRY_TIME_SCOPE(m_timing.configuration);
+  ++m_dataRevision;
 
   if (strcmp(info->id, SCS_TELEMETRY_CONFIG_truck) == 0) {
     m_truckProcessor->HandleConfiguration(info);
-    UpdateTruckWheelChannels(m_truckProcessor->GetConstants().wheel_count);
-    UpdateHShifterSelectorChannels(m_truckProcessor->GetConstants().selector_count);
+    m_channelLayoutDirty = true;
 
     // Notify about the truck configuration update.
     m_eventManager.System.Telemetry.OnTruckConstantsChanged.Call(m_truckProcessor->GetConstants());
   } else if (strncmp(info->id, "trailer.", 8) == 0) {
     m_trailerProcessor->HandleConfiguration(info);
     unsigned int trailer_index;
-    if (sscanf_s(info->id, "trailer.%u", &trailer_index) == 1 && trailer_index < m_trailerProcessor->GetData().size()) {
-      UpdateTrailerWheelChannels(trailer_index, m_trailerProcessor->GetData()[trailer_index].constants.wheel_count);
+    if (sscanf_s(info->id, "trailer.%u", &trailer_index) == 1 && trailer_index < m_trailerChannels.size()) {
+      m_trailerChannels[trailer_index].configured = true;
+      m_channelLayoutDirty = true;
 
       // Notify about the trailer configuration update.
       m_eventManager.System.Telemetry.OnTrailerConstantsChanged.Call(m_trailerProcessor->GetData()[trailer_index].constants);
@@ -303,7 +550,8 @@ void SCSTelemetryService::HandleConfiguration(const scs_telemetry_configuration_
   } else if (strcmp(info->id, SCS_TELEMETRY_CONFIG_trailer) == 0) {
     m_trailerProcessor->HandleConfiguration(info);
     if (!m_trailerProcessor->GetData().empty()) {
-      UpdateTrailerWheelChannels(0, m_trailerProcessor->GetData()[0].constants.wheel_count);
+      m_trailerChannels[0].configured = true;
+      m_channelLayoutDirty = true;
 
       // Notify about the trailer configuration update (for the first trailer).
       m_eventManager.System.Telemetry.OnTrailerConstantsChanged.Call(m_trailerProcessor->GetData()[0].constants);
@@ -323,30 +571,9 @@ void SCSTelemetryService::HandleConfiguration(const scs_telemetry_configuration_
     // Notify about the gearbox/controls configuration update.
     m_eventManager.System.Telemetry.OnGearboxConstantsChanged.Call(m_gearboxProcessor->GetConstants());
   }
-}
 
-void SCSTelemetryService::StaticChannelCallback(const scs_string_t name, const scs_u32_t index, const scs_value_t* value, scs_context_t context) {
-  if (context) static_cast<SCSTelemetryService*>(context)->HandleChannelUpdate(name, index, value);
-}
-
-void SCSTelemetryService::HandleChannelUpdate(const scs_string_t name, const scs_u32_t index, const scs_value_t* value) {
-  if (!name || !value) return;
-
-  // Route channel data to the appropriate processor based on the channel name prefix.
-  else if (strncmp(name, "truck.input.", 12) == 0 || strncmp(name, "truck.effective.", 16) == 0) {
-    m_controlsProcessor->HandleChannelUpdate(name, index, value);
-  } else if (strncmp(name, "truck.navigation.", 17) == 0)  // Route truck.navigation.* channels to JobProcessor
-  {
-    m_jobProcessor->HandleChannelUpdate(name, index, value);
-  } else if (strncmp(name, "truck.", 6) == 0) {
-    m_truckProcessor->HandleChannelUpdate(name, index, value);
-  } else if (strncmp(name, "trailer.", 8) == 0) {
-    m_trailerProcessor->HandleChannelUpdate(name, index, value);
-  } else if (strncmp(name, "job.", 4) == 0) {
-    m_jobProcessor->HandleChannelUpdate(name, index, value);
-  } else {
-    m_gameDataProcessor->HandleChannelUpdate(name, index, value);
-  }
+  ApplyChannelDemand();
+  PublishSnapshot();
 }
 
 void SCSTelemetryService::StaticFrameStartCallback(scs_event_t, const void* event_info, scs_context_t context) {
@@ -354,53 +581,118 @@ void SCSTelemetryService::StaticFrameStartCallback(scs_event_t, const void* even
 }
 
 void SCSTelemetryService::HandleFrameStart(const scs_telemetry_frame_start_t* info) {
+  SPF_TELEMETRY_TIME_SCOPE(m_timing.frameStart);
+
   // Calculate delta time first
   auto currentTime = std::chrono::steady_clock::now();
   std::chrono::duration<float> dt_duration = currentTime - m_lastFrameTime;
   m_deltaTime = dt_duration.count();
   m_lastFrameTime = currentTime;
+  ++m_dataRevision;
+  ++m_frameId;
+
+  if (info->flags & SCS_TELEMETRY_FRAME_START_FLAG_timer_restart) {
+    m_placementInterpolator.Reset();
+    m_routeStore.Break();
+  }
 
-  m_gameDataProcessor->HandleFrameStart(info);
+  // Groups acquired or released since the previous event take effect from this frame on.
+  ApplyChannelDemand();
+  m_channelSubscriptions->Apply([this](const ChannelSubscriptionRegistry::ChannelInfo& channel, scs_u32_t index) { RefreshChannel(channel, index); });
 
-  // Post-process calculations that depend on multiple processors
-  const auto& jobConstants = m_jobProcessor->GetJobConstants();
-  if (jobConstants.delivery_time > 0)  // Job is active
   {
-    const auto& commonData = m_gameDataProcessor->GetCommonData();
-    auto& jobData = m_jobProcessor->GetMutableJobData();
+    SPF_TELEMETRY_TIME_SCOPE(m_timing.processors);
+    m_gameDataProcessor->HandleFrameStart(info);
+
+    // Post-process calculations that depend on multiple processors
+    const auto& jobConstants = m_jobProcessor->GetJobConstants();
+    if (jobConstants.delivery_time > 0)  // Job is active
+    {
+      const auto& commonData = m_gameDataProcessor->GetCommonData();
+      auto& jobData = m_jobProcessor->GetMutableJobData();
+
+      const float remaining = jobConstants.delivery_time < commonData.game_time ? 0.0f : static_cast<float>(jobConstants.delivery_time - commonData.game_time);
+      if (jobData.remaining_delivery_minutes != remaining) {
+        jobData.remaining_delivery_minutes = remaining;
+        MarkChanged(m_jobProcessor->GetMutableChangedFields(), Field::JobRemainingDeliveryMinutes);
+      }
+    }
 
-    if (jobConstants.delivery_time < commonData.game_time) {
-      jobData.remaining_delivery_minutes = 0;
-    } else {
-      jobData.remaining_delivery_minutes = jobConstants.delivery_time - commonData.game_time;
+    // Calculate real-time to destination
+    auto& navData = m_jobProcessor->GetMutableNavigationData();
+    const auto& gameState = m_gameDataProcessor->GetGameState();
+    const float realSeconds = (gameState.scale > 0.0f && navData.navigation_time > 0.0f) ? navData.navigation_time / gameState.scale : 0.0f;
+    if (navData.navigation_time_real_seconds != realSeconds) {
+      navData.navigation_time_real_seconds = realSeconds;
+      MarkChanged(m_jobProcessor->GetMutableChangedFields(), Field::NavigationTimeRealSeconds);
     }
+
+    // Collect what changed since the previous frame start.
+    CollectChangedFields();
   }
 
-  // Calculate real-time to destination
-  auto& navData = m_jobProcessor->GetMutableNavigationData();
-  const auto& gameState = m_gameDataProcessor->GetGameState();
-  if (gameState.scale > 0.0f && navData.navigation_time > 0.0f) {
-    navData.navigation_time_real_seconds = navData.navigation_time / gameState.scale;
-  } else {
-    navData.navigation_time_real_seconds = 0.0f;
+  // Derived channels read the change mask to skip unchanged inputs and add their own fields to it.
+  {
+    SPF_TELEMETRY_TIME_SCOPE(m_timing.derived);
+    m_derivedChannels->Evaluate(m_truckProcessor->GetConstants(), m_truckProcessor->GetData(), m_gameDataProcessor->GetTimestamps(), m_changedFields);
   }
 
+  // The processors keep being written by channel callbacks until the next frame
+  // starts, so consumers that outlive this call read the published snapshot instead.
+  PublishSnapshot();
+
   // --- Fire Data Update Events ---
   // Now that all channel data for the frame has been processed, notify listeners
   // with the complete, updated data structures.
-  m_eventManager.System.Telemetry.OnTimestampsUpdated.Call(m_gameDataProcessor->GetTimestamps());
-  m_eventManager.System.Telemetry.OnTruckDataUpdated.Call(m_truckProcessor->GetData());
-  m_eventManager.System.Telemetry.OnTrailersUpdated.Call(m_trailerProcessor->GetData());
-  m_eventManager.System.Telemetry.OnJobDataUpdated.Call(m_jobProcessor->GetJobData());
-  m_eventManager.System.Telemetry.OnNavigationDataUpdated.Call(m_jobProcessor->GetNavigationData());
-  m_eventManager.System.Telemetry.OnControlsUpdated.Call(m_controlsProcessor->GetData());
-  m_eventManager.System.Telemetry.OnCommonDataUpdated.Call(m_gameDataProcessor->GetCommonData());
+  {
+    SPF_TELEMETRY_TIME_SCOPE(m_timing.dispatch);
+    m_eventManager.System.Telemetry.OnTimestampsUpdated.Call(m_gameDataProcessor->GetTimestamps());
+    m_eventManager.System.Telemetry.OnTruckDataUpdated.Call(m_truckProcessor->GetData());
+    m_eventManager.System.Telemetry.OnDerivedDataUpdated.Call(m_derivedChannels->GetData());
+    if (m_changedTrailers.any()) {
+      m_eventManager.System.Telemetry.OnTrailersUpdated.Call(m_trailerProcessor->GetData());
+    }
+    m_eventManager.System.Telemetry.OnJobDataUpdated.Call(m_jobProcessor->GetJobData());
+    m_eventManager.System.Telemetry.OnNavigationDataUpdated.Call(m_jobProcessor->GetNavigationData());
+    m_eventManager.System.Telemetry.OnControlsUpdated.Call(m_controlsProcessor->GetData());
+    m_eventManager.System.Telemetry.OnCommonDataUpdated.Call(m_gameDataProcessor->GetCommonData());
+    if (m_changedFields.any()) {
+      m_eventManager.System.Telemetry.OnFieldsChanged.Call(*m_latestSnapshot.load(std::memory_order_relaxed), m_changedFields);
+    }
+    m_fieldAggregator.Sample(*m_latestSnapshot.load(std::memory_order_relaxed));
+    m_fieldHistory->Sample(*m_latestSnapshot.load(std::memory_order_relaxed));
+    m_triggerEngine->Evaluate(*m_latestSnapshot.load(std::memory_order_relaxed));
+    m_channelSubscriptions->Dispatch();
 
-  // Notify the system that a telemetry frame has started
-  m_eventManager.System.OnTelemetryFrameStart.Call();
+    // Notify the system that a telemetry frame has started
+    m_eventManager.System.OnTelemetryFrameStart.Call();
+  }
 
   // Reset single-frame event flags AFTER plugins have had a chance to process them.
   m_eventsProcessor->HandleFrameStart();
+  ++m_dataRevision;
+}
+
+void SCSTelemetryService::StaticFrameEndCallback(scs_event_t, const void*, scs_context_t context) {
+  if (context) static_cast<SCSTelemetryService*>(context)->HandleFrameEnd();
+}
+
+void SCSTelemetryService::HandleFrameEnd() {
+  // Channel values for the frame were written between frame start and now.
+  ++m_dataRevision;
+
+  if (HasChannelGroup(m_registeredGroups, ChannelGroup::TruckMotion)) {
+    m_placementInterpolator.AddSample(m_gameDataProcessor->GetTimestamps(), m_truckProcessor->GetData());
+    // Paused frames include the menus, whose placement is not where the truck is.
+    if (!m_gameDataProcessor->GetGameState().paused) {
+      m_routeStore.AddSample(m_truckProcessor->GetData().world_placement, m_gameDataProcessor->GetTimestamps().simulation);
+    }
+    m_routeSampling = true;
+  } else if (m_routeSampling) {
+    // The truck moves on unobserved; do not connect the route across the gap.
+    m_routeStore.Break();
+    m_routeSampling = false;
+  }
 }
 
 void SCSTelemetryService::StaticPausedCallback(scs_event_t, const void*, scs_context_t context) {
@@ -408,7 +700,9 @@ void SCSTelemetryService::StaticPausedCallback(scs_event_t, const void*, scs_con
 }
 
 void SCSTelemetryService::HandlePaused() {
+  ++m_dataRevision;
   m_gameDataProcessor->HandlePaused();
+  PublishSnapshot();
   m_eventManager.System.Telemetry.OnGameStateUpdated.Call(m_gameDataProcessor->GetGameState());
 }
 
@@ -417,7 +711,9 @@ void SCSTelemetryService::StaticStartedCallback(scs_event_t, const void*, scs_co
 }
 
 void SCSTelemetryService::HandleStarted() {
+  ++m_dataRevision;
   m_gameDataProcessor->HandleStarted();
+  PublishSnapshot();
   m_eventManager.System.Telemetry.OnGameStateUpdated.Call(m_gameDataProcessor->GetGameState());
 }
 
@@ -426,8 +722,12 @@ void SCSTelemetryService::StaticGameplayEventCallback(scs_event_t, const void* e
 }
 
 void SCSTelemetryService::HandleGameplayEvent(const scs_telemetry_gameplay_event_t* info) {
+  SPF_TELEMETRY_TIME_SCOPE(m_timing.gameplayEvent);
+  ++m_dataRevision;
+
   // Let the processor handle the raw event first to update its internal state.
-  m_eventsProcessor->HandleGameplayEvent(info);
+  m_eventsProcessor->HandleGameplayEvent(info, m_gameDataProcessor->GetTimestamps(), m_gameDataProcessor->GetCommonData().game_time);
+  PublishSnapshot();
 
   // Now, fire the framework-level event with the processed data.
   const char* event_id = m_eventsProcessor->GetLastGameplayEventId().c_str();
@@ -457,6 +757,123 @@ const std::string& SCSTelemetryService::GetLastGameplayEventId() const { return
 
 float SCSTelemetryService::GetDeltaTime() const { return m_deltaTime; }
 
+uint64_t SCSTelemetryService::GetDataRevision() const { return m_dataRevision; }
+
+const FieldMask& SCSTelemetryService::GetChangedFields() const { return m_changedFields; }
+
+FieldAggregator& SCSTelemetryService::GetFieldAggregator() { return m_fieldAggregator; }
+
+FieldHistory& SCSTelemetryService::GetFieldHistory() { return *m_fieldHistory; }
+
+FieldHistoryLease SCSTelemetryService::RecordFieldHistory(std::span<const Field> fields) {
+  if (fields.empty()) return {};
+
+  ChannelGroupMask groups;
+  for (const Field field : fields) groups |= ChannelGroupsForField(field);
+  return FieldHistoryLease(m_fieldHistory, std::vector<Field>(fields.begin(), fields.end()), AcquireChannels(groups));
+}
+
+ChannelLease SCSTelemetryService::AcquireChannels(const ChannelGroupMask& groups) { return ChannelLease(m_channelDemand, groups); }
+
+ChannelSubscription SCSTelemetryService::SubscribeToChannel(std::string_view name, uint32_t index, ChannelCallback callback, bool changesOnly) {
+  const auto id = m_channelSubscriptions->FindChannel(name);
+  if (!id || !callback) return {};
+
+  const auto& channel = m_channelSubscriptions->GetChannel(*id);
+  const bool validIndex = channel.indexed ? index < ChannelSubscriptionRegistry::MaxChannelIndex : index == SCS_U32_NIL;
+  if (!validIndex) return {};
+
+  auto channels = AcquireChannels(MakeChannelGroupMask(channel.group));
+  auto subscriber = m_channelSubscriptions->Add(*id, index, std::move(callback), changesOnly);
+  return ChannelSubscription(m_channelSubscriptions, std::move(subscriber), std::move(channels));
+}
+
+TriggerSubscription SCSTelemetryService::AddTrigger(std::span<const TriggerCondition> conditions, const TriggerOptions& options, TriggerCallback callback) {
+  if (conditions.empty() || !callback) return {};
+
+  ChannelGroupMask groups;
+  for (const auto& condition : conditions) groups |= ChannelGroupsForField(condition.field);
+
+  auto channels = AcquireChannels(groups);
+  auto trigger = m_triggerEngine->Add(conditions, options, std::move(callback));
+  return TriggerSubscription(m_triggerEngine, std::move(trigger), std::move(channels));
+}
+
+const DerivedData& SCSTelemetryService::GetDerivedData() const { return m_derivedChannels->GetData(); }
+
+const GameplayEventHistory& SCSTelemetryService::GetGameplayEventHistory() const { return m_eventsProcessor->GetHistory(); }
+
+RouteStore& SCSTelemetryService::GetRouteStore() { return m_routeStore; }
+
+InterpolatedPlacements SCSTelemetryService::GetInterpolatedPlacements() const { return m_placementInterpolator.Get(); }
+
+void SCSTelemetryService::UpdateInterpolatedPlacements() { m_placementInterpolator.Update(); }
+
+std::shared_ptr<const TelemetrySnapshot> SCSTelemetryService::GetSnapshot() const { return m_latestSnapshot.load(std::memory_order_acquire); }
+
+// --- Change Tracking ---
+
+void SCSTelemetryService::CollectChangedFields() {
+  auto collect = [this](FieldMask& processorChanges) {
+    m_changedFields |= processorChanges;
+    processorChanges.reset();
+  };
+  m_changedFields.reset();
+  collect(m_gameDataProcessor->GetMutableChangedFields());
+  collect(m_truckProcessor->GetMutableChangedFields());
+  collect(m_controlsProcessor->GetMutableChangedFields());
+  collect(m_jobProcessor->GetMutableChangedFields());
+
+  m_changedTrailers = m_trailerProcessor->GetChangedTrailers();
+  m_trailerProcessor->GetMutableChangedTrailers().reset();
+}
+
+// --- Snapshots ---
+
+void SCSTelemetryService::PublishSnapshot() {
+  SPF_TELEMETRY_TIME_SCOPE(m_timing.snapshot);
+  // A slot is free once the last reference to its published snapshot is gone. That may be
+  // dropped on another thread; the acquire pairs with the deleter's release, so the reader's
+  // last accesses happen before the writes below.
+  std::shared_ptr<SnapshotSlot> slot;
+  for (const auto& pooled : m_snapshotPool) {
+    if (!pooled->inUse.load(std::memory_order_acquire)) {
+      slot = pooled;
+      break;
+    }
+  }
+  if (!slot) {
+    slot = std::make_shared<SnapshotSlot>();
+    if (m_snapshotPool.size() < SnapshotPoolSize) m_snapshotPool.push_back(slot);
+  }
+  slot->inUse.store(true, std::memory_order_relaxed);
+  TelemetrySnapshot* snapshot = &slot->snapshot;
+
+  snapshot->frameId = m_frameId;
+  snapshot->revision = m_dataRevision;
+  snapshot->changedFields = m_changedFields;
+  snapshot->changedTrailers = m_changedTrailers;
+  snapshot->gameState = m_gameDataProcessor->GetGameState();
+  snapshot->timestamps = m_gameDataProcessor->GetTimestamps();
+  snapshot->commonData = m_gameDataProcessor->GetCommonData();
+  snapshot->truckConstants = m_truckProcessor->GetConstants();
+  snapshot->truckData = m_truckProcessor->GetData();
+  snapshot->trailers = m_trailerProcessor->GetData();
+  snapshot->jobConstants = m_jobProcessor->GetJobConstants();
+  snapshot->jobData = m_jobProcessor->GetJobData();
+  snapshot->navigationData = m_jobProcessor->GetNavigationData();
+  snapshot->controls = m_controlsProcessor->GetData();
+  snapshot->specialEvents = m_eventsProcessor->GetSpecialEvents();
+  snapshot->gameplayEvents = m_eventsProcessor->GetGameplayEvents();
+  snapshot->gearboxConstants = m_gearboxProcessor->GetConstants();
+  snapshot->lastGameplayEventId = m_eventsProcessor->GetLastGameplayEventId();
+  snapshot->derived = m_derivedChannels->GetData();
+
+  // The deleter holds the slot, so consumers may keep a snapshot past the service's lifetime.
+  std::shared_ptr<const TelemetrySnapshot> published(snapshot, [slot](const TelemetrySnapshot*) { slot->inUse.store(false, std::memory_order_release); });
+  m_latestSnapshot.store(std::move(published), std::memory_order_release);
+}
+
 // --- Signal Accessors (ITelemetryService Implementation) ---
 Utils::Signal<void(const SCS::GameState&)>& SCSTelemetryService::GetGameStateSignal() {
     return m_eventManager.System.Telemetry.OnGameStateUpdated;
@@ -514,5 +931,13 @@ Utils::Signal<void(const SCS::GearboxConstants&)>& SCSTelemetryService::GetGearb
     return m_eventManager.System.Telemetry.OnGearboxConstantsChanged;
 }
 
+Utils::Signal<void(const TelemetrySnapshot&, const FieldMask&)>& SCSTelemetryService::GetFieldsChangedSignal() {
+    return m_eventManager.System.Telemetry.OnFieldsChanged;
+}
+
+Utils::Signal<void(const DerivedData&)>& SCSTelemetryService::GetDerivedDataSignal() {
+    return m_eventManager.System.Telemetry.OnDerivedDataUpdated;
+}
+
 }  // namespace Telemetry
 SPF_NS_END
\ No newline at end of file
@@ -0,0 +1,112 @@
+#include "SPF/Telemetry/TelemetryFields.hpp"
+
+#include "SPF/Telemetry/TelemetrySnapshot.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+
+double ReadFieldValue(const TelemetrySnapshot& snapshot, Field field) {
+  const auto& game = snapshot.gameState;
+  const auto& common = snapshot.commonData;
+  const auto& truck = snapshot.truckData;
+  const auto& controls = snapshot.controls;
+  const auto& job = snapshot.jobData;
+  const auto& nav = snapshot.navigationData;
+  const auto& derived = snapshot.derived;
+
+  switch (field) {
+    case Field::GamePaused: return game.paused;
+    case Field::GameScale: return game.scale;
+    case Field::MultiplayerTimeOffset: return game.multiplayer_time_offset;
+    case Field::GameTime: return common.game_time;
+    case Field::NextRestStop: return common.next_rest_stop;
+
+    case Field::TruckSpeed: return truck.speed;
+    case Field::TruckEngineRpm: return truck.engine_rpm;
+    case Field::TruckGear: return truck.gear;
+    case Field::TruckDisplayedGear: return truck.displayed_gear;
+    case Field::TruckCruiseControlSpeed: return truck.cruise_control_speed;
+    case Field::TruckHShifterSlot: return truck.hshifter_slot;
+    case Field::TruckParkingBrake: return truck.parking_brake;
+    case Field::TruckMotorBrake: return truck.motor_brake;
+    case Field::TruckRetarderLevel: return truck.retarder_level;
+    case Field::TruckAirPressure: return truck.air_pressure;
+    case Field::TruckAirPressureWarning: return truck.air_pressure_warning;
+    case Field::TruckAirPressureEmergency: return truck.air_pressure_emergency;
+    case Field::TruckBrakeTemperature: return truck.brake_temperature;
+    case Field::TruckFuelAmount: return truck.fuel_amount;
+    case Field::TruckFuelWarning: return truck.fuel_warning;
+    case Field::TruckFuelAverageConsumption: return truck.fuel_average_consumption;
+    case Field::TruckFuelRange: return truck.fuel_range;
+    case Field::TruckAdblueAmount: return truck.adblue_amount;
+    case Field::TruckAdblueWarning: return truck.adblue_warning;
+    case Field::TruckOilPressure: return truck.oil_pressure;
+    case Field::TruckOilPressureWarning: return truck.oil_pressure_warning;
+    case Field::TruckOilTemperature: return truck.oil_temperature;
+    case Field::TruckWaterTemperature: return truck.water_temperature;
+    case Field::TruckWaterTemperatureWarning: return truck.water_temperature_warning;
+    case Field::TruckBatteryVoltage: return truck.battery_voltage;
+    case Field::TruckBatteryVoltageWarning: return truck.battery_voltage_warning;
+    case Field::TruckElectricEnabled: return truck.electric_enabled;
+    case Field::TruckEngineEnabled: return truck.engine_enabled;
+    case Field::TruckWipers: return truck.wipers;
+    case Field::TruckDifferentialLock: return truck.differential_lock;
+    case Field::TruckLiftAxle: return truck.lift_axle;
+    case Field::TruckLiftAxleIndicator: return truck.lift_axle_indicator;
+    case Field::TruckTrailerLiftAxle: return truck.trailer_lift_axle;
+    case Field::TruckTrailerLiftAxleIndicator: return truck.trailer_lift_axle_indicator;
+    case Field::TruckLBlinker: return truck.lblinker;
+    case Field::TruckRBlinker: return truck.rblinker;
+    case Field::TruckHazardWarning: return truck.hazard_warning;
+    case Field::TruckLightLBlinker: return truck.light_lblinker;
+    case Field::TruckLightRBlinker: return truck.light_rblinker;
+    case Field::TruckLightParking: return truck.light_parking;
+    case Field::TruckLightLowBeam: return truck.light_low_beam;
+    case Field::TruckLightHighBeam: return truck.light_high_beam;
+    case Field::TruckLightAuxFront: return truck.light_aux_front;
+    case Field::TruckLightAuxRoof: return truck.light_aux_roof;
+    case Field::TruckLightBeacon: return truck.light_beacon;
+    case Field::TruckLightBrake: return truck.light_brake;
+    case Field::TruckLightReverse: return truck.light_reverse;
+    case Field::TruckDashboardBacklight: return truck.dashboard_backlight;
+    case Field::TruckWearEngine: return truck.wear_engine;
+    case Field::TruckWearTransmission: return truck.wear_transmission;
+    case Field::TruckWearCabin: return truck.wear_cabin;
+    case Field::TruckWearChassis: return truck.wear_chassis;
+    case Field::TruckWearWheels: return truck.wear_wheels;
+    case Field::TruckOdometer: return truck.odometer;
+
+    case Field::UserSteering: return controls.userInput.steering;
+    case Field::UserThrottle: return controls.userInput.throttle;
+    case Field::UserBrake: return controls.userInput.brake;
+    case Field::UserClutch: return controls.userInput.clutch;
+    case Field::EffectiveSteering: return controls.effectiveInput.steering;
+    case Field::EffectiveThrottle: return controls.effectiveInput.throttle;
+    case Field::EffectiveBrake: return controls.effectiveInput.brake;
+    case Field::EffectiveClutch: return controls.effectiveInput.clutch;
+
+    case Field::JobCargoDamage: return job.cargo_damage;
+    case Field::JobRemainingDeliveryMinutes: return job.remaining_delivery_minutes;
+
+    case Field::NavigationDistance: return nav.navigation_distance;
+    case Field::NavigationTime: return nav.navigation_time;
+    case Field::NavigationSpeedLimit: return nav.navigation_speed_limit;
+    case Field::NavigationTimeRealSeconds: return nav.navigation_time_real_seconds;
+
+    case Field::DerivedLongitudinalG: return derived.longitudinal_g;
+    case Field::DerivedLateralG: return derived.lateral_g;
+    case Field::DerivedVerticalG: return derived.vertical_g;
+    case Field::DerivedJerk: return derived.jerk;
+    case Field::DerivedMaxWheelSlip: return derived.max_wheel_slip;
+    case Field::DerivedFuelEconomy: return derived.fuel_economy;
+    case Field::DerivedTripFuelEconomy: return derived.trip_fuel_economy;
+    case Field::DerivedFuelRate: return derived.fuel_rate;
+    case Field::DerivedTimeToEmpty: return derived.time_to_empty;
+
+    case Field::Count: break;
+  }
+  return 0.0;
+}
+
+}  // namespace Telemetry
+SPF_NS_END
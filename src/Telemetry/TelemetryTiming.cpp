@@ -0,0 +1,106 @@
+#include "SPF/Telemetry/TelemetryTiming.hpp"
+
+#include <algorithm>
+#include <bit>
+
+SPF_NS_BEGIN
+namespace Telemetry {
+// --- TimingHistogram ---
+
+size_t TimingHistogram::BucketIndex(uint64_t nanoseconds) {
+  if (nanoseconds < SubBuckets) return static_cast<size_t>(nanoseconds);
+  const uint32_t exponent = std::min<uint32_t>(std::bit_width(nanoseconds) - 1, 31);
+  if (exponent == 31 && nanoseconds >= (uint64_t{1} << 32)) return BucketCount - 1;
+  const uint32_t sub = static_cast<uint32_t>(nanoseconds >> (exponent - SubBucketBits)) & (SubBuckets - 1);
+  return (exponent - SubBucketBits + 1) * SubBuckets + sub;
+}
+
+uint64_t TimingHistogram::BucketLowerBound(size_t index) {
+  if (index < SubBuckets) return index;
+  const uint32_t exponent = static_cast<uint32_t>(index / SubBuckets) + SubBucketBits - 1;
+  const uint64_t sub = index % SubBuckets;
+  return (SubBuckets + sub) << (exponent - SubBucketBits);
+}
+
+void TimingHistogram::Record(uint64_t nanoseconds) {
+  uint32_t current = m_current.load(std::memory_order_relaxed);
+  if (m_generations[current].count.load(std::memory_order_relaxed) >= WindowSamples) {
+    // Retire the older generation and start filling it again.
+    current ^= 1;
+    auto& fresh = m_generations[current];
+    for (auto& bucket : fresh.buckets) bucket.store(0, std::memory_order_relaxed);
+    fresh.count.store(0, std::memory_order_relaxed);
+    fresh.max.store(0, std::memory_order_relaxed);
+    m_current.store(current, std::memory_order_relaxed);
+  }
+
+  auto& generation = m_generations[current];
+  Increment(generation.buckets[BucketIndex(nanoseconds)]);
+  Increment(generation.count);
+  if (nanoseconds > generation.max.load(std::memory_order_relaxed)) generation.max.store(nanoseconds, std::memory_order_relaxed);
+}
+
+TimingStats TimingHistogram::GetStats() const {
+  std::array<uint64_t, BucketCount> merged = {};
+  uint64_t total = 0;
+  uint64_t max = 0;
+  for (const auto& generation : m_generations) {
+    for (size_t i = 0; i < BucketCount; ++i) {
+      const uint32_t count = generation.buckets[i].load(std::memory_order_relaxed);
+      merged[i] += count;
+      total += count;
+    }
+    max = std::max(max, generation.max.load(std::memory_order_relaxed));
+  }
+
+  TimingStats stats;
+  stats.count = total;
+  stats.maxUs = max / 1000.0;
+  if (total == 0) return stats;
+
+  // Reports the middle of the bucket that holds the requested rank.
+  const auto percentile = [&](double fraction) {
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(fraction * total + 0.5));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BucketCount; ++i) {
+      seen += merged[i];
+      if (seen >= rank) {
+        const uint64_t upper = i + 1 < BucketCount ? BucketLowerBound(i + 1) : max + 1;
+        const double middle = (BucketLowerBound(i) + upper - 1) / 2.0;
+        return std::min(middle, static_cast<double>(max)) / 1000.0;
+      }
+    }
+    return stats.maxUs;
+  };
+  stats.p50Us = percentile(0.50);
+  stats.p99Us = percentile(0.99);
+  return stats;
+}
+
+// --- TimingRegistry ---
+
+TimingRegistry& TimingRegistry::GetInstance() {
+  static TimingRegistry instance;
+  return instance;
+}
+
+std::shared_ptr<TimingHistogram> TimingRegistry::Add(std::string name) {
+  auto histogram = std::make_shared<TimingHistogram>();
+  std::lock_guard lock(m_mutex);
+  m_histograms.emplace_back(std::move(name), histogram);
+  return histogram;
+}
+
+std::vector<TimingRegistry::Entry> TimingRegistry::GetStats() {
+  std::lock_guard lock(m_mutex);
+  std::erase_if(m_histograms, [](const auto& entry) { return entry.second.expired(); });
+
+  std::vector<Entry> entries;
+  entries.reserve(m_histograms.size());
+  for (const auto& [name, weak] : m_histograms) {
+    if (auto histogram = weak.lock()) entries.push_back({name, histogram->GetStats()});
+  }
+  return entries;
+}
+}  // namespace Telemetry
+SPF_NS_END
@@ -0,0 +1,224 @@
+#include "SPF/Telemetry/TriggerEngine.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "SPF/Telemetry/TelemetrySnapshot.hpp"
+
+SPF_NS_BEGIN
+namespace Telemetry {
+namespace {
+constexpr size_t NotCompiled = std::numeric_limits<size_t>::max();
+}  // namespace
+
+// --- TriggerEngine ---
+
+std::shared_ptr<TriggerEngine::Trigger> TriggerEngine::Add(std::span<const TriggerCondition> conditions, const TriggerOptions& options, TriggerCallback callback) {
+  auto trigger = std::make_shared<Trigger>();
+  trigger->conditions.assign(conditions.begin(), conditions.end());
+  trigger->options = options;
+  trigger->callback = std::move(callback);
+  trigger->firstCondition = NotCompiled;
+
+  std::lock_guard lock(m_mutex);
+  m_pendingAdds.push_back(trigger);
+  m_hasPending.store(true, std::memory_order_release);
+  return trigger;
+}
+
+void TriggerEngine::Remove(const std::shared_ptr<Trigger>& trigger) {
+  if (!trigger) return;
+  trigger->active.store(false, std::memory_order_release);
+
+  std::lock_guard lock(m_mutex);
+  m_pendingRemoves.push_back(trigger);
+  m_hasPending.store(true, std::memory_order_release);
+}
+
+void TriggerEngine::Apply() {
+  if (!m_hasPending.load(std::memory_order_acquire)) return;
+
+  std::vector<std::shared_ptr<Trigger>> adds;
+  std::vector<std::shared_ptr<Trigger>> removes;
+  {
+    std::lock_guard lock(m_mutex);
+    adds.swap(m_pendingAdds);
+    removes.swap(m_pendingRemoves);
+    m_hasPending.store(false, std::memory_order_relaxed);
+  }
+
+  for (const auto& trigger : removes) {
+    if (std::erase(m_triggers, trigger) > 0) m_compiled = false;
+  }
+  for (auto& trigger : adds) {
+    if (!trigger->active.load(std::memory_order_acquire)) continue;
+    trigger->lastTransition = m_lastTimeUs;
+    m_triggers.push_back(std::move(trigger));
+    m_compiled = false;
+  }
+}
+
+void TriggerEngine::Compile() {
+  size_t total = 0;
+  for (const auto& trigger : m_triggers) total += trigger->conditions.size();
+
+  // Conditions of triggers that were already compiled keep whether they hold, so a
+  // change elsewhere does not reset their hysteresis.
+  std::vector<uint8_t> holds(total, 0);
+  m_fields.clear();
+  m_fieldMask.reset();
+  m_condField.resize(total);
+  m_condCenter.resize(total);
+  m_condAbs.resize(total);
+  m_condSign.resize(total);
+  m_condEnter.resize(total);
+  m_condExit.resize(total);
+  m_condInclusive.resize(total);
+
+  size_t next = 0;
+  for (const auto& trigger : m_triggers) {
+    const size_t previous = trigger->firstCondition;
+    trigger->firstCondition = next;
+
+    for (size_t i = 0; i < trigger->conditions.size(); ++i, ++next) {
+      const auto& condition = trigger->conditions[i];
+      const size_t fieldIndex = static_cast<size_t>(condition.field);
+      if (!m_fieldMask.test(fieldIndex)) {
+        m_fieldMask.set(fieldIndex);
+        m_fields.push_back(condition.field);
+      }
+
+      const double threshold = condition.threshold;
+      const double hysteresis = std::max(condition.hysteresis, 0.0);
+      m_condField[next] = static_cast<uint16_t>(fieldIndex);
+      m_condCenter[next] = 0.0;
+      m_condAbs[next] = 0;
+      switch (condition.op) {
+        case CompareOp::Greater:
+        case CompareOp::GreaterEqual:
+          m_condSign[next] = 1.0;
+          m_condEnter[next] = threshold;
+          m_condExit[next] = threshold - hysteresis;
+          break;
+        case CompareOp::Less:
+        case CompareOp::LessEqual:
+          m_condSign[next] = -1.0;
+          m_condEnter[next] = -threshold;
+          m_condExit[next] = -(threshold + hysteresis);
+          break;
+        case CompareOp::Equal:
+          m_condCenter[next] = threshold;
+          m_condAbs[next] = 1;
+          m_condSign[next] = -1.0;
+          m_condEnter[next] = -hysteresis;
+          m_condExit[next] = -hysteresis;
+          break;
+        case CompareOp::NotEqual:
+          m_condCenter[next] = threshold;
+          m_condAbs[next] = 1;
+          m_condSign[next] = 1.0;
+          m_condEnter[next] = hysteresis;
+          m_condExit[next] = hysteresis;
+          break;
+      }
+      m_condInclusive[next] = condition.op == CompareOp::GreaterEqual || condition.op == CompareOp::LessEqual || condition.op == CompareOp::Equal;
+      if (previous != NotCompiled) holds[next] = m_condHolds[previous + i];
+    }
+  }
+
+  m_condHolds.swap(holds);
+  m_compiled = true;
+  m_forceEvaluate = true;
+}
+
+void TriggerEngine::Evaluate(const TelemetrySnapshot& snapshot) {
+  const uint64_t nowUs = snapshot.timestamps.render;
+  if (m_hasLastTime && nowUs < m_lastTimeUs) {
+    // The render clock restarted (e.g. a new game session); restart the running timers with it.
+    for (const auto& trigger : m_triggers) {
+      trigger->timerStart = nowUs;
+      trigger->lastTransition = nowUs;
+    }
+  }
+  m_lastTimeUs = nowUs;
+  m_hasLastTime = true;
+
+  Apply();
+  if (m_triggers.empty()) return;
+  if (!m_compiled) Compile();
+
+  // Nothing can change unless a referenced field moved or a hold/release timer is running.
+  bool timersRunning = false;
+  for (const auto& trigger : m_triggers) timersRunning |= trigger->timing;
+  if (!m_forceEvaluate && !timersRunning && (snapshot.changedFields & m_fieldMask).none()) return;
+  m_forceEvaluate = false;
+
+  for (const Field field : m_fields) {
+    m_values[static_cast<size_t>(field)] = ReadFieldValue(snapshot, field);
+  }
+
+  const size_t count = m_condField.size();
+  for (size_t i = 0; i < count; ++i) {
+    double value = m_values[m_condField[i]] - m_condCenter[i];
+    value = m_condAbs[i] ? std::abs(value) : value;
+    value *= m_condSign[i];
+    const double limit = m_condHolds[i] ? m_condExit[i] : m_condEnter[i];
+    m_condHolds[i] = m_condInclusive[i] ? value >= limit : value > limit;
+  }
+
+  // Triggers added or removed from a callback are queued until the next Apply(), so m_triggers is stable here.
+  for (const auto& trigger : m_triggers) {
+    const auto first = m_condHolds.begin() + trigger->firstCondition;
+    const bool holds = std::all_of(first, first + trigger->conditions.size(), [](uint8_t h) { return h != 0; });
+    Step(*trigger, holds, nowUs);
+  }
+}
+
+void TriggerEngine::Step(Trigger& trigger, bool holds, uint64_t nowUs) {
+  if (holds == trigger.on) {
+    trigger.timing = false;
+    return;
+  }
+  if (!trigger.timing) {
+    trigger.timing = true;
+    trigger.timerStart = nowUs;
+  }
+
+  const uint64_t delayUs = static_cast<uint64_t>(trigger.on ? trigger.options.releaseMs : trigger.options.holdMs) * 1000;
+  if (nowUs - trigger.timerStart < delayUs) return;
+
+  const TriggerEvent event{holds, nowUs, nowUs - trigger.lastTransition};
+  trigger.timing = false;
+  trigger.on = holds;
+  trigger.lastTransition = nowUs;
+
+  const bool reported = trigger.options.edge == TriggerEdge::Both || (trigger.options.edge == TriggerEdge::Rising) == holds;
+  if (reported && trigger.active.load(std::memory_order_acquire)) trigger.callback(event);
+}
+
+// --- TriggerSubscription ---
+
+TriggerSubscription::TriggerSubscription(std::shared_ptr<TriggerEngine> engine, std::shared_ptr<TriggerEngine::Trigger> trigger, ChannelLease channels)
+    : m_engine(std::move(engine)), m_trigger(std::move(trigger)), m_channels(std::move(channels)) {}
+
+TriggerSubscription::~TriggerSubscription() { Reset(); }
+
+TriggerSubscription& TriggerSubscription::operator=(TriggerSubscription&& other) noexcept {
+  if (this != &other) {
+    Reset();
+    m_engine = std::move(other.m_engine);
+    m_trigger = std::move(other.m_trigger);
+    m_channels = std::move(other.m_channels);
+  }
+  return *this;
+}
+
+void TriggerSubscription::Reset() {
+  if (m_engine && m_trigger) m_engine->Remove(m_trigger);
+  m_engine.reset();
+  m_trigger.reset();
+  m_channels.Reset();
+}
+}  // namespace Telemetry
+SPF_NS_END
@@ -9,9 +9,13 @@
 #include "SPF/Telemetry/SCS/Controls.hpp"
 #include "SPF/Telemetry/SCS/Events.hpp"
 #include "SPF/Telemetry/SCS/Gearbox.hpp"
+#include "SPF/Telemetry/TelemetryTiming.hpp"
+#include "SPF/Telemetry/FieldHistory.hpp"
 
 #include <imgui.h>
 #include <fmt/core.h>
+#include <algorithm>
+#include <array>
 #include <string>
 
 SPF_NS_BEGIN
@@ -24,33 +28,14 @@ using namespace SPF::Modules;
 TelemetryWindow::TelemetryWindow(const std::string& componentName, const std::string& windowId, ITelemetryService& telemetryService)
     : BaseWindow(componentName, windowId),
       m_telemetryService(telemetryService),
-      m_gameStateSink(m_telemetryService.GetGameStateSignal()),
-      m_timestampsSink(m_telemetryService.GetTimestampsSignal()),
-      m_commonDataSink(m_telemetryService.GetCommonDataSignal()),
-      m_truckConstantsSink(m_telemetryService.GetTruckConstantsSignal()),
-      m_truckDataSink(m_telemetryService.GetTruckDataSignal()),
-      m_trailersSink(m_telemetryService.GetTrailersSignal()),
-      m_jobConstantsSink(m_telemetryService.GetJobConstantsSignal()),
-      m_jobDataSink(m_telemetryService.GetJobDataSignal()),
-      m_navigationDataSink(m_telemetryService.GetNavigationDataSignal()),
-      m_controlsSink(m_telemetryService.GetControlsSignal()),
       m_specialEventsSink(m_telemetryService.GetSpecialEventsSignal()),
-      m_gameplayEventsSink(m_telemetryService.GetGameplayEventsSignal()),
-      m_gearboxConstantsSink(m_telemetryService.GetGearboxConstantsSignal()) {
-  // Connect signals to their respective slots
-  m_gameStateSink.Connect<&TelemetryWindow::OnGameStateUpdate>(this);
-  m_timestampsSink.Connect<&TelemetryWindow::OnTimestampsUpdate>(this);
-  m_commonDataSink.Connect<&TelemetryWindow::OnCommonDataUpdate>(this);
-  m_truckConstantsSink.Connect<&TelemetryWindow::OnTruckConstantsUpdate>(this);
-  m_truckDataSink.Connect<&TelemetryWindow::OnTruckDataUpdate>(this);
-  m_trailersSink.Connect<&TelemetryWindow::OnTrailersUpdate>(this);
-  m_jobConstantsSink.Connect<&TelemetryWindow::OnJobConstantsUpdate>(this);
-  m_jobDataSink.Connect<&TelemetryWindow::OnJobDataUpdate>(this);
-  m_navigationDataSink.Connect<&TelemetryWindow::OnNavigationDataUpdate>(this);
-  m_controlsSink.Connect<&TelemetryWindow::OnControlsUpdate>(this);
+      m_timestampsSink(m_telemetryService.GetTimestampsSignal()) {
+  // Frame data is read from the published snapshot at render time. Special event
+  // flags are cleared by the service one frame after they fire, so the window
+  // latches them through the signal until the next gameplay event.
   m_specialEventsSink.Connect<&TelemetryWindow::OnSpecialEventsUpdate>(this);
-  m_gameplayEventsSink.Connect<&TelemetryWindow::OnGameplayEventUpdate>(this);
-  m_gearboxConstantsSink.Connect<&TelemetryWindow::OnGearboxConstantsUpdate>(this);
+  // Timestamps arrive every frame; they are used to drop the channel lease once hidden.
+  m_timestampsSink.Connect<&TelemetryWindow::OnTimestampsUpdate>(this);
   
   m_titleLocalizationKey = "telemetry_window.title";
 
@@ -61,6 +46,8 @@ TelemetryWindow::TelemetryWindow(const std::string& componentName, const std::st
   m_locTabPositioning = "telemetry_window.tabs.positioning";
   m_locTabTrailers = "telemetry_window.tabs.trailers";
   m_locTabControlsEvents = "telemetry_window.tabs.controls_events";
+  m_locTabTiming = "telemetry_window.tabs.timing";
+  m_locTabGraphs = "telemetry_window.tabs.graphs";
 
   m_locHeaderGameState = "telemetry_window.headers.game_state";
   m_locHeaderConstants = "telemetry_window.headers.constants";
@@ -126,6 +113,16 @@ TelemetryWindow::TelemetryWindow(const std::string& componentName, const std::st
   m_locLabelHshifterGear = "telemetry_window.labels.hshifter_table.gear";
   m_locLabelHshifterHandlePos = "telemetry_window.labels.hshifter_table.handle_pos";
   m_locLabelHshifterSelectors = "telemetry_window.labels.hshifter_table.selectors";
+  m_locLabelTimingSection = "telemetry_window.labels.timing_table.section";
+  m_locLabelTimingSamples = "telemetry_window.labels.timing_table.samples";
+  m_locLabelTimingP50 = "telemetry_window.labels.timing_table.p50";
+  m_locLabelTimingP99 = "telemetry_window.labels.timing_table.p99";
+  m_locLabelTimingMax = "telemetry_window.labels.timing_table.max";
+  m_locLabelTimingDisabled = "telemetry_window.labels.timing_disabled";
+  m_locLabelGraphRange = "telemetry_window.labels.graphs.range";
+  m_locLabelGraphMinutes = "telemetry_window.labels.graphs.minutes";
+  m_locLabelGraphOilTemp = "telemetry_window.labels.graphs.oil_temperature";
+  m_locLabelGraphNoData = "telemetry_window.labels.graphs.no_data";
   m_locLabelGearRatios = "telemetry_window.labels.gear_ratios";
   m_locLabelForward = "telemetry_window.labels.forward";
   m_locLabelReverse = "telemetry_window.labels.reverse";
@@ -347,21 +344,27 @@ void DisplayDPlacement(const char* label, const scs_value_dplacement_t& p, const
 void TelemetryWindow::RenderContent() {
   auto& loc = LocalizationManager::GetInstance();
 
-  // Use the cached data which is updated by the signal handlers
-  const auto& gameState = m_gameState;
-  const auto& timestamps = m_timestamps;
-  const auto& commonData = m_commonData;
-  const auto& truckConstants = m_truckConstants;
-  const auto& truckData = m_truckData;
-  const auto& trailers = m_trailers;
-  const auto& jobConstants = m_jobConstants;
-  const auto& jobData = m_jobData;
-  const auto& navigationData = m_navigationData;
-  const auto& controls = m_controls;
+  // The window shows every channel; they are registered from the next frame on.
+  if (m_channels.GetGroups().none()) {
+    m_channels = m_telemetryService.AcquireChannels(Telemetry::AllChannelGroups());
+  }
+
+  // Hold one snapshot for the whole render pass so every tab shows the same frame.
+  const auto snapshot = m_telemetryService.GetSnapshot();
+  const auto& gameState = snapshot->gameState;
+  const auto& timestamps = snapshot->timestamps;
+  const auto& commonData = snapshot->commonData;
+  const auto& truckConstants = snapshot->truckConstants;
+  const auto& truckData = snapshot->truckData;
+  const auto& trailers = snapshot->trailers;
+  const auto& jobConstants = snapshot->jobConstants;
+  const auto& jobData = snapshot->jobData;
+  const auto& navigationData = snapshot->navigationData;
+  const auto& controls = snapshot->controls;
   const auto& specialEvents = m_specialEvents;
-  const auto& gameplayEvents = m_gameplayEvents;
-  const auto& gearboxConstants = m_gearboxConstants;
-  const auto& lastEventId = m_lastGameplayEventId;
+  const auto& gameplayEvents = snapshot->gameplayEvents;
+  const auto& gearboxConstants = snapshot->gearboxConstants;
+  const auto& lastEventId = snapshot->lastGameplayEventId;
 
   if (ImGui::BeginTabBar("TelemetryTabs")) {
     if (ImGui::BeginTabItem(loc.Get(m_locTabGame).c_str())) {
@@ -685,7 +688,7 @@ void TelemetryWindow::RenderContent() {
       if (ImGui::CollapsingHeader(loc.Get(m_locHeaderWheels).c_str())) {
         for (size_t i = 0; i < truckData.wheels.size(); ++i) {
           if (i < truckConstants.wheels.size()) {
-            const auto& wheel_data = truckData.wheels[i];
+            const auto wheel_data = truckData.wheels[i];
             const auto& wheel_const = truckConstants.wheels[i];
             const std::string& wheel_node_format = loc.Get(m_locLabelWheelX);
             std::string wheel_node_id = fmt::format(fmt::runtime(wheel_node_format), i);
@@ -809,7 +812,7 @@ void TelemetryWindow::RenderContent() {
             for (size_t j = 0; j < trailer.constants.wheel_count; ++j) {
               if (j >= trailer.data.wheels.size() || j >= trailer.constants.wheels.size()) continue;
 
-              const auto& wheel_data = trailer.data.wheels[j];
+              const auto wheel_data = trailer.data.wheels[j];
               const auto& wheel_const = trailer.constants.wheels[j];
               std::string wheel_node_str = loc.Get(m_locLabelWheelX);
               size_t pos = wheel_node_str.find("{}");
@@ -876,7 +879,6 @@ void TelemetryWindow::RenderContent() {
         ImGui::Text(loc.Get(m_locLabelTrain).c_str(), specialEvents.train ? loc.Get(m_locGenericYes).c_str() : loc.Get(m_locGenericNo).c_str());
         ImGui::Separator();
         ImGui::TextUnformatted(loc.Get(m_locLabelLastGameplayEvent).c_str());
-        const std::string& lastEventId = m_lastGameplayEventId;
         if (lastEventId.empty()) {
           ImGui::TextUnformatted(loc.Get(m_locLabelNoEventYet).c_str());
         } else if (lastEventId == SCS_TELEMETRY_GAMEPLAY_EVENT_job_delivered) {
@@ -910,26 +912,123 @@ void TelemetryWindow::RenderContent() {
       ImGui::EndTabItem();
     }
 
+    if (ImGui::BeginTabItem(loc.Get(m_locTabTiming).c_str())) {
+#if SPF_TELEMETRY_TIMING
+      // Service stages first, then one row per plugin subscription.
+      const auto sections = Telemetry::TimingRegistry::GetInstance().GetStats();
+      if (ImGui::BeginTable("timing", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp)) {
+        ImGui::TableSetupColumn(loc.Get(m_locLabelTimingSection).c_str());
+        ImGui::TableSetupColumn(loc.Get(m_locLabelTimingSamples).c_str());
+        ImGui::TableSetupColumn(loc.Get(m_locLabelTimingP50).c_str());
+        ImGui::TableSetupColumn(loc.Get(m_locLabelTimingP99).c_str());
+        ImGui::TableSetupColumn(loc.Get(m_locLabelTimingMax).c_str());
+        ImGui::TableHeadersRow();
+        for (const auto& section : sections) {
+          ImGui::TableNextRow();
+          ImGui::TableNextColumn();
+          ImGui::TextUnformatted(section.name.c_str());
+          ImGui::TableNextColumn();
+          ImGui::Text("%llu", static_cast<unsigned long long>(section.stats.count));
+          ImGui::TableNextColumn();
+          ImGui::Text("%.1f", section.stats.p50Us);
+          ImGui::TableNextColumn();
+          ImGui::Text("%.1f", section.stats.p99Us);
+          ImGui::TableNextColumn();
+          ImGui::Text("%.1f", section.stats.maxUs);
+        }
+        ImGui::EndTable();
+      }
+#else
+      ImGui::TextUnformatted(loc.Get(m_locLabelTimingDisabled).c_str());
+#endif
+      ImGui::EndTabItem();
+    }
+
+    if (ImGui::BeginTabItem(loc.Get(m_locTabGraphs).c_str())) {
+      if (!m_graphHistory) {
+        constexpr std::array<Field, 4> graphFields = {Field::TruckSpeed, Field::TruckEngineRpm, Field::TruckWaterTemperature, Field::TruckOilTemperature};
+        m_graphHistory = m_telemetryService.RecordFieldHistory(graphFields);
+      }
+
+      ImGui::TextUnformatted(loc.Get(m_locLabelGraphRange).c_str());
+      for (const int minutes : {1, 10, 60}) {
+        ImGui::SameLine();
+        ImGui::RadioButton(fmt::format(fmt::runtime(loc.Get(m_locLabelGraphMinutes)), minutes).c_str(), &m_graphRangeMinutes, minutes);
+      }
+
+      const uint64_t toUs = m_telemetryService.GetFieldHistory().GetLatestTime();
+      const uint64_t rangeUs = static_cast<uint64_t>(m_graphRangeMinutes) * 60'000'000;
+      const uint64_t fromUs = toUs > rangeUs ? toUs - rangeUs : 0;
+
+      ImGui::Text(loc.Get(m_locLabelSpeed).c_str(), truckData.speed * 3.6f);
+      RenderHistoryGraph("##graph_speed", Field::TruckSpeed, 3.6f, fromUs, toUs);
+      ImGui::Text(loc.Get(m_locLabelEngineRpm).c_str(), truckData.engine_rpm);
+      RenderHistoryGraph("##graph_rpm", Field::TruckEngineRpm, 1.0f, fromUs, toUs);
+      ImGui::Text(loc.Get(m_locLabelWaterTemp).c_str(), truckData.water_temperature);
+      RenderHistoryGraph("##graph_water", Field::TruckWaterTemperature, 1.0f, fromUs, toUs);
+      ImGui::Text(loc.Get(m_locLabelGraphOilTemp).c_str(), truckData.oil_temperature);
+      RenderHistoryGraph("##graph_oil", Field::TruckOilTemperature, 1.0f, fromUs, toUs);
+      ImGui::EndTabItem();
+    }
+
     ImGui::EndTabBar();
   }
 }
 
-void TelemetryWindow::OnGameStateUpdate(const Telemetry::SCS::GameState& data) { m_gameState = data; }
-void TelemetryWindow::OnTimestampsUpdate(const Telemetry::SCS::Timestamps& data) { m_timestamps = data; }
-void TelemetryWindow::OnCommonDataUpdate(const Telemetry::SCS::CommonData& data) { m_commonData = data; }
-void TelemetryWindow::OnTruckConstantsUpdate(const Telemetry::SCS::TruckConstants& data) { m_truckConstants = data; }
-void TelemetryWindow::OnTruckDataUpdate(const Telemetry::SCS::TruckData& data) { m_truckData = data; }
-void TelemetryWindow::OnTrailersUpdate(const std::vector<Telemetry::SCS::Trailer>& data) { m_trailers = data; }
-void TelemetryWindow::OnJobConstantsUpdate(const Telemetry::SCS::JobConstants& data) { m_jobConstants = data; }
-void TelemetryWindow::OnJobDataUpdate(const Telemetry::SCS::JobData& data) { m_jobData = data; }
-void TelemetryWindow::OnNavigationDataUpdate(const Telemetry::SCS::NavigationData& data) { m_navigationData = data; }
-void TelemetryWindow::OnControlsUpdate(const Telemetry::SCS::Controls& data) { m_controls = data; }
+void TelemetryWindow::RenderHistoryGraph(const char* id, Field field, float scale, uint64_t fromUs, uint64_t toUs) {
+  const float width = std::max(ImGui::GetContentRegionAvail().x, 3.0f);
+  const float height = ImGui::GetTextLineHeight() * 5.0f;
+  ImGui::InvisibleButton(id, ImVec2(width, height));
+  const ImVec2 p_min = ImGui::GetItemRectMin();
+  const ImVec2 p_max = ImGui::GetItemRectMax();
+  ImDrawList* draw_list = ImGui::GetWindowDrawList();
+  draw_list->AddRectFilled(p_min, p_max, ImGui::GetColorU32(ImGuiCol_FrameBg), ImGui::GetStyle().FrameRounding);
+
+  // One point per pixel column; the history picks the tier and decimates.
+  const size_t count = m_telemetryService.GetFieldHistory().Query(field, fromUs, toUs, static_cast<size_t>(width), m_graphPoints);
+  if (count == 0 || toUs <= fromUs) {
+    draw_list->AddText(ImVec2(p_min.x + 4.0f, p_min.y + 2.0f), ImGui::GetColorU32(ImGuiCol_TextDisabled), LocalizationManager::GetInstance().Get(m_locLabelGraphNoData).c_str());
+    return;
+  }
+
+  float low = m_graphPoints[0].min * scale;
+  float high = m_graphPoints[0].max * scale;
+  for (const auto& point : m_graphPoints) {
+    low = std::min(low, point.min * scale);
+    high = std::max(high, point.max * scale);
+  }
+  if (high - low < 1.0f) {
+    low -= 0.5f;
+    high += 0.5f;
+  }
+
+  const double xScale = width / static_cast<double>(toUs - fromUs);
+  auto toScreen = [&](uint64_t time, float value) {
+    const float x = p_min.x + static_cast<float>(static_cast<double>(time > fromUs ? time - fromUs : 0) * xScale);
+    const float y = p_max.y - (value * scale - low) / (high - low) * height;
+    return ImVec2(x, y);
+  };
+
+  // Envelope of the samples each point stands for, then the series itself.
+  const ImU32 envelopeColor = ImGui::GetColorU32(ImGuiCol_PlotLines, 0.35f);
+  const ImU32 lineColor = ImGui::GetColorU32(ImGuiCol_PlotLines);
+  for (const auto& point : m_graphPoints) {
+    if (point.max > point.min) draw_list->AddLine(toScreen(point.time, point.min), toScreen(point.time, point.max), envelopeColor);
+  }
+  for (size_t i = 1; i < count; ++i) {
+    draw_list->AddLine(toScreen(m_graphPoints[i - 1].time, m_graphPoints[i - 1].value), toScreen(m_graphPoints[i].time, m_graphPoints[i].value), lineColor, 1.5f);
+  }
+
+  const ImU32 textColor = ImGui::GetColorU32(ImGuiCol_TextDisabled);
+  draw_list->AddText(ImVec2(p_min.x + 4.0f, p_min.y + 2.0f), textColor, fmt::format("{:.0f}", high).c_str());
+  draw_list->AddText(ImVec2(p_min.x + 4.0f, p_max.y - ImGui::GetTextLineHeight() - 2.0f), textColor, fmt::format("{:.0f}", low).c_str());
+}
+
 void TelemetryWindow::OnSpecialEventsUpdate(const Telemetry::SCS::SpecialEvents& data) { m_specialEvents = data; }
-void TelemetryWindow::OnGameplayEventUpdate(const char* event_id, const Telemetry::SCS::GameplayEvents& data) {
-  m_gameplayEvents = data;
-  m_lastGameplayEventId = event_id;
+
+void TelemetryWindow::OnTimestampsUpdate(const Telemetry::SCS::Timestamps&) {
+  if (!IsVisible()) m_channels.Reset();
 }
-void TelemetryWindow::OnGearboxConstantsUpdate(const Telemetry::SCS::GearboxConstants& data) { m_gearboxConstants = data; }
 
 }  // namespace UI
 SPF_NS_END
\ No newline at end of file
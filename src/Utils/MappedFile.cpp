@@ -0,0 +1,103 @@
+#include "SPF/Utils/MappedFile.hpp"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+SPF_NS_BEGIN
+namespace Utils {
+
+MappedFile::~MappedFile() { Close(); }
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::string& path) {
+  Close();
+
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE) return false;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size)) {
+    CloseHandle(file);
+    return false;
+  }
+
+  m_fileHandle = file;
+  m_size = static_cast<size_t>(size.QuadPart);
+  m_isOpen = true;
+  if (m_size == 0) return true;  // Zero-length files cannot be mapped.
+
+  HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping) {
+    Close();
+    return false;
+  }
+  m_mappingHandle = mapping;
+
+  m_data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+  if (!m_data) {
+    Close();
+    return false;
+  }
+  return true;
+}
+
+void MappedFile::Close() {
+  if (m_data) UnmapViewOfFile(m_data);
+  if (m_mappingHandle) CloseHandle(m_mappingHandle);
+  if (m_fileHandle) CloseHandle(m_fileHandle);
+  m_data = nullptr;
+  m_mappingHandle = nullptr;
+  m_fileHandle = nullptr;
+  m_size = 0;
+  m_isOpen = false;
+}
+
+#else
+
+bool MappedFile::Open(const std::string& path) {
+  Close();
+
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+
+  struct stat info;
+  if (fstat(fd, &info) != 0) {
+    ::close(fd);
+    return false;
+  }
+
+  m_size = static_cast<size_t>(info.st_size);
+  if (m_size > 0) {
+    void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      ::close(fd);
+      m_size = 0;
+      return false;
+    }
+    m_data = static_cast<const uint8_t*>(data);
+  }
+
+  // The mapping keeps its own reference to the file.
+  ::close(fd);
+  m_isOpen = true;
+  return true;
+}
+
+void MappedFile::Close() {
+  if (m_data) munmap(const_cast<uint8_t*>(m_data), m_size);
+  m_data = nullptr;
+  m_size = 0;
+  m_isOpen = false;
+}
+
+#endif
+
+}  // namespace Utils
+SPF_NS_END
@@ -0,0 +1,167 @@
+#include "SPF/Utils/SharedMemory.hpp"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <semaphore.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <ctime>
+#endif
+
+SPF_NS_BEGIN
+namespace Utils {
+
+SharedMemory::~SharedMemory() { Close(); }
+
+bool SharedMemory::Create(const std::string& name, size_t size) { return Map(name, size, true, true); }
+
+bool SharedMemory::Open(const std::string& name, size_t size, bool writable) { return Map(name, size, false, writable); }
+
+NamedSemaphore::~NamedSemaphore() { Close(); }
+
+#ifdef _WIN32
+
+bool SharedMemory::Map(const std::string& name, size_t size, bool create, bool writable) {
+  Close();
+  const std::string objectName = "Local\\" + name;
+
+  HANDLE mapping = nullptr;
+  if (create) {
+    const auto size64 = static_cast<uint64_t>(size);
+    mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64), objectName.c_str());
+  } else {
+    mapping = OpenFileMappingA(writable ? FILE_MAP_WRITE : FILE_MAP_READ, FALSE, objectName.c_str());
+  }
+  if (!mapping) return false;
+
+  void* view = MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size);
+  if (!view) {
+    CloseHandle(mapping);
+    return false;
+  }
+
+  m_mappingHandle = mapping;
+  m_data = static_cast<uint8_t*>(view);
+  m_size = size;
+  return true;
+}
+
+void SharedMemory::Close() {
+  if (m_data) UnmapViewOfFile(m_data);
+  if (m_mappingHandle) CloseHandle(m_mappingHandle);
+  m_data = nullptr;
+  m_mappingHandle = nullptr;
+  m_size = 0;
+}
+
+bool NamedSemaphore::Create(const std::string& name) {
+  Close();
+  m_handle = CreateSemaphoreA(nullptr, 0, LONG_MAX, ("Local\\" + name).c_str());
+  return m_handle != nullptr;
+}
+
+bool NamedSemaphore::Open(const std::string& name) {
+  Close();
+  m_handle = OpenSemaphoreA(SEMAPHORE_MODIFY_STATE | SYNCHRONIZE, FALSE, ("Local\\" + name).c_str());
+  return m_handle != nullptr;
+}
+
+void NamedSemaphore::Close() {
+  if (m_handle) CloseHandle(m_handle);
+  m_handle = nullptr;
+}
+
+void NamedSemaphore::Post(uint32_t count) {
+  if (m_handle && count > 0) ReleaseSemaphore(m_handle, static_cast<LONG>(count), nullptr);
+}
+
+bool NamedSemaphore::Wait(uint32_t timeoutMs) { return m_handle && WaitForSingleObject(m_handle, timeoutMs) == WAIT_OBJECT_0; }
+
+#else
+
+bool SharedMemory::Map(const std::string& name, size_t size, bool create, bool writable) {
+  Close();
+  const std::string objectName = "/" + name;
+
+  const int flags = create ? (O_RDWR | O_CREAT) : (writable ? O_RDWR : O_RDONLY);
+  const int fd = shm_open(objectName.c_str(), flags, 0644);
+  if (fd < 0) return false;
+
+  if (create && ftruncate(fd, static_cast<off_t>(size)) != 0) {
+    ::close(fd);
+    return false;
+  }
+
+  void* data = mmap(nullptr, size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) return false;
+
+  m_data = static_cast<uint8_t*>(data);
+  m_size = size;
+  if (create) m_unlinkName = objectName;
+  return true;
+}
+
+void SharedMemory::Close() {
+  if (m_data) munmap(m_data, m_size);
+  if (!m_unlinkName.empty()) shm_unlink(m_unlinkName.c_str());
+  m_data = nullptr;
+  m_size = 0;
+  m_unlinkName.clear();
+}
+
+bool NamedSemaphore::Create(const std::string& name) {
+  Close();
+  const std::string objectName = "/" + name;
+  sem_t* semaphore = sem_open(objectName.c_str(), O_CREAT, 0644, 0);
+  if (semaphore == SEM_FAILED) return false;
+  m_handle = semaphore;
+  m_unlinkName = objectName;
+  return true;
+}
+
+bool NamedSemaphore::Open(const std::string& name) {
+  Close();
+  sem_t* semaphore = sem_open(("/" + name).c_str(), 0);
+  if (semaphore == SEM_FAILED) return false;
+  m_handle = semaphore;
+  return true;
+}
+
+void NamedSemaphore::Close() {
+  if (m_handle) sem_close(static_cast<sem_t*>(m_handle));
+  if (!m_unlinkName.empty()) sem_unlink(m_unlinkName.c_str());
+  m_handle = nullptr;
+  m_unlinkName.clear();
+}
+
+void NamedSemaphore::Post(uint32_t count) {
+  if (!m_handle) return;
+  for (uint32_t i = 0; i < count; ++i) sem_post(static_cast<sem_t*>(m_handle));
+}
+
+bool NamedSemaphore::Wait(uint32_t timeoutMs) {
+  if (!m_handle) return false;
+  timespec deadline;
+  clock_gettime(CLOCK_REALTIME, &deadline);
+  deadline.tv_sec += timeoutMs / 1000;
+  deadline.tv_nsec += static_cast<long>(timeoutMs % 1000) * 1000000L;
+  if (deadline.tv_nsec >= 1000000000L) {
+    ++deadline.tv_sec;
+    deadline.tv_nsec -= 1000000000L;
+  }
+  while (sem_timedwait(static_cast<sem_t*>(m_handle), &deadline) != 0) {
+    if (errno != EINTR) return false;
+  }
+  return true;
+}
+
+#endif
+
+}  // namespace Utils
+SPF_NS_END
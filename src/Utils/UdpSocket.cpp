@@ -0,0 +1,146 @@
+#include "SPF/Utils/UdpSocket.hpp"
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#endif
+
+SPF_NS_BEGIN
+namespace Utils {
+namespace {
+#ifdef _WIN32
+using NativeSocket = SOCKET;
+using AddressLength = int;
+constexpr NativeSocket InvalidSocket = INVALID_SOCKET;
+
+void CloseNative(NativeSocket socket) { closesocket(socket); }
+std::string LastSocketError() { return "WSA error " + std::to_string(WSAGetLastError()); }
+bool SetNonBlocking(NativeSocket socket) {
+  u_long enabled = 1;
+  return ioctlsocket(socket, FIONBIO, &enabled) == 0;
+}
+#else
+using NativeSocket = int;
+using AddressLength = socklen_t;
+constexpr NativeSocket InvalidSocket = -1;
+
+void CloseNative(NativeSocket socket) { close(socket); }
+std::string LastSocketError() { return strerror(errno); }
+bool SetNonBlocking(NativeSocket socket) {
+  const int flags = fcntl(socket, F_GETFL, 0);
+  return flags != -1 && fcntl(socket, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+#endif
+
+sockaddr_in ToSockAddr(const UdpEndpoint& endpoint) {
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(endpoint.address);
+  address.sin_port = htons(endpoint.port);
+  return address;
+}
+}  // namespace
+
+UdpSocket::~UdpSocket() { Close(); }
+
+bool UdpSocket::IsOpen() const { return static_cast<NativeSocket>(m_socket) != InvalidSocket; }
+
+bool UdpSocket::ParseAddress(const std::string& text, uint32_t& address) {
+  in_addr parsed = {};
+  if (inet_pton(AF_INET, text.c_str(), &parsed) != 1) return false;
+  address = ntohl(parsed.s_addr);
+  return true;
+}
+
+bool UdpSocket::Open(const std::string& address, uint16_t port) {
+  Close();
+
+#ifdef _WIN32
+  WSADATA data;
+  if (WSAStartup(MAKEWORD(2, 2), &data) != 0) {
+    m_lastError = "WSAStartup failed";
+    return false;
+  }
+  m_winsockStarted = true;
+#endif
+
+  UdpEndpoint local{0, port};
+  if (!ParseAddress(address, local.address)) {
+    m_lastError = "Invalid IPv4 address '" + address + "'";
+    Close();
+    return false;
+  }
+
+  const NativeSocket socket = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (socket == InvalidSocket) {
+    m_lastError = "socket() failed: " + LastSocketError();
+    Close();
+    return false;
+  }
+  m_socket = static_cast<uintptr_t>(socket);
+
+  const sockaddr_in bound = ToSockAddr(local);
+  if (bind(socket, reinterpret_cast<const sockaddr*>(&bound), sizeof(bound)) != 0 || !SetNonBlocking(socket)) {
+    m_lastError = "Could not bind " + address + ":" + std::to_string(port) + ": " + LastSocketError();
+    Close();
+    return false;
+  }
+
+  sockaddr_in actual = {};
+  AddressLength length = sizeof(actual);
+  getsockname(socket, reinterpret_cast<sockaddr*>(&actual), &length);
+  m_localPort = ntohs(actual.sin_port);
+  return true;
+}
+
+void UdpSocket::Close() {
+  if (IsOpen()) CloseNative(static_cast<NativeSocket>(m_socket));
+  m_socket = static_cast<uintptr_t>(InvalidSocket);
+  m_localPort = 0;
+#ifdef _WIN32
+  if (m_winsockStarted) WSACleanup();
+  m_winsockStarted = false;
+#endif
+}
+
+bool UdpSocket::SendTo(const UdpEndpoint& to, const void* data, size_t size) {
+  if (!IsOpen()) return false;
+  const sockaddr_in address = ToSockAddr(to);
+  auto sent = sendto(static_cast<NativeSocket>(m_socket), static_cast<const char*>(data), static_cast<int>(size), 0, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+  return sent == static_cast<decltype(sent)>(size);
+}
+
+size_t UdpSocket::ReceiveFrom(void* buffer, size_t capacity, UdpEndpoint& from, uint32_t timeoutMs) {
+  if (!IsOpen()) return 0;
+  const auto socket = static_cast<NativeSocket>(m_socket);
+
+  if (timeoutMs > 0) {
+    fd_set readable;
+    FD_ZERO(&readable);
+    FD_SET(socket, &readable);
+    timeval timeout = {static_cast<long>(timeoutMs / 1000), static_cast<long>((timeoutMs % 1000) * 1000)};
+    if (select(static_cast<int>(socket) + 1, &readable, nullptr, nullptr, &timeout) <= 0) return 0;
+  }
+
+  sockaddr_in address = {};
+  AddressLength length = sizeof(address);
+  const auto received = recvfrom(socket, static_cast<char*>(buffer), static_cast<int>(capacity), 0, reinterpret_cast<sockaddr*>(&address), &length);
+  // Errors include "would block" and, on Windows, ICMP port-unreachable reports for earlier sends.
+  if (received <= 0) return 0;
+
+  from.address = ntohl(address.sin_addr.s_addr);
+  from.port = ntohs(address.sin_port);
+  return static_cast<size_t>(received);
+}
+}  // namespace Utils
+SPF_NS_END
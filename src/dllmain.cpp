@@ -85,6 +85,10 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
     case DLL_PROCESS_DETACH: {
       // This is called when the DLL is unloaded.
       // We ensure our Core is destroyed and uninitialize MinHook.
+      // lpReserved is non-null when the process is exiting rather than unloading the DLL.
+      if (g_Core) {
+        g_Core->FullShutdown(lpReserved != nullptr);
+      }
       g_Core.reset();
       MH_Uninitialize();
       break;
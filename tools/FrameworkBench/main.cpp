@@ -0,0 +1,283 @@
+/**
+ * @file main.cpp
+ * @brief Micro-benchmarks for framework hot paths that do not need the game.
+ *
+ * `signal` times Utils::Signal::Call with 1, 10 and 100 connected delegates against a signal
+ * that copies its delegate list on every call (how Call worked before), and counts the heap
+ * allocations made by Call, and times disconnecting Sinks of growing size.
+ *
+ * `logging` times a Logger call whose level no sink accepts, with the UI sink collecting from
+ * Info (so the call returns before formatting) and from Trace (so it formats and collects),
+ * next to an Info call that reaches every sink.
+ *
+ * Usage:
+ *   FrameworkBench signal [--iterations N]
+ *   FrameworkBench logging [--iterations N]
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "SPF/Logging/Logger.hpp"
+#include "SPF/Logging/Sinks/LoggerWindowSink.hpp"
+#include "SPF/Utils/Signal.hpp"
+
+using namespace SPF::Logging;
+
+using namespace SPF::Utils;
+
+namespace {
+std::atomic<uint64_t> g_allocations = 0;
+}  // namespace
+
+// Counts heap allocations, so a benchmark can show that a path does not allocate. The whole
+// replaceable set is defined, so every form of new is counted and paired with its delete.
+namespace {
+void* CountedAlloc(size_t size) noexcept {
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  return std::malloc(size ? size : 1);
+}
+
+void* CountedAlignedAlloc(size_t size, std::align_val_t alignment) noexcept {
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  const size_t align = std::max(static_cast<size_t>(alignment), sizeof(void*));
+  return std::aligned_alloc(align, (std::max<size_t>(size, 1) + align - 1) / align * align);
+}
+}  // namespace
+
+void* operator new(size_t size) {
+  if (void* memory = CountedAlloc(size)) return memory;
+  throw std::bad_alloc();
+}
+void* operator new[](size_t size) {
+  if (void* memory = CountedAlloc(size)) return memory;
+  throw std::bad_alloc();
+}
+void* operator new(size_t size, std::align_val_t alignment) {
+  if (void* memory = CountedAlignedAlloc(size, alignment)) return memory;
+  throw std::bad_alloc();
+}
+void* operator new[](size_t size, std::align_val_t alignment) {
+  if (void* memory = CountedAlignedAlloc(size, alignment)) return memory;
+  throw std::bad_alloc();
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return CountedAlloc(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return CountedAlloc(size); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return CountedAlignedAlloc(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return CountedAlignedAlloc(size, alignment); }
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, size_t) noexcept { std::free(memory); }
+void operator delete(void* memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void* memory, size_t, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept { std::free(memory); }
+
+namespace {
+struct Options {
+  uint64_t iterations = 0;  // 0: a count that takes long enough to measure
+};
+
+template <typename Fn>
+double TimeNs(uint64_t iterations, Fn&& fn) {
+  const auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < iterations; ++i) fn(i);
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / static_cast<double>(iterations);
+}
+
+// ---- signal ----
+
+struct Counter {
+  uint64_t total = 0;
+  void OnEvent(int value) { total += static_cast<uint64_t>(value); }
+};
+
+// Signal::Call before it stopped copying: the delegate list is copied on every call.
+class CopyingSignal {
+ public:
+  template <auto MethodAddr, typename T>
+  void Connect(T* content) {
+    Delegate<void(int)> delegate;
+    delegate.template Connect<MethodAddr>(content);
+    m_calls.push_back(delegate);
+  }
+
+  void Call(int value) noexcept {
+    auto callsCopy = m_calls;
+    for (auto& delegate : callsCopy) delegate.Call(value);
+  }
+
+ private:
+  std::vector<Delegate<void(int)>> m_calls;
+};
+
+int RunSignalBench(const Options& options) {
+  bool ok = true;
+  printf("Signal::Call          copying list     in place     allocations per call\n");
+  for (const size_t subscribers : {1, 10, 100}) {
+    const uint64_t iterations = options.iterations ? options.iterations : std::max<uint64_t>(100000, 20000000 / subscribers);
+
+    std::vector<Counter> counters(subscribers);
+    CopyingSignal copying;
+    Signal<void(int)> signal;
+    Sink sink(signal);
+    for (auto& counter : counters) {
+      copying.Connect<&Counter::OnEvent>(&counter);
+      sink.Connect<&Counter::OnEvent>(&counter);
+    }
+
+    const double copyingNs = TimeNs(iterations, [&](uint64_t) { copying.Call(1); });
+    const uint64_t allocationsBefore = g_allocations.load(std::memory_order_relaxed);
+    const double inPlaceNs = TimeNs(iterations, [&](uint64_t) { signal.Call(1); });
+    const uint64_t allocations = g_allocations.load(std::memory_order_relaxed) - allocationsBefore;
+
+    // Every delegate must have run once per call of each signal.
+    for (const auto& counter : counters) {
+      if (counter.total != 2 * iterations) ok = false;
+    }
+    printf("  %3zu delegates    %9.1f ns   %9.1f ns     %.2f\n", subscribers, copyingNs, inPlaceNs, static_cast<double>(allocations) / static_cast<double>(iterations));
+  }
+
+  // Disconnecting a sink from a signal that other sinks keep using. The time per delegate
+  // should stay flat as the sink and the signal grow.
+  printf("Sink::Clear of N of 2N delegates (with reconnect)   per clear    per delegate   allocations per clear\n");
+  for (const size_t connected : {10, 100, 1000}) {
+    std::vector<Counter> counters(2 * connected);
+    Signal<void(int)> signal;
+    Sink others(signal);
+    for (size_t i = 0; i < connected; ++i) others.Connect<&Counter::OnEvent>(&counters[i]);
+    Sink sink(signal);
+
+    const uint64_t rounds = std::max<uint64_t>(1000, 1000000 / connected);
+    uint64_t allocations = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t round = 0; round < rounds; ++round) {
+      for (size_t i = connected; i < counters.size(); ++i) sink.Connect<&Counter::OnEvent>(&counters[i]);
+      const uint64_t allocationsBefore = g_allocations.load(std::memory_order_relaxed);
+      sink.Clear();
+      allocations += g_allocations.load(std::memory_order_relaxed) - allocationsBefore;
+    }
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / static_cast<double>(rounds);
+
+    signal.Call(1);
+    for (size_t i = 0; i < counters.size(); ++i) {
+      if (counters[i].total != (i < connected ? 1u : 0u)) ok = false;
+    }
+    printf("  N = %4zu                                        %9.1f ns   %9.1f ns     %.2f\n", connected, ns, ns / static_cast<double>(connected),
+           static_cast<double>(allocations) / static_cast<double>(rounds));
+  }
+
+  if (!ok) {
+    fprintf(stderr, "Delegates were not called as expected\n");
+    return 1;
+  }
+  return 0;
+}
+
+// ---- logging ----
+
+// Stands in for the file sink: filtered by the logger level, and cheap.
+class CountingSink : public ILogSink {
+ public:
+  fmt::string_view GetName() const override { return "counting"; }
+  void Log(const LogMessage&) override { ++count; }
+
+  uint64_t count = 0;
+};
+
+int RunLoggingBench(const Options& options) {
+  const uint64_t iterations = options.iterations ? options.iterations : 2000000;
+  constexpr uint64_t uiClearInterval = 10000;  // Keeps the UI sink's message list small
+
+  auto fileSink = std::make_shared<CountingSink>();
+  auto uiSink = std::make_shared<Sinks::LoggerWindowSink>();
+  Logger logger("Bench");
+  logger.SetLevel(LogLevel::Info);
+  logger.SetSinks({fileSink, uiSink});
+
+  bool ok = true;
+  const auto measure = [&](const char* label, LogLevel level) {
+    const uint64_t fileBefore = fileSink->count;
+    uint64_t collected = 0;
+    const uint64_t allocationsBefore = g_allocations.load(std::memory_order_relaxed);
+    const double ns = TimeNs(iterations, [&](uint64_t i) {
+      logger.Log(level, "frame {} took {:.3f} ms on {}", i, 16.6, "render");
+      if ((i + 1) % uiClearInterval == 0) {
+        collected += uiSink->GetMessages().size();
+        uiSink->Clear();
+      }
+    });
+    const uint64_t allocations = g_allocations.load(std::memory_order_relaxed) - allocationsBefore;
+    collected += uiSink->GetMessages().size();
+    uiSink->Clear();
+    printf("  %-44s %8.1f ns  %6.2f allocations  (file %llu, UI %llu)\n", label, ns, static_cast<double>(allocations) / static_cast<double>(iterations),
+           static_cast<unsigned long long>(fileSink->count - fileBefore), static_cast<unsigned long long>(collected));
+    return std::pair<uint64_t, uint64_t>{fileSink->count - fileBefore, collected};
+  };
+
+  printf("Logger at Info with a file sink and the UI sink, per call:\n");
+  uiSink->SetLevel(LogLevel::Info);
+  logger.RefreshSinkLevels();
+  const auto disabled = measure("Debug, UI collects from Info (skipped)", LogLevel::Debug);
+  ok = ok && !logger.ShouldLog(LogLevel::Debug) && disabled.first == 0 && disabled.second == 0;
+
+  uiSink->SetLevel(LogLevel::Trace);
+  logger.RefreshSinkLevels();
+  const auto collectedByUi = measure("Debug, UI collects from Trace (formatted)", LogLevel::Debug);
+  ok = ok && logger.ShouldLog(LogLevel::Debug) && collectedByUi.first == 0 && collectedByUi.second == iterations;
+
+  const auto enabled = measure("Info, reaches both sinks", LogLevel::Info);
+  ok = ok && enabled.first == iterations && enabled.second == iterations;
+
+  if (!ok) {
+    fprintf(stderr, "Messages did not reach the expected sinks\n");
+    return 1;
+  }
+  return 0;
+}
+
+void PrintUsage() {
+  fprintf(stderr,
+          "Usage:\n"
+          "  FrameworkBench signal [--iterations N]\n"
+          "  FrameworkBench logging [--iterations N]\n");
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    PrintUsage();
+    return 1;
+  }
+
+  const std::string mode = argv[1];
+  Options options;
+  for (int i = 2; i < argc; ++i) {
+    if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+      options.iterations = strtoull(argv[++i], nullptr, 10);
+    } else {
+      PrintUsage();
+      return 1;
+    }
+  }
+
+  if (mode == "signal") return RunSignalBench(options);
+  if (mode == "logging") return RunLoggingBench(options);
+
+  PrintUsage();
+  return 1;
+}
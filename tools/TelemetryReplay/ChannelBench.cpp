@@ -0,0 +1,427 @@
+#include "ChannelBench.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "SPF/Telemetry/ChannelBinding.hpp"
+#include "SPF/Telemetry/Recording/TelemetryReplayer.hpp"
+
+using SPF::Telemetry::ChannelBinding;
+using SPF::Telemetry::Recording::TelemetryReplayer;
+
+namespace {
+constexpr scs_u32_t kMaxWheels = 16;  // Indices registered for each wheel channel
+constexpr size_t kNoChannel = SIZE_MAX;
+
+struct ChannelDef {
+  const char* name;
+  scs_value_type_t type;
+};
+
+// Everything the framework registers, in the old registration order.
+// clang-format off
+constexpr ChannelDef kScalarChannels[] = {
+    {SCS_TELEMETRY_CHANNEL_local_scale, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_CHANNEL_game_time, SCS_VALUE_TYPE_u32},
+    {SCS_TELEMETRY_CHANNEL_multiplayer_time_offset, SCS_VALUE_TYPE_s32},
+    {SCS_TELEMETRY_CHANNEL_next_rest_stop, SCS_VALUE_TYPE_s32},
+    {SCS_TELEMETRY_JOB_CHANNEL_cargo_damage, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_world_placement, SCS_VALUE_TYPE_dplacement},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_local_linear_velocity, SCS_VALUE_TYPE_fvector},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_local_angular_velocity, SCS_VALUE_TYPE_fvector},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_local_linear_acceleration, SCS_VALUE_TYPE_fvector},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_local_angular_acceleration, SCS_VALUE_TYPE_fvector},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_cabin_offset, SCS_VALUE_TYPE_fplacement},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_cabin_angular_velocity, SCS_VALUE_TYPE_fvector},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_cabin_angular_acceleration, SCS_VALUE_TYPE_fvector},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_head_offset, SCS_VALUE_TYPE_fplacement},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_speed, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_engine_rpm, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_engine_gear, SCS_VALUE_TYPE_s32},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_displayed_gear, SCS_VALUE_TYPE_s32},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_input_steering, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_input_throttle, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_input_brake, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_input_clutch, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_effective_steering, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_effective_throttle, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_effective_brake, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_effective_clutch, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_cruise_control, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_hshifter_slot, SCS_VALUE_TYPE_u32},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_parking_brake, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_motor_brake, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_retarder_level, SCS_VALUE_TYPE_u32},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_brake_air_pressure, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_brake_air_pressure_warning, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_brake_air_pressure_emergency, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_brake_temperature, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_fuel, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_fuel_warning, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_fuel_average_consumption, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_fuel_range, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_adblue, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_adblue_warning, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_oil_pressure, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_oil_pressure_warning, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_oil_temperature, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_water_temperature, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_water_temperature_warning, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_battery_voltage, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_battery_voltage_warning, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_electric_enabled, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_engine_enabled, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wipers, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_differential_lock, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_lift_axle, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_lift_axle_indicator, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_trailer_lift_axle, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_trailer_lift_axle_indicator, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_lblinker, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_rblinker, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_hazard_warning, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_lblinker, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_rblinker, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_parking, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_low_beam, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_high_beam, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_aux_front, SCS_VALUE_TYPE_u32},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_aux_roof, SCS_VALUE_TYPE_u32},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_beacon, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_brake, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_light_reverse, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_dashboard_backlight, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wear_engine, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wear_transmission, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wear_cabin, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wear_chassis, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wear_wheels, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_odometer, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_navigation_distance, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_navigation_time, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_navigation_speed_limit, SCS_VALUE_TYPE_float},
+};
+
+constexpr ChannelDef kIndexedTruckChannels[] = {
+    {SCS_TELEMETRY_TRUCK_CHANNEL_hshifter_selector, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wheel_susp_deflection, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wheel_on_ground, SCS_VALUE_TYPE_bool},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wheel_substance, SCS_VALUE_TYPE_u32},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wheel_velocity, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wheel_steering, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wheel_rotation, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wheel_lift, SCS_VALUE_TYPE_float},
+    {SCS_TELEMETRY_TRUCK_CHANNEL_wheel_lift_offset, SCS_VALUE_TYPE_float},
+};
+
+// Registered as "trailer.<index>.<suffix>"; the wheel channels are indexed.
+constexpr ChannelDef kTrailerChannels[] = {
+    {"connected", SCS_VALUE_TYPE_bool},
+    {"cargo.damage", SCS_VALUE_TYPE_float},
+    {"world.placement", SCS_VALUE_TYPE_dplacement},
+    {"velocity.linear", SCS_VALUE_TYPE_fvector},
+    {"velocity.angular", SCS_VALUE_TYPE_fvector},
+    {"acceleration.linear", SCS_VALUE_TYPE_fvector},
+    {"acceleration.angular", SCS_VALUE_TYPE_fvector},
+    {"wear.body", SCS_VALUE_TYPE_float},
+    {"wear.chassis", SCS_VALUE_TYPE_float},
+    {"wear.wheels", SCS_VALUE_TYPE_float},
+    {"wheel.suspension.deflection", SCS_VALUE_TYPE_float},
+    {"wheel.on_ground", SCS_VALUE_TYPE_bool},
+    {"wheel.substance", SCS_VALUE_TYPE_u32},
+    {"wheel.angular_velocity", SCS_VALUE_TYPE_float},
+    {"wheel.steering", SCS_VALUE_TYPE_float},
+    {"wheel.rotation", SCS_VALUE_TYPE_float},
+    {"wheel.lift", SCS_VALUE_TYPE_float},
+    {"wheel.lift.offset", SCS_VALUE_TYPE_float},
+};
+constexpr size_t kFirstTrailerWheelChannel = 10;
+
+// The old processors' strcmp chains, in their order. The truck chain still tested the input
+// and navigation names, although the prefix router sent those channels elsewhere.
+constexpr const char* kLegacyCommonChain[] = {
+    SCS_TELEMETRY_CHANNEL_game_time, SCS_TELEMETRY_CHANNEL_local_scale, SCS_TELEMETRY_CHANNEL_next_rest_stop, SCS_TELEMETRY_CHANNEL_multiplayer_time_offset,
+};
+constexpr const char* kLegacyJobChain[] = {
+    SCS_TELEMETRY_JOB_CHANNEL_cargo_damage, SCS_TELEMETRY_TRUCK_CHANNEL_navigation_distance, SCS_TELEMETRY_TRUCK_CHANNEL_navigation_time,
+    SCS_TELEMETRY_TRUCK_CHANNEL_navigation_speed_limit,
+};
+constexpr const char* kLegacyControlsChain[] = {
+    SCS_TELEMETRY_TRUCK_CHANNEL_input_steering, SCS_TELEMETRY_TRUCK_CHANNEL_input_throttle, SCS_TELEMETRY_TRUCK_CHANNEL_input_brake,
+    SCS_TELEMETRY_TRUCK_CHANNEL_input_clutch, SCS_TELEMETRY_TRUCK_CHANNEL_effective_steering, SCS_TELEMETRY_TRUCK_CHANNEL_effective_throttle,
+    SCS_TELEMETRY_TRUCK_CHANNEL_effective_brake, SCS_TELEMETRY_TRUCK_CHANNEL_effective_clutch,
+};
+constexpr const char* kLegacyTruckChain[] = {
+    SCS_TELEMETRY_TRUCK_CHANNEL_world_placement, SCS_TELEMETRY_TRUCK_CHANNEL_local_linear_velocity, SCS_TELEMETRY_TRUCK_CHANNEL_local_angular_velocity,
+    SCS_TELEMETRY_TRUCK_CHANNEL_local_linear_acceleration, SCS_TELEMETRY_TRUCK_CHANNEL_local_angular_acceleration, SCS_TELEMETRY_TRUCK_CHANNEL_cabin_offset,
+    SCS_TELEMETRY_TRUCK_CHANNEL_cabin_angular_velocity, SCS_TELEMETRY_TRUCK_CHANNEL_cabin_angular_acceleration, SCS_TELEMETRY_TRUCK_CHANNEL_head_offset,
+    SCS_TELEMETRY_TRUCK_CHANNEL_speed, SCS_TELEMETRY_TRUCK_CHANNEL_engine_rpm, SCS_TELEMETRY_TRUCK_CHANNEL_engine_gear,
+    SCS_TELEMETRY_TRUCK_CHANNEL_displayed_gear, SCS_TELEMETRY_TRUCK_CHANNEL_input_steering, SCS_TELEMETRY_TRUCK_CHANNEL_input_throttle,
+    SCS_TELEMETRY_TRUCK_CHANNEL_input_brake, SCS_TELEMETRY_TRUCK_CHANNEL_input_clutch, SCS_TELEMETRY_TRUCK_CHANNEL_effective_steering,
+    SCS_TELEMETRY_TRUCK_CHANNEL_effective_throttle, SCS_TELEMETRY_TRUCK_CHANNEL_effective_brake, SCS_TELEMETRY_TRUCK_CHANNEL_effective_clutch,
+    SCS_TELEMETRY_TRUCK_CHANNEL_cruise_control, SCS_TELEMETRY_TRUCK_CHANNEL_hshifter_slot, SCS_TELEMETRY_TRUCK_CHANNEL_hshifter_selector,
+    SCS_TELEMETRY_TRUCK_CHANNEL_parking_brake, SCS_TELEMETRY_TRUCK_CHANNEL_motor_brake, SCS_TELEMETRY_TRUCK_CHANNEL_retarder_level,
+    SCS_TELEMETRY_TRUCK_CHANNEL_brake_air_pressure, SCS_TELEMETRY_TRUCK_CHANNEL_brake_air_pressure_warning, SCS_TELEMETRY_TRUCK_CHANNEL_brake_air_pressure_emergency,
+    SCS_TELEMETRY_TRUCK_CHANNEL_brake_temperature, SCS_TELEMETRY_TRUCK_CHANNEL_fuel, SCS_TELEMETRY_TRUCK_CHANNEL_fuel_warning,
+    SCS_TELEMETRY_TRUCK_CHANNEL_fuel_average_consumption, SCS_TELEMETRY_TRUCK_CHANNEL_fuel_range, SCS_TELEMETRY_TRUCK_CHANNEL_adblue,
+    SCS_TELEMETRY_TRUCK_CHANNEL_adblue_warning, SCS_TELEMETRY_TRUCK_CHANNEL_adblue_average_consumption, SCS_TELEMETRY_TRUCK_CHANNEL_oil_pressure,
+    SCS_TELEMETRY_TRUCK_CHANNEL_oil_pressure_warning, SCS_TELEMETRY_TRUCK_CHANNEL_oil_temperature, SCS_TELEMETRY_TRUCK_CHANNEL_water_temperature,
+    SCS_TELEMETRY_TRUCK_CHANNEL_water_temperature_warning, SCS_TELEMETRY_TRUCK_CHANNEL_battery_voltage, SCS_TELEMETRY_TRUCK_CHANNEL_battery_voltage_warning,
+    SCS_TELEMETRY_TRUCK_CHANNEL_electric_enabled, SCS_TELEMETRY_TRUCK_CHANNEL_engine_enabled, SCS_TELEMETRY_TRUCK_CHANNEL_wipers,
+    SCS_TELEMETRY_TRUCK_CHANNEL_differential_lock, SCS_TELEMETRY_TRUCK_CHANNEL_lift_axle, SCS_TELEMETRY_TRUCK_CHANNEL_lift_axle_indicator,
+    SCS_TELEMETRY_TRUCK_CHANNEL_trailer_lift_axle, SCS_TELEMETRY_TRUCK_CHANNEL_trailer_lift_axle_indicator, SCS_TELEMETRY_TRUCK_CHANNEL_lblinker,
+    SCS_TELEMETRY_TRUCK_CHANNEL_rblinker, SCS_TELEMETRY_TRUCK_CHANNEL_hazard_warning, SCS_TELEMETRY_TRUCK_CHANNEL_light_lblinker,
+    SCS_TELEMETRY_TRUCK_CHANNEL_light_rblinker, SCS_TELEMETRY_TRUCK_CHANNEL_light_parking, SCS_TELEMETRY_TRUCK_CHANNEL_light_low_beam,
+    SCS_TELEMETRY_TRUCK_CHANNEL_light_high_beam, SCS_TELEMETRY_TRUCK_CHANNEL_light_aux_front, SCS_TELEMETRY_TRUCK_CHANNEL_light_aux_roof,
+    SCS_TELEMETRY_TRUCK_CHANNEL_light_beacon, SCS_TELEMETRY_TRUCK_CHANNEL_light_brake, SCS_TELEMETRY_TRUCK_CHANNEL_light_reverse,
+    SCS_TELEMETRY_TRUCK_CHANNEL_dashboard_backlight, SCS_TELEMETRY_TRUCK_CHANNEL_wear_engine, SCS_TELEMETRY_TRUCK_CHANNEL_wear_transmission,
+    SCS_TELEMETRY_TRUCK_CHANNEL_wear_cabin, SCS_TELEMETRY_TRUCK_CHANNEL_wear_chassis, SCS_TELEMETRY_TRUCK_CHANNEL_wear_wheels,
+    SCS_TELEMETRY_TRUCK_CHANNEL_odometer, SCS_TELEMETRY_TRUCK_CHANNEL_navigation_distance, SCS_TELEMETRY_TRUCK_CHANNEL_navigation_time,
+    SCS_TELEMETRY_TRUCK_CHANNEL_navigation_speed_limit, SCS_TELEMETRY_TRUCK_CHANNEL_wheel_susp_deflection, SCS_TELEMETRY_TRUCK_CHANNEL_wheel_on_ground,
+    SCS_TELEMETRY_TRUCK_CHANNEL_wheel_substance, SCS_TELEMETRY_TRUCK_CHANNEL_wheel_velocity, SCS_TELEMETRY_TRUCK_CHANNEL_wheel_steering,
+    SCS_TELEMETRY_TRUCK_CHANNEL_wheel_rotation, SCS_TELEMETRY_TRUCK_CHANNEL_wheel_lift, SCS_TELEMETRY_TRUCK_CHANNEL_wheel_lift_offset,
+};
+// clang-format on
+
+struct BenchChannel {
+  std::string name;
+  scs_value_type_t type = SCS_VALUE_TYPE_INVALID;
+  bool indexed = false;
+};
+
+// Where a router writes: one slot per channel, or one per index for indexed channels.
+using ValueStore = std::vector<std::vector<scs_value_t>>;
+
+ValueStore MakeStore(const std::vector<BenchChannel>& channels) {
+  ValueStore store(channels.size());
+  for (size_t i = 0; i < channels.size(); ++i) {
+    store[i].resize(channels[i].indexed ? kMaxWheels : 1);
+    for (auto& value : store[i]) memset(&value, 0, sizeof(value));
+  }
+  return store;
+}
+
+// Both routers end in this write, so only the way they find the channel is compared.
+bool StoreValue(std::vector<scs_value_t>& slots, scs_u32_t index, const scs_value_t& value) {
+  const size_t slot = index == SCS_U32_NIL ? 0 : index;
+  if (slot >= slots.size()) return false;
+  slots[slot] = value;
+  return true;
+}
+
+bool WriteBoundValue(void* target, scs_u32_t index, const scs_value_t& value) { return StoreValue(*static_cast<std::vector<scs_value_t>*>(target), index, value); }
+
+/**
+ * @brief The routing the framework did before channels were bound: a strncmp prefix chain
+ *        picks a processor, whose strcmp chain finds the field; trailer channels parse their
+ *        index with atoi first.
+ */
+class LegacyRouter {
+ public:
+  LegacyRouter(const std::vector<BenchChannel>& channels, ValueStore& store) : m_store(store) {
+    const auto find = [&](const char* name) {
+      for (size_t i = 0; i < channels.size(); ++i) {
+        if (channels[i].name == name) return i;
+      }
+      return kNoChannel;
+    };
+    for (const char* name : kLegacyCommonChain) m_common.push_back({name, find(name)});
+    for (const char* name : kLegacyJobChain) m_job.push_back({name, find(name)});
+    for (const char* name : kLegacyControlsChain) m_controls.push_back({name, find(name)});
+    for (const char* name : kLegacyTruckChain) m_truck.push_back({name, find(name)});
+    for (scs_u32_t t = 0; t < SCS_TELEMETRY_trailers_count; ++t) {
+      m_trailerBase[t] = find(("trailer." + std::to_string(t) + "." + kTrailerChannels[0].name).c_str());
+    }
+  }
+
+  static SCSAPI_VOID Callback(const scs_string_t name, const scs_u32_t index, const scs_value_t* const value, const scs_context_t context) {
+    if (!name || !value) return;
+    auto* router = static_cast<LegacyRouter*>(context);
+
+    const std::vector<Route>* chain = nullptr;
+    if (strncmp(name, "truck.input.", 12) == 0 || strncmp(name, "truck.effective.", 16) == 0) {
+      chain = &router->m_controls;
+    } else if (strncmp(name, "truck.navigation.", 17) == 0) {
+      chain = &router->m_job;
+    } else if (strncmp(name, "truck.", 6) == 0) {
+      chain = &router->m_truck;
+    } else if (strncmp(name, "trailer.", 8) == 0) {
+      router->RouteTrailer(name, index, *value);
+      return;
+    } else if (strncmp(name, "job.", 4) == 0) {
+      chain = &router->m_job;
+    } else {
+      chain = &router->m_common;
+    }
+
+    for (const auto& route : *chain) {
+      if (strcmp(name, route.name) == 0) {
+        router->Write(route.channel, index, *value);
+        return;
+      }
+    }
+  }
+
+ private:
+  struct Route {
+    const char* name;
+    size_t channel;
+  };
+
+  void RouteTrailer(const char* name, scs_u32_t index, const scs_value_t& value) {
+    const char* firstDot = strchr(name, '.');
+    if (!firstDot) return;
+    const char* secondDot = strchr(firstDot + 1, '.');
+    unsigned int trailer = 0;
+    const char* channelPart = firstDot + 1;
+    if (secondDot) {
+      trailer = static_cast<unsigned int>(atoi(firstDot + 1));
+      channelPart = secondDot + 1;
+    }
+    if (trailer >= m_trailerBase.size() || m_trailerBase[trailer] == kNoChannel) return;
+
+    for (size_t i = 0; i < std::size(kTrailerChannels); ++i) {
+      if (strcmp(channelPart, kTrailerChannels[i].name) == 0) {
+        Write(m_trailerBase[trailer] + i, index, value);
+        return;
+      }
+    }
+  }
+
+  void Write(size_t channel, scs_u32_t index, const scs_value_t& value) {
+    if (channel != kNoChannel) StoreValue(m_store[channel], index, value);
+  }
+
+  ValueStore& m_store;
+  std::vector<Route> m_common;
+  std::vector<Route> m_job;
+  std::vector<Route> m_controls;
+  std::vector<Route> m_truck;
+  std::array<size_t, SCS_TELEMETRY_trailers_count> m_trailerBase = {};
+};
+
+struct CapturedValue {
+  uint32_t channel;
+  scs_u32_t index;
+  scs_value_t value;
+};
+
+struct CaptureTap {
+  std::vector<CapturedValue>* stream;
+  uint32_t channel;
+};
+
+SCSAPI_VOID CaptureCallback(const scs_string_t, const scs_u32_t index, const scs_value_t* const value, const scs_context_t context) {
+  if (!value) return;
+  const auto* tap = static_cast<const CaptureTap*>(context);
+  tap->stream->push_back({tap->channel, index, *value});
+}
+
+std::vector<BenchChannel> BuildChannelList() {
+  std::vector<BenchChannel> channels;
+  for (const auto& def : kScalarChannels) channels.push_back({def.name, def.type, false});
+  for (const auto& def : kIndexedTruckChannels) channels.push_back({def.name, def.type, true});
+  for (scs_u32_t t = 0; t < SCS_TELEMETRY_trailers_count; ++t) {
+    const std::string prefix = "trailer." + std::to_string(t) + ".";
+    for (size_t i = 0; i < std::size(kTrailerChannels); ++i) {
+      channels.push_back({prefix + kTrailerChannels[i].name, kTrailerChannels[i].type, i >= kFirstTrailerWheelChannel});
+    }
+  }
+  return channels;
+}
+
+/**
+ * @brief Passes the captured stream to `callback` the way the game would, `repeat` times.
+ * @return Elapsed time in nanoseconds.
+ */
+double DeliverStream(const std::vector<CapturedValue>& stream, const std::vector<BenchChannel>& channels, scs_telemetry_channel_callback_t callback,
+                     const std::vector<scs_context_t>& contexts, uint64_t repeat) {
+  const auto start = std::chrono::steady_clock::now();
+  for (uint64_t r = 0; r < repeat; ++r) {
+    for (const auto& captured : stream) {
+      callback(channels[captured.channel].name.c_str(), captured.index, &captured.value, contexts[captured.channel]);
+    }
+  }
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
+int RunChannelBench(const char* recordingPath, uint64_t repeat) {
+  const std::vector<BenchChannel> channels = BuildChannelList();
+
+  // Capture what the recording delivers for the framework's channel set.
+  std::vector<CapturedValue> stream;
+  uint64_t frames = 0;
+  {
+    TelemetryReplayer replayer;
+    if (!replayer.Open(recordingPath)) {
+      fprintf(stderr, "%s\n", replayer.GetLastError().c_str());
+      return 1;
+    }
+
+    std::vector<CaptureTap> taps(channels.size());
+    const auto* params = replayer.GetInitParams();
+    for (size_t i = 0; i < channels.size(); ++i) {
+      taps[i] = {&stream, static_cast<uint32_t>(i)};
+      const scs_u32_t indices = channels[i].indexed ? kMaxWheels : 1;
+      for (scs_u32_t index = 0; index < indices; ++index) {
+        params->register_for_channel(channels[i].name.c_str(), channels[i].indexed ? index : SCS_U32_NIL, channels[i].type, SCS_TELEMETRY_CHANNEL_FLAG_none,
+                                     CaptureCallback, &taps[i]);
+      }
+    }
+    frames = replayer.Run(TelemetryReplayer::Pacing::MaxSpeed);
+  }
+  if (stream.empty()) {
+    fprintf(stderr, "The recording delivers none of the framework's channels.\n");
+    return 1;
+  }
+  if (repeat == 0) {
+    repeat = std::max<uint64_t>(1, 20000000 / stream.size());
+  }
+
+  ValueStore legacyStore = MakeStore(channels);
+  LegacyRouter router(channels, legacyStore);
+  const std::vector<scs_context_t> legacyContexts(channels.size(), &router);
+
+  ValueStore boundStore = MakeStore(channels);
+  std::vector<ChannelBinding> bindings(channels.size());
+  std::vector<scs_context_t> boundContexts(channels.size());
+  for (size_t i = 0; i < channels.size(); ++i) {
+    bindings[i] = ChannelBinding{&boundStore[i], &WriteBoundValue};
+    boundContexts[i] = &bindings[i];
+  }
+
+  // Alternate the two and keep the best round of each.
+  constexpr int rounds = 5;
+  double legacyNs = 0.0;
+  double boundNs = 0.0;
+  for (int round = 0; round < rounds; ++round) {
+    const double legacy = DeliverStream(stream, channels, &LegacyRouter::Callback, legacyContexts, repeat);
+    const double bound = DeliverStream(stream, channels, &ChannelBinding::StaticChannelCallback, boundContexts, repeat);
+    legacyNs = round == 0 ? legacy : std::min(legacyNs, legacy);
+    boundNs = round == 0 ? bound : std::min(boundNs, bound);
+  }
+
+  for (size_t i = 0; i < channels.size(); ++i) {
+    for (size_t slot = 0; slot < legacyStore[i].size(); ++slot) {
+      if (memcmp(&legacyStore[i][slot], &boundStore[i][slot], sizeof(scs_value_t)) != 0) {
+        fprintf(stderr, "Routers disagree on %s[%zu]\n", channels[i].name.c_str(), slot);
+        return 1;
+      }
+    }
+  }
+
+  const double values = static_cast<double>(stream.size()) * static_cast<double>(repeat);
+  const double perFrame = frames > 0 ? static_cast<double>(stream.size()) / static_cast<double>(frames) : 0.0;
+  printf("Channel stream: %zu values in %llu frames (%.1f per frame), delivered %llu times\n", stream.size(), static_cast<unsigned long long>(frames), perFrame,
+         static_cast<unsigned long long>(repeat));
+  printf("  string router:  %6.2f ns/value  %8.3f us/frame\n", legacyNs / values, legacyNs / values * perFrame / 1000.0);
+  printf("  bound channels: %6.2f ns/value  %8.3f us/frame\n", boundNs / values, boundNs / values * perFrame / 1000.0);
+  return 0;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Compares the cost of delivering a recorded channel stream through the string router
+ *        the framework used before channels were bound at registration, and through
+ *        ChannelBinding::StaticChannelCallback.
+ *
+ * The recording is replayed once to capture every channel value it delivers; the captured
+ * stream is then passed to both routers `repeat` times (0 picks a count that takes long enough
+ * to measure), so the replayer's decoding is not part of the timings.
+ *
+ * @return Process exit code: non-zero if the recording cannot be read or the routers disagree.
+ */
+int RunChannelBench(const char* recordingPath, uint64_t repeat);
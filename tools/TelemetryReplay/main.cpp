@@ -0,0 +1,153 @@
+/**
+ * @file main.cpp
+ * @brief Headless telemetry replay driver.
+ *
+ * Loads any SCS telemetry plugin (including the framework itself), initializes it with
+ * the replayer's params instead of the game's, and plays a `.spftrec` recording into it.
+ * Used to reproduce telemetry bugs and to measure per-frame processing cost without
+ * launching the game.
+ *
+ * `--bench-channels` loads no plugin: it replays the recording's channel stream through the
+ * old string router and through the bound channel callbacks and reports the cost of each
+ * (see ChannelBench.hpp).
+ *
+ * Usage:
+ *   TelemetryReplay <recording.spftrec> <plugin> [--realtime] [--frames N] [--seek FRAME]
+ *   TelemetryReplay <recording.spftrec> --bench-channels [--repeat N]
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include "ChannelBench.hpp"
+#include "SPF/Telemetry/Recording/TelemetryReplayer.hpp"
+
+using SPF::Telemetry::Recording::TelemetryReplayer;
+
+namespace {
+typedef SCSAPI_RESULT_FPTR(TelemetryInitFn)(const scs_u32_t version, const scs_telemetry_init_params_t* const params);
+typedef SCSAPI_VOID_FPTR(TelemetryShutdownFn)(void);
+
+struct Plugin {
+  void* handle = nullptr;
+  TelemetryInitFn init = nullptr;
+  TelemetryShutdownFn shutdown = nullptr;
+};
+
+bool LoadPlugin(const char* path, Plugin& plugin) {
+#ifdef _WIN32
+  HMODULE module = LoadLibraryA(path);
+  if (!module) return false;
+  plugin.handle = module;
+  plugin.init = reinterpret_cast<TelemetryInitFn>(GetProcAddress(module, "scs_telemetry_init"));
+  plugin.shutdown = reinterpret_cast<TelemetryShutdownFn>(GetProcAddress(module, "scs_telemetry_shutdown"));
+#else
+  plugin.handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+  if (!plugin.handle) return false;
+  plugin.init = reinterpret_cast<TelemetryInitFn>(dlsym(plugin.handle, "scs_telemetry_init"));
+  plugin.shutdown = reinterpret_cast<TelemetryShutdownFn>(dlsym(plugin.handle, "scs_telemetry_shutdown"));
+#endif
+  return plugin.init != nullptr;
+}
+
+void UnloadPlugin(Plugin& plugin) {
+  if (!plugin.handle) return;
+#ifdef _WIN32
+  FreeLibrary(static_cast<HMODULE>(plugin.handle));
+#else
+  dlclose(plugin.handle);
+#endif
+  plugin = {};
+}
+
+void PrintUsage() {
+  fprintf(stderr,
+          "Usage:\n"
+          "  TelemetryReplay <recording.spftrec> <plugin> [--realtime] [--frames N] [--seek FRAME]\n"
+          "  TelemetryReplay <recording.spftrec> --bench-channels [--repeat N]\n");
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    PrintUsage();
+    return 1;
+  }
+
+  const char* recordingPath = argv[1];
+  if (strcmp(argv[2], "--bench-channels") == 0) {
+    uint64_t repeat = 0;
+    for (int i = 3; i < argc; ++i) {
+      if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+        repeat = strtoull(argv[++i], nullptr, 10);
+      } else {
+        PrintUsage();
+        return 1;
+      }
+    }
+    return RunChannelBench(recordingPath, repeat);
+  }
+
+  const char* pluginPath = argv[2];
+  auto pacing = TelemetryReplayer::Pacing::MaxSpeed;
+  uint64_t maxFrames = UINT64_MAX;
+  uint64_t seekFrame = 0;
+  for (int i = 3; i < argc; ++i) {
+    if (strcmp(argv[i], "--realtime") == 0) {
+      pacing = TelemetryReplayer::Pacing::RealTime;
+    } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      maxFrames = strtoull(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--seek") == 0 && i + 1 < argc) {
+      seekFrame = strtoull(argv[++i], nullptr, 10);
+    } else {
+      PrintUsage();
+      return 1;
+    }
+  }
+
+  TelemetryReplayer replayer;
+  if (!replayer.Open(recordingPath)) {
+    fprintf(stderr, "%s\n", replayer.GetLastError().c_str());
+    return 1;
+  }
+  const auto& header = replayer.GetHeader();
+  printf("Recording: %s (%s), %zu keyframes every %u frames\n", replayer.GetInitParams()->common.game_name, replayer.GetInitParams()->common.game_id,
+         replayer.GetKeyframes().size(), header.keyframeInterval);
+
+  Plugin plugin;
+  if (!LoadPlugin(pluginPath, plugin)) {
+    fprintf(stderr, "Could not load telemetry plugin: %s\n", pluginPath);
+    UnloadPlugin(plugin);
+    return 1;
+  }
+
+  const scs_result_t result = plugin.init(SCS_TELEMETRY_VERSION_CURRENT, replayer.GetInitParams());
+  if (result != SCS_RESULT_ok) {
+    fprintf(stderr, "scs_telemetry_init failed with %d\n", result);
+    UnloadPlugin(plugin);
+    return 1;
+  }
+
+  if (seekFrame > 0 && !replayer.SeekToFrame(seekFrame)) {
+    fprintf(stderr, "Could not seek to frame %llu\n", static_cast<unsigned long long>(seekFrame));
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  const uint64_t frames = replayer.Run(pacing, maxFrames);
+  const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+  if (plugin.shutdown) plugin.shutdown();
+  UnloadPlugin(plugin);
+
+  printf("Replayed %llu frames in %.1f ms (%.4f ms/frame)\n", static_cast<unsigned long long>(frames), elapsed.count(),
+         frames > 0 ? elapsed.count() / static_cast<double>(frames) : 0.0);
+  return 0;
+}
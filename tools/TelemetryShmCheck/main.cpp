@@ -0,0 +1,203 @@
+/**
+ * @file main.cpp
+ * @brief Reader and load generator for the shared-memory telemetry export.
+ *
+ * `read` attaches to a running exporter (the game, or `write` below) and verifies every
+ * frame it manages to copy: the copy must be consistent (frame_id == frame_id_end) and
+ * frame ids must never go backwards. With `--pattern`, the whole frame body is checked
+ * against the byte pattern `write` produces, which catches any torn copy.
+ *
+ * `write` publishes synthetic frames through the same seqlock code the exporter uses, and
+ * `selftest` runs a writer and a pattern-checking reader against each other in one process.
+ *
+ * Usage:
+ *   TelemetryShmCheck read [--name NAME] [--frames N] [--pattern]
+ *   TelemetryShmCheck write [--name NAME] [--frames N] [--interval-us N]
+ *   TelemetryShmCheck selftest [--name NAME] [--frames N]
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "SPF/Telemetry/Export/TelemetryShmProtocol.hpp"
+
+using namespace SPF::Telemetry::Export;
+using SPF::Utils::NamedSemaphore;
+using SPF::Utils::SharedMemory;
+
+namespace {
+struct Options {
+  std::string name = SPF_TELEMETRY_SHM_DEFAULT_NAME;
+  uint64_t frames = 100000;
+  uint32_t intervalUs = 0;
+  bool pattern = false;
+};
+
+struct ReadStats {
+  uint64_t frames = 0;   // Distinct frames read
+  uint64_t skipped = 0;  // Frames published while the reader was not looking
+  uint64_t retries = 0;  // Copies rejected by the seqlock
+  uint64_t torn = 0;     // Copies accepted by the seqlock but inconsistent (must stay 0)
+  uint64_t reordered = 0;
+};
+
+// Offset range of the frame body filled by the pattern (everything between the two ids).
+constexpr size_t kBodyBegin = offsetof(SPF_TelemetryShmFrame, frame_id) + sizeof(uint64_t);
+constexpr size_t kBodyEnd = offsetof(SPF_TelemetryShmFrame, frame_id_end);
+
+void FillPattern(SPF_TelemetryShmFrame& frame, uint64_t frameId) {
+  frame.frame_id = frameId;
+  auto* bytes = reinterpret_cast<uint8_t*>(&frame);
+  std::memset(bytes + kBodyBegin, static_cast<int>(frameId & 0xFF), kBodyEnd - kBodyBegin);
+  frame.frame_id_end = frameId;
+}
+
+bool CheckPattern(const SPF_TelemetryShmFrame& frame) {
+  const auto* bytes = reinterpret_cast<const uint8_t*>(&frame);
+  const auto expected = static_cast<uint8_t>(frame.frame_id & 0xFF);
+  for (size_t i = kBodyBegin; i < kBodyEnd; ++i) {
+    if (bytes[i] != expected) return false;
+  }
+  return true;
+}
+
+int RunWriter(const Options& options, std::atomic<bool>* readerReady = nullptr) {
+  SharedMemory memory;
+  NamedSemaphore semaphore;
+  if (!memory.Create(options.name, sizeof(SPF_TelemetryShmRegion)) || !semaphore.Create(options.name + ".frame")) {
+    fprintf(stderr, "Could not create shared memory '%s'\n", options.name.c_str());
+    return 1;
+  }
+  auto& region = *reinterpret_cast<SPF_TelemetryShmRegion*>(memory.Data());
+  InitializeRegion(region);
+  if (readerReady) {
+    readerReady->store(true, std::memory_order_release);
+  }
+
+  auto staged = std::make_unique<SPF_TelemetryShmFrame>();
+  for (uint64_t id = 1; id <= options.frames; ++id) {
+    FillPattern(*staged, id);
+    PublishFrame(region, *staged, semaphore);
+    if (options.intervalUs > 0) std::this_thread::sleep_for(std::chrono::microseconds(options.intervalUs));
+  }
+
+  WriterActive(region.header).store(0, std::memory_order_release);
+  semaphore.Post(Waiters(region.header).load(std::memory_order_acquire));
+  printf("Wrote %llu frames\n", static_cast<unsigned long long>(options.frames));
+  return 0;
+}
+
+int RunReader(const Options& options, ReadStats& stats) {
+  SharedMemory memory;
+  NamedSemaphore semaphore;
+  for (int attempt = 0; attempt < 50 && !memory.Open(options.name, sizeof(SPF_TelemetryShmRegion), true); ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  if (!memory.IsOpen() || !semaphore.Open(options.name + ".frame")) {
+    fprintf(stderr, "Could not open shared memory '%s'\n", options.name.c_str());
+    return 1;
+  }
+
+  auto& region = *reinterpret_cast<SPF_TelemetryShmRegion*>(memory.Data());
+  if (std::atomic_ref<uint32_t>(region.header.magic).load(std::memory_order_acquire) != SPF_TELEMETRY_SHM_MAGIC ||
+      region.header.version != SPF_TELEMETRY_SHM_VERSION || region.header.frame_size != sizeof(SPF_TelemetryShmFrame)) {
+    fprintf(stderr, "Incompatible shared memory layout (version %u, frame size %u)\n", region.header.version, region.header.frame_size);
+    return 1;
+  }
+
+  auto frame = std::make_unique<SPF_TelemetryShmFrame>();
+  uint64_t lastFrameId = 0;
+  while (stats.frames < options.frames) {
+    const uint64_t published = WaitForFrame(region, semaphore, lastFrameId, 1000);
+    if (published == lastFrameId) {
+      if (WriterActive(region.header).load(std::memory_order_acquire) == 0) break;
+      continue;
+    }
+
+    while (!TryReadFrame(region, *frame)) ++stats.retries;
+
+    if (frame->frame_id != frame->frame_id_end || (options.pattern && !CheckPattern(*frame))) {
+      ++stats.torn;
+      fprintf(stderr, "Torn frame %llu\n", static_cast<unsigned long long>(frame->frame_id));
+      continue;
+    }
+    if (frame->frame_id < lastFrameId) {
+      ++stats.reordered;
+      continue;
+    }
+    if (frame->frame_id == lastFrameId) continue;
+
+    stats.skipped += frame->frame_id - lastFrameId - 1;
+    ++stats.frames;
+    lastFrameId = frame->frame_id;
+  }
+
+  printf("Read %llu frames (%llu skipped, %llu seqlock retries, %llu torn, %llu out of order)\n", static_cast<unsigned long long>(stats.frames),
+         static_cast<unsigned long long>(stats.skipped), static_cast<unsigned long long>(stats.retries), static_cast<unsigned long long>(stats.torn),
+         static_cast<unsigned long long>(stats.reordered));
+  return (stats.torn == 0 && stats.reordered == 0) ? 0 : 2;
+}
+
+void PrintUsage() {
+  fprintf(stderr,
+          "Usage:\n"
+          "  TelemetryShmCheck read [--name NAME] [--frames N] [--pattern]\n"
+          "  TelemetryShmCheck write [--name NAME] [--frames N] [--interval-us N]\n"
+          "  TelemetryShmCheck selftest [--name NAME] [--frames N]\n");
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    PrintUsage();
+    return 1;
+  }
+
+  const std::string mode = argv[1];
+  Options options;
+  for (int i = 2; i < argc; ++i) {
+    if (strcmp(argv[i], "--name") == 0 && i + 1 < argc) {
+      options.name = argv[++i];
+    } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      options.frames = strtoull(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--interval-us") == 0 && i + 1 < argc) {
+      options.intervalUs = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--pattern") == 0) {
+      options.pattern = true;
+    } else {
+      PrintUsage();
+      return 1;
+    }
+  }
+
+  if (mode == "write") return RunWriter(options);
+
+  ReadStats stats;
+  if (mode == "read") return RunReader(options, stats);
+
+  if (mode == "selftest") {
+    // The reader stops when the writer finishes, so it checks as many frames as it can keep up with.
+    options.pattern = true;
+    std::atomic<bool> writerReady{false};
+    int writerResult = 0;
+    std::thread writer([&] { writerResult = RunWriter(options, &writerReady); });
+    while (!writerReady.load(std::memory_order_acquire)) std::this_thread::yield();
+    const int readerResult = RunReader(options, stats);
+    writer.join();
+    if (writerResult != 0) return writerResult;
+    if (readerResult != 0 || stats.frames == 0) {
+      fprintf(stderr, "Self-test FAILED\n");
+      return readerResult != 0 ? readerResult : 2;
+    }
+    printf("Self-test passed\n");
+    return 0;
+  }
+
+  PrintUsage();
+  return 1;
+}
@@ -0,0 +1,248 @@
+/**
+ * @file main.cpp
+ * @brief Client and loopback self-test for the UDP telemetry stream.
+ *
+ * `listen` subscribes to a running server (the game, with `settings.telemetry_stream.enabled`)
+ * and reports what it receives: frames, keyframes, resyncs, bytes per frame and the latency
+ * from the game thread queueing a frame to the client decoding it. Latency is only
+ * meaningful when the client runs on the game's machine, since it compares monotonic clocks.
+ *
+ * `selftest` runs a server fed with synthetic snapshots and a client in one process, and
+ * additionally checks every decoded value against the value that was published.
+ *
+ * Usage:
+ *   TelemetryStreamCheck listen [--address A] [--port P] [--fields 5,6,...] [--frames N]
+ *   TelemetryStreamCheck selftest [--frames N] [--interval-us N] [--keyframe-interval N]
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SPF/Telemetry/Export/TelemetryStreamProtocol.hpp"
+#include "SPF/Telemetry/Export/TelemetryStreamServer.hpp"
+#include "SPF/Telemetry/TelemetrySnapshot.hpp"
+
+using namespace SPF::Telemetry;
+using namespace SPF::Telemetry::Export;
+using SPF::Utils::UdpEndpoint;
+using SPF::Utils::UdpSocket;
+
+namespace {
+struct Options {
+  std::string address = "127.0.0.1";
+  uint16_t port = SPF_TELEMETRY_STREAM_DEFAULT_PORT;
+  std::vector<uint16_t> fields = {static_cast<uint16_t>(Field::TruckSpeed), static_cast<uint16_t>(Field::TruckEngineRpm)};
+  uint64_t frames = 2000;
+  uint32_t intervalUs = 2000;
+  uint32_t keyframeInterval = 60;
+};
+
+struct ClientStats {
+  uint64_t frames = 0;
+  uint64_t keyframes = 0;
+  uint64_t resyncs = 0;
+  uint64_t mismatches = 0;  // Self-test only: decoded values that differ from the published ones
+  uint64_t bytes = 0;
+  uint64_t keyframeBytes = 0;
+  std::vector<uint64_t> latenciesUs;
+};
+
+uint64_t NowUs() { return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+
+// Deterministic frame contents for the self-test: a smooth value, a sawtooth, a rarely
+// changing one, a constant and a slow ramp.
+void FillSnapshot(TelemetrySnapshot& snapshot, uint64_t frameId) {
+  snapshot.frameId = frameId;
+  snapshot.timestamps.render = frameId * 16667;
+  snapshot.truckData.speed = static_cast<float>(20.0 + 5.0 * std::sin(frameId * 0.05));
+  snapshot.truckData.engine_rpm = static_cast<float>(1200 + (frameId % 50) * 8);
+  snapshot.truckData.gear = static_cast<int32_t>((frameId / 300) % 12 + 1);
+  snapshot.truckData.water_temperature = 90.0f;
+  snapshot.truckData.fuel_amount = 400.0f - frameId * 0.01f;
+}
+
+const std::vector<uint16_t> kSelfTestFields = {static_cast<uint16_t>(Field::TruckSpeed), static_cast<uint16_t>(Field::TruckEngineRpm), static_cast<uint16_t>(Field::TruckGear),
+                                               static_cast<uint16_t>(Field::TruckWaterTemperature), static_cast<uint16_t>(Field::TruckFuelAmount)};
+
+/// Receives until `frames` frames were decoded or the server stays silent for two seconds.
+/// `check` (optional) verifies the decoded values of a frame.
+int RunClient(const Options& options, ClientStats& stats, const std::function<bool(const StreamDecoder&)>& check = {}) {
+  UdpSocket socket;
+  UdpEndpoint server;
+  if (!socket.Open("0.0.0.0", 0) || !UdpSocket::ParseAddress(options.address, server.address)) {
+    fprintf(stderr, "Could not open a client socket for %s: %s\n", options.address.c_str(), socket.GetLastError().c_str());
+    return 1;
+  }
+  server.port = options.port;
+
+  std::vector<uint8_t> request;
+  auto subscribe = [&](uint16_t flags) {
+    EncodeSubscribe(request, options.fields, flags);
+    socket.SendTo(server, request.data(), request.size());
+  };
+  subscribe(0);
+
+  StreamDecoder decoder;
+  std::vector<uint8_t> buffer(SPF_TELEMETRY_STREAM_MAX_PACKET);
+  uint64_t lastKeepAliveUs = NowUs();
+  uint64_t lastPacketUs = NowUs();
+  while (stats.frames < options.frames && NowUs() - lastPacketUs < 2'000'000) {
+    if (NowUs() - lastKeepAliveUs > SPF_TELEMETRY_STREAM_CLIENT_TIMEOUT_MS * 1000 / 4) {
+      subscribe(0);
+      lastKeepAliveUs = NowUs();
+    }
+
+    UdpEndpoint from;
+    const size_t size = socket.ReceiveFrom(buffer.data(), buffer.size(), from, 100);
+    if (size == 0 || !(from == server)) continue;
+    lastPacketUs = NowUs();
+
+    switch (decoder.Decode(buffer.data(), size)) {
+      case StreamDecoder::Result::Schema:
+        printf("Schema %u: %u fields\n", decoder.GetSchema().schema_id, decoder.GetSchema().field_count);
+        break;
+      case StreamDecoder::Result::Frame: {
+        const bool keyframe = (decoder.GetFrame().flags & SPF_TELEMETRY_STREAM_FRAME_KEYFRAME) != 0;
+        ++stats.frames;
+        stats.bytes += size;
+        if (keyframe) {
+          ++stats.keyframes;
+          stats.keyframeBytes += size;
+        }
+        stats.latenciesUs.push_back(NowUs() - decoder.GetFrame().publish_time);
+        if (check && !check(decoder)) ++stats.mismatches;
+        break;
+      }
+      case StreamDecoder::Result::Resync:
+        ++stats.resyncs;
+        subscribe(SPF_TELEMETRY_STREAM_SUBSCRIBE_RESYNC);
+        break;
+      case StreamDecoder::Result::Ignored:
+        break;
+    }
+  }
+
+  BeginPacket(request, SPF_TELEMETRY_STREAM_PACKET_UNSUBSCRIBE);
+  socket.SendTo(server, request.data(), request.size());
+
+  auto& latencies = stats.latenciesUs;
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&](double p) { return latencies.empty() ? 0ull : static_cast<unsigned long long>(latencies[static_cast<size_t>(p * (latencies.size() - 1))]); };
+  const uint64_t deltas = stats.frames - stats.keyframes;
+  printf("Received %llu frames (%llu keyframes, %llu resyncs)\n", static_cast<unsigned long long>(stats.frames), static_cast<unsigned long long>(stats.keyframes),
+         static_cast<unsigned long long>(stats.resyncs));
+  printf("Bytes per frame: %.1f average, %.1f keyframe, %.1f delta (UDP payload)\n", stats.frames ? double(stats.bytes) / stats.frames : 0.0,
+         stats.keyframes ? double(stats.keyframeBytes) / stats.keyframes : 0.0, deltas ? double(stats.bytes - stats.keyframeBytes) / deltas : 0.0);
+  printf("Latency (us): p50 %llu, p99 %llu, max %llu\n", percentile(0.5), percentile(0.99), percentile(1.0));
+  return stats.frames > 0 ? 0 : 2;
+}
+
+int RunSelfTest(Options options) {
+  TelemetryStreamServer server;
+  if (!server.Start("127.0.0.1", 0, options.keyframeInterval)) {
+    fprintf(stderr, "Could not start the server: %s\n", server.GetLastError().c_str());
+    return 1;
+  }
+  options.port = server.GetPort();
+  options.fields = kSelfTestFields;
+
+  // The publisher starts once the client is subscribed and keeps going until the client is done.
+  std::atomic<bool> clientDone{false};
+  std::thread publisher([&] {
+    TelemetrySnapshot snapshot;
+    while (server.GetStats().clients == 0 && !clientDone.load()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    for (uint64_t id = 1; !clientDone.load(); ++id) {
+      FillSnapshot(snapshot, id);
+      server.Publish(snapshot);
+      std::this_thread::sleep_for(std::chrono::microseconds(options.intervalUs));
+    }
+  });
+
+  ClientStats stats;
+  const int result = RunClient(options, stats, [](const StreamDecoder& decoder) {
+    TelemetrySnapshot expected;
+    FillSnapshot(expected, decoder.GetFrame().frame_id);
+    for (size_t i = 0; i < decoder.GetFields().size(); ++i) {
+      if (decoder.GetValues()[i] != static_cast<float>(ReadFieldValue(expected, static_cast<Field>(decoder.GetFields()[i])))) return false;
+    }
+    return true;
+  });
+  clientDone.store(true);
+  publisher.join();
+
+  const auto serverStats = server.GetStats();
+  server.Stop();
+  printf("Server: %llu frames queued, %llu dropped, %llu packets, %llu bytes\n", static_cast<unsigned long long>(serverStats.framesQueued),
+         static_cast<unsigned long long>(serverStats.framesDropped), static_cast<unsigned long long>(serverStats.packetsSent), static_cast<unsigned long long>(serverStats.bytesSent));
+
+  if (result != 0 || stats.mismatches > 0 || stats.frames < options.frames) {
+    fprintf(stderr, "Self-test FAILED (%llu mismatched frames)\n", static_cast<unsigned long long>(stats.mismatches));
+    return result != 0 ? result : 2;
+  }
+  printf("Self-test passed\n");
+  return 0;
+}
+
+std::vector<uint16_t> ParseFields(const char* text) {
+  std::vector<uint16_t> fields;
+  for (const char* cursor = text; *cursor;) {
+    char* end = nullptr;
+    fields.push_back(static_cast<uint16_t>(strtoul(cursor, &end, 10)));
+    if (end == cursor) break;
+    cursor = *end == ',' ? end + 1 : end;
+  }
+  return fields;
+}
+
+void PrintUsage() {
+  fprintf(stderr,
+          "Usage:\n"
+          "  TelemetryStreamCheck listen [--address A] [--port P] [--fields 5,6,...] [--frames N]\n"
+          "  TelemetryStreamCheck selftest [--frames N] [--interval-us N] [--keyframe-interval N]\n");
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    PrintUsage();
+    return 1;
+  }
+
+  const std::string mode = argv[1];
+  Options options;
+  for (int i = 2; i < argc; ++i) {
+    if (strcmp(argv[i], "--address") == 0 && i + 1 < argc) {
+      options.address = argv[++i];
+    } else if (strcmp(argv[i], "--port") == 0 && i + 1 < argc) {
+      options.port = static_cast<uint16_t>(strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--fields") == 0 && i + 1 < argc) {
+      options.fields = ParseFields(argv[++i]);
+    } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      options.frames = strtoull(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--interval-us") == 0 && i + 1 < argc) {
+      options.intervalUs = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+    } else if (strcmp(argv[i], "--keyframe-interval") == 0 && i + 1 < argc) {
+      options.keyframeInterval = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+    } else {
+      PrintUsage();
+      return 1;
+    }
+  }
+
+  if (mode == "listen") {
+    ClientStats stats;
+    return RunClient(options, stats);
+  }
+  if (mode == "selftest") return RunSelfTest(options);
+
+  PrintUsage();
+  return 1;
+}